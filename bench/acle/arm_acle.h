@@ -0,0 +1,60 @@
+/**
+ * @file arm_acle.h
+ * @brief Host stand-in for the Arm C Language Extensions header.
+ *
+ * Lets bench/pq_ntt_dsp.c compile and run the Cortex-M4 DSP path of
+ * crypto/pq_ntt.c on the host. Only the ACLE intrinsics that path uses are
+ * provided, each with the name, types and result the ACLE specification
+ * gives it (flags such as Q and GE are not modelled). An intrinsic the
+ * specification does not define is absent here too, so it fails to build
+ * on the host as it would against the toolchain's arm_acle.h.
+ */
+
+#ifndef BENCH_ARM_ACLE_H
+#define BENCH_ARM_ACLE_H
+
+#include <stdint.h>
+
+// Two signed halfwords packed in a word, bottom lane in bits 15:0
+typedef int32_t int16x2_t;
+
+// --- Private Helpers ---
+
+static inline int32_t AcleBottom(int32_t x) {
+    return (int16_t)(uint16_t)((uint32_t)x & 0xFFFFU);
+}
+
+static inline int32_t AcleTop(int32_t x) {
+    return (int16_t)(uint16_t)((uint32_t)x >> 16);
+}
+
+static inline int16x2_t AclePack(int32_t top, int32_t bottom) {
+    return (int16x2_t)(((uint32_t)top << 16) | ((uint32_t)bottom & 0xFFFFU));
+}
+
+// --- 16-bit Multiplications (__ARM_FEATURE_DSP) ---
+
+static inline int32_t __smulbb(int32_t a, int32_t b) {
+    return AcleBottom(a) * AcleBottom(b);
+}
+
+static inline int32_t __smultb(int32_t a, int32_t b) {
+    return AcleTop(a) * AcleBottom(b);
+}
+
+// The accumulation wraps; the target sets Q on overflow
+static inline int32_t __smlabb(int32_t a, int32_t b, int32_t acc) {
+    return (int32_t)((uint32_t)__smulbb(a, b) + (uint32_t)acc);
+}
+
+// --- Parallel Halfword Arithmetic (__ARM_FEATURE_SIMD32) ---
+
+static inline int16x2_t __sadd16(int16x2_t a, int16x2_t b) {
+    return AclePack(AcleTop(a) + AcleTop(b), AcleBottom(a) + AcleBottom(b));
+}
+
+static inline int16x2_t __ssub16(int16x2_t a, int16x2_t b) {
+    return AclePack(AcleTop(a) - AcleTop(b), AcleBottom(a) - AcleBottom(b));
+}
+
+#endif // BENCH_ARM_ACLE_H
@@ -0,0 +1,1610 @@
+/**
+ * @file bench_main.c
+ * @brief Host benchmark driver for firmware modules and host layout tools.
+ *
+ * Usage: asic_bench [--iterations N] [--trace-out FILE]
+ *   --trace-out  Write the secure trace export, for tools/verify_trace.py.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "anomaly_features.h"
+#include "anomaly_model.h"
+#include "cert_cache.h"
+#include "connectivity.h"
+#include "constraint_sweeper.h"
+#include "constraints.h"
+#include "cycle_counter.h"
+#include "fault_log.h"
+#include "flash_sim.h"
+#include "gdsii.h"
+#include "lms.h"
+#include "ml_dsa.h"
+#include "ml_kem.h"
+#include "ml_kernels.h"
+#include "ml_runtime.h"
+#include "p256.h"
+#include "pq_ntt.h"
+#include "precompute_pool.h"
+#include "ramfunc.h"
+#include "rsa.h"
+#include "secure_boot.h"
+#include "secure_trace.h"
+#include "sha256.h"
+#include "sha256_mb.h"
+#include "tamper_monitor.h"
+#include "tamper_sim.h"
+#include "x509.h"
+#include "zeroize.h"
+
+// --- Private Defines and Constants ---
+#define BENCH_DEFAULT_ITERATIONS    10000U
+
+// --- Private Variables ---
+static _Alignas(ML_ARENA_ALIGN) uint8_t MlArena[ANOMALY_MODEL_ARENA_BYTES];
+
+// --- Benchmarks ---
+
+static int RunMlBenchmark(uint32_t iterations) {
+    MlRuntime rt;
+    if (!MlRuntime_Init(&rt, &AnomalyModel, MlArena, sizeof(MlArena))) {
+        return 1;
+    }
+
+    // Deterministic input window so repeated runs are comparable
+    int8_t input[ANOMALY_MODEL_WINDOW * ANOMALY_MODEL_FEATURES];
+    for (uint32_t i = 0; i < sizeof(input); i++) {
+        input[i] = (int8_t)((i * 37U) & 0xFF);
+    }
+
+    MlBenchResult result;
+    MlRuntime_Benchmark(&rt, input, iterations, &result);
+    MlRuntime_PrintReport(&rt, &result);
+
+    const int8_t *logits = MlRuntime_Output(&rt);
+    printf("[INFO] ML: logits normal=%d anomalous=%d\n", logits[0], logits[1]);
+    return 0;
+}
+
+// --- Anomaly Feature Extraction ---
+// Simulated time in microseconds: four sessions of steady traffic, then a
+// tag-failure storm on session 2 and a replay flood on session 3.
+#define ANOMALY_SIM_SESSIONS        4
+#define ANOMALY_SIM_SECONDS         20
+#define ANOMALY_SIM_STEP_US         1000U
+
+typedef struct {
+    uint32_t windows;
+    int8_t   last[ANOMALY_SIM_SESSIONS][ANOMALY_FEATURE_COUNT];
+} AnomalyBenchSink;
+
+static void AnomalyBenchClassifier(void *ctx, uint32_t session_id, const int8_t *window) {
+    AnomalyBenchSink *sink = (AnomalyBenchSink *)ctx;
+    sink->windows++;
+    if (session_id < ANOMALY_SIM_SESSIONS) {
+        memcpy(sink->last[session_id], window + (ANOMALY_FEATURE_HISTORY - 1) * ANOMALY_FEATURE_COUNT,
+               ANOMALY_FEATURE_COUNT);
+    }
+}
+
+static int RunAnomalyFeatureBenchmark(void) {
+    static AnomalyFeatures fx;
+    AnomalyBenchSink sink = { 0 };
+    AnomalyFeaturesConfig config = { .cadence_ticks = 100000, .window_ticks = 1000000, .ewma_shift = 4 };
+    if (!AnomalyFeatures_Init(&fx, &config, 0, AnomalyBenchClassifier, &sink)) {
+        return 1;
+    }
+
+    uint32_t rng = 12345;
+    uint32_t events = 0;
+    uint64_t ticks = 0;
+    for (uint32_t now = 0; now < ANOMALY_SIM_SECONDS * 1000000U; now += ANOMALY_SIM_STEP_US) {
+        bool storm = now >= 10000000U;
+        for (uint32_t session = 0; session < ANOMALY_SIM_SESSIONS; session++) {
+            uint32_t jobs = (storm && session >= 2) ? 8 : 1;
+            for (uint32_t j = 0; j < jobs; j++) {
+                rng = rng * 1664525U + 1013904223U;
+                uint8_t outcome = ANOMALY_JOB_OK;
+                if (storm && session == 2 && (rng >> 28) != 0) {
+                    outcome = ANOMALY_JOB_TAG_FAIL;
+                } else if (storm && session == 3 && (rng >> 28) != 0) {
+                    outcome = ANOMALY_JOB_REPLAY;
+                }
+                uint32_t start = CycleCounter_Read();
+                AnomalyFeatures_RecordCryptoJob(&fx, session, outcome, 192 + ((rng >> 16) & 127),
+                                                40 + ((rng >> 8) & 15), now);
+                ticks += CycleCounter_Elapsed(start);
+                events++;
+            }
+        }
+        AnomalyFeatures_Poll(&fx, now);
+    }
+
+    printf("[INFO] ANOMALY: %lu events, %.1f ticks/event, %lu vectors, %lu windows classified\n",
+           (unsigned long)events, events ? (double)ticks / events : 0.0,
+           (unsigned long)fx.vectors_emitted, (unsigned long)sink.windows);
+    printf("[INFO] ANOMALY: extractor state %lu bytes\n", (unsigned long)sizeof(fx));
+    for (uint32_t session = 0; session < ANOMALY_SIM_SESSIONS; session++) {
+        const int8_t *f = sink.last[session];
+        printf("[INFO] ANOMALY: session %lu jobs=%d tag_fail_ratio=%d replay_ratio=%d burst=%d\n",
+               (unsigned long)session, f[ANOMALY_F_JOBS] + 128, f[ANOMALY_F_TAG_FAIL_RATIO] + 128,
+               f[ANOMALY_F_REPLAY_RATIO] + 128, f[ANOMALY_F_FAIL_BURST] + 128);
+    }
+    return 0;
+}
+
+// --- RAMFUNC Placement ---
+// Times each kernel from its RAMFUNC copy (MlKernel_*) and from the copy in
+// ml_kernels_flash.c (MlKernelFlash_*), on the layer shapes of the anomaly
+// model. On target the difference is the flash wait-state cost; on the host
+// both copies sit in the same memory.
+#define PLACEMENT_BENCH_RUNS        1000U
+
+int32_t MlKernelFlash_DotS8(const int8_t *a, const int8_t *b, uint32_t n);
+int8_t MlKernelFlash_Requantize(int32_t acc, const MlRequant *rq);
+void MlKernelFlash_FullyConnected(const int8_t *input, const int8_t *weights, const int32_t *bias,
+                                  uint32_t in_features, uint32_t out_features,
+                                  const MlRequant *rq, int8_t *output);
+void MlKernelFlash_Conv2d(const int8_t *input, uint32_t in_h, uint32_t in_w, uint32_t in_c,
+                          const int8_t *filters, const int32_t *bias,
+                          uint32_t kernel_h, uint32_t kernel_w, uint32_t out_c,
+                          uint32_t stride_h, uint32_t stride_w,
+                          const MlRequant *rq, int8_t *output);
+
+typedef struct {
+    int8_t   input[ANOMALY_MODEL_WINDOW * ANOMALY_MODEL_FEATURES];
+    int8_t   weights[16 * 48];
+    int32_t  bias[16];
+    int8_t   output[64];
+    MlRequant rq;
+    volatile int32_t sink;          // Keeps scalar results live
+} PlacementBench;
+
+static uint64_t TimeDot(PlacementBench *pb, int32_t (*dot)(const int8_t *, const int8_t *, uint32_t)) {
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PLACEMENT_BENCH_RUNS; r++) {
+        pb->sink = dot(pb->input, pb->weights, 48);
+    }
+    return CycleCounter_Elapsed(start);
+}
+
+static uint64_t TimeRequantize(PlacementBench *pb, int8_t (*requantize)(int32_t, const MlRequant *)) {
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PLACEMENT_BENCH_RUNS; r++) {
+        pb->sink = requantize((int32_t)(r * 7919U), &pb->rq);
+    }
+    return CycleCounter_Elapsed(start);
+}
+
+static uint64_t TimeFullyConnected(PlacementBench *pb,
+                                   void (*fc)(const int8_t *, const int8_t *, const int32_t *,
+                                              uint32_t, uint32_t, const MlRequant *, int8_t *)) {
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PLACEMENT_BENCH_RUNS; r++) {
+        fc(pb->input, pb->weights, pb->bias, 48, 16, &pb->rq, pb->output);
+    }
+    return CycleCounter_Elapsed(start);
+}
+
+static uint64_t TimeConv2d(PlacementBench *pb,
+                           void (*conv)(const int8_t *, uint32_t, uint32_t, uint32_t,
+                                        const int8_t *, const int32_t *, uint32_t, uint32_t, uint32_t,
+                                        uint32_t, uint32_t, const MlRequant *, int8_t *)) {
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PLACEMENT_BENCH_RUNS; r++) {
+        // The model's first layer: 8x1x16 window, 3x1 kernel, 8 output channels
+        conv(pb->input, ANOMALY_MODEL_WINDOW, 1, ANOMALY_MODEL_FEATURES, pb->weights, pb->bias,
+             3, 1, 8, 1, 1, &pb->rq, pb->output);
+    }
+    return CycleCounter_Elapsed(start);
+}
+
+static void ReportPlacement(const char *name, uint64_t flash_ticks, uint64_t ram_ticks) {
+    printf("[INFO] RAMFUNC: %-24s flash %8.1f ticks/call, ram %8.1f ticks/call (%.2fx)\n", name,
+           (double)flash_ticks / PLACEMENT_BENCH_RUNS, (double)ram_ticks / PLACEMENT_BENCH_RUNS,
+           ram_ticks ? (double)flash_ticks / ram_ticks : 0.0);
+}
+
+static int RunPlacementBenchmark(void) {
+    static PlacementBench pb;
+    for (uint32_t i = 0; i < sizeof(pb.input); i++) {
+        pb.input[i] = (int8_t)((i * 37U) & 0xFF);
+    }
+    for (uint32_t i = 0; i < sizeof(pb.weights); i++) {
+        pb.weights[i] = (int8_t)((i * 53U + 11U) & 0xFF);
+    }
+    pb.rq = (MlRequant){ .multiplier = 1518500250, .shift = 9, .output_zero_point = -3,
+                         .activation_min = -128, .activation_max = 127 };
+
+    printf("[INFO] RAMFUNC: kernels placed in RAM on this build: %s\n", RAMFUNC_ENABLED ? "yes" : "no");
+    // Flash first, then RAM, so any warm-up favours neither consistently
+    uint64_t flash = TimeDot(&pb, MlKernelFlash_DotS8);
+    ReportPlacement("MlKernel_DotS8", flash, TimeDot(&pb, MlKernel_DotS8));
+    flash = TimeRequantize(&pb, MlKernelFlash_Requantize);
+    ReportPlacement("MlKernel_Requantize", flash, TimeRequantize(&pb, MlKernel_Requantize));
+    flash = TimeFullyConnected(&pb, MlKernelFlash_FullyConnected);
+    ReportPlacement("MlKernel_FullyConnected", flash, TimeFullyConnected(&pb, MlKernel_FullyConnected));
+    flash = TimeConv2d(&pb, MlKernelFlash_Conv2d);
+    ReportPlacement("MlKernel_Conv2d", flash, TimeConv2d(&pb, MlKernel_Conv2d));
+    return 0;
+}
+
+// --- Constraint Checks ---
+// The validation calls that sit on every configuration and memory access
+// path. Only in-range values are used: the out-of-range path halts.
+#define CONSTRAINT_BENCH_CHECKS     100000U
+#define CONSTRAINT_BENCH_RAM_BASE   (0x20000000UL)
+
+static int RunConstraintBenchmark(void) {
+    uint32_t passed = 0;
+    uint64_t ticks = 0;
+    for (uint32_t i = 0; i < CONSTRAINT_BENCH_CHECKS; i++) {
+        uint32_t start = CycleCounter_Read();
+        passed += ConstraintsManager_ValidateClockFrequency(80000000UL + (i & 0xFFFF) * 1000U);
+        passed += ConstraintsManager_ValidateRamAddress(CONSTRAINT_BENCH_RAM_BASE + ((i * 4U) & 0xFFFF));
+        ticks += CycleCounter_Elapsed(start);
+    }
+    printf("[INFO] CONSTRAINTS: %lu checks, %.1f ticks/check\n", (unsigned long)passed,
+           passed ? (double)ticks / passed : 0.0);
+    return passed == 2 * CONSTRAINT_BENCH_CHECKS ? 0 : 1;
+}
+
+// --- Violation Storm ---
+// A peer flooding two non-critical constraints for just over one log
+// window. Only the first CONSTRAINTS_LOG_BURST reports per id are printed,
+// then one summary line.
+#define STORM_BENCH_TICKS           ((uint32_t)(CYCLE_COUNTER_HZ + CYCLE_COUNTER_HZ / 5))
+
+static int RunViolationStormBenchmark(void) {
+    uint32_t reports = 0;
+    uint32_t begin = CycleCounter_Read();
+    while (CycleCounter_Elapsed(begin) < STORM_BENCH_TICKS) {
+        uint32_t id = (reports & 1U) ? CONSTRAINT_ID_COMM_BUFFER_FULL : CONSTRAINT_ID_SENSOR_TIMEOUT;
+        ConstraintsManager_ReportViolationFmt(id, "Storm report %lu.", (unsigned long)reports);
+        reports++;
+    }
+    uint32_t ticks = CycleCounter_Elapsed(begin);
+    ConstraintsManager_PollViolationLog(CycleCounter_Read());
+
+    const ConstraintsLogStats *st = ConstraintsManager_LogStats();
+    printf("[INFO] CONSTRAINTS: storm %lu reports, %.1f ticks/report, %lu logged, %lu suppressed "
+           "(%lu by CPU cap), %lu summaries, log share %lu.%lu%%\n",
+           (unsigned long)reports, reports ? (double)ticks / reports : 0.0, (unsigned long)st->logged,
+           (unsigned long)st->suppressed, (unsigned long)st->capped, (unsigned long)st->summaries,
+           (unsigned long)st->window_permille / 10, (unsigned long)st->window_permille % 10);
+    return st->violations == reports ? 0 : 1;
+}
+
+// --- Fault Journal ---
+// One hour of simulated time at 10000 violations/s spread over 12 ids, more
+// than a batch holds, so coalescing, the flush interval and dropping all take
+// part. The superloop polls every simulated millisecond. Then power is cut
+// in the middle of a batch and the journal is recovered. Last, a crash
+// that follows a full batch within the flush interval must still reach
+// flash.
+#define JOURNAL_BENCH_SECONDS       3600U
+#define JOURNAL_BENCH_RATE          10000U      // Events per simulated second
+#define JOURNAL_BENCH_IDS           12U
+#define JOURNAL_BENCH_CUT_BYTES     100U        // Three whole records, then a torn one
+#define JOURNAL_BENCH_CRASH_ID      0xC0DEU
+#define FLASH_ENDURANCE_CYCLES      100000.0
+
+static void JournalNewest(const FaultLogRecord *record, void *ctx) {
+    *(uint32_t *)ctx = record->sequence;
+}
+
+static void JournalCountCrashes(const FaultLogRecord *record, void *ctx) {
+    if (record->type == FAULT_LOG_TYPE_CRASH && record->id == JOURNAL_BENCH_CRASH_ID) {
+        (*(uint32_t *)ctx)++;
+    }
+}
+
+static int RunFaultLogBenchmark(void) {
+    FlashSim_Reset();
+    FaultLog_Init();
+
+    uint32_t step = (uint32_t)(CYCLE_COUNTER_HZ / JOURNAL_BENCH_RATE);
+    uint32_t poll_every = JOURNAL_BENCH_RATE / 1000U;
+    uint32_t events = JOURNAL_BENCH_SECONDS * JOURNAL_BENCH_RATE;
+    uint32_t now = 0;
+    uint32_t begin = CycleCounter_Read();
+    for (uint32_t e = 0; e < events; e++, now += step) {
+        FaultLog_Record(FAULT_LOG_TYPE_VIOLATION, e % JOURNAL_BENCH_IDS, 0, 0, now);
+        if (e % poll_every == 0) {
+            FaultLog_Poll(now);
+        }
+    }
+    uint32_t ticks = CycleCounter_Elapsed(begin);
+    FaultLog_Flush();
+
+    const FaultLogStats *st = FaultLog_Stats();
+    uint32_t max_erases = FlashSim_MaxEraseCount();
+    printf("[INFO] FAULT_LOG: %lu events in %u s, %.1f ticks/event, %lu records in %lu batches, "
+           "%lu coalesced, %lu dropped\n",
+           (unsigned long)events, JOURNAL_BENCH_SECONDS, (double)ticks / events,
+           (unsigned long)st->records_written, (unsigned long)st->batches, (unsigned long)st->coalesced,
+           (unsigned long)st->dropped);
+    printf("[INFO] FAULT_LOG: %lu erases, at most %lu per sector; 100k-cycle flash lasts %.0f days at this rate\n",
+           (unsigned long)FlashSim_TotalErases(), (unsigned long)max_erases,
+           max_erases ? FLASH_ENDURANCE_CYCLES * JOURNAL_BENCH_SECONDS / max_erases / 86400.0 : 0.0);
+
+    uint32_t before = 0;
+    FaultLog_ForEach(JournalNewest, &before);
+    for (uint32_t i = 0; i < 5; i++) {
+        FaultLog_Record(FAULT_LOG_TYPE_CRASH, i, 0, 0, now);
+    }
+    FlashSim_FailAfter(JOURNAL_BENCH_CUT_BYTES);
+    bool flushed = FaultLog_Flush();
+    FlashSim_PowerCycle();
+
+    begin = CycleCounter_Read();
+    FaultLog_Init();
+    ticks = CycleCounter_Elapsed(begin);
+    uint32_t after = 0;
+    FaultLog_ForEach(JournalNewest, &after);
+    FaultLog_Record(FAULT_LOG_TYPE_CRASH, 5, 0, 0, now);
+    FaultLog_Flush();
+    uint32_t resumed = 0;
+    FaultLog_ForEach(JournalNewest, &resumed);
+    printf("[INFO] FAULT_LOG: recovery %lu ticks, %lu slots read, %lu torn, newest %lu -> %lu, resumed at %lu\n",
+           (unsigned long)ticks, (unsigned long)st->scan_reads, (unsigned long)st->torn,
+           (unsigned long)before, (unsigned long)after, (unsigned long)resumed);
+
+    // Storm then crash, as ErrorHandler does it: a batch flushed by the poll
+    // at now, then a full batch and a crash before the next second
+    uint32_t batches = st->batches;
+    FaultLog_Record(FAULT_LOG_TYPE_VIOLATION, 0xFFU, 0, 0, now);
+    while (st->batches == batches) {
+        now += step;
+        FaultLog_Poll(now);
+    }
+    for (uint32_t id = 0; id < FAULT_LOG_BATCH_RECORDS; id++) {
+        FaultLog_Record(FAULT_LOG_TYPE_VIOLATION, 0x100U + id, 0, 0, now);
+    }
+    bool crash_kept = FaultLog_Record(FAULT_LOG_TYPE_CRASH, JOURNAL_BENCH_CRASH_ID, 0, 0, now);
+    FaultLog_Flush();
+    uint32_t crashes = 0;
+    FaultLog_ForEach(JournalCountCrashes, &crashes);
+    printf("[INFO] FAULT_LOG: crash after a full batch %s, %lu crash record(s) in flash\n",
+           crash_kept ? "kept" : "DROPPED", (unsigned long)crashes);
+    return (!flushed && after == before + 3 && resumed == after + 1 && crash_kept && crashes == 1U) ? 0 : 1;
+}
+
+// --- Secure Event Trace ---
+// Events arrive in runs of 16 between superloop passes, which seal the full
+// blocks. A tamper response then freezes the trace and wipes its key; the
+// frozen export must still be written and end with TAMPER and ZEROIZE. The
+// key is the fixed test key 00 01 .. 1F, so the --trace-out file (the
+// frozen export) checks with tools/verify_trace.py --key 000102...1F.
+#define TRACE_BENCH_EVENTS          100000U
+#define TRACE_BENCH_RUN             16U
+#define TRACE_BENCH_EXPORT_BYTES    (sizeof(SecureTraceExportHeader) + SECURE_TRACE_BLOCKS * sizeof(SecureTraceBlock) + \
+                                     sizeof(SecureTraceExportTrailer))
+
+static uint8_t TraceExport[TRACE_BENCH_EXPORT_BYTES];
+
+static int RunSecureTraceBenchmark(const char *out_path) {
+    uint8_t key[32];
+    for (uint32_t i = 0; i < sizeof(key); i++) {
+        key[i] = (uint8_t)i;
+    }
+    SecureTrace_Init(key, sizeof(key), 1);
+
+    uint64_t event_ticks = 0;
+    uint64_t seal_ticks = 0;
+    for (uint32_t e = 0; e < TRACE_BENCH_EVENTS; e += TRACE_BENCH_RUN) {
+        uint32_t start = CycleCounter_Read();
+        for (uint32_t i = 0; i < TRACE_BENCH_RUN; i++) {
+            SecureTrace_Event(SECURE_TRACE_EVENT_TAG_FAIL, e + i, 0);
+        }
+        event_ticks += CycleCounter_Elapsed(start);
+        start = CycleCounter_Read();
+        SecureTrace_Poll();
+        seal_ticks += CycleCounter_Elapsed(start);
+    }
+    uint32_t bytes = SecureTrace_Export(TraceExport, sizeof(TraceExport));
+
+    const SecureTraceStats *st = SecureTrace_Stats();
+    printf("[INFO] TRACE: %lu events, %.1f ticks/event to record, %lu blocks sealed at %lu ticks/block "
+           "(%.1f ticks/event), %lu forced\n",
+           (unsigned long)st->events, (double)event_ticks / TRACE_BENCH_EVENTS, (unsigned long)st->blocks_sealed,
+           (unsigned long)st->last_seal_cycles, (double)seal_ticks / TRACE_BENCH_EVENTS,
+           (unsigned long)st->forced_seals);
+    printf("[INFO] TRACE: export %lu bytes, %lu blocks retired\n", (unsigned long)bytes,
+           (unsigned long)st->blocks_retired);
+    if (bytes == 0) {
+        return 1;
+    }
+
+    // Tamper response order: seal the trace, then wipe its key
+    SecureTrace_Event(SECURE_TRACE_EVENT_TAG_FAIL, 0, 0);
+    SecureTrace_Tamper(TAMPER_SENSOR_VOLTAGE);
+    SecureTrace_Zeroize();
+    uint32_t events = st->events;
+    SecureTrace_Event(SECURE_TRACE_EVENT_TAG_FAIL, 0, 0);
+    bytes = SecureTrace_Export(TraceExport, sizeof(TraceExport));
+    bool sealed = false;
+    if (bytes > sizeof(SecureTraceExportHeader) + sizeof(SecureTraceExportTrailer)) {
+        const SecureTraceBlock *last =
+            (const SecureTraceBlock *)(TraceExport + bytes - sizeof(SecureTraceExportTrailer) - sizeof(SecureTraceBlock));
+        sealed = last->count >= 2U && last->records[last->count - 2U].type == SECURE_TRACE_EVENT_TAMPER &&
+                 last->records[last->count - 1U].type == SECURE_TRACE_EVENT_ZEROIZE;
+    }
+    printf("[INFO] TRACE: tamper sealed in %lu ticks, %lu lost, frozen export %lu bytes %s\n",
+           (unsigned long)st->tamper_cycles, (unsigned long)st->tamper_lost, (unsigned long)bytes,
+           sealed ? "ends with TAMPER, ZEROIZE" : "MISSING the tamper records");
+    if (!sealed || st->events != events) {
+        return 1;
+    }
+    if (out_path != NULL) {
+        FILE *fp = fopen(out_path, "wb");
+        if (fp == NULL || fwrite(TraceExport, 1, bytes, fp) != bytes) {
+            printf("[ERROR] TRACE: cannot write %s\n", out_path);
+            if (fp != NULL) {
+                fclose(fp);
+            }
+            return 1;
+        }
+        fclose(fp);
+    }
+    return 0;
+}
+
+// --- Health Check Sweeper ---
+// Six synthetic checks of different cost and period share a 2000-tick pass
+// budget. Check "fan" fails between 0.5 s and 1.0 s of simulated time. The
+// superloop pass is 100 us.
+#define SWEEP_BENCH_PASSES          20000U
+#define SWEEP_BENCH_PASS_TICKS      100000U
+#define SWEEP_BENCH_BUDGET          2000U
+
+typedef struct {
+    const char *name;
+    uint32_t    work;           // Busy-loop iterations per run
+    uint32_t    period;         // Ticks
+    uint32_t    fail_from;
+    uint32_t    fail_until;
+    uint32_t    now;            // Simulated time, set each pass
+} SweepBenchCheck;
+
+static bool SweepBenchRun(void *ctx) {
+    SweepBenchCheck *c = (SweepBenchCheck *)ctx;
+    volatile uint32_t x = 0;
+    for (uint32_t i = 0; i < c->work; i++) {
+        x += i;
+    }
+    return !(c->now >= c->fail_from && c->now < c->fail_until);
+}
+
+static int RunSweeperBenchmark(void) {
+    static SweepBenchCheck checks[] = {
+        { "voltage", 50, 1000000, 0, 0, 0 },
+        { "temperature", 200, 5000000, 0, 0, 0 },
+        { "fan", 100, 2000000, 500000000U, 1000000000U, 0 },
+        { "clock", 20, 1000000, 0, 0, 0 },
+        { "bus", 800, 10000000, 0, 0, 0 },
+        { "ram ecc", 1500, 20000000, 0, 0, 0 },
+    };
+    static ConstraintSweeper sw;
+    ConstraintSweeper_Init(&sw, SWEEP_BENCH_BUDGET);
+    for (uint32_t i = 0; i < sizeof(checks) / sizeof(checks[0]); i++) {
+        ConstraintSweeper_Register(&sw, checks[i].name, SweepBenchRun, &checks[i], checks[i].period);
+    }
+
+    uint32_t now = 0;
+    for (uint32_t pass = 0; pass < SWEEP_BENCH_PASSES; pass++, now += SWEEP_BENCH_PASS_TICKS) {
+        for (uint32_t i = 0; i < sizeof(checks) / sizeof(checks[0]); i++) {
+            checks[i].now = now;
+        }
+        ConstraintSweeper_Run(&sw, now);
+    }
+
+    const ConstraintSweepStats *st = ConstraintSweeper_Stats(&sw);
+    printf("[INFO] SWEEPER: %lu passes, %lu checks run, %lu deferred, budget used %lu.%lu%%, max pass %lu ticks\n",
+           (unsigned long)st->passes, (unsigned long)st->checks_run, (unsigned long)st->checks_deferred,
+           (unsigned long)st->budget_permille / 10, (unsigned long)st->budget_permille % 10,
+           (unsigned long)st->max_pass_cycles);
+    for (uint32_t i = 0; i < sw.count; i++) {
+        const ConstraintSweepEntry *e = &sw.entries[i];
+        printf("[INFO] SWEEPER: %-12s runs=%lu failures=%lu period=%lu (base %lu) cost=%lu\n", e->name,
+               (unsigned long)e->runs, (unsigned long)e->failures, (unsigned long)e->period,
+               (unsigned long)e->base_period, (unsigned long)e->cost_cycles);
+    }
+    return 0;
+}
+
+// --- Tamper Monitor ---
+// The simulator replays three scripts. Simulated time is in timer ticks (1 us).
+//  - Noise: short glitches on rotating sensors, some overlapping, at about
+//    11 a second. Every one must be filtered and traced, and the key kept.
+//  - Glitch attack: a train of short glitches 100 us apart. The response
+//    must trip on exactly the TAMPER_MONITOR_GLITCH_LIMIT-th one.
+//  - Held edge: the voltage detector stays high. The key must be wiped
+//    exactly one debounce window after the edge.
+#define TAMPER_BENCH_GLITCHES       100U
+#define TAMPER_BENCH_SPACING        100000U     // 100 ms between noise glitches
+#define TAMPER_BENCH_TRAIN_SPACING  100U
+#define TAMPER_BENCH_POLL_TICKS     10000U      // The 10 ms sensor poll this replaces
+
+typedef struct {
+    volatile uint8_t key[32];
+    uint32_t wiped_at;
+} TamperBenchCtx;
+
+static void TamperBenchRespond(uint32_t sensors, void *ctx) {
+    (void)sensors;
+    TamperBenchCtx *c = (TamperBenchCtx *)ctx;
+    for (uint32_t i = 0; i < sizeof(c->key); i++) {
+        c->key[i] = 0;
+    }
+    c->wiped_at = Tamper_HwTimerNow();
+}
+
+static void TamperBenchArm(TamperBenchCtx *ctx) {
+    for (uint32_t i = 0; i < sizeof(ctx->key); i++) {
+        ctx->key[i] = (uint8_t)(0xA5U ^ i);
+    }
+    ctx->wiped_at = 0;
+    TamperMonitor_Init(TAMPER_MONITOR_DEBOUNCE_TICKS, TamperBenchRespond, ctx);
+}
+
+static int RunTamperBenchmark(void) {
+    static TamperBenchCtx ctx;
+    TamperSim_Reset();
+    TamperBenchArm(&ctx);
+
+    uint32_t edges = 0;
+    for (uint32_t g = 0; g < TAMPER_BENCH_GLITCHES; g++) {
+        uint32_t sensor = 1UL << (g % TAMPER_SENSOR_COUNT);
+        uint32_t width = 1U + (g * 7U) % (TAMPER_MONITOR_DEBOUNCE_TICKS - 1U);
+        TamperSim_Assert(sensor, width);
+        edges++;
+        if (g % 10U == 0) {
+            // A second sensor glitches while the first is being debounced
+            TamperSim_Advance(width / 2U);
+            TamperSim_Assert(1UL << ((g + 1U) % TAMPER_SENSOR_COUNT), TAMPER_MONITOR_DEBOUNCE_TICKS - 1U);
+            edges++;
+            TamperSim_Advance(TAMPER_BENCH_SPACING - width / 2U);
+        } else {
+            TamperSim_Advance(TAMPER_BENCH_SPACING);
+        }
+        TamperMonitor_Poll();
+    }
+    const TamperMonitorStats *st = TamperMonitor_Stats();
+    bool noise_ok = ctx.key[0] != 0 && st->edges == edges && st->filtered == edges && st->traced == edges &&
+                    st->escalations == 0 && TamperMonitor_Armed();
+    double isr_per_edge = (double)st->isr_cycles / st->edges;
+    printf("[INFO] TAMPER: noise: %lu edges, %lu filtered, %lu traced, key %s\n", (unsigned long)st->edges,
+           (unsigned long)st->filtered, (unsigned long)st->traced, (ctx.key[0] != 0) ? "kept" : "LOST");
+
+    // A quiet second closes the noise window
+    TamperSim_Advance(TAMPER_MONITOR_GLITCH_WINDOW_TICKS);
+    uint32_t train = 0;
+    uint32_t train_at = Tamper_HwTimerNow();
+    while (ctx.key[0] != 0 && train < 2U * TAMPER_MONITOR_GLITCH_LIMIT) {
+        TamperSim_Assert(1UL << (train % TAMPER_SENSOR_COUNT), TAMPER_MONITOR_DEBOUNCE_TICKS / 2U);
+        TamperSim_Advance(TAMPER_BENCH_TRAIN_SPACING);
+        train++;
+    }
+    bool train_ok = ctx.key[0] == 0 && train == TAMPER_MONITOR_GLITCH_LIMIT && st->escalations == 1U;
+    printf("[INFO] TAMPER: glitch attack: wiped on glitch %lu of the train, %lu us after it began\n",
+           (unsigned long)train, (unsigned long)(ctx.wiped_at - train_at));
+
+    TamperBenchArm(&ctx);
+    uint32_t attack_at = Tamper_HwTimerNow();
+    TamperSim_Assert(TAMPER_SENSOR_VOLTAGE, TAMPER_SIM_HELD);
+    TamperSim_Advance(TAMPER_BENCH_TRAIN_SPACING);
+    uint32_t latency = ctx.wiped_at - attack_at;
+    printf("[INFO] TAMPER: held edge to wipe %lu us (debounce %u us, polling up to %u us), max %lu us\n",
+           (unsigned long)latency, TAMPER_MONITOR_DEBOUNCE_TICKS, TAMPER_BENCH_POLL_TICKS,
+           (unsigned long)st->max_latency_ticks);
+    printf("[INFO] TAMPER: %.1f interrupt ticks per noise edge, response %lu ticks\n", isr_per_edge,
+           (unsigned long)st->response_cycles);
+
+    bool ok = noise_ok && train_ok && st->confirmed == 1U && latency == TAMPER_MONITOR_DEBOUNCE_TICKS &&
+              ctx.key[0] == 0 && !TamperMonitor_Armed();
+    if (!ok) {
+        printf("[ERROR] TAMPER: Unexpected response to the glitch script.\n");
+    }
+    return ok ? 0 : 1;
+}
+
+// --- Key Zeroisation ---
+// A key store, an AES-256 round-key schedule and an HMAC midstate, plus the
+// whole 128 KB RAM image as a bulk range: the worst case the tamper
+// response can be asked to wipe. Each pass refills everything with a
+// pattern, so every wipe writes dirty lines.
+#define ZEROIZE_BENCH_RAM_BYTES     (128U * 1024U)
+#define ZEROIZE_BENCH_PASSES        64U
+
+static int RunZeroizeBenchmark(void) {
+    static _Alignas(64) uint8_t ram_image[ZEROIZE_BENCH_RAM_BYTES];
+    static uint8_t key_store[256];
+    static uint32_t round_keys[60];
+    static HmacSha256Key midstate;
+
+    Zeroize_Register(ram_image, sizeof(ram_image), ZEROIZE_PRIORITY_BULK);
+    Zeroize_Register(&midstate, sizeof(midstate), ZEROIZE_PRIORITY_MIDSTATE);
+    Zeroize_Register(round_keys, sizeof(round_keys), ZEROIZE_PRIORITY_ROUND_KEYS);
+    Zeroize_Register(key_store, sizeof(key_store), ZEROIZE_PRIORITY_KEY_STORE);
+
+    uint64_t total = 0;
+    bool clean = true;
+    for (uint32_t pass = 0; pass < ZEROIZE_BENCH_PASSES; pass++) {
+        memset(ram_image, 0xA5, sizeof(ram_image));
+        memset(key_store, 0x5A, sizeof(key_store));
+        memset(round_keys, 0x3C, sizeof(round_keys));
+        memset(&midstate, 0xC3, sizeof(midstate));
+        clean = Zeroize_All() && clean;
+        total += Zeroize_Stats()->last_wipe_cycles;
+    }
+    clean = clean && ram_image[sizeof(ram_image) - 1] == 0 && key_store[0] == 0 && midstate.outer[7] == 0;
+
+    // Reference: the same 128 KB cleared one volatile byte at a time
+    memset(ram_image, 0xA5, sizeof(ram_image));
+    uint32_t start = CycleCounter_Read();
+    volatile uint8_t *p = ram_image;
+    for (uint32_t i = 0; i < sizeof(ram_image); i++) {
+        p[i] = 0;
+    }
+    uint32_t bytewise = CycleCounter_Elapsed(start);
+
+    const ZeroizeStats *st = Zeroize_Stats();
+    printf("[INFO] ZEROIZE: %s, %lu bytes registered\n", Zeroize_BackendName(),
+           (unsigned long)Zeroize_RegisteredBytes());
+    printf("[INFO] ZEROIZE: keys clear after %lu ticks; full wipe mean %.0f, worst %lu ticks (%.1f bytes/tick), "
+           "verify %lu ticks\n",
+           (unsigned long)st->secrets_cycles, (double)total / ZEROIZE_BENCH_PASSES,
+           (unsigned long)st->max_wipe_cycles, (double)st->bytes / st->max_wipe_cycles,
+           (unsigned long)st->last_verify_cycles);
+    printf("[INFO] ZEROIZE: byte-wise reference %lu ticks, %lu verify failures\n", (unsigned long)bytewise,
+           (unsigned long)st->verify_failures);
+
+    Zeroize_Unregister(ram_image);
+    Zeroize_Unregister(&midstate);
+    Zeroize_Unregister(round_keys);
+    Zeroize_Unregister(key_store);
+    if (!clean) {
+        printf("[ERROR] ZEROIZE: Memory not clear after wipe.\n");
+    }
+    return clean ? 0 : 1;
+}
+
+// --- Precomputed Signing ---
+// ECDSA P-256 and RSA-2048 signing, first with an empty pool (every
+// signature pays for its own nonce or blinding), then after the pool has
+// been filled in 100 us idle slots. Every signature is verified. The
+// RSA-2048 key is a fixed test key, e = 65537.
+#define PRECOMPUTE_BENCH_SLOT       ((uint32_t)(CYCLE_COUNTER_HZ / 10000U))
+#define PRECOMPUTE_BENCH_RSA_BYTES  256U
+
+static const char PrecomputeBenchRsaN[] =
+    "b9f54d9080a36ca8024dbae7d23e4716c5da56d9eab616bf00120ec6da6f1587"
+    "a9e306a4c31cb224524a1398deae51e8ef310591c6c0381d2649e1e2b8b4f2ec"
+    "93ed2121d8bd9e802a2e49c7106dce69a2240eefe2e20629e3b80dc1f1d81878"
+    "c02a03e1fe4157aa73e444c3c47616171b75be0e5ac6a4f83498f13ff4d610b9"
+    "e400194da05a86617815fa22e546efff05636edc0b02b49f9c502929a92b2f18"
+    "98a23cf32010ec9a193c9369e294e546bfbfea1bcdc68d70f3db1791b00ebf3e"
+    "7ab1f2d524637ef4301e0a68eb85c2aee313b24e130aaee9312287ae6ae098e3"
+    "ed5b2dae90ed6954c95f27829a542da7f4f8bedb7c3c9872a6288fdbb4c3d89b";
+static const char PrecomputeBenchRsaD[] =
+    "8df191c05080ee4a9c5f8ae0b359f85788b4ee00af2948d9888b401e47d3ed22"
+    "3dea5e42dbf00686b50d784203101ad3ebe88670ccbe22d71547e615729a24a7"
+    "b30e9970c5898ff812ba7c7467b4f98f2645d1e5085131153e8e5a6a0559c6ec"
+    "3cfa95362726e76ce3c3853dcdb3b98eefd60339dfceab540e8a03f4a6c5d3c3"
+    "53d6b775048ba4a276fae1e178148dc683315b72cc1d1972e0af3d1f7413d571"
+    "5afca39f33714b7abbcbe87aed4b0f92a400a9afeaec533845f9c420e9ac35d9"
+    "0090493cacfb0ea78e61a8c0ab6525f945a64958b2a946afe01b46391e1de4c5"
+    "289cf8f03e4c588dff8c5925358043b10347953dafa00e97f4ca6f37a426c541";
+
+static void HexToBytes(const char *hex, uint8_t *out, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        char pair[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+        out[i] = (uint8_t)strtoul(pair, NULL, 16);
+    }
+}
+
+static int RunPrecomputeBenchmark(void) {
+    static RsaKey rsa;
+    uint8_t rsa_n[PRECOMPUTE_BENCH_RSA_BYTES];
+    uint8_t rsa_d[PRECOMPUTE_BENCH_RSA_BYTES];
+    HexToBytes(PrecomputeBenchRsaN, rsa_n, sizeof(rsa_n));
+    HexToBytes(PrecomputeBenchRsaD, rsa_d, sizeof(rsa_d));
+    if (!Rsa_Init(&rsa, rsa_n, rsa_d, sizeof(rsa_n), 65537U)) {
+        return 1;
+    }
+
+    uint8_t seed[32];
+    uint8_t priv[P256_BYTES];
+    for (uint32_t i = 0; i < sizeof(seed); i++) {
+        seed[i] = (uint8_t)i;
+        priv[i] = (uint8_t)(i + 1U);
+    }
+    uint8_t pub[2 * P256_BYTES];
+    uint8_t hash[SHA256_DIGEST_BYTES];
+    P256_PublicKey(priv, pub);
+    Sha256_Digest("precompute bench", 16, hash);
+    uint8_t message[PRECOMPUTE_BENCH_RSA_BYTES];
+    for (uint32_t i = 0; i < sizeof(message); i++) {
+        message[i] = (i == 0) ? 0 : (uint8_t)(i * 29U);
+    }
+    PrecomputePool_Init(seed, sizeof(seed), &rsa);
+
+    // Empty pool: the online path
+    static uint8_t sigs[PRECOMPUTE_ECDSA_DEPTH][2 * P256_BYTES];
+    static uint8_t rsa_sig[PRECOMPUTE_BENCH_RSA_BYTES];
+    static uint8_t rsa_check[PRECOMPUTE_BENCH_RSA_BYTES];
+    bool ok = true;
+    uint32_t start = CycleCounter_Read();
+    ok = PrecomputePool_EcdsaSign(priv, hash, sigs[0]) && ok;
+    uint32_t ecdsa_online = CycleCounter_Elapsed(start);
+    ok = P256_EcdsaVerify(pub, hash, sigs[0]) && ok;
+    start = CycleCounter_Read();
+    ok = PrecomputePool_RsaSign(message, rsa_sig) && ok;
+    uint32_t rsa_online = CycleCounter_Elapsed(start);
+    ok = Rsa_Public(&rsa, rsa_sig, rsa_check) && memcmp(rsa_check, message, sizeof(message)) == 0 && ok;
+
+    // Fill in idle slots
+    uint32_t slots = 0;
+    while (PrecomputePool_Idle(PRECOMPUTE_BENCH_SLOT) > 0) {
+        slots++;
+    }
+    const PrecomputePoolStats *st = PrecomputePool_Stats();
+    uint32_t ecdsa_ready = st->ecdsa_ready;
+    uint32_t rsa_ready = st->rsa_ready;
+
+    // Full pool: one entry per signature
+    start = CycleCounter_Read();
+    for (uint32_t i = 0; i < PRECOMPUTE_ECDSA_DEPTH; i++) {
+        ok = PrecomputePool_EcdsaSign(priv, hash, sigs[i]) && ok;
+    }
+    uint32_t ecdsa_pooled = CycleCounter_Elapsed(start) / PRECOMPUTE_ECDSA_DEPTH;
+    for (uint32_t i = 0; i < PRECOMPUTE_ECDSA_DEPTH; i++) {
+        ok = P256_EcdsaVerify(pub, hash, sigs[i]) && ok;
+    }
+    start = CycleCounter_Read();
+    ok = PrecomputePool_RsaSign(message, rsa_sig) && ok;
+    uint32_t rsa_pooled = CycleCounter_Elapsed(start);
+    ok = Rsa_Public(&rsa, rsa_sig, rsa_check) && memcmp(rsa_check, message, sizeof(message)) == 0 && ok;
+
+    // A tamper wipe disables the pool until the next Init: no signature, no idle work
+    PrecomputePool_Idle(PRECOMPUTE_BENCH_SLOT);
+    Zeroize_All();
+    bool disabled = !PrecomputePool_EcdsaSign(priv, hash, sigs[0]) && !PrecomputePool_RsaSign(message, rsa_sig) &&
+                    PrecomputePool_Idle(PRECOMPUTE_BENCH_SLOT) == 0;
+    ok = disabled && ok;
+
+    st = PrecomputePool_Stats();
+    printf("[INFO] PRECOMPUTE: filled %lu/%d tuples and %lu/%d pairs in %lu idle slots, longest step %lu ticks\n",
+           (unsigned long)ecdsa_ready, PRECOMPUTE_ECDSA_DEPTH, (unsigned long)rsa_ready, PRECOMPUTE_RSA_DEPTH,
+           (unsigned long)slots, (unsigned long)st->max_step_cycles);
+    printf("[INFO] PRECOMPUTE: refill %lu tuples/s (%lu ticks each), %lu pairs/s (%lu ticks each)\n",
+           (unsigned long)st->ecdsa_per_sec, (unsigned long)st->ecdsa_fill_cycles, (unsigned long)st->rsa_per_sec,
+           (unsigned long)st->rsa_fill_cycles);
+    printf("[INFO] PRECOMPUTE: ECDSA sign %lu ticks online, %lu pooled; RSA-2048 sign %lu online, %lu pooled\n",
+           (unsigned long)ecdsa_online, (unsigned long)ecdsa_pooled, (unsigned long)rsa_online,
+           (unsigned long)rsa_pooled);
+    printf("[INFO] PRECOMPUTE: %lu misses, signatures %s, pool %s after a wipe\n",
+           (unsigned long)(st->ecdsa_misses + st->rsa_misses), ok ? "verified" : "FAILED",
+           disabled ? "disabled" : "STILL ACTIVE");
+
+    // Re-seed for the batch verify benchmark, which signs through the pool
+    PrecomputePool_Init(seed, sizeof(seed), &rsa);
+    return ok ? 0 : 1;
+}
+
+// --- Batch Verification and Multi-Scalar Multiplication ---
+// ECDSA verification of 64 signatures under 4 keys, one call each and
+// then in batches of 1, 4, 16 and 64, with one corrupted signature that
+// must be the only failure. Inversions are shared per P256_VERIFY_CHUNK,
+// so 64 costs the same per signature as 16. Then sum(k_i * P_i) for growing counts; the
+// 256-term sum (Pippenger) is checked against two 128-term sums (Straus)
+// and the 8-term sum against separate ladders.
+#define BATCH_BENCH_SIGS            64U
+#define BATCH_BENCH_KEYS            4U
+#define BATCH_BENCH_BAD             37U
+#define MSM_BENCH_MAX_POINTS        1024U
+#define MSM_BENCH_SCRATCH           2600U   // Straus at 128 terms needs the most
+
+static uint8_t BatchSigs[BATCH_BENCH_SIGS][2 * P256_BYTES];
+static uint8_t BatchHashes[BATCH_BENCH_SIGS][SHA256_DIGEST_BYTES];
+static uint8_t BatchPubs[BATCH_BENCH_KEYS][2 * P256_BYTES];
+static P256VerifyItem BatchItems[BATCH_BENCH_SIGS];
+static bool BatchValid[BATCH_BENCH_SIGS];
+static P256Point MsmPoints[MSM_BENCH_MAX_POINTS];
+static BnLimb MsmScalars[MSM_BENCH_MAX_POINTS * P256_LIMBS];
+static BnLimb MsmNormScratch[MSM_BENCH_MAX_POINTS * P256_LIMBS];
+static P256Point MsmScratch[MSM_BENCH_SCRATCH];
+
+static bool SameAffine(const P256Point *a, const P256Point *b) {
+    BnLimb ax[P256_LIMBS], ay[P256_LIMBS], bx[P256_LIMBS], by[P256_LIMBS];
+    return P256_ToAffine(a, ax, ay) && P256_ToAffine(b, bx, by) && memcmp(ax, bx, sizeof(ax)) == 0 &&
+           memcmp(ay, by, sizeof(ay)) == 0;
+}
+
+static bool RunMsmBenchmark(void) {
+    // Points 3G, 10G, 17G, ..., normalised; scalars from SHA-256, below n
+    BnLimb k[P256_LIMBS] = { 3 };
+    P256Point step;
+    P256_ScalarMult(&MsmPoints[0], k, NULL);
+    k[0] = 7;
+    P256_ScalarMult(&step, k, NULL);
+    for (uint32_t i = 1; i < MSM_BENCH_MAX_POINTS; i++) {
+        P256_Add(&MsmPoints[i], &MsmPoints[i - 1U], &step);
+    }
+    P256_NormalizeBatch(MsmPoints, MSM_BENCH_MAX_POINTS, MsmNormScratch);
+    for (uint32_t i = 0; i < MSM_BENCH_MAX_POINTS; i++) {
+        uint8_t digest[SHA256_DIGEST_BYTES];
+        Sha256_Digest(&i, sizeof(i), digest);
+        digest[0] &= 0x7FU;
+        P256_ScalarFromBytes(&MsmScalars[i * P256_LIMBS], digest);
+    }
+
+    bool ok = true;
+    P256Point sum, check, part;
+    memset(&check, 0, sizeof(check));
+    for (uint32_t i = 0; i < 8U; i++) {
+        P256_ScalarMult(&part, &MsmScalars[i * P256_LIMBS], &MsmPoints[i]);
+        P256_Add(&check, &check, &part);
+    }
+    ok = P256_MultiScalarMult(&sum, MsmScalars, MsmPoints, 8U, MsmScratch, MSM_BENCH_SCRATCH) && ok;
+    ok = SameAffine(&sum, &check) && ok;
+
+    ok = P256_MultiScalarMult(&check, MsmScalars, MsmPoints, 128U, MsmScratch, MSM_BENCH_SCRATCH) && ok;
+    ok = P256_MultiScalarMult(&part, &MsmScalars[128U * P256_LIMBS], &MsmPoints[128], 128U, MsmScratch,
+                              MSM_BENCH_SCRATCH) && ok;
+    P256_Add(&check, &check, &part);
+    ok = P256_MultiScalarMult(&sum, MsmScalars, MsmPoints, 256U, MsmScratch, MSM_BENCH_SCRATCH) && ok;
+    ok = SameAffine(&sum, &check) && ok;
+
+    static const uint32_t counts[] = { 1U, 8U, 64U, 256U, 1024U };
+    for (uint32_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        uint32_t start = CycleCounter_Read();
+        ok = P256_MultiScalarMult(&sum, MsmScalars, MsmPoints, counts[c], MsmScratch, MSM_BENCH_SCRATCH) && ok;
+        uint32_t ticks = CycleCounter_Elapsed(start);
+        printf("[INFO] MSM: %4lu terms in %9lu ticks, %7lu per term\n", (unsigned long)counts[c],
+               (unsigned long)ticks, (unsigned long)(ticks / counts[c]));
+    }
+    printf("[INFO] MSM: results %s\n", ok ? "match" : "MISMATCH");
+    return ok;
+}
+
+static int RunBatchVerifyBenchmark(void) {
+    for (uint32_t i = 0; i < BATCH_BENCH_KEYS; i++) {
+        uint8_t priv[P256_BYTES];
+        memset(priv, (int)(0x11U * (i + 1U)), sizeof(priv));
+        P256_PublicKey(priv, BatchPubs[i]);
+    }
+    for (uint32_t i = 0; i < BATCH_BENCH_SIGS; i++) {
+        uint8_t priv[P256_BYTES];
+        memset(priv, (int)(0x11U * (i % BATCH_BENCH_KEYS + 1U)), sizeof(priv));
+        Sha256_Digest(&i, sizeof(i), BatchHashes[i]);
+        PrecomputePool_EcdsaSign(priv, BatchHashes[i], BatchSigs[i]);
+        BatchItems[i] = (P256VerifyItem){ BatchPubs[i % BATCH_BENCH_KEYS], BatchHashes[i], BatchSigs[i] };
+    }
+    BatchSigs[BATCH_BENCH_BAD][2 * P256_BYTES - 1U] ^= 0x01U;
+
+    // Reference: u1 * G and u2 * Q as two separate ladders
+    BnLimb u[P256_LIMBS];
+    P256Point q, a, b;
+    P256_PointFromBytes(&q, BatchPubs[0]);
+    P256_ScalarFromBytes(u, BatchHashes[0]);
+    uint32_t start = CycleCounter_Read();
+    P256_ScalarMult(&a, u, NULL);
+    P256_ScalarMult(&b, u, &q);
+    P256_Add(&a, &a, &b);
+    uint32_t ladders = CycleCounter_Elapsed(start);
+
+    bool ok = true;
+    start = CycleCounter_Read();
+    uint32_t passed = 0;
+    for (uint32_t i = 0; i < BATCH_BENCH_SIGS; i++) {
+        passed += P256_EcdsaVerify(BatchItems[i].pub, BatchItems[i].hash, BatchItems[i].sig) ? 1U : 0U;
+    }
+    uint32_t single = CycleCounter_Elapsed(start) / BATCH_BENCH_SIGS;
+    ok = (passed == BATCH_BENCH_SIGS - 1U) && ok;
+    printf("[INFO] BATCH_VERIFY: two ladders %lu ticks; one call per signature %lu ticks\n",
+           (unsigned long)ladders, (unsigned long)single);
+
+    static const uint32_t sizes[] = { 1U, 4U, 16U, 64U };
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        passed = 0;
+        start = CycleCounter_Read();
+        for (uint32_t i = 0; i < BATCH_BENCH_SIGS; i += sizes[s]) {
+            passed += P256_EcdsaVerifyBatch(&BatchItems[i], sizes[s], &BatchValid[i]);
+        }
+        uint32_t per_sig = CycleCounter_Elapsed(start) / BATCH_BENCH_SIGS;
+        ok = (passed == BATCH_BENCH_SIGS - 1U) && !BatchValid[BATCH_BENCH_BAD] && ok;
+        printf("[INFO] BATCH_VERIFY: batches of %2lu: %lu ticks per signature, %lu verifies/s\n",
+               (unsigned long)sizes[s], (unsigned long)per_sig,
+               (unsigned long)((per_sig > 0) ? CYCLE_COUNTER_HZ / per_sig : 0));
+    }
+    printf("[INFO] BATCH_VERIFY: %lu/%lu valid, corrupted signature %s\n", (unsigned long)passed,
+           (unsigned long)BATCH_BENCH_SIGS, BatchValid[BATCH_BENCH_BAD] ? "ACCEPTED" : "rejected");
+
+    ok = RunMsmBenchmark() && ok;
+    return ok ? 0 : 1;
+}
+
+// --- Certificate Chains ---
+// A P-256 test chain (root, intermediate, leaf; ecdsa-with-SHA256) is
+// parsed in place and verified leaf to root key: once cold, then warm
+// from the verified-link cache. A corrupted signature, a changed subject
+// and a chain in the wrong order must all be rejected.
+#define CERT_BENCH_ROOT_BYTES       452U
+#define CERT_BENCH_INT_BYTES        464U
+#define CERT_BENCH_LEAF_BYTES       455U
+#define CERT_BENCH_WARM_RUNS        100U
+
+static const char CertBenchRoot[] =
+    "308201c030820167a0030201020214794d476d2fd512843c7421f023c370f56c3e784e300a06082a8648ce3d04030230"
+    "2d31123010060355040a0c094153494320546573743117301506035504030c0e41534943205465737420526f6f743020"
+    "170d3236313031373132333930375a180f32313236303932333132333930375a302d31123010060355040a0c09415349"
+    "4320546573743117301506035504030c0e41534943205465737420526f6f743059301306072a8648ce3d020106082a86"
+    "48ce3d030107034200043cfb8126813f7590868495992c643b788457aec3b8dedcca9d29e3f4e68fa966caccd97477cd"
+    "c31c9be3b19dcbd4ae8d1ee8d9dde480415fea1af37208e071bda3633061301d0603551d0e041604145b930accab42b6"
+    "fdcfcb2e43b0816f863b30f55a301f0603551d230418301680145b930accab42b6fdcfcb2e43b0816f863b30f55a300f"
+    "0603551d130101ff040530030101ff300e0603551d0f0101ff040403020204300a06082a8648ce3d0403020347003044"
+    "02200e9c34ee12bdf04c18b3422605187572640db3c203d095df8266bcc5e954eafd02200fe1a3fb4c43d5c0bee9d8d5"
+    "da8b33ac4d5946c846f0da18bcb424fd96c9f4c1";
+static const char CertBenchIntermediate[] =
+    "308201cc30820172a00302010202143b75c6d92ae8b285f73e5caa889880d435fcc150300a06082a8648ce3d04030230"
+    "2d31123010060355040a0c094153494320546573743117301506035504030c0e41534943205465737420526f6f743020"
+    "170d3236313031373132333930375a180f32313236303932333132333930375a303531123010060355040a0c09415349"
+    "432054657374311f301d06035504030c1641534943205465737420496e7465726d6564696174653059301306072a8648"
+    "ce3d020106082a8648ce3d03010703420004cacda793b055a2a28904055b461834367e9a8c0f6c89b7addd9ffbfb5719"
+    "a858266343f45d3491dbf04d0b44e645e2fac97cac79384d3a6cb1900dfc0a0da5e1a366306430120603551d130101ff"
+    "040830060101ff020100300e0603551d0f0101ff040403020204301d0603551d0e04160414d7352b992e9e392bab6686"
+    "34ecb83c3427039f4b301f0603551d230418301680145b930accab42b6fdcfcb2e43b0816f863b30f55a300a06082a86"
+    "48ce3d0403020348003045022100e990fe67bafe4af20c831bc23bda2d47de0bf23f5fa96a0f456696d5afe9c7050220"
+    "2f9349f581103fb10a020caf8778ca4d24f5e0cb9c8e935e5a616e1cd779f344";
+static const char CertBenchLeaf[] =
+    "308201c33082016aa00302010202144dfe5db6c0ab41862460e940a7771296373a980b300a06082a8648ce3d04030230"
+    "3531123010060355040a0c09415349432054657374311f301d06035504030c1641534943205465737420496e7465726d"
+    "6564696174653020170d3236313031373132333930375a180f32313236303932333132333930375a302b311230100603"
+    "55040a0c094153494320546573743115301306035504030c0c617369632d706565722d30313059301306072a8648ce3d"
+    "020106082a8648ce3d03010703420004d9a38efa8d79b5629d5710d06703a548047eae573029bf72b4dbd33cc885417b"
+    "cc648873ecfacf34719542c3159e748d674357e312d13ac2affc73c557ed024ca360305e300c0603551d130101ff0402"
+    "3000300e0603551d0f0101ff040403020780301d0603551d0e041604140f3f2df262213c4bcf4b2dc368e186b965a83a"
+    "b0301f0603551d23041830168014d7352b992e9e392bab668634ecb83c3427039f4b300a06082a8648ce3d0403020347"
+    "003044022077b71d17473455f4a163fb61c588074137c2763e46525755e5df6642276952a5022022b244d04e2da52988"
+    "8a7428ad1c98addf1322761140317a5d0b4e8f40b59540";
+
+static uint8_t CertRoot[CERT_BENCH_ROOT_BYTES];
+static uint8_t CertIntermediate[CERT_BENCH_INT_BYTES];
+static uint8_t CertLeaf[CERT_BENCH_LEAF_BYTES];
+static uint8_t CertLeafBad[CERT_BENCH_LEAF_BYTES];
+
+static int RunCertChainBenchmark(void) {
+    HexToBytes(CertBenchRoot, CertRoot, sizeof(CertRoot));
+    HexToBytes(CertBenchIntermediate, CertIntermediate, sizeof(CertIntermediate));
+    HexToBytes(CertBenchLeaf, CertLeaf, sizeof(CertLeaf));
+
+    X509Cert root;
+    bool ok = true;
+    uint32_t start = CycleCounter_Read();
+    ok = X509_Parse(&root, CertRoot, sizeof(CertRoot)) && ok;
+    uint32_t parse = CycleCounter_Elapsed(start);
+
+    CertCache_Init();
+    CertBlob chain[2] = { { CertLeaf, sizeof(CertLeaf) }, { CertIntermediate, sizeof(CertIntermediate) } };
+    const uint8_t *leaf_pub = NULL;
+    start = CycleCounter_Read();
+    ok = CertCache_VerifyChain(chain, 2, root.pub, &leaf_pub) && ok;
+    uint32_t cold = CycleCounter_Elapsed(start);
+    ok = (leaf_pub != NULL) && ok;
+
+    start = CycleCounter_Read();
+    for (uint32_t i = 0; i < CERT_BENCH_WARM_RUNS; i++) {
+        ok = CertCache_VerifyChain(chain, 2, root.pub, NULL) && ok;
+    }
+    uint32_t warm = CycleCounter_Elapsed(start) / CERT_BENCH_WARM_RUNS;
+
+    // Rejections: signature, signed content, order
+    uint32_t rejected = 0;
+    CertBlob bad[2] = { { CertLeafBad, sizeof(CertLeafBad) }, chain[1] };
+    memcpy(CertLeafBad, CertLeaf, sizeof(CertLeaf));
+    CertLeafBad[sizeof(CertLeafBad) - 1U] ^= 0x01U;
+    rejected += CertCache_VerifyChain(bad, 2, root.pub, NULL) ? 0U : 1U;
+    X509Cert leaf;
+    X509_Parse(&leaf, CertLeaf, sizeof(CertLeaf));
+    memcpy(CertLeafBad, CertLeaf, sizeof(CertLeaf));
+    CertLeafBad[(uint32_t)(leaf.subject.ptr - CertLeaf) + leaf.subject.len - 1U] ^= 0x01U;
+    rejected += CertCache_VerifyChain(bad, 2, root.pub, NULL) ? 0U : 1U;
+    CertBlob swapped[2] = { chain[1], chain[0] };
+    rejected += CertCache_VerifyChain(swapped, 2, root.pub, NULL) ? 0U : 1U;
+    ok = (rejected == 3U) && ok;
+
+    const CertCacheStats *st = CertCache_Stats();
+    printf("[INFO] CERT_CACHE: parse %lu ticks per certificate, chain cold %lu ticks, warm %lu ticks (%lux)\n",
+           (unsigned long)parse, (unsigned long)cold, (unsigned long)warm,
+           (unsigned long)((warm > 0) ? cold / warm : 0));
+    printf("[INFO] CERT_CACHE: %lu hits, %lu misses, %lu signatures verified, %lu entries, %lu/3 bad chains rejected\n",
+           (unsigned long)st->hits, (unsigned long)st->misses, (unsigned long)st->verified,
+           (unsigned long)st->entries, (unsigned long)rejected);
+    return ok ? 0 : 1;
+}
+
+// --- Post-Quantum Schemes ---
+// ML-KEM-768 and ML-DSA-65 from fixed seeds, averaged over a few runs.
+// Both shared secrets must agree, a corrupted ciphertext must fall back to
+// implicit rejection, and a signature must fail on a changed message.
+// First, the Cortex-M4 DSP transforms in pq_ntt_dsp.c (PqNttDsp_*) must
+// give the same results mod q as the host backend.
+#define PQC_BENCH_RUNS              8U
+#define PQC_BENCH_NTT_RUNS          1000U
+
+void PqNttDsp_KemNtt(int16_t a[PQ_N]);
+void PqNttDsp_KemInvNtt(int16_t a[PQ_N]);
+void PqNttDsp_DsaNtt(int32_t a[PQ_N]);
+void PqNttDsp_DsaInvNtt(int32_t a[PQ_N]);
+const char *PqNttDsp_BackendName(void);
+
+static uint8_t PqcEk[ML_KEM_768_EK_BYTES];
+static uint8_t PqcDk[ML_KEM_768_DK_BYTES];
+static uint8_t PqcCt[ML_KEM_768_CT_BYTES];
+static uint8_t PqcPk[ML_DSA_65_PK_BYTES];
+static uint8_t PqcSk[ML_DSA_65_SK_BYTES];
+static uint8_t PqcSig[ML_DSA_65_SIG_BYTES];
+
+// Both polynomials after each transform, compared mod q
+static bool PqcDspMatches(const int16_t *kem_poly, const int32_t *dsa_poly) {
+    int16_t kem[2][PQ_N];
+    int32_t dsa[2][PQ_N];
+    bool same = true;
+    for (uint32_t step = 0; step < 2U; step++) {
+        if (step == 0) {
+            memcpy(kem[0], kem_poly, sizeof(kem[0]));
+            memcpy(kem[1], kem_poly, sizeof(kem[1]));
+            memcpy(dsa[0], dsa_poly, sizeof(dsa[0]));
+            memcpy(dsa[1], dsa_poly, sizeof(dsa[1]));
+            PqKem_Ntt(kem[0]);
+            PqNttDsp_KemNtt(kem[1]);
+            PqDsa_Ntt(dsa[0]);
+            PqNttDsp_DsaNtt(dsa[1]);
+        } else {
+            PqKem_InvNtt(kem[0]);
+            PqNttDsp_KemInvNtt(kem[1]);
+            PqDsa_InvNtt(dsa[0]);
+            PqNttDsp_DsaInvNtt(dsa[1]);
+        }
+        for (uint32_t i = 0; i < PQ_N; i++) {
+            same = same && (kem[0][i] - kem[1][i]) % ML_KEM_Q == 0 &&
+                   ((int64_t)dsa[0][i] - dsa[1][i]) % ML_DSA_Q == 0;
+        }
+    }
+    return same;
+}
+
+static int RunPqcBenchmark(void) {
+    int16_t kem_poly[PQ_N];
+    int32_t dsa_poly[PQ_N];
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        kem_poly[i] = (int16_t)(i % ML_KEM_Q);
+        dsa_poly[i] = (int32_t)(i * 32749U % ML_DSA_Q);
+    }
+    bool dsp = PqcDspMatches(kem_poly, dsa_poly);
+    printf("[INFO] PQC: %s transforms %s the %s backend\n", PqNttDsp_BackendName(),
+           dsp ? "match" : "DO NOT MATCH", PqNtt_BackendName());
+
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PQC_BENCH_NTT_RUNS; r++) {
+        PqKem_Ntt(kem_poly);
+        PqKem_InvNtt(kem_poly);
+    }
+    uint32_t kem_ntt = CycleCounter_Elapsed(start) / PQC_BENCH_NTT_RUNS;
+    start = CycleCounter_Read();
+    for (uint32_t r = 0; r < PQC_BENCH_NTT_RUNS; r++) {
+        PqDsa_Ntt(dsa_poly);
+        PqDsa_InvNtt(dsa_poly);
+    }
+    uint32_t dsa_ntt = CycleCounter_Elapsed(start) / PQC_BENCH_NTT_RUNS;
+    printf("[INFO] PQC: NTT backend %s; forward + inverse %lu ticks (ML-KEM), %lu ticks (ML-DSA)\n",
+           PqNtt_BackendName(), (unsigned long)kem_ntt, (unsigned long)dsa_ntt);
+
+    uint8_t seed[ML_KEM_KEYGEN_SEED_BYTES];
+    uint8_t ss_a[ML_KEM_SS_BYTES];
+    uint8_t ss_b[ML_KEM_SS_BYTES];
+    uint32_t keygen = 0, encaps = 0, decaps = 0;
+    bool ok = dsp;
+    for (uint32_t r = 0; r < PQC_BENCH_RUNS; r++) {
+        memset(seed, (int)(0x40U + r), sizeof(seed));
+        start = CycleCounter_Read();
+        MlKem768_KeyGen(PqcEk, PqcDk, seed);
+        keygen += CycleCounter_Elapsed(start);
+        start = CycleCounter_Read();
+        ok = MlKem768_Encaps(PqcCt, ss_a, PqcEk, seed) && ok;
+        encaps += CycleCounter_Elapsed(start);
+        start = CycleCounter_Read();
+        ok = MlKem768_Decaps(ss_b, PqcCt, PqcDk) && ok;
+        decaps += CycleCounter_Elapsed(start);
+        ok = (memcmp(ss_a, ss_b, sizeof(ss_a)) == 0) && ok;
+    }
+    PqcCt[0] ^= 0x01U;
+    ok = MlKem768_Decaps(ss_b, PqcCt, PqcDk) && (memcmp(ss_a, ss_b, sizeof(ss_a)) != 0) && ok;
+    printf("[INFO] PQC: ML-KEM-768 keygen %lu, encaps %lu, decaps %lu ticks\n",
+           (unsigned long)(keygen / PQC_BENCH_RUNS), (unsigned long)(encaps / PQC_BENCH_RUNS),
+           (unsigned long)(decaps / PQC_BENCH_RUNS));
+
+    static const uint8_t ctx[] = "asic-bench";
+    uint8_t msg[64];
+    uint8_t rnd[ML_DSA_RND_BYTES] = { 0 };
+    uint32_t sign = 0, verify = 0;
+    keygen = 0;
+    for (uint32_t r = 0; r < PQC_BENCH_RUNS; r++) {
+        memset(seed, (int)(0x80U + r), ML_DSA_SEED_BYTES);
+        memset(msg, (int)r, sizeof(msg));
+        start = CycleCounter_Read();
+        MlDsa65_KeyGen(PqcPk, PqcSk, seed);
+        keygen += CycleCounter_Elapsed(start);
+        start = CycleCounter_Read();
+        ok = MlDsa65_Sign(PqcSig, msg, sizeof(msg), ctx, sizeof(ctx) - 1U, PqcSk, rnd) && ok;
+        sign += CycleCounter_Elapsed(start);
+        start = CycleCounter_Read();
+        ok = MlDsa65_Verify(PqcSig, msg, sizeof(msg), ctx, sizeof(ctx) - 1U, PqcPk) && ok;
+        verify += CycleCounter_Elapsed(start);
+    }
+    msg[0] ^= 0x01U;
+    ok = !MlDsa65_Verify(PqcSig, msg, sizeof(msg), ctx, sizeof(ctx) - 1U, PqcPk) && ok;
+    printf("[INFO] PQC: ML-DSA-65 keygen %lu, sign %lu, verify %lu ticks\n",
+           (unsigned long)(keygen / PQC_BENCH_RUNS), (unsigned long)(sign / PQC_BENCH_RUNS),
+           (unsigned long)(verify / PQC_BENCH_RUNS));
+    printf("[INFO] PQC: round trips %s\n", ok ? "match" : "MISMATCH");
+    return ok ? 0 : 1;
+}
+
+// --- Hash-Based Firmware Signatures ---
+// A 16 KB image, signed on the host by tools/lms_sign.py with one HSS
+// level of LMS_SHA256_M32_H5 / LMOTS_SHA256_N32_W8, goes through
+// SecureBoot_VerifyImage. The Winternitz chains run in one lane, then in
+// SHA256_MB_LANES lanes. A changed signature and a changed image must
+// both be rejected.
+#define LMS_BENCH_IMAGE_BYTES       16384U
+#define LMS_BENCH_SIG_BYTES         1296U
+#define LMS_BENCH_RUNS              4U
+
+static const char LmsBenchPub[] =
+    "000000010000000500000004b61d10318863f008d3d7bf6757f25f078f004fcdb8a59be0944aa631edd1a7a93a729515"
+    "92043105069c24e076cde9b8";
+static const char LmsBenchSig[] =
+    "0000000000000000000000043b66e26053de5a78c5c6abadb1405dcb0c6279d0a0213e54b8ce5bf47bb4025f35fe4691"
+    "1319753a4d275ee6b8cbc514d96d76fd474b860a1f304a863fd7a305b25bc3d4ea227d54efa290591ff30030aedd5b63"
+    "4afd740512e676b3fee4ce90054a25d225165f15813d887cc0fe439598b3352ed538b99e79ed07a86b7ddd0b1efa11b7"
+    "d1d99c16a4c7f16ccf5d778aafb15eeb3702af73ae313f0c24df34214373ad5c9b5665ab2eda2ee1e1ff17c880689d31"
+    "0fbf421d9f30465114a165592599234049a676b438103c5160a937e4d91aa6c89e1668faa7cc6a38b4dd016d67a7262d"
+    "72fb7f7d1a81d6e1ceb15aa054cfe80bc5746485e6eb9b9a7e3a6a7a794eff4e126a9c553013988b5699dbe271e42d53"
+    "2ba3040d71fec484e3ac76a59f33503b2d152a1b6335795bc46dc529046d5e9fe88407cff7b4dc985d97a1eec1af27af"
+    "87c08ba543292a93776957ec2c51acaf3b030b396760e07f6df432adb707f1ea79a77b66c68aa9d0977cbfcc1b32fdc8"
+    "aa395be7187263aa337058ceafb039ddb8152c21f6105725581e50bec967b118f98d2787c0cf9b8abeac4e4bbe7bbee5"
+    "280143ca9052ac25715af4203e73b4a72a5f747d40fcd2ef3a14ec2fa354a1e0d45f2c2c02e8af815280af551b0d7cc3"
+    "a1c3e02a1ace53a9f1b522962a3580113fd0c8196344932569ce873d4aab74defcde50a42d38a2496b4cd74a6de4d193"
+    "0211897d5d5420c8c530568e78874067d8f95c7a301ef9335d5eee50be1aeb033aec472dd2a112a48a1bbcff8211c67e"
+    "17315d86ec207a932316f017652ec21ac5e4e34d36ae8e03d42e15affe07ad8b33f61ca5912425aff8df6e1098bb6cb5"
+    "14124279beda776be0f0e8bf21e282c4ccc2ba1e16a42d31ef98c492079c6489ccc99c724bc9dc97f329f3767d07071c"
+    "629c7811268bc6071e8602ef3f5a437ef4b83877f3dc0c81d0d34528850ecf854afb8f016888d9a1169c7e24ff60256a"
+    "5698b334ecfa811a998306ee023ce42c8d5d14e52d35b66b499785f013b656707bd9ebcff7e50605157731b3d74de91e"
+    "6505eb94c26bf40a730a3f73afc43e4654162aa0498f640097a40f3fb6a65898ba92a47dfca8d2202fbfd113c87173a9"
+    "3c25ce6170001b47aef0ec8d99ed0f70a150813a5d201f314f1effe631f7258a45be144c8e2786c27d61ff7205f2fc72"
+    "52b9e742e378cdceaaccb997d9a1ef87f8f1427076e72fe9f883de4d81f7f7683912d40277c47221bbc651d5dd345df4"
+    "cdc419d68426ecde9e1780459bb9cf9cd3f32348ee0d897b1c896bf973eff8fcbbe0e97075db624d1a8eda16e195818e"
+    "7a6713a37514cfb13aafd49bd035dd54634b9093f8f3cd16b494f41ce7290e6fcab17c4554e1f14f3b5a23b612faffde"
+    "84e53d5dc0b7ecbad2257d923180867a14f536f795d5fdadc5dc274b20a321e41cede65bdbe57f83ad7c4a5bc729e5cb"
+    "cf58faf1b75debfa0e502a3c2c0231eadd294c7532a9abb391a9c1e2c4cba00c9ce3575525b63641dcbb0f80b61349e8"
+    "4647bdb9c84ab0f99dad8100521f36059d4eff87f3c26a5e710e68e400000005c7333bf27b6066f327010b7e6d0cae32"
+    "68fc79cd3a2762adcf2f5a45f1f3c9606eecf7afdf7cfcd79ac062250731781bfa45395ab55d3d4f68e4dd59447cd093"
+    "125b98b8d5848e024ffae91f5081acad511e29054f87ae728559ca3ea3fa63c7163cff017c7ff2ba62f0f46945165571"
+    "9d5c8e8cd150d1f917afecf92bb9dcd977d51a15496a7ce2d874e559bbfe602b1f6818a84acadc524c003f89a9e67cd3";
+
+static uint8_t LmsImage[LMS_BENCH_IMAGE_BYTES];
+static uint8_t LmsSig[LMS_BENCH_SIG_BYTES];
+
+static uint32_t TimeSecureBoot(uint32_t lanes, bool *ok) {
+    Lms_SetLanes(lanes);
+    uint32_t start = CycleCounter_Read();
+    for (uint32_t r = 0; r < LMS_BENCH_RUNS; r++) {
+        *ok = SecureBoot_VerifyImage(LmsImage, sizeof(LmsImage), LmsSig, sizeof(LmsSig)) && *ok;
+    }
+    return CycleCounter_Elapsed(start) / LMS_BENCH_RUNS;
+}
+
+static int RunLmsBenchmark(void) {
+    uint8_t pub[HSS_PUBLIC_KEY_BYTES];
+    HexToBytes(LmsBenchPub, pub, sizeof(pub));
+    HexToBytes(LmsBenchSig, LmsSig, sizeof(LmsSig));
+    for (uint32_t i = 0; i < LMS_BENCH_IMAGE_BYTES; i++) {
+        LmsImage[i] = (uint8_t)(i * 31U + 7U);
+    }
+
+    bool ok = SecureBoot_Init(pub, sizeof(pub));
+    uint32_t sequential = TimeSecureBoot(1U, &ok);
+    LmsStats before = *Lms_Stats();
+    uint32_t parallel = TimeSecureBoot(SHA256_MB_LANES, &ok);
+    uint32_t steps = Lms_Stats()->chain_steps - before.chain_steps;
+    uint32_t batches = Lms_Stats()->lane_batches - before.lane_batches;
+
+    uint32_t rejected = 0;
+    LmsSig[LMS_BENCH_SIG_BYTES / 2U] ^= 0x01U;
+    rejected += SecureBoot_VerifyImage(LmsImage, sizeof(LmsImage), LmsSig, sizeof(LmsSig)) ? 0U : 1U;
+    LmsSig[LMS_BENCH_SIG_BYTES / 2U] ^= 0x01U;
+    LmsImage[LMS_BENCH_IMAGE_BYTES - 1U] ^= 0x01U;
+    rejected += SecureBoot_VerifyImage(LmsImage, sizeof(LmsImage), LmsSig, sizeof(LmsSig)) ? 0U : 1U;
+    LmsImage[LMS_BENCH_IMAGE_BYTES - 1U] ^= 0x01U;
+    ok = (rejected == 2U) && ok;
+
+    const SecureBootStats *st = SecureBoot_Stats();
+    printf("[INFO] LMS: multi-buffer backend %s; image verify 1 lane %lu ticks, %lu lanes %lu ticks (%lu.%lux)\n",
+           Sha256Mb_BackendName(), (unsigned long)sequential, (unsigned long)SHA256_MB_LANES,
+           (unsigned long)parallel, (unsigned long)((parallel > 0) ? sequential / parallel : 0),
+           (unsigned long)((parallel > 0) ? (uint64_t)sequential * 10U / parallel % 10U : 0));
+    printf("[INFO] LMS: %lu chain steps per verify in %lu batches, %lu images accepted, %lu/2 bad images rejected\n",
+           (unsigned long)(steps / LMS_BENCH_RUNS), (unsigned long)(batches / LMS_BENCH_RUNS),
+           (unsigned long)st->accepted, (unsigned long)rejected);
+    return ok ? 0 : 1;
+}
+
+// --- Layout Database ---
+// A generated drop of GDS_BENCH_CELLS leaf cells under one top cell, loaded
+// cold (full parse, cache written), again after the tools rewrote every
+// BGNSTR timestamp (all cells from the cache) and after an ECO that moves
+// one shape in one cell (only that cell parsed and appended to the cache).
+// The ECO load must cost under GDS_BENCH_ECO_MAX_PERCENT of the cold one,
+// and reloading the ECO drop from the cache must match a plain parse of it.
+// Nets of the ECO drop are extracted on one thread and on
+// CONNECTIVITY_MAX_THREADS, which must give the same net ids. On a host
+// with fewer cores the threaded run only checks the result, not a speedup.
+// A second, hand-drawn cell checks net extraction on bent paths and L and
+// U polygons.
+#define GDS_BENCH_CELLS             200U
+#define GDS_BENCH_SHAPES            40U     // Rectangles per leaf cell
+#define GDS_BENCH_ECO_CELL          7U
+#define GDS_BENCH_ECO_MAX_PERCENT   50U
+#define GDS_BENCH_BYTES             (GDS_BENCH_CELLS * GDS_BENCH_SHAPES * 64U + 65536U)
+#define GDS_BENCH_PATH_MAX          256U
+#define GDS_BENCH_MAX_POINTS        9U
+#define GDS_BENCH_NETS              7U      // Expected nets in the extraction cell
+
+// GDSII record types written by the generator
+#define GDS_BENCH_REC_HEADER        0x00U
+#define GDS_BENCH_REC_BGNLIB        0x01U
+#define GDS_BENCH_REC_LIBNAME       0x02U
+#define GDS_BENCH_REC_ENDLIB        0x04U
+#define GDS_BENCH_REC_BGNSTR        0x05U
+#define GDS_BENCH_REC_STRNAME       0x06U
+#define GDS_BENCH_REC_ENDSTR        0x07U
+#define GDS_BENCH_REC_BOUNDARY      0x08U
+#define GDS_BENCH_REC_PATH          0x09U
+#define GDS_BENCH_REC_SREF          0x0AU
+#define GDS_BENCH_REC_LAYER         0x0DU
+#define GDS_BENCH_REC_DATATYPE      0x0EU
+#define GDS_BENCH_REC_WIDTH         0x0FU
+#define GDS_BENCH_REC_XY            0x10U
+#define GDS_BENCH_REC_ENDEL         0x11U
+#define GDS_BENCH_REC_SNAME         0x12U
+
+static uint8_t GdsBenchStream[GDS_BENCH_BYTES];
+static size_t GdsBenchLen;
+static bool GdsBenchOverflow;
+
+static void GdsRecord(uint8_t type, const uint8_t *payload, size_t len) {
+    size_t padded = (len + 1U) & ~(size_t)1U;
+    if (GdsBenchLen + 4U + padded > sizeof(GdsBenchStream)) {
+        GdsBenchOverflow = true;
+        return;
+    }
+    uint8_t *p = GdsBenchStream + GdsBenchLen;
+    p[0] = (uint8_t)((4U + padded) >> 8);
+    p[1] = (uint8_t)(4U + padded);
+    p[2] = type;
+    p[3] = 0;   // The reader does not check data types
+    if (len > 0) {
+        memcpy(p + 4, payload, len);
+    }
+    if (padded > len) {
+        p[4 + len] = 0;
+    }
+    GdsBenchLen += 4U + padded;
+}
+
+static void GdsInt16s(uint8_t type, const uint16_t *values, uint32_t count) {
+    uint8_t payload[24];
+    for (uint32_t i = 0; i < count; i++) {
+        payload[2 * i] = (uint8_t)(values[i] >> 8);
+        payload[2 * i + 1] = (uint8_t)values[i];
+    }
+    GdsRecord(type, payload, 2U * count);
+}
+
+static void GdsInt32s(uint8_t type, const int32_t *values, uint32_t count) {
+    uint8_t payload[2 * GDS_BENCH_MAX_POINTS * 4];
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t v = (uint32_t)values[i];
+        payload[4 * i] = (uint8_t)(v >> 24);
+        payload[4 * i + 1] = (uint8_t)(v >> 16);
+        payload[4 * i + 2] = (uint8_t)(v >> 8);
+        payload[4 * i + 3] = (uint8_t)v;
+    }
+    GdsRecord(type, payload, 4U * count);
+}
+
+static void GdsXy(const int32_t *xy, uint32_t points) {
+    GdsInt32s(GDS_BENCH_REC_XY, xy, 2U * points);
+}
+
+static void GdsString(uint8_t type, const char *text) {
+    GdsRecord(type, (const uint8_t *)text, strlen(text));
+}
+
+static void GdsBeginStructure(const char *name, uint16_t stamp) {
+    uint16_t dates[12];
+    for (uint32_t i = 0; i < 12U; i++) {
+        dates[i] = stamp;
+    }
+    GdsInt16s(GDS_BENCH_REC_BGNSTR, dates, 12U);
+    GdsString(GDS_BENCH_REC_STRNAME, name);
+}
+
+// Closed polygon: the last point repeats the first
+static void GdsBoundary(uint16_t layer, const int32_t *xy, uint32_t points) {
+    uint16_t zero = 0;
+    GdsRecord(GDS_BENCH_REC_BOUNDARY, NULL, 0);
+    GdsInt16s(GDS_BENCH_REC_LAYER, &layer, 1U);
+    GdsInt16s(GDS_BENCH_REC_DATATYPE, &zero, 1U);
+    GdsXy(xy, points);
+    GdsRecord(GDS_BENCH_REC_ENDEL, NULL, 0);
+}
+
+static void GdsRectangle(uint16_t layer, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    int32_t xy[10] = { x0, y0, x1, y0, x1, y1, x0, y1, x0, y0 };
+    GdsBoundary(layer, xy, 5U);
+}
+
+// Flush-ended path (the default PATHTYPE)
+static void GdsPath(uint16_t layer, int32_t width, const int32_t *xy, uint32_t points) {
+    uint16_t zero = 0;
+    GdsRecord(GDS_BENCH_REC_PATH, NULL, 0);
+    GdsInt16s(GDS_BENCH_REC_LAYER, &layer, 1U);
+    GdsInt16s(GDS_BENCH_REC_DATATYPE, &zero, 1U);
+    GdsInt32s(GDS_BENCH_REC_WIDTH, &width, 1U);
+    GdsXy(xy, points);
+    GdsRecord(GDS_BENCH_REC_ENDEL, NULL, 0);
+}
+
+static void GdsBeginLibrary(void) {
+    GdsBenchLen = 0;
+    GdsBenchOverflow = false;
+    uint16_t version = 600;
+    uint16_t dates[12] = { 0 };
+    GdsInt16s(GDS_BENCH_REC_HEADER, &version, 1U);
+    GdsInt16s(GDS_BENCH_REC_BGNLIB, dates, 12U);
+    GdsString(GDS_BENCH_REC_LIBNAME, "BENCH.DB");
+}
+
+static bool GdsEndLibrary(const char *path) {
+    GdsRecord(GDS_BENCH_REC_ENDLIB, NULL, 0);
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return false;
+    }
+    bool ok = !GdsBenchOverflow && fwrite(GdsBenchStream, 1, GdsBenchLen, fp) == GdsBenchLen;
+    return (fclose(fp) == 0) && ok;
+}
+
+/**
+ * @brief Writes one layout drop. stamp stands in for the tool's timestamps.
+ *
+ * Neighbouring rectangles of a cell overlap, on layers 1, 2 and 3 in turn,
+ * so the via rule of the extraction joins them into short chains.
+ */
+static bool GdsWriteDrop(const char *path, uint16_t stamp, bool eco) {
+    GdsBeginLibrary();
+
+    char name[GDS_NAME_MAX + 1];
+    for (uint32_t c = 0; c < GDS_BENCH_CELLS; c++) {
+        snprintf(name, sizeof(name), "CELL_%03lu", (unsigned long)c);
+        GdsBeginStructure(name, stamp);
+        for (uint32_t r = 0; r < GDS_BENCH_SHAPES; r++) {
+            int32_t x = (int32_t)(r * 200U + c);
+            int32_t y = (int32_t)((r % 4U) * 100U);
+            if (eco && c == GDS_BENCH_ECO_CELL && r == 0) {
+                y += 50;
+            }
+            GdsRectangle((uint16_t)(1U + r % 3U), x, y, x + 250, y + 140);
+        }
+        GdsRecord(GDS_BENCH_REC_ENDSTR, NULL, 0);
+    }
+
+    GdsBeginStructure("TOP", stamp);
+    for (uint32_t c = 0; c < GDS_BENCH_CELLS; c++) {
+        int32_t origin[2] = { (int32_t)((c % 20U) * 10000U), (int32_t)((c / 20U) * 2000U) };
+        snprintf(name, sizeof(name), "CELL_%03lu", (unsigned long)c);
+        GdsRecord(GDS_BENCH_REC_SREF, NULL, 0);
+        GdsString(GDS_BENCH_REC_SNAME, name);
+        GdsXy(origin, 1U);
+        GdsRecord(GDS_BENCH_REC_ENDEL, NULL, 0);
+    }
+    GdsRecord(GDS_BENCH_REC_ENDSTR, NULL, 0);
+    return GdsEndLibrary(path);
+}
+
+/**
+ * @brief Writes the extraction cell: M1 (1), VIA1 (2) and M2 (3).
+ *
+ * Each bent shape has a separate box inside its bend or notch, which only a
+ * bounding box would reach, so every shape is its own net except the
+ * M1-VIA1-M2 stack: GDS_BENCH_NETS in all.
+ */
+static bool GdsWriteNets(const char *path) {
+    static const int32_t l_shape[] = { 0, 0, 1000, 0, 1000, 200, 200, 200, 200, 1000, 0, 1000, 0, 0 };
+    static const int32_t u_shape[] = { 4000, 0, 5000, 0, 5000, 1000, 4800, 1000, 4800, 200,
+                                       4200, 200, 4200, 1000, 4000, 1000, 4000, 0 };
+    static const int32_t bend[] = { 2000, 0, 3000, 0, 3000, 1000 };
+
+    GdsBeginLibrary();
+    GdsBeginStructure("NETS", 1);
+    GdsBoundary(1, l_shape, 7U);
+    GdsRectangle(1, 400, 400, 800, 800);
+    GdsPath(1, 100, bend, 3U);
+    GdsRectangle(1, 2200, 400, 2600, 800);
+    GdsBoundary(1, u_shape, 9U);
+    GdsRectangle(1, 4400, 400, 4600, 800);
+    GdsRectangle(1, 6000, 0, 6400, 400);
+    GdsRectangle(2, 6100, 100, 6300, 300);
+    GdsRectangle(3, 6000, 0, 6400, 2000);
+    GdsRecord(GDS_BENCH_REC_ENDSTR, NULL, 0);
+    return GdsEndLibrary(path);
+}
+
+static bool GdsLoadTimed(GdsLibrary *lib, const char *gds_path, const char *cache_path, uint32_t *ticks) {
+    uint32_t start = CycleCounter_Read();
+    bool ok = GdsiiReader_Load(lib, gds_path, cache_path);
+    *ticks = CycleCounter_Elapsed(start);
+    return ok;
+}
+
+// Element by element, with offsets replaced by what they point at
+static bool GdsSameStructure(const GdsStructure *a, const GdsStructure *b) {
+    if (strcmp(a->name, b->name) != 0 || a->element_count != b->element_count) {
+        return false;
+    }
+    for (uint32_t i = 0; i < a->element_count; i++) {
+        GdsElement ea = a->elements[i];
+        GdsElement eb = b->elements[i];
+        bool ref = ea.kind == GDS_ELEM_SREF || ea.kind == GDS_ELEM_AREF;
+        if (ref && strcmp(a->names + ea.ref_name, b->names + eb.ref_name) != 0) {
+            return false;
+        }
+        if (ea.point_count > 0 && ea.point_count == eb.point_count &&
+            memcmp(&a->points[ea.point_offset], &b->points[eb.point_offset], ea.point_count * sizeof(GdsPoint)) != 0) {
+            return false;
+        }
+        ea.point_offset = eb.point_offset = 0;
+        ea.ref_name = eb.ref_name = 0;
+        if (memcmp(&ea, &eb, sizeof(ea)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool GdsSameDatabase(const GdsLibrary *a, const GdsLibrary *b) {
+    bool same = a->structure_count == b->structure_count && a->element_total == b->element_total;
+    for (uint32_t s = 0; same && s < a->structure_count; s++) {
+        same = GdsSameStructure(&a->structures[s], &b->structures[s]);
+    }
+    return same;
+}
+
+static int RunGdsBenchmark(void) {
+    const char *dir = getenv("TMPDIR");
+    char gds_path[GDS_BENCH_PATH_MAX];
+    char cache_path[GDS_BENCH_PATH_MAX + 8U];
+    snprintf(gds_path, sizeof(gds_path), "%s/asic_bench_%ld.gds", dir ? dir : "/tmp", (long)getpid());
+    snprintf(cache_path, sizeof(cache_path), "%s.cache", gds_path);
+    remove(cache_path);
+
+    static GdsLibrary cold, warm, eco, reload, parsed;
+    uint32_t cold_ticks = 0, warm_ticks = 0, eco_ticks = 0, reload_ticks = 0;
+    bool ok = GdsWriteDrop(gds_path, 1, false) && GdsLoadTimed(&cold, gds_path, cache_path, &cold_ticks);
+    ok = ok && GdsWriteDrop(gds_path, 2, false) && GdsLoadTimed(&warm, gds_path, cache_path, &warm_ticks);
+    ok = ok && GdsWriteDrop(gds_path, 3, true) && GdsLoadTimed(&eco, gds_path, cache_path, &eco_ticks);
+    ok = ok && GdsLoadTimed(&reload, gds_path, cache_path, &reload_ticks) &&
+         GdsiiReader_Load(&parsed, gds_path, NULL);
+    remove(gds_path);
+    remove(cache_path);
+    if (!ok) {
+        printf("[ERROR] GDSII: cannot write or load %s\n", gds_path);
+        return 1;
+    }
+
+    // Cached loads must rebuild exactly what a parse of the same drop produces
+    bool same = GdsSameDatabase(&cold, &warm) && GdsSameDatabase(&parsed, &eco) &&
+                GdsSameDatabase(&parsed, &reload);
+    bool cheaper = (uint64_t)eco_ticks * 100U < (uint64_t)cold_ticks * GDS_BENCH_ECO_MAX_PERCENT;
+    ok = same && cheaper && cold.structures_cached == 0 && warm.structures_parsed == 0 &&
+         warm.structures_cached == GDS_BENCH_CELLS + 1U && eco.structures_parsed == 1U &&
+         eco.structures_cached == GDS_BENCH_CELLS && reload.structures_parsed == 0;
+    printf("[INFO] GDSII: %lu cells, %lu elements, %lu bytes of stream\n",
+           (unsigned long)cold.structure_count, (unsigned long)cold.element_total, (unsigned long)GdsBenchLen);
+    printf("[INFO] GDSII: cold load %lu ticks (%lu parsed), re-stamped drop %lu ticks (%lu cached), "
+           "ECO drop %lu ticks (%lu parsed)\n",
+           (unsigned long)cold_ticks, (unsigned long)cold.structures_parsed, (unsigned long)warm_ticks,
+           (unsigned long)warm.structures_cached, (unsigned long)eco_ticks, (unsigned long)eco.structures_parsed);
+    printf("[INFO] GDSII: ECO drop %lu%% of the cold load (limit %lu%%), reloaded from the cache %lu ticks\n",
+           (unsigned long)((uint64_t)eco_ticks * 100U / (cold_ticks ? cold_ticks : 1U)),
+           (unsigned long)GDS_BENCH_ECO_MAX_PERCENT, (unsigned long)reload_ticks);
+    printf("[INFO] GDSII: cached databases %s the parsed ones\n", same ? "match" : "DIFFER FROM");
+
+    // The same drop on one thread and on the most the extractor allows:
+    // net ids are renumbered in shape order, so they must match exactly
+    static const ConnectivityViaRule stack[] = { { 1, 2, 3 } };
+    ConnectivityConfig serial = { stack, 1U, 1U };
+    ConnectivityConfig threaded = { stack, 1U, CONNECTIVITY_MAX_THREADS };
+    LayoutNetlist one = { 0 };
+    LayoutNetlist many = { 0 };
+    uint32_t start = CycleCounter_Read();
+    bool extracted = ConnectivityExtractor_Run(&eco, "TOP", &serial, &one);
+    uint32_t serial_ticks = CycleCounter_Elapsed(start);
+    start = CycleCounter_Read();
+    extracted = ConnectivityExtractor_Run(&eco, "TOP", &threaded, &many) && extracted;
+    uint32_t threaded_ticks = CycleCounter_Elapsed(start);
+    bool same_nets = extracted && one.shape_count == many.shape_count && one.net_count == many.net_count &&
+                     memcmp(one.net_ids, many.net_ids, (size_t)one.shape_count * sizeof(uint32_t)) == 0;
+    ok = ok && same_nets && one.shape_count == GDS_BENCH_CELLS * GDS_BENCH_SHAPES && one.net_count < one.shape_count;
+    printf("[INFO] CONNECTIVITY: drop %lu shapes in %lu nets, 1 thread %lu ticks, %lu threads %lu ticks, net ids %s\n",
+           (unsigned long)one.shape_count, (unsigned long)one.net_count, (unsigned long)serial_ticks,
+           (unsigned long)CONNECTIVITY_MAX_THREADS, (unsigned long)threaded_ticks, same_nets ? "match" : "DIFFER");
+    ConnectivityExtractor_Free(&one);
+    ConnectivityExtractor_Free(&many);
+
+    GdsiiReader_Free(&cold);
+    GdsiiReader_Free(&warm);
+    GdsiiReader_Free(&eco);
+    GdsiiReader_Free(&reload);
+    GdsiiReader_Free(&parsed);
+
+    LayoutNetlist netlist = { 0 };
+    GdsLibrary lib;
+    extracted = GdsWriteNets(gds_path) && GdsiiReader_Load(&lib, gds_path, NULL);
+    remove(gds_path);
+    if (extracted) {
+        extracted = ConnectivityExtractor_Run(&lib, "NETS", &serial, &netlist);
+        GdsiiReader_Free(&lib);
+    }
+    ok = extracted && netlist.net_count == GDS_BENCH_NETS && ok;
+    printf("[INFO] CONNECTIVITY: %lu shapes in %lu nets (expected %lu)\n", (unsigned long)netlist.shape_count,
+           (unsigned long)netlist.net_count, (unsigned long)GDS_BENCH_NETS);
+    ConnectivityExtractor_Free(&netlist);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    uint32_t iterations = BENCH_DEFAULT_ITERATIONS;
+    const char *trace_out = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--trace-out") == 0 && i + 1 < argc) {
+            trace_out = argv[++i];
+        }
+    }
+    int status = RunMlBenchmark(iterations);
+    status |= RunAnomalyFeatureBenchmark();
+    status |= RunConstraintBenchmark();
+    status |= RunViolationStormBenchmark();
+    status |= RunFaultLogBenchmark();
+    status |= RunSecureTraceBenchmark(trace_out);
+    status |= RunTamperBenchmark();
+    status |= RunZeroizeBenchmark();
+    status |= RunPrecomputeBenchmark();
+    status |= RunBatchVerifyBenchmark();
+    status |= RunCertChainBenchmark();
+    status |= RunPqcBenchmark();
+    status |= RunLmsBenchmark();
+    status |= RunPlacementBenchmark();
+    status |= RunSweeperBenchmark();
+    status |= RunGdsBenchmark();
+    return status;
+}
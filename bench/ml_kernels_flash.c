@@ -0,0 +1,18 @@
+/**
+ * @file ml_kernels_flash.c
+ * @brief Second copy of the int8 kernels, left in flash, for the RAMFUNC comparison.
+ *
+ * ml/ml_kernels.c is compiled again here with RAMFUNC disabled and every
+ * public symbol renamed to MlKernelFlash_*. On target the bench can then
+ * time the same code from flash and from RAM side by side. On the host both
+ * copies run from the same memory and should time the same.
+ */
+
+#define ASIC_RAMFUNC_DISABLE
+#define MlKernel_BackendName        MlKernelFlash_BackendName
+#define MlKernel_DotS8              MlKernelFlash_DotS8
+#define MlKernel_Requantize         MlKernelFlash_Requantize
+#define MlKernel_FullyConnected     MlKernelFlash_FullyConnected
+#define MlKernel_Conv2d             MlKernelFlash_Conv2d
+
+#include "../ml/ml_kernels.c"
@@ -0,0 +1,23 @@
+/**
+ * @file pq_ntt_dsp.c
+ * @brief Second copy of the NTT transforms, built for the Cortex-M4 DSP path.
+ *
+ * crypto/pq_ntt.c is compiled again here as if for a core with the DSP and
+ * SIMD32 extensions, against the host ACLE stand-in in bench/acle, and
+ * every public symbol is renamed to PqNttDsp_*. There is no Arm compiler in
+ * the host build, so this is what keeps the DSP path compiling, and the
+ * bench checks its results against the host backend.
+ */
+
+#define __ARM_FEATURE_DSP           1
+#define __ARM_FEATURE_SIMD32        1
+#define PqKem_Ntt                   PqNttDsp_KemNtt
+#define PqKem_InvNtt                PqNttDsp_KemInvNtt
+#define PqKem_BaseMul               PqNttDsp_KemBaseMul
+#define PqKem_BaseMulAcc            PqNttDsp_KemBaseMulAcc
+#define PqDsa_Ntt                   PqNttDsp_DsaNtt
+#define PqDsa_InvNtt                PqNttDsp_DsaInvNtt
+#define PqDsa_PointwiseMul          PqNttDsp_DsaPointwiseMul
+#define PqNtt_BackendName           PqNttDsp_BackendName
+
+#include "../crypto/pq_ntt.c"
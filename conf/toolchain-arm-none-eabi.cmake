@@ -0,0 +1,20 @@
+# Toolchain file for cross-compiling the firmware with GNU Arm Embedded
+#   cmake -S . -B build/target -DCMAKE_TOOLCHAIN_FILE=conf/toolchain-arm-none-eabi.cmake
+# Without it the firmware variants build for the host, which is useful for
+# compile checks and for running modules against the host simulators.
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(TOOLCHAIN_PREFIX arm-none-eabi-)  # config.json build_config_defaults.toolchain_prefix
+set(CMAKE_C_COMPILER ${TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_ASM_COMPILER ${TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_OBJCOPY ${TOOLCHAIN_PREFIX}objcopy)
+set(CMAKE_SIZE ${TOOLCHAIN_PREFIX}size)
+
+# Bare metal: compiler checks cannot link an executable
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,16 @@
+/**
+ * @file asic_variant.c
+ * @brief Definitions of the per-variant constants, compiled into each variant.
+ */
+
+#include "asic_variant.h"
+
+#if !defined(ASIC_ID) || !defined(ASIC_SYSTEM_CLOCK_HZ) || \
+    !defined(ASIC_RAM_SIZE_BYTES) || !defined(ASIC_FLASH_SIZE_BYTES)
+#error "asic_variant.c must be built as part of a firmware variant"
+#endif
+
+const char AsicVariant_Id[] = ASIC_ID;
+const uint32_t AsicVariant_SystemClockHz = ASIC_SYSTEM_CLOCK_HZ;
+const uint32_t AsicVariant_RamSizeBytes = ASIC_RAM_SIZE_BYTES;
+const uint32_t AsicVariant_FlashSizeBytes = ASIC_FLASH_SIZE_BYTES;
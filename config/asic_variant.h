@@ -0,0 +1,22 @@
+/**
+ * @file asic_variant.h
+ * @brief Per-variant constants visible to code that is compiled once.
+ *
+ * Each firmware variant is built with its own ASIC_* compile definitions
+ * (see tools/gen_variants.py), but shared object libraries are compiled
+ * without them so every variant can link the same objects. Shared code that
+ * needs a variant value reads it from these constants instead, which
+ * asic_variant.c defines once per variant image.
+ */
+
+#ifndef ASIC_VARIANT_H
+#define ASIC_VARIANT_H
+
+#include <stdint.h>
+
+extern const char     AsicVariant_Id[];
+extern const uint32_t AsicVariant_SystemClockHz;
+extern const uint32_t AsicVariant_RamSizeBytes;
+extern const uint32_t AsicVariant_FlashSizeBytes;
+
+#endif // ASIC_VARIANT_H
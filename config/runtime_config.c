@@ -0,0 +1,159 @@
+/**
+ * @file runtime_config.c
+ * @brief Implementation of the in-place runtime configuration loader.
+ */
+
+#include "runtime_config.h"
+#include "crc32.h"
+
+#define LOG_MODULE  LOG_MODULE_RUNTIME_CONFIG
+#include "log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// --- Private Variables ---
+static const RuntimeConfigImage DefaultImage = RUNTIME_CONFIG_DEFAULT_IMAGE;
+
+// Readers may run in interrupts; the pointer is swapped with one word store
+static const RuntimeConfigImage *volatile ActiveImage = &DefaultImage;
+static uint32_t ActiveSector;       // 0 while running on defaults
+static uint32_t ActiveSequence;
+static uint32_t StagingSector;      // 0 when no update is in progress
+static uint32_t Generation;
+static uint32_t SectionVersions[RUNTIME_CONFIG_SECTION_COUNT];
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] RUNTIME_CONFIG: %s\n", level, message);
+}
+
+static bool ImageValid(const RuntimeConfigImage *image) {
+    const RuntimeConfigHeader *h = &image->header;
+    if (h->magic != RUNTIME_CONFIG_MAGIC ||
+        h->layout_version != RUNTIME_CONFIG_LAYOUT_VERSION ||
+        h->section_count != RUNTIME_CONFIG_SECTION_COUNT ||
+        h->image_bytes != sizeof(RuntimeConfigImage)) {
+        return false;
+    }
+    const uint8_t *body = (const uint8_t *)image + sizeof(RuntimeConfigHeader);
+    return Crc32_Update(CRC32_INIT, body, sizeof(RuntimeConfigImage) - sizeof(RuntimeConfigHeader)) ==
+           h->image_crc;
+}
+
+static bool SectorValid(uint32_t sector, uint32_t *sequence) {
+    const RuntimeConfigCommit *commit = Flash_Map(sector + RUNTIME_CONFIG_COMMIT_OFFSET);
+    if (commit == NULL || commit->commit != RUNTIME_CONFIG_COMMIT) {
+        return false;
+    }
+    if (!ImageValid((const RuntimeConfigImage *)Flash_Map(sector))) {
+        return false;
+    }
+    *sequence = commit->sequence;
+    return true;
+}
+
+static void Activate(uint32_t sector, uint32_t sequence) {
+    const RuntimeConfigImage *next = (const RuntimeConfigImage *)Flash_Map(sector);
+    const RuntimeConfigImage *prev = ActiveImage;
+    for (uint32_t i = 0; i < RUNTIME_CONFIG_SECTION_COUNT; i++) {
+        if (next->section_crc[i] != prev->section_crc[i]) {
+            SectionVersions[i]++;
+        }
+    }
+    ActiveSector = sector;
+    ActiveSequence = sequence;
+    ActiveImage = next;
+    Generation++;
+}
+
+// --- Public Function Implementations ---
+
+bool RuntimeConfig_Init(void) {
+    ActiveImage = &DefaultImage;
+    ActiveSector = 0;
+    ActiveSequence = 0;
+    StagingSector = 0;
+    Generation = 1;
+    for (uint32_t i = 0; i < RUNTIME_CONFIG_SECTION_COUNT; i++) {
+        SectionVersions[i] = 1;
+    }
+
+    uint32_t seq_a = 0;
+    uint32_t seq_b = 0;
+    bool valid_a = SectorValid(RUNTIME_CONFIG_SECTOR_A, &seq_a);
+    bool valid_b = SectorValid(RUNTIME_CONFIG_SECTOR_B, &seq_b);
+    if (!valid_a && !valid_b) {
+        LOG_WARN("No valid configuration sector, using build defaults.");
+        return false;
+    }
+
+    // Sequence numbers compare modulo 2^32 so they never run out
+    bool use_b = valid_b && (!valid_a || (int32_t)(seq_b - seq_a) > 0);
+    ActiveSector = use_b ? RUNTIME_CONFIG_SECTOR_B : RUNTIME_CONFIG_SECTOR_A;
+    ActiveSequence = use_b ? seq_b : seq_a;
+    ActiveImage = (const RuntimeConfigImage *)Flash_Map(ActiveSector);
+    return true;
+}
+
+const RuntimeConfigImage *RuntimeConfig_Get(void) {
+    return ActiveImage;
+}
+
+uint32_t RuntimeConfig_Generation(void) {
+    return Generation;
+}
+
+bool RuntimeConfig_SectionChanged(uint32_t section, uint32_t *seen_version) {
+    if (section >= RUNTIME_CONFIG_SECTION_COUNT || *seen_version == SectionVersions[section]) {
+        return false;
+    }
+    *seen_version = SectionVersions[section];
+    return true;
+}
+
+bool RuntimeConfig_StageBegin(void) {
+    uint32_t target = (ActiveSector == RUNTIME_CONFIG_SECTOR_A) ? RUNTIME_CONFIG_SECTOR_B
+                                                                : RUNTIME_CONFIG_SECTOR_A;
+    StagingSector = 0;
+    if (!Flash_EraseSector(target)) {
+        LOG_ERROR("Failed to erase staging sector.");
+        return false;
+    }
+    StagingSector = target;
+    return true;
+}
+
+bool RuntimeConfig_StageWrite(uint32_t offset, const void *data, uint32_t len) {
+    if (StagingSector == 0 || offset > RUNTIME_CONFIG_COMMIT_OFFSET ||
+        len > RUNTIME_CONFIG_COMMIT_OFFSET - offset) {
+        return false;
+    }
+    return Flash_Program(StagingSector + offset, data, len);
+}
+
+bool RuntimeConfig_StageCommit(void) {
+    uint32_t sector = StagingSector;
+    if (sector == 0) {
+        return false;
+    }
+    StagingSector = 0;
+
+    if (!ImageValid((const RuntimeConfigImage *)Flash_Map(sector))) {
+        LOG_ERROR("Staged configuration image is invalid; keeping current one.");
+        return false;
+    }
+
+    RuntimeConfigCommit commit = { .sequence = ActiveSequence + 1, .commit = RUNTIME_CONFIG_COMMIT };
+    uint32_t sequence = 0;
+    if (!Flash_Program(sector + RUNTIME_CONFIG_COMMIT_OFFSET, &commit, sizeof(commit)) ||
+        !SectorValid(sector, &sequence) || sequence != commit.sequence) {
+        LOG_ERROR("Failed to commit staged configuration.");
+        return false;
+    }
+
+    Activate(sector, sequence);
+    LOG_INFO("New configuration active.");
+    return true;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file runtime_config.h
+ * @brief Runtime configuration read in place from flash, with hot reload.
+ *
+ * The image built from config/config.json by tools/gen_config_image.py
+ * lives in one of two dedicated flash sectors. At boot the newest committed
+ * valid sector is selected, and consumers read its structs directly through
+ * the returned pointer. Nothing is copied to RAM. If neither sector is
+ * valid, the compiled-in defaults are used.
+ *
+ * An update is staged into the inactive sector: StageBegin erases it,
+ * StageWrite programs the image in chunks, and StageCommit verifies the
+ * image and then programs a sequence number and commit word at the end of
+ * the sector. The commit word is the last thing written. Until it lands,
+ * the old sector stays authoritative, so a power loss at any point leaves
+ * one complete image. After the commit, the active pointer is switched
+ * with a single word store.
+ *
+ * Consumers poll for changes:
+ *
+ *     static uint32_t seen_debug;
+ *     if (RuntimeConfig_SectionChanged(RUNTIME_CONFIG_SECTION_DEBUG, &seen_debug)) {
+ *         ApplyLogLevel(RuntimeConfig_Get()->debug.default_log_level);
+ *     }
+ *
+ * A section's version counter moves only when that section's contents
+ * change, so reapplying the same values is skipped. A pointer returned by
+ * RuntimeConfig_Get() stays valid until the next StageBegin.
+ */
+
+#ifndef RUNTIME_CONFIG_H
+#define RUNTIME_CONFIG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "flash.h"
+#include "runtime_config_layout.h"
+
+// --- Flash Placement: the last two sectors ---
+#define RUNTIME_CONFIG_SECTOR_A     (FLASH_BASE_ADDR + FLASH_SIZE_BYTES - 2 * FLASH_SECTOR_BYTES)
+#define RUNTIME_CONFIG_SECTOR_B     (FLASH_BASE_ADDR + FLASH_SIZE_BYTES - 1 * FLASH_SECTOR_BYTES)
+
+/**
+ * @brief Written at the end of a sector once its image is complete.
+ */
+typedef struct {
+    uint32_t sequence;          // Higher (mod 2^32) wins between the two sectors
+    uint32_t commit;            // RUNTIME_CONFIG_COMMIT
+} RuntimeConfigCommit;
+
+#define RUNTIME_CONFIG_COMMIT_OFFSET (FLASH_SECTOR_BYTES - sizeof(RuntimeConfigCommit))
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Selects the newest valid sector.
+ *
+ * @return True if a flash image was found, false if running on defaults.
+ */
+bool RuntimeConfig_Init(void);
+
+/**
+ * @brief The active configuration, never NULL.
+ */
+const RuntimeConfigImage *RuntimeConfig_Get(void);
+
+/**
+ * @brief Incremented every time a new image becomes active.
+ */
+uint32_t RuntimeConfig_Generation(void);
+
+/**
+ * @brief Checks whether a section changed since the caller last looked.
+ *
+ * @param section      One of RUNTIME_CONFIG_SECTION_*.
+ * @param seen_version Caller-owned; start at 0. Updated when a change is reported.
+ * @return True if the section changed (always true on the first call).
+ */
+bool RuntimeConfig_SectionChanged(uint32_t section, uint32_t *seen_version);
+
+/**
+ * @brief Erases the inactive sector to receive a new image.
+ */
+bool RuntimeConfig_StageBegin(void);
+
+/**
+ * @brief Programs part of the new image at offset within the image.
+ */
+bool RuntimeConfig_StageWrite(uint32_t offset, const void *data, uint32_t len);
+
+/**
+ * @brief Verifies the staged image, commits it and makes it active.
+ *
+ * @return False if the image is invalid or flash programming failed; the
+ *         current configuration stays active in that case.
+ */
+bool RuntimeConfig_StageCommit(void);
+
+#endif // RUNTIME_CONFIG_H
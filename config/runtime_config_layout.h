@@ -0,0 +1,118 @@
+/**
+ * @file runtime_config_layout.h
+ * @brief Binary layout of the runtime configuration image.
+ *
+ * GENERATED by tools/gen_config_image.py from config/config.json. Do not edit.
+ */
+
+#ifndef RUNTIME_CONFIG_LAYOUT_H
+#define RUNTIME_CONFIG_LAYOUT_H
+
+#include <stdint.h>
+
+#define RUNTIME_CONFIG_MAGIC            0x47464341UL
+#define RUNTIME_CONFIG_COMMIT           0x544D4F43UL
+#define RUNTIME_CONFIG_LAYOUT_VERSION   0xA419
+#define RUNTIME_CONFIG_SECTION_COUNT    4
+
+// --- Section Identifiers ---
+#define RUNTIME_CONFIG_SECTION_CLOCK             0
+#define RUNTIME_CONFIG_SECTION_DEBUG             1
+#define RUNTIME_CONFIG_SECTION_POWER             2
+#define RUNTIME_CONFIG_SECTION_PERIPHERAL        3
+
+// --- Encoded Values ---
+#define RUNTIME_CONFIG_LOG_LEVEL_DEBUG           0
+#define RUNTIME_CONFIG_LOG_LEVEL_INFO            1
+#define RUNTIME_CONFIG_LOG_LEVEL_WARN            2
+#define RUNTIME_CONFIG_LOG_LEVEL_ERROR           3
+#define RUNTIME_CONFIG_LOG_LEVEL_FATAL           4
+#define RUNTIME_CONFIG_OSC_HSE                   0
+#define RUNTIME_CONFIG_OSC_HSI                   1
+#define RUNTIME_CONFIG_OSC_PLL                   2
+#define RUNTIME_CONFIG_SLEEP_NONE                0
+#define RUNTIME_CONFIG_SLEEP_SLEEP               1
+#define RUNTIME_CONFIG_SLEEP_DEEP_SLEEP          2
+#define RUNTIME_CONFIG_PULL_NONE                 0
+#define RUNTIME_CONFIG_PULL_UP                   1
+#define RUNTIME_CONFIG_PULL_DOWN                 2
+#define RUNTIME_CONFIG_FLOW_NONE                 0
+#define RUNTIME_CONFIG_FLOW_RTS_CTS              1
+#define RUNTIME_CONFIG_SPI_MODE0                 0
+#define RUNTIME_CONFIG_SPI_MODE1                 1
+#define RUNTIME_CONFIG_SPI_MODE2                 2
+#define RUNTIME_CONFIG_SPI_MODE3                 3
+#define RUNTIME_CONFIG_WAKEUP_GPIO_WKUP          (1UL << 0)
+#define RUNTIME_CONFIG_WAKEUP_TIMER_WKUP         (1UL << 1)
+#define RUNTIME_CONFIG_WAKEUP_UART_WKUP          (1UL << 2)
+#define RUNTIME_CONFIG_WAKEUP_RTC_WKUP           (1UL << 3)
+
+// --- Sections ---
+
+// config.json "clock_settings"
+typedef struct {
+    uint32_t  system_clock_hz;
+    uint8_t   pll_multiplier;
+    uint8_t   pll_divider;
+    uint8_t   oscillator_type;
+    uint8_t   reserved[1];
+} RuntimeConfigClock;
+
+// config.json "debug_settings"
+typedef struct {
+    uint32_t  uart_debug_baud_rate;
+    uint8_t   default_log_level;
+    uint8_t   jtag_swd_enabled;
+    uint8_t   halt_on_startup;
+    uint8_t   reserved[1];
+} RuntimeConfigDebug;
+
+// config.json "power_management_defaults"
+typedef struct {
+    uint32_t  wakeup_sources;
+    uint8_t   default_sleep_mode;
+    uint8_t   reserved[3];
+} RuntimeConfigPower;
+
+// config.json "peripheral_defaults"
+typedef struct {
+    uint16_t  i2c_speed_default_khz;
+    uint8_t   gpio_pull_up_down_default;
+    uint8_t   uart_flow_control_default;
+    uint8_t   spi_mode_default;
+    uint8_t   reserved[3];
+} RuntimeConfigPeripheral;
+
+// --- Image ---
+
+typedef struct {
+    uint32_t magic;             // RUNTIME_CONFIG_MAGIC
+    uint16_t layout_version;    // RUNTIME_CONFIG_LAYOUT_VERSION
+    uint16_t section_count;
+    uint32_t image_bytes;       // sizeof(RuntimeConfigImage)
+    uint32_t image_crc;         // CRC-32 of everything after this header
+} RuntimeConfigHeader;
+
+typedef struct {
+    RuntimeConfigHeader header;
+    uint32_t section_crc[RUNTIME_CONFIG_SECTION_COUNT];   // For change detection
+    RuntimeConfigClock clock;
+    RuntimeConfigDebug debug;
+    RuntimeConfigPower power;
+    RuntimeConfigPeripheral peripheral;
+} RuntimeConfigImage;
+
+_Static_assert(sizeof(RuntimeConfigImage) == 64, "layout differs from the image packer");
+
+// --- Defaults (config.json at build time) ---
+
+#define RUNTIME_CONFIG_DEFAULT_IMAGE { \
+    .header = { 0x47464341UL, 0xA419, 4, 64, 0x4888D707UL }, \
+    .section_crc = { 0xA9CE69F6UL, 0x4C828F3CUL, 0x41A41001UL, 0x31837128UL }, \
+    .clock = { .system_clock_hz = 120000000, .pll_multiplier = 5, .pll_divider = 2, .oscillator_type = 0 }, \
+    .debug = { .uart_debug_baud_rate = 115200, .default_log_level = 1, .jtag_swd_enabled = 1, .halt_on_startup = 0 }, \
+    .power = { .wakeup_sources = 3, .default_sleep_mode = 2 }, \
+    .peripheral = { .i2c_speed_default_khz = 100, .gpio_pull_up_down_default = 0, .uart_flow_control_default = 0, .spi_mode_default = 0 }, \
+}
+
+#endif // RUNTIME_CONFIG_LAYOUT_H
@@ -0,0 +1,174 @@
+/**
+ * @file constraint_sweeper.c
+ * @brief Implementation of the time-sliced health-check scheduler.
+ */
+
+#include "constraint_sweeper.h"
+#include "constraints.h"
+#include "cycle_counter.h"
+
+#define LOG_MODULE  LOG_MODULE_SWEEPER
+#include "log.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] SWEEPER: %s\n", level, message);
+}
+
+static bool CheckResource(void *ctx) {
+    return ConstraintsManager_CheckCriticalResource((uint32_t)(uintptr_t)ctx);
+}
+
+static bool IsDue(const ConstraintSweepEntry *e, uint32_t now) {
+    return e->runs == 0 || (int32_t)(now - e->next_due) >= 0;
+}
+
+static void Adapt(ConstraintSweepEntry *e, bool healthy) {
+    uint32_t shortest = e->base_period >> CONSTRAINT_SWEEP_FAIL_SHIFT;
+    uint32_t longest = e->base_period << CONSTRAINT_SWEEP_MAX_BACKOFF_SHIFT;
+
+    if (!healthy) {
+        e->failures++;
+        e->passes_in_row = 0;
+        e->period = shortest ? shortest : 1;
+        if (!e->failing && LOG_ENABLED(LOG_LEVEL_WARN)) {
+            char msg[96];
+            snprintf(msg, sizeof(msg), "%s failing, checking every %lu ticks.", e->name,
+                     (unsigned long)e->period);
+            LogHandler("WARN", msg);
+        }
+        e->failing = true;
+        return;
+    }
+
+    e->failing = false;
+    if (++e->passes_in_row >= CONSTRAINT_SWEEP_BACKOFF_AFTER && e->period < longest) {
+        e->period = (e->period > longest / 2) ? longest : e->period * 2;
+        e->passes_in_row = 0;
+    }
+}
+
+static void RunEntry(ConstraintSweepEntry *e, uint32_t now, uint32_t *spent) {
+    uint32_t start = CycleCounter_Read();
+    bool healthy = e->check(e->ctx);
+    uint32_t cost = CycleCounter_Elapsed(start);
+
+    *spent += cost;
+    if (e->runs == 0) {
+        e->cost_cycles = cost;
+    } else {
+        int32_t delta = (int32_t)(cost - e->cost_cycles);
+        e->cost_cycles = (uint32_t)((int32_t)e->cost_cycles + delta / (1 << CONSTRAINT_SWEEP_COST_SHIFT));
+    }
+    e->runs++;
+
+    Adapt(e, healthy);
+    e->next_due = now + e->period;
+}
+
+// --- Public Function Implementations ---
+
+bool ConstraintSweeper_Init(ConstraintSweeper *sw, uint32_t budget_cycles) {
+    if (sw == NULL || budget_cycles == 0) {
+        return false;
+    }
+    memset(sw, 0, sizeof(*sw));
+    sw->budget_cycles = budget_cycles;
+    return true;
+}
+
+bool ConstraintSweeper_Register(ConstraintSweeper *sw, const char *name, ConstraintSweepCheck check,
+                                void *ctx, uint32_t period_ticks) {
+    if (sw == NULL || check == NULL || period_ticks == 0 ||
+        period_ticks > (INT32_MAX >> CONSTRAINT_SWEEP_MAX_BACKOFF_SHIFT)) {
+        return false;
+    }
+    if (sw->count >= CONSTRAINT_SWEEP_MAX_CHECKS) {
+        LOG_ERROR("Check table full.");
+        return false;
+    }
+    ConstraintSweepEntry *e = &sw->entries[sw->count++];
+    memset(e, 0, sizeof(*e));
+    e->name = name;
+    e->check = check;
+    e->ctx = ctx;
+    e->base_period = period_ticks;
+    e->period = period_ticks;
+    return true;
+}
+
+bool ConstraintSweeper_RegisterResource(ConstraintSweeper *sw, uint32_t resource_id, uint32_t period_ticks) {
+    const char *name = "resource";
+    switch (resource_id) {
+        case CONSTRAINT_ID_SENSOR_TIMEOUT:
+            name = "sensor";
+            break;
+        case CONSTRAINT_ID_COMM_BUFFER_FULL:
+            name = "comm buffer";
+            break;
+        default:
+            break;
+    }
+    return ConstraintSweeper_Register(sw, name, CheckResource, (void *)(uintptr_t)resource_id, period_ticks);
+}
+
+uint32_t ConstraintSweeper_Run(ConstraintSweeper *sw, uint32_t now) {
+    uint32_t spent = 0;
+    uint32_t ran = 0;
+    uint32_t deferred = 0;
+    uint32_t resume = sw->count;    // First deferred entry, if any
+
+    for (uint32_t n = 0; n < sw->count; n++) {
+        uint32_t index = (sw->cursor + n) % sw->count;
+        ConstraintSweepEntry *e = &sw->entries[index];
+        if (!IsDue(e, now)) {
+            continue;
+        }
+        if (ran > 0 && e->cost_cycles > sw->budget_cycles - spent) {
+            if (resume == sw->count) {
+                resume = index;
+            }
+            deferred++;
+            continue;
+        }
+        RunEntry(e, now, &spent);
+        ran++;
+        if (spent >= sw->budget_cycles) {
+            // Everything not yet visited waits for the next pass
+            for (uint32_t m = n + 1; m < sw->count; m++) {
+                uint32_t rest = (sw->cursor + m) % sw->count;
+                if (IsDue(&sw->entries[rest], now)) {
+                    if (resume == sw->count) {
+                        resume = rest;
+                    }
+                    deferred++;
+                }
+            }
+            break;
+        }
+    }
+    if (resume != sw->count) {
+        sw->cursor = resume;
+    }
+
+    ConstraintSweepStats *st = &sw->stats;
+    st->passes++;
+    st->checks_run += ran;
+    st->checks_deferred += deferred;
+    st->last_pass_cycles = spent;
+    if (spent > st->max_pass_cycles) {
+        st->max_pass_cycles = spent;
+    }
+    sw->cycles_total += spent;
+    st->budget_permille = (uint32_t)((sw->cycles_total * 1000U) / ((uint64_t)st->passes * sw->budget_cycles));
+    return ran;
+}
+
+const ConstraintSweepStats *ConstraintSweeper_Stats(const ConstraintSweeper *sw) {
+    return &sw->stats;
+}
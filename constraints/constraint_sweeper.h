@@ -0,0 +1,124 @@
+/**
+ * @file constraint_sweeper.h
+ * @brief Time-sliced scheduler for periodic health checks.
+ *
+ * Health checks (ConstraintsManager_CheckCriticalResource and any other
+ * bool-returning check) are registered once, each with its own period.
+ * The superloop calls ConstraintSweeper_Run() every pass. The sweeper runs
+ * the checks that are due, within a cycle budget for the pass, and leaves
+ * the rest due for the next pass.
+ *
+ * Scheduling:
+ *  - Due checks are visited round-robin, starting at the first check that
+ *    was deferred last pass, so an expensive check cannot starve the others.
+ *  - A check runs only if its estimated cost (an EWMA of measured cycles)
+ *    fits in what is left of the budget. The first due check of a pass
+ *    always runs, so the sweep makes progress even under a tiny budget.
+ *  - After a failure, a check's period drops to base / 2^FAIL_SHIFT, so
+ *    a failing resource is watched closely. After
+ *    CONSTRAINT_SWEEP_BACKOFF_AFTER consecutive passes, the period doubles,
+ *    up to base * 2^MAX_BACKOFF_SHIFT.
+ *
+ * Timestamps are CycleCounter ticks and must not go backwards. Periods must
+ * stay below 2^31 ticks, including the maximum backoff.
+ *
+ *     static ConstraintSweeper sweeper;
+ *     ConstraintSweeper_Init(&sweeper, 2000);               // 2000 cycles per pass
+ *     ConstraintSweeper_RegisterResource(&sweeper, CONSTRAINT_ID_SENSOR_TIMEOUT, 1200000);
+ *     while (true) {
+ *         ConstraintSweeper_Run(&sweeper, CycleCounter_Read());
+ *         ...
+ *     }
+ */
+
+#ifndef CONSTRAINT_SWEEPER_H
+#define CONSTRAINT_SWEEPER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Sizing and Adaptation ---
+#define CONSTRAINT_SWEEP_MAX_CHECKS         16
+#define CONSTRAINT_SWEEP_FAIL_SHIFT         2   // Period after a failure: base / 4
+#define CONSTRAINT_SWEEP_MAX_BACKOFF_SHIFT  3   // Longest period: base * 8
+#define CONSTRAINT_SWEEP_BACKOFF_AFTER      4   // Consecutive passes before the period doubles
+#define CONSTRAINT_SWEEP_COST_SHIFT         2   // Cost EWMA weight 1/4
+
+// --- Public Types ---
+
+/**
+ * @brief A health check.
+ *
+ * @param ctx Context given at registration.
+ * @return True if healthy. A failing check reports its own violation.
+ */
+typedef bool (*ConstraintSweepCheck)(void *ctx);
+
+typedef struct {
+    const char          *name;
+    ConstraintSweepCheck check;
+    void                *ctx;
+    uint32_t             base_period;
+    uint32_t             period;         // Current, adapted
+    uint32_t             next_due;
+    uint32_t             cost_cycles;    // EWMA of measured cost, 0 until first run
+    uint32_t             runs;
+    uint32_t             failures;
+    uint8_t              passes_in_row;
+    bool                 failing;        // Last result
+} ConstraintSweepEntry;
+
+typedef struct {
+    uint32_t passes;
+    uint32_t checks_run;
+    uint32_t checks_deferred;   // Due but left for a later pass by the budget
+    uint32_t last_pass_cycles;
+    uint32_t max_pass_cycles;
+    uint32_t budget_permille;   // Mean share of the pass budget spent checking
+} ConstraintSweepStats;
+
+typedef struct {
+    ConstraintSweepEntry entries[CONSTRAINT_SWEEP_MAX_CHECKS];
+    uint32_t             count;
+    uint32_t             cursor;         // Round-robin start for the next pass
+    uint32_t             budget_cycles;
+    uint64_t             cycles_total;
+    ConstraintSweepStats stats;
+} ConstraintSweeper;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Empties the schedule.
+ *
+ * @param budget_cycles Cycles a pass may spend running checks.
+ */
+bool ConstraintSweeper_Init(ConstraintSweeper *sw, uint32_t budget_cycles);
+
+/**
+ * @brief Adds a check. It is first due on the next Run.
+ *
+ * @param period_ticks Period while healthy, before any backoff.
+ * @return False if the table is full or the period is out of range.
+ */
+bool ConstraintSweeper_Register(ConstraintSweeper *sw, const char *name, ConstraintSweepCheck check,
+                                void *ctx, uint32_t period_ticks);
+
+/**
+ * @brief Registers ConstraintsManager_CheckCriticalResource(resource_id).
+ */
+bool ConstraintSweeper_RegisterResource(ConstraintSweeper *sw, uint32_t resource_id, uint32_t period_ticks);
+
+/**
+ * @brief Runs the checks that are due and fit the budget.
+ *
+ * @return Number of checks run.
+ */
+uint32_t ConstraintSweeper_Run(ConstraintSweeper *sw, uint32_t now);
+
+/**
+ * @brief Scheduling and budget statistics since Init.
+ */
+const ConstraintSweepStats *ConstraintSweeper_Stats(const ConstraintSweeper *sw);
+
+#endif // CONSTRAINT_SWEEPER_H
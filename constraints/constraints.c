@@ -9,19 +9,62 @@
  */
 
 #include "constraints.h"
+#include "cycle_counter.h"
+#include "fault_log.h"
+#include "secure_trace.h"
+#include "tamper_monitor.h"
+#include <stdarg.h>
 #include <stdio.h> // For printf-style logging (adapt for actual embedded logging)
+#include <string.h>
+
+#define LOG_MODULE  LOG_MODULE_CONSTRAINTS
+#include "log.h"
 // Potentially include a header generated from common_config.json if applicable
 // For demonstration, we'll use some placeholder constants.
 
 // --- Private Defines and Constants (Example values for demonstration) ---
-// In a real system, these might come from a generated header based on config.json
+// The RAM range comes from the variant build (tools/gen_variants.py), which
+// layers the ASIC profile over config.json.
 #define SYS_CLK_MIN_HZ              (80000000UL) // 80 MHz
 #define SYS_CLK_MAX_HZ              (200000000UL) // 200 MHz
 
+#if defined(ASIC_RAM_BASE_ADDR) && defined(ASIC_RAM_SIZE_BYTES)
+#define RAM_START_ADDR              (ASIC_RAM_BASE_ADDR)
+#define RAM_SIZE_BYTES              (ASIC_RAM_SIZE_BYTES)
+#else
 #define RAM_START_ADDR              (0x20000000UL) // Matches common_config.json example
 #define RAM_SIZE_BYTES              (131072UL)     // 128KB, Matches common_config.json example
+#endif
 #define RAM_END_ADDR                (RAM_START_ADDR + RAM_SIZE_BYTES - 1)
 
+// Log rate limiting (see constraints.h). Timestamps are CycleCounter ticks;
+// the superloop polls often enough that differences never wrap.
+#define LOG_WINDOW_TICKS            ((uint32_t)CYCLE_COUNTER_HZ)
+#define LOG_REFILL_TICKS            (LOG_WINDOW_TICKS / CONSTRAINTS_LOG_BURST)
+#define LOG_BUDGET_MAX_CYCLES       ((int32_t)(((uint64_t)LOG_WINDOW_TICKS * CONSTRAINTS_LOG_CPU_PERMILLE) / 1000U))
+#define LOG_OTHER_ID                UINT32_MAX  // Shared bucket for ids past CONSTRAINTS_LOG_MAX_IDS
+
+// --- Private Types ---
+typedef struct {
+    uint32_t id;
+    uint32_t tokens;
+    uint32_t refill_stamp;
+    uint32_t suppressed;        // In the current window
+} ViolationBucket;
+
+// --- Private Variables ---
+static ConstraintsViolationObserver ViolationObserver = NULL;
+static void *ViolationObserverCtx = NULL;
+
+static ViolationBucket ViolationBuckets[CONSTRAINTS_LOG_MAX_IDS + 1];   // Last one is LOG_OTHER_ID
+static uint32_t ViolationBucketCount = 0;
+static bool LogStarted = false;
+static uint32_t LogWindowStart;
+static uint32_t LogWindowCycles;    // Spent logging in the current window
+static uint32_t LogBudgetStamp;
+static int32_t LogBudget;           // Cycles logging may still spend; negative after an overrun
+static ConstraintsLogStats LogStats;
+
 // --- Private Helper Functions ---
 
 /**
@@ -53,12 +96,15 @@ static void LogHandler(const char *level, const char *message) { // Following Ha
  * @param message The error message.
  */
 static void ErrorHandler(uint32_t violation_id, const char *message) { // Following Handler function naming convention
-    LogHandler("FATAL", message);
+    LOG_FATAL(message);
+    // Persist the crash, with whatever violations are still batched, before halting
+    FaultLog_Record(FAULT_LOG_TYPE_CRASH, violation_id,
+                    (uint32_t)(uintptr_t)__builtin_return_address(0), 0, CycleCounter_Read());
+    FaultLog_Flush();
     // For a real ASIC, you'd implement a robust error handling strategy.
     // Examples:
     // watchdog_reset(); // Force a system reset
     // set_error_led(violation_id); // Indicate error via LEDs
-    // store_fault_log(violation_id, message); // Log to non-volatile memory
     //
     // For development/debugging:
     while (true) {
@@ -67,6 +113,154 @@ static void ErrorHandler(uint32_t violation_id, const char *message) { // Follow
     }
 }
 
+static void LogLimiterStart(uint32_t now) {
+    memset(ViolationBuckets, 0, sizeof(ViolationBuckets));
+    ViolationBuckets[CONSTRAINTS_LOG_MAX_IDS].id = LOG_OTHER_ID;
+    ViolationBuckets[CONSTRAINTS_LOG_MAX_IDS].tokens = CONSTRAINTS_LOG_BURST;
+    ViolationBuckets[CONSTRAINTS_LOG_MAX_IDS].refill_stamp = now;
+    ViolationBucketCount = 0;
+    LogWindowStart = now;
+    LogWindowCycles = 0;
+    LogBudgetStamp = now;
+    LogBudget = LOG_BUDGET_MAX_CYCLES;
+    LogStarted = true;
+}
+
+static ViolationBucket *FindBucket(uint32_t constraint_id, uint32_t now) {
+    for (uint32_t i = 0; i < ViolationBucketCount; i++) {
+        if (ViolationBuckets[i].id == constraint_id) {
+            return &ViolationBuckets[i];
+        }
+    }
+    if (ViolationBucketCount == CONSTRAINTS_LOG_MAX_IDS) {
+        return &ViolationBuckets[CONSTRAINTS_LOG_MAX_IDS];
+    }
+    ViolationBucket *b = &ViolationBuckets[ViolationBucketCount++];
+    b->id = constraint_id;
+    b->tokens = CONSTRAINTS_LOG_BURST;
+    b->refill_stamp = now;
+    return b;
+}
+
+static void RefillBucket(ViolationBucket *b, uint32_t now) {
+    uint32_t gained = (now - b->refill_stamp) / LOG_REFILL_TICKS;
+    if (gained == 0) {
+        return;
+    }
+    if (gained >= CONSTRAINTS_LOG_BURST - b->tokens) {
+        b->tokens = CONSTRAINTS_LOG_BURST;
+        b->refill_stamp = now;
+    } else {
+        b->tokens += gained;
+        b->refill_stamp += gained * LOG_REFILL_TICKS;
+    }
+}
+
+// Logging earns CONSTRAINTS_LOG_CPU_PERMILLE of elapsed cycles, up to one window's worth
+static void CreditLogBudget(uint32_t now) {
+    uint64_t credit = ((uint64_t)(now - LogBudgetStamp) * CONSTRAINTS_LOG_CPU_PERMILLE) / 1000U;
+    if (credit == 0) {
+        return;     // Keep the stamp so short intervals still add up
+    }
+    if (credit >= (uint64_t)(LOG_BUDGET_MAX_CYCLES - LogBudget)) {
+        LogBudget = LOG_BUDGET_MAX_CYCLES;
+        LogBudgetStamp = now;
+    } else {
+        LogBudget += (int32_t)credit;
+        LogBudgetStamp += (uint32_t)((credit * 1000U) / CONSTRAINTS_LOG_CPU_PERMILLE);
+    }
+}
+
+static void ChargeLog(uint32_t start) {
+    uint32_t cycles = CycleCounter_Elapsed(start);
+    LogBudget -= (int32_t)cycles;
+    LogWindowCycles += cycles;
+}
+
+/**
+ * @brief Decides whether a non-critical report is logged in full.
+ *
+ * Takes a token from the id's bucket if the CPU budget allows; otherwise
+ * counts the report for the window summary.
+ */
+static bool ViolationAdmit(uint32_t constraint_id, uint32_t now) {
+    ViolationBucket *b = FindBucket(constraint_id, now);
+    RefillBucket(b, now);
+    CreditLogBudget(now);
+    if (b->tokens > 0 && LogBudget > 0) {
+        b->tokens--;
+        return true;
+    }
+    b->suppressed++;
+    LogStats.suppressed++;
+    if (b->tokens > 0) {
+        LogStats.capped++;
+    }
+    return false;
+}
+
+static void EmitViolationSummary(uint32_t elapsed) {
+    uint32_t total = 0;
+    for (uint32_t i = 0; i <= CONSTRAINTS_LOG_MAX_IDS; i++) {
+        total += ViolationBuckets[i].suppressed;
+    }
+    if (total == 0 || !LOG_ENABLED(LOG_LEVEL_WARN)) {
+        return;
+    }
+
+    uint32_t start = CycleCounter_Read();
+    char msg[160];
+    int len = snprintf(msg, sizeof(msg), "Suppressed %lu violations in %lu ms:", (unsigned long)total,
+                       (unsigned long)(((uint64_t)elapsed * 1000U) / CYCLE_COUNTER_HZ));
+    for (uint32_t i = 0; i <= CONSTRAINTS_LOG_MAX_IDS && len < (int)sizeof(msg); i++) {
+        ViolationBucket *b = &ViolationBuckets[i];
+        if (b->suppressed == 0) {
+            continue;
+        }
+        if (b->id == LOG_OTHER_ID) {
+            len += snprintf(msg + len, sizeof(msg) - len, " other x%lu", (unsigned long)b->suppressed);
+        } else {
+            len += snprintf(msg + len, sizeof(msg) - len, " 0x%02lX x%lu", (unsigned long)b->id,
+                            (unsigned long)b->suppressed);
+        }
+    }
+    LogHandler("WARN", msg);
+    LogStats.summaries++;
+    ChargeLog(start);
+}
+
+static void ViolationReport(uint32_t constraint_id, const char *format, va_list args) {
+    uint32_t now = CycleCounter_Read();
+
+    // Statistics consumers see every violation, logged or not
+    if (ViolationObserver != NULL) {
+        ViolationObserver(constraint_id, ViolationObserverCtx);
+    }
+    ConstraintsManager_PollViolationLog(now);
+    LogStats.violations++;
+    SecureTrace_Event(SECURE_TRACE_EVENT_VIOLATION, constraint_id, 0);
+
+    // Critical violations halt the system, so they cannot storm: always log them
+    bool critical = (constraint_id == CONSTRAINT_ID_SYS_CLK_RANGE ||
+                     constraint_id == CONSTRAINT_ID_RAM_ACCESS_OOB);
+    if (!critical) {
+        FaultLog_Record(FAULT_LOG_TYPE_VIOLATION, constraint_id, 0, 0, now);   // Crashes are stored by ErrorHandler
+    }
+    if (LOG_ENABLED(LOG_LEVEL_ERROR) && (critical || ViolationAdmit(constraint_id, now))) {
+        uint32_t start = CycleCounter_Read();
+        char full_msg[256];
+        int len = snprintf(full_msg, sizeof(full_msg), "Violation ID 0x%02lX: ", (unsigned long)constraint_id);
+        vsnprintf(full_msg + len, sizeof(full_msg) - len, format, args);
+        LogHandler("ERROR", full_msg);
+        LogStats.logged++;
+        ChargeLog(start);
+    }
+
+    if (critical) {
+        ErrorHandler(constraint_id, "Critical constraint violation. System halted.");
+    }
+}
+
 // --- Public Function Implementations ---
 
 /**
@@ -79,10 +273,11 @@ static void ErrorHandler(uint32_t violation_id, const char *message) { // Follow
  * @return True if initialization is successful, false otherwise.
  */
 bool ConstraintsManager_Init(void) {
-    LogHandler("INFO", "Constraints module initialized.");
+    LogLimiterStart(CycleCounter_Read());
+    LOG_INFO("Constraints module initialized.");
     // Example: Perform a self-test or initial check
     if (!ConstraintsManager_ValidateClockFrequency(SYS_CLK_MIN_HZ + 1000)) { // Just a test value
-        LogHandler("WARN", "Initial clock frequency might be out of range.");
+        LOG_WARN("Initial clock frequency might be out of range.");
         // This wouldn't be a FATAL error unless it's critical.
     }
     return true;
@@ -96,11 +291,10 @@ bool ConstraintsManager_Init(void) {
  */
 bool ConstraintsManager_ValidateClockFrequency(uint32_t freq_hz) {
     if (freq_hz < SYS_CLK_MIN_HZ || freq_hz > SYS_CLK_MAX_HZ) {
-        char msg[128];
-        snprintf(msg, sizeof(msg),
-                 "Clock frequency %lu Hz is out of bounds [%lu - %lu] Hz.",
-                 freq_hz, SYS_CLK_MIN_HZ, SYS_CLK_MAX_HZ);
-        ConstraintsManager_ReportViolation(CONSTRAINT_ID_SYS_CLK_RANGE, msg);
+        ConstraintsManager_ReportViolationFmt(CONSTRAINT_ID_SYS_CLK_RANGE,
+                                              "Clock frequency %lu Hz is out of bounds [%lu - %lu] Hz.",
+                                              (unsigned long)freq_hz, (unsigned long)SYS_CLK_MIN_HZ,
+                                              (unsigned long)SYS_CLK_MAX_HZ);
         return false;
     }
     return true;
@@ -114,11 +308,10 @@ bool ConstraintsManager_ValidateClockFrequency(uint32_t freq_hz) {
  */
 bool ConstraintsManager_ValidateRamAddress(uint32_t address) {
     if (address < RAM_START_ADDR || address > RAM_END_ADDR) {
-        char msg[128];
-        snprintf(msg, sizeof(msg),
-                 "Memory access 0x%08lX is outside RAM range [0x%08lX - 0x%08lX].",
-                 address, RAM_START_ADDR, RAM_END_ADDR);
-        ConstraintsManager_ReportViolation(CONSTRAINT_ID_RAM_ACCESS_OOB, msg);
+        ConstraintsManager_ReportViolationFmt(CONSTRAINT_ID_RAM_ACCESS_OOB,
+                                              "Memory access 0x%08lX is outside RAM range [0x%08lX - 0x%08lX].",
+                                              (unsigned long)address, (unsigned long)RAM_START_ADDR,
+                                              (unsigned long)RAM_END_ADDR);
         return false;
     }
     return true;
@@ -136,12 +329,13 @@ bool ConstraintsManager_ValidateRamAddress(uint32_t address) {
 bool ConstraintsManager_CheckCriticalResource(uint32_t resource_id) {
     switch (resource_id) {
         case CONSTRAINT_ID_SENSOR_TIMEOUT:
-            // Example: Check if a sensor has timed out
-            // if (sensor_is_timed_out()) {
-            //     ConstraintsManager_ReportViolation(resource_id, "Sensor communication timed out.");
-            //     return false;
-            // }
-            LogHandler("INFO", "Sensor check OK.");
+            // The glitch detectors raise interrupts themselves (tamper_monitor.h);
+            // on demand, only confirm that none is masked after a confirmed trip
+            if (!TamperMonitor_Armed()) {
+                ConstraintsManager_ReportViolation(resource_id, "Glitch detector tripped or disarmed.");
+                return false;
+            }
+            LOG_DEBUG("Sensor check OK.");
             break;
         case CONSTRAINT_ID_COMM_BUFFER_FULL:
             // Example: Check if a communication buffer is overflowing
@@ -149,12 +343,14 @@ bool ConstraintsManager_CheckCriticalResource(uint32_t resource_id) {
             //     ConstraintsManager_ReportViolation(resource_id, "Communication buffer overflow.");
             //     return false;
             // }
-            LogHandler("INFO", "Communication buffer check OK.");
+            LOG_DEBUG("Communication buffer check OK.");
             break;
         default:
-            char msg[64];
-            snprintf(msg, sizeof(msg), "Unknown resource ID 0x%02lX for check.", resource_id);
-            LogHandler("WARN", msg);
+            if (LOG_ENABLED(LOG_LEVEL_WARN)) {
+                char msg[64];
+                snprintf(msg, sizeof(msg), "Unknown resource ID 0x%02lX for check.", (unsigned long)resource_id);
+                LogHandler("WARN", msg);
+            }
             return false; // Unknown resource, treat as unhealthy
     }
     return true; // Resource appears healthy
@@ -163,20 +359,66 @@ bool ConstraintsManager_CheckCriticalResource(uint32_t resource_id) {
 /**
  * @brief Reports a constraint violation.
  *
- * This function logs the violation and then, depending on severity,
- * might call a critical error handler.
+ * The observer sees every violation and critical ones always halt; only
+ * the log line is rate limited.
  *
  * @param constraint_id A unique identifier for the violated constraint.
  * @param error_message A descriptive string for the error.
  */
 void ConstraintsManager_ReportViolation(uint32_t constraint_id, const char *error_message) {
-    char full_msg[256];
-    snprintf(full_msg, sizeof(full_msg), "Violation ID 0x%02lX: %s", constraint_id, error_message);
-    LogHandler("ERROR", full_msg);
+    ConstraintsManager_ReportViolationFmt(constraint_id, "%s", error_message);
+}
 
-    // Critical violations might trigger a fatal error response
-    if (constraint_id == CONSTRAINT_ID_SYS_CLK_RANGE ||
-        constraint_id == CONSTRAINT_ID_RAM_ACCESS_OOB) {
-        ErrorHandler(constraint_id, "Critical constraint violation. System halted.");
+/**
+ * @brief Reports a constraint violation, formatting the message only if it is logged.
+ *
+ * @param constraint_id A unique identifier for the violated constraint.
+ * @param format        printf-style format of the error message.
+ */
+void ConstraintsManager_ReportViolationFmt(uint32_t constraint_id, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    ViolationReport(constraint_id, format, args);
+    va_end(args);
+}
+
+/**
+ * @brief Closes an elapsed log window and writes its summary.
+ *
+ * @param now CycleCounter ticks.
+ */
+void ConstraintsManager_PollViolationLog(uint32_t now) {
+    if (!LogStarted) {
+        LogLimiterStart(now);
+        return;
+    }
+    uint32_t elapsed = now - LogWindowStart;
+    if (elapsed < LOG_WINDOW_TICKS) {
+        return;
     }
+    EmitViolationSummary(elapsed);
+    for (uint32_t i = 0; i <= CONSTRAINTS_LOG_MAX_IDS; i++) {
+        ViolationBuckets[i].suppressed = 0;     // Ids cut off by a full line are dropped
+    }
+    LogStats.window_permille = (uint32_t)(((uint64_t)LogWindowCycles * 1000U) / elapsed);
+    LogWindowCycles = 0;
+    LogWindowStart = now;
+}
+
+/**
+ * @brief Rate limiter statistics since the first report.
+ */
+const ConstraintsLogStats *ConstraintsManager_LogStats(void) {
+    return &LogStats;
+}
+
+/**
+ * @brief Registers a single observer for violation events.
+ *
+ * @param observer Callback, or NULL.
+ * @param ctx      Passed back to the callback.
+ */
+void ConstraintsManager_SetViolationObserver(ConstraintsViolationObserver observer, void *ctx) {
+    ViolationObserver = observer;
+    ViolationObserverCtx = ctx;
 }
@@ -14,6 +14,39 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// --- Violation Log Rate Limiting ---
+// Each constraint id has a token bucket of CONSTRAINTS_LOG_BURST full reports,
+// refilled at that many per window (one second of CycleCounter ticks).
+// Reports beyond it are counted and folded into one summary line per window.
+// Independently, logging may spend at most CONSTRAINTS_LOG_CPU_PERMILLE of
+// elapsed cycles; past that, reports are counted instead of formatted.
+#ifndef CONSTRAINTS_LOG_BURST
+#define CONSTRAINTS_LOG_BURST           4   // Full reports per id per window
+#endif
+#ifndef CONSTRAINTS_LOG_CPU_PERMILLE
+#define CONSTRAINTS_LOG_CPU_PERMILLE    20  // 2% of the CPU
+#endif
+#define CONSTRAINTS_LOG_MAX_IDS         8   // Ids tracked separately; the rest share one bucket
+
+// --- Public Types ---
+
+/**
+ * @brief Called for every reported violation, before it is handled.
+ *
+ * @param constraint_id The violated constraint.
+ * @param ctx           Context given to ConstraintsManager_SetViolationObserver.
+ */
+typedef void (*ConstraintsViolationObserver)(uint32_t constraint_id, void *ctx);
+
+typedef struct {
+    uint32_t violations;        // Every report, logged or not
+    uint32_t logged;            // Formatted and written in full
+    uint32_t suppressed;        // Folded into summaries
+    uint32_t capped;            // Of those, suppressed by the CPU cap rather than the id's bucket
+    uint32_t summaries;
+    uint32_t window_permille;   // Share of the last closed window's cycles spent logging
+} ConstraintsLogStats;
+
 // --- Public Function Declarations ---
 
 /**
@@ -63,18 +96,62 @@ bool ConstraintsManager_CheckCriticalResource(uint32_t resource_id);
  *
  * This function handles what happens when a constraint is violated.
  * It might log the error, trigger a system reset, or enter a safe state.
+ * The observer sees every report and critical ones always halt; the log
+ * line is rate limited per constraint id (see CONSTRAINTS_LOG_BURST).
  *
  * @param constraint_id A unique identifier for the violated constraint.
  * @param error_message A descriptive string for the error.
  */
 void ConstraintsManager_ReportViolation(uint32_t constraint_id, const char *error_message);
 
+/**
+ * @brief Reports a constraint violation with a printf-style message.
+ *
+ * Same as ConstraintsManager_ReportViolation(), but the message is only
+ * formatted if the rate limiter lets the report through, so a violation
+ * storm costs a few compares per report instead of a format and a print.
+ * Prefer this over formatting into a buffer first.
+ *
+ * @param constraint_id A unique identifier for the violated constraint.
+ * @param format        printf-style format of the error message.
+ */
+void ConstraintsManager_ReportViolationFmt(uint32_t constraint_id, const char *format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Closes the log window once it has elapsed.
+ *
+ * Writes the summary of suppressed reports, if any. Call once per superloop
+ * pass so summaries come out on time even when violations stop. Reports
+ * also close an elapsed window themselves.
+ *
+ * @param now CycleCounter ticks.
+ */
+void ConstraintsManager_PollViolationLog(uint32_t now);
+
+/**
+ * @brief Rate limiter statistics since the first report.
+ */
+const ConstraintsLogStats *ConstraintsManager_LogStats(void);
+
+/**
+ * @brief Registers a single observer for violation events.
+ *
+ * Used by modules that derive statistics from violations (e.g. the anomaly
+ * feature extractor). Pass NULL to remove the observer.
+ *
+ * @param observer Callback, or NULL.
+ * @param ctx      Passed back to the callback.
+ */
+void ConstraintsManager_SetViolationObserver(ConstraintsViolationObserver observer, void *ctx);
+
 // --- Constraint Identifiers (Example) ---
 // Define unique IDs for different constraints for better logging/reporting.
 #define CONSTRAINT_ID_SYS_CLK_RANGE     0x01
 #define CONSTRAINT_ID_RAM_ACCESS_OOB    0x02
 #define CONSTRAINT_ID_SENSOR_TIMEOUT    0x03
 #define CONSTRAINT_ID_COMM_BUFFER_FULL  0x04
+#define CONSTRAINT_ID_TRAFFIC_ANOMALY   0x05 // Raised by the on-device anomaly classifier
 // ... add more as needed
 
 #endif // CONSTRAINTS_H
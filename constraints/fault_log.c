@@ -0,0 +1,264 @@
+/**
+ * @file fault_log.c
+ * @brief Implementation of the flash fault journal.
+ */
+
+#include "fault_log.h"
+#include "crc32.h"
+#include "cycle_counter.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_MODULE  LOG_MODULE_FAULT_LOG
+#include "log.h"
+
+// --- Private Defines ---
+#define FAULT_LOG_FLUSH_TICKS       ((uint32_t)CYCLE_COUNTER_HZ)    // One batch per second at most
+#define RECORD_CRC_BYTES            ((uint32_t)offsetof(FaultLogRecord, crc))
+#define RECORD_WORDS                (FAULT_LOG_RECORD_BYTES / sizeof(uint32_t))
+
+_Static_assert(sizeof(FaultLogRecord) == FAULT_LOG_RECORD_BYTES, "record must fill one slot");
+_Static_assert(FLASH_SECTOR_BYTES % FAULT_LOG_RECORD_BYTES == 0, "slots must tile a sector");
+
+// --- Private Variables ---
+static FaultLogRecord Pending[FAULT_LOG_BATCH_RECORDS + 1];    // +1 for the DROPPED record
+static uint32_t PendingCount;
+static uint32_t DroppedPending;
+static uint32_t HeadSector;         // Sector index being filled
+static uint32_t WriteSlot;          // Next free slot in HeadSector
+static uint32_t NextSequence;
+static uint32_t LastFlush;
+static bool Initialized;
+static FaultLogStats Stats;
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] FAULT_LOG: %s\n", level, message);
+}
+
+static uint32_t SlotAddress(uint32_t sector, uint32_t slot) {
+    return FAULT_LOG_BASE_ADDR + sector * FLASH_SECTOR_BYTES + slot * FAULT_LOG_RECORD_BYTES;
+}
+
+static const FaultLogRecord *ReadSlot(uint32_t sector, uint32_t slot) {
+    Stats.scan_reads++;
+    return (const FaultLogRecord *)Flash_Map(SlotAddress(sector, slot));
+}
+
+static bool SlotErased(const FaultLogRecord *r) {
+    const uint32_t *w = (const uint32_t *)r;
+    for (uint32_t i = 0; i < RECORD_WORDS; i++) {
+        if (w[i] != 0xFFFFFFFFUL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool RecordValid(const FaultLogRecord *r) {
+    return Crc32_Update(CRC32_INIT, r, RECORD_CRC_BYTES) == r->crc;
+}
+
+// Slots fill in order, so the first erased slot ends the sector's records
+static bool FirstSequence(uint32_t sector, uint32_t *sequence) {
+    for (uint32_t slot = 0; slot < FAULT_LOG_SLOTS_PER_SECTOR; slot++) {
+        const FaultLogRecord *r = ReadSlot(sector, slot);
+        if (SlotErased(r)) {
+            return false;
+        }
+        if (RecordValid(r)) {
+            *sequence = r->sequence;
+            return true;
+        }
+        Stats.torn++;
+    }
+    return false;
+}
+
+static bool ProgramRecords(const FaultLogRecord *records, uint32_t count) {
+    uint32_t done = 0;
+    while (done < count) {
+        if (WriteSlot == FAULT_LOG_SLOTS_PER_SECTOR) {
+            // Reuse the oldest sector
+            HeadSector = (HeadSector + 1) % FAULT_LOG_SECTORS;
+            WriteSlot = 0;
+            Stats.erases++;
+            if (!Flash_EraseSector(SlotAddress(HeadSector, 0))) {
+                return false;
+            }
+        }
+        uint32_t chunk = FAULT_LOG_SLOTS_PER_SECTOR - WriteSlot;
+        if (chunk > count - done) {
+            chunk = count - done;
+        }
+        bool ok = Flash_Program(SlotAddress(HeadSector, WriteSlot), &records[done],
+                                chunk * FAULT_LOG_RECORD_BYTES);
+        // Slots are spent even on failure: they may be partly programmed
+        WriteSlot += chunk;
+        Stats.batches++;
+        if (!ok) {
+            return false;
+        }
+        done += chunk;
+    }
+    return true;
+}
+
+static bool FlushBatch(uint32_t now) {
+    if (DroppedPending > 0) {
+        FaultLogRecord *d = &Pending[PendingCount++];
+        memset(d, 0, sizeof(*d));
+        d->type = FAULT_LOG_TYPE_DROPPED;
+        d->count = (DroppedPending > UINT16_MAX) ? UINT16_MAX : (uint16_t)DroppedPending;
+        d->first_seen = now;
+        d->last_seen = now;
+        d->data[0] = DroppedPending;
+        DroppedPending = 0;
+    }
+    LastFlush = now;
+    if (PendingCount == 0) {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < PendingCount; i++) {
+        Pending[i].sequence = NextSequence++;
+        Pending[i].crc = Crc32_Update(CRC32_INIT, &Pending[i], RECORD_CRC_BYTES);
+    }
+    bool ok = ProgramRecords(Pending, PendingCount);
+    if (ok) {
+        Stats.records_written += PendingCount;
+    } else {
+        Stats.lost += PendingCount;
+        LOG_ERROR("Flash program failed, batch lost.");
+    }
+    PendingCount = 0;
+    return ok;
+}
+
+// --- Public Function Implementations ---
+
+bool FaultLog_Init(void) {
+    PendingCount = 0;
+    DroppedPending = 0;
+    Stats.torn = 0;
+    Stats.scan_reads = 0;
+
+    // Head sector: the one whose first record is newest
+    bool found = false;
+    uint32_t head_sequence = 0;
+    HeadSector = 0;
+    for (uint32_t sector = 0; sector < FAULT_LOG_SECTORS; sector++) {
+        uint32_t sequence;
+        if (FirstSequence(sector, &sequence) && (!found || (int32_t)(sequence - head_sequence) > 0)) {
+            HeadSector = sector;
+            head_sequence = sequence;
+            found = true;
+        }
+    }
+
+    // Write position: after the last slot that is not erased
+    WriteSlot = FAULT_LOG_SLOTS_PER_SECTOR;
+    while (WriteSlot > 0 && SlotErased(ReadSlot(HeadSector, WriteSlot - 1))) {
+        WriteSlot--;
+    }
+    NextSequence = found ? head_sequence + 1 : 0;
+    for (uint32_t slot = WriteSlot; found && slot > 0; slot--) {
+        const FaultLogRecord *r = ReadSlot(HeadSector, slot - 1);
+        if (RecordValid(r)) {
+            NextSequence = r->sequence + 1;
+            break;
+        }
+        Stats.torn++;
+    }
+
+    LastFlush = CycleCounter_Read() - FAULT_LOG_FLUSH_TICKS;
+    Initialized = true;
+    if (LOG_ENABLED(LOG_LEVEL_INFO)) {
+        char msg[96];
+        snprintf(msg, sizeof(msg), "Journal head sector %lu slot %lu, next sequence %lu, %lu torn.",
+                 (unsigned long)HeadSector, (unsigned long)WriteSlot, (unsigned long)NextSequence,
+                 (unsigned long)Stats.torn);
+        LogHandler("INFO", msg);
+    }
+    return found;
+}
+
+bool FaultLog_Record(uint8_t type, uint32_t id, uint32_t data0, uint32_t data1, uint32_t now) {
+    if (!Initialized) {
+        FaultLog_Init();
+    }
+    if (type == FAULT_LOG_TYPE_VIOLATION) {
+        for (uint32_t i = 0; i < PendingCount; i++) {
+            FaultLogRecord *r = &Pending[i];
+            if (r->type == type && r->id == id) {
+                if (r->count < UINT16_MAX) {
+                    r->count++;
+                }
+                r->last_seen = now;
+                Stats.coalesced++;
+                return true;
+            }
+        }
+    }
+    if (PendingCount == FAULT_LOG_BATCH_RECORDS) {
+        // A crash is never dropped: it writes the full batch at once
+        if (type != FAULT_LOG_TYPE_CRASH && now - LastFlush < FAULT_LOG_FLUSH_TICKS) {
+            DroppedPending++;
+            Stats.dropped++;
+            return false;
+        }
+        FlushBatch(now);
+    }
+
+    FaultLogRecord *r = &Pending[PendingCount++];
+    memset(r, 0, sizeof(*r));
+    r->type = type;
+    r->count = 1;
+    r->id = id;
+    r->first_seen = now;
+    r->last_seen = now;
+    r->data[0] = data0;
+    r->data[1] = data1;
+    return true;
+}
+
+bool FaultLog_Flush(void) {
+    if (!Initialized) {
+        FaultLog_Init();
+    }
+    return FlushBatch(CycleCounter_Read());
+}
+
+void FaultLog_Poll(uint32_t now) {
+    if ((PendingCount > 0 || DroppedPending > 0) && now - LastFlush >= FAULT_LOG_FLUSH_TICKS) {
+        FlushBatch(now);
+    }
+}
+
+uint32_t FaultLog_ForEach(FaultLogVisitor visit, void *ctx) {
+    if (!Initialized) {
+        FaultLog_Init();
+    }
+    uint32_t visited = 0;
+    for (uint32_t n = 1; n <= FAULT_LOG_SECTORS; n++) {
+        uint32_t sector = (HeadSector + n) % FAULT_LOG_SECTORS;
+        for (uint32_t slot = 0; slot < FAULT_LOG_SLOTS_PER_SECTOR; slot++) {
+            const FaultLogRecord *r = (const FaultLogRecord *)Flash_Map(SlotAddress(sector, slot));
+            if (SlotErased(r)) {
+                break;
+            }
+            if (RecordValid(r)) {
+                visit(r, ctx);
+                visited++;
+            }
+        }
+    }
+    return visited;
+}
+
+const FaultLogStats *FaultLog_Stats(void) {
+    return &Stats;
+}
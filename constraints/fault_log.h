@@ -0,0 +1,126 @@
+/**
+ * @file fault_log.h
+ * @brief Persistent fault journal: an append-only ring of records in flash.
+ *
+ * Violations and crashes are stored as fixed-size 32-byte records in
+ * FAULT_LOG_SECTORS flash sectors reserved just below the runtime
+ * configuration sectors (the linker script keeps code out of both).
+ *
+ * Writing:
+ *  - FaultLog_Record() only touches RAM. Records wait in a batch of
+ *    FAULT_LOG_BATCH_RECORDS. A violation with the same id as a waiting
+ *    record is folded into it (count, last_seen) instead of taking a slot.
+ *  - A batch is programmed with one Flash_Program() call, at most once a
+ *    second: when it fills, or from FaultLog_Poll() once the second has
+ *    passed. Events that find the batch full before then are counted, and
+ *    the count is stored as one FAULT_LOG_TYPE_DROPPED record. A CRASH
+ *    record is never dropped: if the batch is full, it is programmed at
+ *    once, whatever the interval.
+ *    FaultLog_Flush() writes at once; ErrorHandler uses it before halting.
+ *  - Sectors are used in turn. When the head sector is full, the next one
+ *    (the oldest) is erased, so every sector wears at the same rate.
+ *
+ * Wear is bounded whatever the event rate. At most 9 records are written a
+ * second, so each of the 16 sectors is erased at most once every
+ * 16 * 128 / 9 = 227 s. That is about 260 days of a worst-case storm on
+ * 100k-cycle flash, and a storm on a few ids coalesces to far fewer records.
+ *
+ * Recovery (FaultLog_Init) reads the first valid record of each sector to
+ * find the head sector, then scans that sector backwards for the write
+ * position. Records carry a sequence number (compared modulo 2^32) and a
+ * CRC-32, so a record torn by a power loss is skipped, never trusted.
+ */
+
+#ifndef FAULT_LOG_H
+#define FAULT_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "flash.h"
+
+// --- Flash Placement: FAULT_LOG_SECTORS below the two runtime config sectors ---
+#define FAULT_LOG_SECTORS           16  // Must match FAULT_LOG_SECTORS in tools/gen_linker_script.py
+#define FAULT_LOG_BASE_ADDR         (FLASH_BASE_ADDR + FLASH_SIZE_BYTES - (2 + FAULT_LOG_SECTORS) * FLASH_SECTOR_BYTES)
+#define FAULT_LOG_RECORD_BYTES      32U
+#define FAULT_LOG_SLOTS_PER_SECTOR  (FLASH_SECTOR_BYTES / FAULT_LOG_RECORD_BYTES)
+
+// --- Batching ---
+#define FAULT_LOG_BATCH_RECORDS     8   // 256 bytes per flash program
+
+// --- Record Types ---
+#define FAULT_LOG_TYPE_VIOLATION    1   // id: constraint id
+#define FAULT_LOG_TYPE_CRASH        2   // id: constraint id or fault cause; data: fault registers
+#define FAULT_LOG_TYPE_DROPPED      3   // count: events lost to a full batch
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t sequence;          // Journal order, modulo 2^32
+    uint8_t  type;              // FAULT_LOG_TYPE_*
+    uint8_t  reserved;
+    uint16_t count;             // Occurrences folded into this record, saturating
+    uint32_t id;
+    uint32_t first_seen;        // CycleCounter ticks
+    uint32_t last_seen;
+    uint32_t data[2];           // Type-specific
+    uint32_t crc;               // CRC-32 of the bytes before it
+} FaultLogRecord;
+
+typedef struct {
+    uint32_t records_written;
+    uint32_t batches;           // Flash_Program calls
+    uint32_t erases;
+    uint32_t coalesced;         // Events folded into a waiting record
+    uint32_t dropped;           // Events lost to a full batch
+    uint32_t lost;              // Records in batches whose program failed
+    uint32_t torn;              // Unreadable slots met by the last recovery scan
+    uint32_t scan_reads;        // Records read by the last recovery scan
+} FaultLogStats;
+
+/**
+ * @brief Called by FaultLog_ForEach for each valid record, oldest first.
+ */
+typedef void (*FaultLogVisitor)(const FaultLogRecord *record, void *ctx);
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Finds the journal head and write position.
+ *
+ * Called lazily by the first FaultLog_Record if not called at boot.
+ *
+ * @return True if the journal holds at least one valid record.
+ */
+bool FaultLog_Init(void);
+
+/**
+ * @brief Records an event in the RAM batch.
+ *
+ * @param now CycleCounter ticks.
+ * @return False if the event was dropped.
+ */
+bool FaultLog_Record(uint8_t type, uint32_t id, uint32_t data0, uint32_t data1, uint32_t now);
+
+/**
+ * @brief Programs the waiting batch now, ignoring the flush interval.
+ *
+ * @return False if the flash program failed; the batch is then lost.
+ */
+bool FaultLog_Flush(void);
+
+/**
+ * @brief Programs the waiting batch if a second has passed since the last flush.
+ */
+void FaultLog_Poll(uint32_t now);
+
+/**
+ * @brief Visits the records in flash, oldest first.
+ *
+ * @return Number of records visited.
+ */
+uint32_t FaultLog_ForEach(FaultLogVisitor visit, void *ctx);
+
+const FaultLogStats *FaultLog_Stats(void);
+
+#endif // FAULT_LOG_H
@@ -0,0 +1,309 @@
+/**
+ * @file bignum.c
+ * @brief Implementation of the multi-precision and Montgomery arithmetic.
+ */
+
+#include "bignum.h"
+
+#include <string.h>
+
+#define BN_WINDOW_BITS              4U
+#define BN_WINDOW_SIZE              (1U << BN_WINDOW_BITS)
+
+// --- Private Helper Functions ---
+
+// r = cond ? a : r, without a branch on cond
+static void Select(BnLimb *r, const BnLimb *a, BnLimb cond, uint32_t n) {
+    BnLimb mask = (BnLimb)0 - cond;
+    for (uint32_t i = 0; i < n; i++) {
+        r[i] = (r[i] & ~mask) | (a[i] & mask);
+    }
+}
+
+static void ShiftRight1(BnLimb *a, BnLimb top, uint32_t n) {
+    for (uint32_t i = 0; i + 1 < n; i++) {
+        a[i] = (a[i] >> 1) | (a[i + 1] << 31);
+    }
+    a[n - 1] = (a[n - 1] >> 1) | (top << 31);
+}
+
+// a = a / 2 mod m, for odd m
+static void HalveMod(BnLimb *a, const BnLimb *m, uint32_t n) {
+    BnLimb carry = 0;
+    if (a[0] & 1U) {
+        carry = Bn_Add(a, a, m, n);
+    }
+    ShiftRight1(a, carry, n);
+}
+
+static bool IsOne(const BnLimb *a, uint32_t n) {
+    BnLimb acc = a[0] ^ 1U;
+    for (uint32_t i = 1; i < n; i++) {
+        acc |= a[i];
+    }
+    return acc == 0;
+}
+
+// --- Plain Arithmetic ---
+
+bool Bn_FromBytes(BnLimb *r, uint32_t n, const uint8_t *be, uint32_t len) {
+    memset(r, 0, n * sizeof(BnLimb));
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t byte = len - 1U - i;   // Significance of be[i]
+        if (byte / 4U >= n) {
+            if (be[i] != 0) {
+                return false;
+            }
+            continue;
+        }
+        r[byte / 4U] |= (BnLimb)be[i] << (8U * (byte % 4U));
+    }
+    return true;
+}
+
+void Bn_ToBytes(uint8_t *be, uint32_t len, const BnLimb *a, uint32_t n) {
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t byte = len - 1U - i;
+        be[i] = (byte / 4U < n) ? (uint8_t)(a[byte / 4U] >> (8U * (byte % 4U))) : 0;
+    }
+}
+
+BnLimb Bn_Add(BnLimb *r, const BnLimb *a, const BnLimb *b, uint32_t n) {
+    uint64_t c = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        c += (uint64_t)a[i] + b[i];
+        r[i] = (BnLimb)c;
+        c >>= 32;
+    }
+    return (BnLimb)c;
+}
+
+BnLimb Bn_Sub(BnLimb *r, const BnLimb *a, const BnLimb *b, uint32_t n) {
+    uint64_t borrow = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t d = (uint64_t)a[i] - b[i] - borrow;
+        r[i] = (BnLimb)d;
+        borrow = (d >> 32) & 1U;
+    }
+    return (BnLimb)borrow;
+}
+
+int Bn_Cmp(const BnLimb *a, const BnLimb *b, uint32_t n) {
+    for (uint32_t i = n; i > 0; i--) {
+        if (a[i - 1] != b[i - 1]) {
+            return (a[i - 1] > b[i - 1]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+bool Bn_IsZero(const BnLimb *a, uint32_t n) {
+    BnLimb acc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        acc |= a[i];
+    }
+    return acc == 0;
+}
+
+void Bn_ModAdd(BnLimb *r, const BnLimb *a, const BnLimb *b, const BnLimb *m, uint32_t n) {
+    BnLimb t[BN_MAX_LIMBS];
+    BnLimb carry = Bn_Add(r, a, b, n);
+    BnLimb borrow = Bn_Sub(t, r, m, n);
+    // Keep the difference if the sum overflowed or was at least m
+    Select(r, t, carry | (borrow ^ 1U), n);
+}
+
+void Bn_ModSub(BnLimb *r, const BnLimb *a, const BnLimb *b, const BnLimb *m, uint32_t n) {
+    BnLimb t[BN_MAX_LIMBS];
+    BnLimb borrow = Bn_Sub(r, a, b, n);
+    Bn_Add(t, r, m, n);
+    Select(r, t, borrow, n);
+}
+
+bool Bn_ModInv(BnLimb *r, const BnLimb *a, const BnLimb *m, uint32_t n) {
+    BnLimb u[BN_MAX_LIMBS];
+    BnLimb v[BN_MAX_LIMBS];
+    BnLimb x1[BN_MAX_LIMBS];
+    BnLimb x2[BN_MAX_LIMBS];
+    memcpy(u, a, n * sizeof(BnLimb));
+    memcpy(v, m, n * sizeof(BnLimb));
+    memset(x1, 0, n * sizeof(BnLimb));
+    memset(x2, 0, n * sizeof(BnLimb));
+    x1[0] = 1;
+
+    // Invariants: x1 * a = u and x2 * a = v (mod m)
+    while (!IsOne(u, n) && !IsOne(v, n)) {
+        if (Bn_IsZero(u, n) || Bn_IsZero(v, n)) {
+            return false;   // gcd(a, m) > 1
+        }
+        while ((u[0] & 1U) == 0) {
+            ShiftRight1(u, 0, n);
+            HalveMod(x1, m, n);
+        }
+        while ((v[0] & 1U) == 0) {
+            ShiftRight1(v, 0, n);
+            HalveMod(x2, m, n);
+        }
+        if (Bn_Cmp(u, v, n) >= 0) {
+            Bn_Sub(u, u, v, n);
+            Bn_ModSub(x1, x1, x2, m, n);
+        } else {
+            Bn_Sub(v, v, u, n);
+            Bn_ModSub(x2, x2, x1, m, n);
+        }
+    }
+    memcpy(r, IsOne(u, n) ? x1 : x2, n * sizeof(BnLimb));
+    return true;
+}
+
+// --- Montgomery Arithmetic ---
+
+bool BnMont_Init(BnMont *ctx, const BnLimb *m, uint32_t n) {
+    if (n == 0 || n > BN_MAX_LIMBS || (m[0] & 1U) == 0 || m[n - 1] == 0) {
+        return false;
+    }
+    memcpy(ctx->m, m, n * sizeof(BnLimb));
+    ctx->n = n;
+
+    // Newton iteration: each step doubles the correct low bits of m^-1
+    BnLimb inv = 1;
+    for (uint32_t i = 0; i < 5; i++) {
+        inv *= 2U - m[0] * inv;
+    }
+    ctx->m0inv = (BnLimb)0 - inv;
+
+    // R^2 mod m by doubling 1 (2 * 32 * n) times
+    memset(ctx->rr, 0, sizeof(ctx->rr));
+    ctx->rr[0] = 1;
+    for (uint32_t i = 0; i < 2U * BN_LIMB_BITS * n; i++) {
+        Bn_ModAdd(ctx->rr, ctx->rr, ctx->rr, ctx->m, n);
+    }
+    return true;
+}
+
+void BnMont_Mul(const BnMont *ctx, BnLimb *r, const BnLimb *a, const BnLimb *b) {
+    // Coarsely integrated operand scanning (CIOS)
+    const uint32_t n = ctx->n;
+    BnLimb t[BN_MAX_LIMBS + 2];
+    memset(t, 0, (n + 2) * sizeof(BnLimb));
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t c = 0;
+        for (uint32_t j = 0; j < n; j++) {
+            c += (uint64_t)t[j] + (uint64_t)a[j] * b[i];
+            t[j] = (BnLimb)c;
+            c >>= 32;
+        }
+        c += t[n];
+        t[n] = (BnLimb)c;
+        t[n + 1] = (BnLimb)(c >> 32);
+
+        BnLimb u = t[0] * ctx->m0inv;
+        c = ((uint64_t)t[0] + (uint64_t)u * ctx->m[0]) >> 32;
+        for (uint32_t j = 1; j < n; j++) {
+            c += (uint64_t)t[j] + (uint64_t)u * ctx->m[j];
+            t[j - 1] = (BnLimb)c;
+            c >>= 32;
+        }
+        c += t[n];
+        t[n - 1] = (BnLimb)c;
+        t[n] = t[n + 1] + (BnLimb)(c >> 32);
+    }
+    // t < 2m: subtract m once if needed
+    BnLimb d[BN_MAX_LIMBS];
+    BnLimb borrow = Bn_Sub(d, t, ctx->m, n);
+    memcpy(r, t, n * sizeof(BnLimb));
+    Select(r, d, t[n] | (borrow ^ 1U), n);
+}
+
+void BnMont_ToMont(const BnMont *ctx, BnLimb *r, const BnLimb *a) {
+    BnMont_Mul(ctx, r, a, ctx->rr);
+}
+
+void BnMont_FromMont(const BnMont *ctx, BnLimb *r, const BnLimb *a) {
+    BnLimb one[BN_MAX_LIMBS];
+    memset(one, 0, ctx->n * sizeof(BnLimb));
+    one[0] = 1;
+    BnMont_Mul(ctx, r, a, one);
+}
+
+void BnMont_Exp(const BnMont *ctx, BnLimb *r, const BnLimb *a, const BnLimb *e, uint32_t e_limbs) {
+    const uint32_t n = ctx->n;
+    BnLimb table[BN_WINDOW_SIZE][BN_MAX_LIMBS];
+    BnLimb acc[BN_MAX_LIMBS];
+    BnLimb pick[BN_MAX_LIMBS];
+
+    // table[i] = a^i * R
+    BnLimb one[BN_MAX_LIMBS];
+    memset(one, 0, n * sizeof(BnLimb));
+    one[0] = 1;
+    BnMont_ToMont(ctx, table[0], one);
+    BnMont_ToMont(ctx, table[1], a);
+    for (uint32_t i = 2; i < BN_WINDOW_SIZE; i++) {
+        BnMont_Mul(ctx, table[i], table[i - 1], table[1]);
+    }
+
+    memcpy(acc, table[0], n * sizeof(BnLimb));
+    for (uint32_t w = e_limbs * (BN_LIMB_BITS / BN_WINDOW_BITS); w > 0; w--) {
+        for (uint32_t s = 0; s < BN_WINDOW_BITS; s++) {
+            BnMont_Mul(ctx, acc, acc, acc);
+        }
+        uint32_t bit = (w - 1U) * BN_WINDOW_BITS;
+        BnLimb digit = (e[bit / BN_LIMB_BITS] >> (bit % BN_LIMB_BITS)) & (BN_WINDOW_SIZE - 1U);
+        for (uint32_t i = 0; i < BN_WINDOW_SIZE; i++) {
+            Select(pick, table[i], (BnLimb)(i == digit), n);
+        }
+        BnMont_Mul(ctx, acc, acc, pick);
+    }
+    BnMont_FromMont(ctx, r, acc);
+}
+
+void BnMont_InvPrime(const BnMont *ctx, BnLimb *r, const BnLimb *a) {
+    const uint32_t n = ctx->n;
+    BnLimb two[BN_MAX_LIMBS];
+    BnLimb e[BN_MAX_LIMBS];
+    BnLimb t[BN_MAX_LIMBS];
+    memset(two, 0, n * sizeof(BnLimb));
+    two[0] = 2;
+    Bn_Sub(e, ctx->m, two, n);
+    BnMont_FromMont(ctx, t, a);
+    BnMont_Exp(ctx, t, t, e, n);
+    BnMont_ToMont(ctx, r, t);
+}
+
+void BnMont_InvPrimeBatch(const BnMont *ctx, BnLimb *values, uint32_t stride, uint32_t count, BnLimb *scratch) {
+    const uint32_t n = ctx->n;
+    if (count == 0) {
+        return;
+    }
+    BnLimb one[BN_MAX_LIMBS];
+    BnLimb inv[BN_MAX_LIMBS];
+    BnLimb t[BN_MAX_LIMBS];
+    memset(t, 0, n * sizeof(BnLimb));
+    t[0] = 1;
+    BnMont_ToMont(ctx, one, t);
+
+    // scratch[i] = product of the non-zero values[0..i]
+    const BnLimb *prev = one;
+    for (uint32_t i = 0; i < count; i++) {
+        const BnLimb *v = &values[i * stride];
+        if (Bn_IsZero(v, n)) {
+            memcpy(&scratch[i * n], prev, n * sizeof(BnLimb));
+        } else {
+            BnMont_Mul(ctx, &scratch[i * n], prev, v);
+        }
+        prev = &scratch[i * n];
+    }
+
+    // Walk back: inv holds the inverse of the product up to i
+    BnMont_InvPrime(ctx, inv, &scratch[(count - 1U) * n]);
+    for (uint32_t i = count; i > 0; i--) {
+        BnLimb *v = &values[(i - 1U) * stride];
+        if (Bn_IsZero(v, n)) {
+            continue;
+        }
+        const BnLimb *before = (i > 1U) ? &scratch[(i - 2U) * n] : one;
+        BnMont_Mul(ctx, t, inv, before);    // v^-1
+        BnMont_Mul(ctx, inv, inv, v);       // Inverse of the product up to i - 1
+        memcpy(v, t, n * sizeof(BnLimb));
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file bignum.h
+ * @brief Fixed-size multi-precision integers and Montgomery arithmetic.
+ *
+ * Numbers are arrays of 32-bit limbs, least significant first, with the
+ * length passed explicitly; nothing is allocated. BN_MAX_LIMBS covers
+ * RSA-2048. Modular multiplication uses Montgomery form: with
+ * R = 2^(32 * n), BnMont_Mul(a, b) = a * b / R mod m, so values are kept
+ * multiplied by R while a computation is in progress. BnMont_ToMont and
+ * BnMont_FromMont convert at the ends.
+ *
+ * BnMont_Mul and BnMont_Exp run in time that depends only on the sizes,
+ * not the values. Bn_ModInv does not: use it on blinded or public values.
+ */
+
+#ifndef BIGNUM_H
+#define BIGNUM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t BnLimb;
+
+#define BN_LIMB_BITS                32U
+#define BN_MAX_LIMBS                64U     // 2048 bits
+
+// --- Public Types ---
+
+typedef struct {
+    BnLimb   m[BN_MAX_LIMBS];       // Odd modulus
+    BnLimb   rr[BN_MAX_LIMBS];      // R^2 mod m
+    BnLimb   m0inv;                 // -m^-1 mod 2^32
+    uint32_t n;                     // Limbs
+} BnMont;
+
+// --- Plain Arithmetic ---
+
+/**
+ * @brief Loads a big-endian byte string into n limbs, zero-extended.
+ *
+ * @return False if the value does not fit.
+ */
+bool Bn_FromBytes(BnLimb *r, uint32_t n, const uint8_t *be, uint32_t len);
+
+/**
+ * @brief Stores the low len bytes of a, big-endian.
+ */
+void Bn_ToBytes(uint8_t *be, uint32_t len, const BnLimb *a, uint32_t n);
+
+BnLimb Bn_Add(BnLimb *r, const BnLimb *a, const BnLimb *b, uint32_t n);     // Returns the carry
+BnLimb Bn_Sub(BnLimb *r, const BnLimb *a, const BnLimb *b, uint32_t n);     // Returns the borrow
+int Bn_Cmp(const BnLimb *a, const BnLimb *b, uint32_t n);
+bool Bn_IsZero(const BnLimb *a, uint32_t n);
+
+/**
+ * @brief r = (a + b) mod m and r = (a - b) mod m, for a, b < m.
+ */
+void Bn_ModAdd(BnLimb *r, const BnLimb *a, const BnLimb *b, const BnLimb *m, uint32_t n);
+void Bn_ModSub(BnLimb *r, const BnLimb *a, const BnLimb *b, const BnLimb *m, uint32_t n);
+
+/**
+ * @brief r = a^-1 mod m for odd m (binary extended Euclid, variable time).
+ *
+ * @return False if a is not invertible.
+ */
+bool Bn_ModInv(BnLimb *r, const BnLimb *a, const BnLimb *m, uint32_t n);
+
+// --- Montgomery Arithmetic ---
+
+/**
+ * @brief Prepares a modulus. m must be odd and its top limb non-zero.
+ */
+bool BnMont_Init(BnMont *ctx, const BnLimb *m, uint32_t n);
+
+/**
+ * @brief r = a * b / R mod m, for a, b < m. r may alias a or b.
+ */
+void BnMont_Mul(const BnMont *ctx, BnLimb *r, const BnLimb *a, const BnLimb *b);
+
+void BnMont_ToMont(const BnMont *ctx, BnLimb *r, const BnLimb *a);
+void BnMont_FromMont(const BnMont *ctx, BnLimb *r, const BnLimb *a);
+
+/**
+ * @brief r = a^e mod m, a and r in normal form.
+ *
+ * Fixed 4-bit windows; the table is read in full for every window.
+ */
+void BnMont_Exp(const BnMont *ctx, BnLimb *r, const BnLimb *a, const BnLimb *e, uint32_t e_limbs);
+
+/**
+ * @brief r = a^-1 for a prime modulus, Montgomery form in and out (a^(m-2)).
+ */
+void BnMont_InvPrime(const BnMont *ctx, BnLimb *r, const BnLimb *a);
+
+/**
+ * @brief Inverts count values in place with one inversion (Montgomery's trick).
+ *
+ * Values are in Montgomery form, ctx->n limbs each, stride limbs apart, so
+ * they may sit inside larger structures. The cost is one BnMont_InvPrime
+ * and 3 (count - 1) multiplications. Zero values are left at zero.
+ *
+ * @param scratch count * ctx->n limbs.
+ */
+void BnMont_InvPrimeBatch(const BnMont *ctx, BnLimb *values, uint32_t stride, uint32_t count, BnLimb *scratch);
+
+#endif // BIGNUM_H
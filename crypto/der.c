@@ -0,0 +1,123 @@
+/**
+ * @file der.c
+ * @brief Implementation of the streaming DER reader.
+ */
+
+#include "der.h"
+
+#include <string.h>
+
+// --- Private Helper Functions ---
+
+static bool Fail(DerReader *r) {
+    r->failed = true;
+    r->p = r->end;
+    return false;
+}
+
+// --- Public Function Implementations ---
+
+void Der_Init(DerReader *r, const uint8_t *buf, uint32_t len) {
+    r->p = buf;
+    r->end = buf + len;
+    r->failed = false;
+}
+
+bool Der_Next(DerReader *r, DerItem *item) {
+    if (r->failed || r->p >= r->end) {
+        return false;
+    }
+    const uint8_t *p = r->p;
+    uint32_t avail = (uint32_t)(r->end - p);
+    if (avail < 2U || (p[0] & 0x1FU) == 0x1FU) {
+        return Fail(r);                     // Truncated, or a multi-byte tag
+    }
+    uint8_t tag = p[0];
+    uint32_t len = p[1];
+    uint32_t header = 2;
+    if (len & 0x80U) {
+        uint32_t octets = len & 0x7FU;
+        if (octets == 0 || octets > DER_MAX_LENGTH_BYTES || avail < 2U + octets) {
+            return Fail(r);                 // Indefinite, too long or truncated
+        }
+        len = 0;
+        for (uint32_t i = 0; i < octets; i++) {
+            len = (len << 8) | p[2 + i];
+        }
+        // Minimal encoding: no leading zero octet, and short form where it fits
+        if (p[2] == 0 || len < 0x80U) {
+            return Fail(r);
+        }
+        header += octets;
+    }
+    if (len > avail - header) {
+        return Fail(r);
+    }
+    item->start = p;
+    item->value = p + header;
+    item->len = len;
+    item->tag = tag;
+    r->p = item->value + len;
+    return true;
+}
+
+bool Der_Expect(DerReader *r, uint8_t tag, DerItem *item) {
+    if (!Der_Next(r, item)) {
+        return Fail(r);
+    }
+    if (item->tag != tag) {
+        return Fail(r);
+    }
+    return true;
+}
+
+bool Der_Optional(DerReader *r, uint8_t tag, DerItem *item) {
+    if (r->failed || r->p >= r->end || r->p[0] != tag) {
+        return false;
+    }
+    return Der_Next(r, item);
+}
+
+void Der_Enter(const DerItem *item, DerReader *inner) {
+    Der_Init(inner, item->value, item->len);
+}
+
+bool Der_AtEnd(const DerReader *r) {
+    return !r->failed && r->p == r->end;
+}
+
+bool Der_Failed(const DerReader *r) {
+    return r->failed;
+}
+
+uint32_t Der_Size(const DerItem *item) {
+    return (uint32_t)(item->value - item->start) + item->len;
+}
+
+bool Der_OidEquals(const DerItem *item, const uint8_t *oid, uint32_t len) {
+    return item->tag == DER_TAG_OID && item->len == len && memcmp(item->value, oid, len) == 0;
+}
+
+bool Der_ToUint32(const DerItem *item, uint32_t *out) {
+    const uint8_t *v = item->value;
+    uint32_t len = item->len;
+    if (item->tag != DER_TAG_INTEGER || len == 0 || (v[0] & 0x80U)) {
+        return false;                       // Empty or negative
+    }
+    if (len > 1U && v[0] == 0 && (v[1] & 0x80U) == 0) {
+        return false;                       // Non-minimal
+    }
+    if (v[0] == 0) {
+        v++;
+        len--;
+    }
+    if (len > 4U) {
+        return false;
+    }
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        value = (value << 8) | v[i];
+    }
+    *out = value;
+    return true;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file der.h
+ * @brief Streaming zero-copy DER reader.
+ *
+ * A DerReader walks one level of a DER encoding and yields each element
+ * as a (tag, length, pointer) view into the caller's buffer. Nothing is
+ * copied or allocated. To descend into a constructed element (SEQUENCE,
+ * SET, explicit context tag), open a reader over its value with Der_Enter.
+ * The buffer must stay unchanged while views into it are in use.
+ *
+ * Encodings that DER forbids are rejected, not tolerated:
+ *  - indefinite lengths;
+ *  - non-minimal long-form lengths;
+ *  - multi-byte tags;
+ *  - lengths that run past the end of the enclosing element.
+ * After a malformed element the reader is marked failed and yields
+ * nothing more, so a caller can check Der_Failed once at the end.
+ */
+
+#ifndef DER_H
+#define DER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Tags ---
+#define DER_TAG_BOOLEAN             0x01U
+#define DER_TAG_INTEGER             0x02U
+#define DER_TAG_BIT_STRING          0x03U
+#define DER_TAG_OCTET_STRING        0x04U
+#define DER_TAG_NULL                0x05U
+#define DER_TAG_OID                 0x06U
+#define DER_TAG_UTC_TIME            0x17U
+#define DER_TAG_GENERALIZED_TIME    0x18U
+#define DER_TAG_SEQUENCE            0x30U
+#define DER_TAG_SET                 0x31U
+#define DER_TAG_CONTEXT(n)          (0xA0U | (n))   // Constructed, context-specific
+
+#define DER_MAX_LENGTH_BYTES        4U      // Long-form length octets accepted
+
+// --- Public Types ---
+
+typedef struct {
+    const uint8_t *p;               // Next element
+    const uint8_t *end;
+    bool           failed;
+} DerReader;
+
+typedef struct {
+    const uint8_t *start;           // Tag octet: the whole element is start .. value + len
+    const uint8_t *value;
+    uint32_t       len;
+    uint8_t        tag;
+} DerItem;
+
+// --- Public Function Declarations ---
+
+void Der_Init(DerReader *r, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief Yields the next element.
+ *
+ * @return False at the end of the level or on a malformed element.
+ */
+bool Der_Next(DerReader *r, DerItem *item);
+
+/**
+ * @brief Yields the next element if it has the given tag; fails the reader otherwise.
+ */
+bool Der_Expect(DerReader *r, uint8_t tag, DerItem *item);
+
+/**
+ * @brief Yields the next element only if it has the given tag, for OPTIONAL fields.
+ *
+ * @return False, without consuming or failing, if the tag differs.
+ */
+bool Der_Optional(DerReader *r, uint8_t tag, DerItem *item);
+
+/**
+ * @brief Opens a reader over the value of a constructed element.
+ */
+void Der_Enter(const DerItem *item, DerReader *inner);
+
+bool Der_AtEnd(const DerReader *r);
+bool Der_Failed(const DerReader *r);
+
+/**
+ * @brief Size of the whole element, header included.
+ */
+uint32_t Der_Size(const DerItem *item);
+
+/**
+ * @brief Compares an OID element with encoded OID content octets.
+ */
+bool Der_OidEquals(const DerItem *item, const uint8_t *oid, uint32_t len);
+
+/**
+ * @brief Reads a non-negative INTEGER of up to 4 bytes.
+ */
+bool Der_ToUint32(const DerItem *item, uint32_t *out);
+
+#endif // DER_H
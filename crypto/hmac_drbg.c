@@ -0,0 +1,62 @@
+/**
+ * @file hmac_drbg.c
+ * @brief Implementation of HMAC_DRBG (SHA-256).
+ */
+
+#include "hmac_drbg.h"
+
+#include <string.h>
+
+// --- Private Helper Functions ---
+
+// out = HMAC(K, V || [sep || data])
+static void Mac(const HmacDrbg *drbg, const uint8_t *sep, const uint8_t *data, uint32_t len, uint8_t *out) {
+    HmacSha256Key key;
+    HmacSha256Ctx ctx;
+    HmacSha256_SetKey(&key, drbg->k, sizeof(drbg->k));
+    HmacSha256_Init(&ctx, &key);
+    HmacSha256_Update(&ctx, drbg->v, sizeof(drbg->v));
+    if (sep != NULL) {
+        HmacSha256_Update(&ctx, sep, 1);
+        HmacSha256_Update(&ctx, data, len);
+    }
+    HmacSha256_Final(&ctx, out);
+    HmacSha256_ClearKey(&key);
+}
+
+// HMAC_DRBG_Update (SP 800-90A 10.1.2.2)
+static void Update(HmacDrbg *drbg, const uint8_t *data, uint32_t len) {
+    static const uint8_t Sep[2] = { 0x00, 0x01 };
+    for (uint32_t round = 0; round < 2; round++) {
+        Mac(drbg, &Sep[round], data, len, drbg->k);
+        Mac(drbg, NULL, NULL, 0, drbg->v);
+        if (len == 0) {
+            break;
+        }
+    }
+}
+
+// --- Public Function Implementations ---
+
+void HmacDrbg_Init(HmacDrbg *drbg, const uint8_t *seed, uint32_t len) {
+    memset(drbg->k, 0x00, sizeof(drbg->k));
+    memset(drbg->v, 0x01, sizeof(drbg->v));
+    HmacDrbg_Reseed(drbg, seed, len);
+}
+
+void HmacDrbg_Reseed(HmacDrbg *drbg, const uint8_t *seed, uint32_t len) {
+    Update(drbg, seed, len);
+    drbg->reseed_counter = 1;
+}
+
+void HmacDrbg_Generate(HmacDrbg *drbg, uint8_t *out, uint32_t len) {
+    while (len > 0) {
+        Mac(drbg, NULL, NULL, 0, drbg->v);
+        uint32_t chunk = (len < sizeof(drbg->v)) ? len : (uint32_t)sizeof(drbg->v);
+        memcpy(out, drbg->v, chunk);
+        out += chunk;
+        len -= chunk;
+    }
+    Update(drbg, NULL, 0);
+    drbg->reseed_counter++;
+}
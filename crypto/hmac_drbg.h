@@ -0,0 +1,32 @@
+/**
+ * @file hmac_drbg.h
+ * @brief HMAC_DRBG with SHA-256 (NIST SP 800-90A), for nonces and blinding.
+ *
+ * The caller provides the seed (entropy input, nonce and personalisation,
+ * concatenated) and reseeds when it has fresh entropy. Prediction
+ * resistance and additional input on generate are not supported. The
+ * state is secret: whoever owns an HmacDrbg registers it for zeroisation.
+ */
+
+#ifndef HMAC_DRBG_H
+#define HMAC_DRBG_H
+
+#include <stdint.h>
+
+#include "hmac_sha256.h"
+
+// --- Public Types ---
+
+typedef struct {
+    uint8_t  k[HMAC_SHA256_BYTES];
+    uint8_t  v[HMAC_SHA256_BYTES];
+    uint32_t reseed_counter;
+} HmacDrbg;
+
+// --- Public Function Declarations ---
+
+void HmacDrbg_Init(HmacDrbg *drbg, const uint8_t *seed, uint32_t len);
+void HmacDrbg_Reseed(HmacDrbg *drbg, const uint8_t *seed, uint32_t len);
+void HmacDrbg_Generate(HmacDrbg *drbg, uint8_t *out, uint32_t len);
+
+#endif // HMAC_DRBG_H
@@ -0,0 +1,72 @@
+/**
+ * @file hmac_sha256.c
+ * @brief Implementation of HMAC-SHA256.
+ */
+
+#include "hmac_sha256.h"
+
+#include <string.h>
+
+// --- Private Helper Functions ---
+
+static void PadState(uint32_t state[8], const uint8_t block[SHA256_BLOCK_BYTES], uint8_t pad) {
+    uint8_t padded[SHA256_BLOCK_BYTES];
+    for (uint32_t i = 0; i < SHA256_BLOCK_BYTES; i++) {
+        padded[i] = block[i] ^ pad;
+    }
+    Sha256Ctx ctx;
+    Sha256_Init(&ctx);
+    Sha256_Compress(ctx.state, padded, 1);
+    memcpy(state, ctx.state, sizeof(ctx.state));
+    memset(padded, 0, sizeof(padded));
+}
+
+// --- Public Function Implementations ---
+
+void HmacSha256_SetKey(HmacSha256Key *key, const uint8_t *secret, uint32_t len) {
+    uint8_t block[SHA256_BLOCK_BYTES] = { 0 };
+    if (len > SHA256_BLOCK_BYTES) {
+        Sha256_Digest(secret, len, block);
+    } else {
+        memcpy(block, secret, len);
+    }
+    PadState(key->inner, block, 0x36);
+    PadState(key->outer, block, 0x5C);
+    memset(block, 0, sizeof(block));
+}
+
+void HmacSha256_ClearKey(HmacSha256Key *key) {
+    volatile uint8_t *p = (volatile uint8_t *)key;
+    for (uint32_t i = 0; i < sizeof(*key); i++) {
+        p[i] = 0;
+    }
+}
+
+void HmacSha256_Init(HmacSha256Ctx *ctx, const HmacSha256Key *key) {
+    memcpy(ctx->sha.state, key->inner, sizeof(key->inner));
+    ctx->sha.length = SHA256_BLOCK_BYTES;
+    ctx->sha.buffered = 0;
+    ctx->key = key;
+}
+
+void HmacSha256_Update(HmacSha256Ctx *ctx, const void *data, uint32_t len) {
+    Sha256_Update(&ctx->sha, data, len);
+}
+
+void HmacSha256_Final(HmacSha256Ctx *ctx, uint8_t mac[HMAC_SHA256_BYTES]) {
+    uint8_t inner[SHA256_DIGEST_BYTES];
+    Sha256_Final(&ctx->sha, inner);
+    memcpy(ctx->sha.state, ctx->key->outer, sizeof(ctx->key->outer));
+    ctx->sha.length = SHA256_BLOCK_BYTES;
+    ctx->sha.buffered = 0;
+    Sha256_Update(&ctx->sha, inner, sizeof(inner));
+    Sha256_Final(&ctx->sha, mac);
+}
+
+bool HmacSha256_Equal(const uint8_t a[HMAC_SHA256_BYTES], const uint8_t b[HMAC_SHA256_BYTES]) {
+    uint8_t diff = 0;
+    for (uint32_t i = 0; i < HMAC_SHA256_BYTES; i++) {
+        diff |= a[i] ^ b[i];
+    }
+    return diff == 0;
+}
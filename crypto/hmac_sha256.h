@@ -0,0 +1,49 @@
+/**
+ * @file hmac_sha256.h
+ * @brief HMAC-SHA256 (RFC 2104) with precomputed key states.
+ *
+ * HmacSha256_SetKey absorbs the padded key into an inner and an outer
+ * state once. Each MAC then starts from those states, which saves two
+ * compressions per message. The key states are secret: clear them with
+ * HmacSha256_ClearKey when done.
+ */
+
+#ifndef HMAC_SHA256_H
+#define HMAC_SHA256_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sha256.h"
+
+#define HMAC_SHA256_BYTES           SHA256_DIGEST_BYTES
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t inner[8];          // State after (key ^ ipad)
+    uint32_t outer[8];          // State after (key ^ opad)
+} HmacSha256Key;
+
+typedef struct {
+    Sha256Ctx            sha;
+    const HmacSha256Key *key;
+} HmacSha256Ctx;
+
+// --- Public Function Declarations ---
+
+void HmacSha256_SetKey(HmacSha256Key *key, const uint8_t *secret, uint32_t len);
+void HmacSha256_ClearKey(HmacSha256Key *key);
+
+void HmacSha256_Init(HmacSha256Ctx *ctx, const HmacSha256Key *key);
+void HmacSha256_Update(HmacSha256Ctx *ctx, const void *data, uint32_t len);
+void HmacSha256_Final(HmacSha256Ctx *ctx, uint8_t mac[HMAC_SHA256_BYTES]);
+
+/**
+ * @brief Compares two MACs in time independent of where they differ.
+ *
+ * @return True if equal.
+ */
+bool HmacSha256_Equal(const uint8_t a[HMAC_SHA256_BYTES], const uint8_t b[HMAC_SHA256_BYTES]);
+
+#endif // HMAC_SHA256_H
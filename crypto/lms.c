@@ -0,0 +1,325 @@
+/**
+ * @file lms.c
+ * @brief Implementation of LMS and HSS verification.
+ */
+
+#include "lms.h"
+#include "sha256.h"
+#include "sha256_mb.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define N                           32U     // Hash output bytes, n = m = 32
+#define ID_BYTES                    16U     // Tree identifier I
+#define OTS_MAX_P                   265U    // Chains for W1
+
+#define D_PBLC                      0x8080U
+#define D_MESG                      0x8181U
+#define D_LEAF                      0x8282U
+#define D_INTR                      0x8383U
+
+// A chain step hashes I || u32 q || u16 i || u8 j || tmp
+#define CHAIN_J                     (ID_BYTES + 6U)
+#define CHAIN_TMP                   (ID_BYTES + 7U)
+#define CHAIN_MESSAGE               (CHAIN_TMP + N)
+
+_Static_assert(CHAIN_MESSAGE <= SHA256_MB_MAX_MESSAGE, "a chain step must be a single block");
+
+// --- Private Types ---
+
+typedef struct {
+    uint8_t  w;                     // Winternitz width in bits
+    uint16_t p;                     // Chains
+    uint8_t  ls;                    // Checksum left shift
+} OtsParams;
+
+// Chains in flight occupy lanes 0 .. active - 1
+typedef struct {
+    uint8_t  block[SHA256_MB_LANES][SHA256_BLOCK_BYTES];
+    uint16_t chain[SHA256_MB_LANES];
+    uint8_t  z[OTS_MAX_P][N];       // Chain ends, in chain order
+} ChainWork;
+
+// --- Private Variables ---
+static const OtsParams OtsTable[] = {
+    [LMOTS_SHA256_N32_W1] = { 1, 265, 7 },
+    [LMOTS_SHA256_N32_W2] = { 2, 133, 6 },
+    [LMOTS_SHA256_N32_W4] = { 4, 67, 4 },
+    [LMOTS_SHA256_N32_W8] = { 8, 34, 0 },
+};
+
+static ChainWork Work;
+static uint32_t Lanes = SHA256_MB_LANES;
+static LmsStats Stats;
+
+// --- Private Helper Functions ---
+
+static uint32_t LoadBe32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void StoreBe32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void StoreBe16(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static const OtsParams *OtsParamsFor(uint32_t type) {
+    if (type < LMOTS_SHA256_N32_W1 || type > LMOTS_SHA256_N32_W8) {
+        return NULL;
+    }
+    return &OtsTable[type];
+}
+
+// Tree height, or 0 if unsupported
+static uint32_t TreeHeight(uint32_t type) {
+    if (type < LMS_SHA256_M32_H5 || type > LMS_SHA256_M32_H25) {
+        return 0;
+    }
+    return 5U * (type - LMS_SHA256_M32_H5 + 1U);
+}
+
+static uint32_t OtsSignatureBytes(const OtsParams *ots) {
+    return 4U + N + (uint32_t)ots->p * N;
+}
+
+// coef(S, i, w): the i-th w-bit digit of S, most significant first
+static uint32_t Coef(const uint8_t *s, uint32_t i, uint32_t w) {
+    uint32_t shift = 8U - (w * (i % (8U / w)) + w);
+    return (s[i * w / 8U] >> shift) & ((1U << w) - 1U);
+}
+
+static uint32_t Checksum(const uint8_t digest[N], const OtsParams *ots) {
+    uint32_t max = (1U << ots->w) - 1U;
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < N * 8U / ots->w; i++) {
+        sum += max - Coef(digest, i, ots->w);
+    }
+    return (sum << ots->ls) & 0xFFFFU;
+}
+
+// H(I || u32 r || u16 d || a [|| b])
+static void HashNode(uint8_t out[N], const uint8_t *id, uint32_t r, uint32_t d, const uint8_t *a, uint32_t a_len,
+                     const uint8_t *b) {
+    uint8_t head[6];
+    StoreBe32(head, r);
+    StoreBe16(head + 4, d);
+    Sha256Ctx ctx;
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, id, ID_BYTES);
+    Sha256_Update(&ctx, head, sizeof(head));
+    Sha256_Update(&ctx, a, a_len);
+    if (b != NULL) {
+        Sha256_Update(&ctx, b, N);
+    }
+    Sha256_Final(&ctx, out);
+}
+
+// Runs chain i from digit a_i to 2^w - 1, starting at y[i], into Work.z[i]
+static void RunChains(const uint8_t *id, const uint8_t *q, const uint8_t *digits, const OtsParams *ots,
+                      const uint8_t *y) {
+    const uint8_t *in[SHA256_MB_LANES];
+    uint8_t *out[SHA256_MB_LANES];
+    uint32_t max = (1U << ots->w) - 1U;
+    for (uint32_t l = 0; l < Lanes; l++) {
+        memcpy(Work.block[l], id, ID_BYTES);
+        memcpy(&Work.block[l][ID_BYTES], q, 4);
+        Sha256Mb_Pad(Work.block[l], CHAIN_MESSAGE);
+        in[l] = Work.block[l];
+        out[l] = &Work.block[l][CHAIN_TMP];
+    }
+
+    uint32_t next = 0;
+    uint32_t active = 0;
+    for (;;) {
+        // Free lanes take the next chains
+        while (active < Lanes && next < ots->p) {
+            uint32_t a = Coef(digits, next, ots->w);
+            if (a == max) {
+                memcpy(Work.z[next], &y[next * N], N);
+            } else {
+                uint8_t *b = Work.block[active];
+                StoreBe16(&b[ID_BYTES + 4U], next);
+                b[CHAIN_J] = (uint8_t)a;
+                memcpy(&b[CHAIN_TMP], &y[next * N], N);
+                Work.chain[active++] = (uint16_t)next;
+            }
+            next++;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        Sha256Mb_Digest(in, out, active);
+        Stats.chain_steps += active;
+        Stats.lane_batches++;
+
+        // Finished lanes hand their slot to the last active lane
+        for (uint32_t l = 0; l < active;) {
+            uint8_t *b = Work.block[l];
+            if (++b[CHAIN_J] < max) {
+                l++;
+                continue;
+            }
+            memcpy(Work.z[Work.chain[l]], &b[CHAIN_TMP], N);
+            active--;
+            if (l != active) {
+                memcpy(b, Work.block[active], SHA256_BLOCK_BYTES);
+                Work.chain[l] = Work.chain[active];
+            }
+        }
+    }
+}
+
+// LM-OTS candidate public key Kc (RFC 8554 Algorithm 4b); ots_sig follows the type word
+static void OtsCandidate(uint8_t kc[N], const uint8_t *id, const uint8_t *q, const OtsParams *ots,
+                         const uint8_t *ots_sig, const uint8_t *msg, uint32_t msg_len) {
+    const uint8_t *c = ots_sig;
+    const uint8_t *y = ots_sig + N;
+
+    // Q || Cksm(Q), Q = H(I || q || D_MESG || C || message)
+    uint8_t digits[N + 2U];
+    uint8_t head[2];
+    StoreBe16(head, D_MESG);
+    Sha256Ctx ctx;
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, id, ID_BYTES);
+    Sha256_Update(&ctx, q, 4);
+    Sha256_Update(&ctx, head, sizeof(head));
+    Sha256_Update(&ctx, c, N);
+    Sha256_Update(&ctx, msg, msg_len);
+    Sha256_Final(&ctx, digits);
+    StoreBe16(&digits[N], Checksum(digits, ots));
+
+    RunChains(id, q, digits, ots, y);
+
+    StoreBe16(head, D_PBLC);
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, id, ID_BYTES);
+    Sha256_Update(&ctx, q, 4);
+    Sha256_Update(&ctx, head, sizeof(head));
+    Sha256_Update(&ctx, Work.z, (uint32_t)ots->p * N);
+    Sha256_Final(&ctx, kc);
+}
+
+// RFC 8554 Algorithm 6a, for a pub of LMS_PUBLIC_KEY_BYTES
+static bool VerifyLms(const uint8_t *pub, const uint8_t *msg, uint32_t msg_len, const uint8_t *sig,
+                      uint32_t sig_len) {
+    uint32_t lms_type = LoadBe32(pub);
+    uint32_t ots_type = LoadBe32(pub + 4);
+    const uint8_t *id = pub + 8;
+    const uint8_t *root = pub + 8 + ID_BYTES;
+    uint32_t height = TreeHeight(lms_type);
+    const OtsParams *ots = OtsParamsFor(ots_type);
+    if (height == 0 || ots == NULL || sig_len != Lms_SignatureBytes(lms_type, ots_type)) {
+        return false;
+    }
+    uint32_t ots_bytes = OtsSignatureBytes(ots);
+    uint32_t q = LoadBe32(sig);
+    if (LoadBe32(sig + 4) != ots_type || LoadBe32(sig + 4 + ots_bytes) != lms_type || q >= (1UL << height)) {
+        return false;
+    }
+
+    uint8_t tmp[N];
+    OtsCandidate(tmp, id, sig, ots, sig + 8, msg, msg_len);
+
+    // Leaf, then up the authentication path
+    const uint8_t *path = sig + 4U + ots_bytes + 4U;
+    uint32_t node = (1UL << height) + q;
+    HashNode(tmp, id, node, D_LEAF, tmp, N, NULL);
+    for (uint32_t i = 0; i < height; i++, node >>= 1) {
+        const uint8_t *sibling = &path[i * N];
+        if (node & 1U) {
+            HashNode(tmp, id, node >> 1, D_INTR, sibling, N, tmp);
+        } else {
+            HashNode(tmp, id, node >> 1, D_INTR, tmp, N, sibling);
+        }
+    }
+    return memcmp(tmp, root, N) == 0;
+}
+
+// Length of the LMS signature at sig, from its own type fields; 0 if malformed
+static uint32_t EmbeddedSignatureBytes(const uint8_t *sig, uint32_t available) {
+    if (available < 8U) {
+        return 0;
+    }
+    const OtsParams *ots = OtsParamsFor(LoadBe32(sig + 4));
+    if (ots == NULL || available < 4U + OtsSignatureBytes(ots) + 4U) {
+        return 0;
+    }
+    uint32_t len = Lms_SignatureBytes(LoadBe32(sig + 4U + OtsSignatureBytes(ots)), LoadBe32(sig + 4));
+    return (len <= available) ? len : 0;
+}
+
+static bool Result(bool ok) {
+    if (ok) {
+        Stats.verified++;
+    } else {
+        Stats.rejected++;
+    }
+    return ok;
+}
+
+// --- Public Function Implementations ---
+
+bool Lms_Verify(const uint8_t *pub, uint32_t pub_len, const uint8_t *msg, uint32_t msg_len, const uint8_t *sig,
+                uint32_t sig_len) {
+    return Result(pub_len == LMS_PUBLIC_KEY_BYTES && VerifyLms(pub, msg, msg_len, sig, sig_len));
+}
+
+bool Hss_Verify(const uint8_t *pub, uint32_t pub_len, const uint8_t *msg, uint32_t msg_len, const uint8_t *sig,
+                uint32_t sig_len) {
+    if (pub_len != HSS_PUBLIC_KEY_BYTES || sig_len < 4U) {
+        return Result(false);
+    }
+    uint32_t levels = LoadBe32(pub);
+    if (levels == 0 || levels > HSS_MAX_LEVELS || LoadBe32(sig) != levels - 1U) {
+        return Result(false);
+    }
+
+    // Each upper level signs the LMS public key that follows its signature
+    const uint8_t *key = pub + 4;
+    const uint8_t *p = sig + 4;
+    uint32_t remaining = sig_len - 4U;
+    for (uint32_t level = 0; level + 1U < levels; level++) {
+        uint32_t len = EmbeddedSignatureBytes(p, remaining);
+        if (len == 0 || remaining - len < LMS_PUBLIC_KEY_BYTES) {
+            return Result(false);
+        }
+        const uint8_t *next_key = p + len;
+        if (!VerifyLms(key, next_key, LMS_PUBLIC_KEY_BYTES, p, len)) {
+            return Result(false);
+        }
+        key = next_key;
+        p += len + LMS_PUBLIC_KEY_BYTES;
+        remaining -= len + LMS_PUBLIC_KEY_BYTES;
+    }
+    return Result(VerifyLms(key, msg, msg_len, p, remaining));
+}
+
+uint32_t Lms_SignatureBytes(uint32_t lms_type, uint32_t ots_type) {
+    uint32_t height = TreeHeight(lms_type);
+    const OtsParams *ots = OtsParamsFor(ots_type);
+    if (height == 0 || ots == NULL) {
+        return 0;
+    }
+    return 4U + OtsSignatureBytes(ots) + 4U + height * N;
+}
+
+void Lms_SetLanes(uint32_t lanes) {
+    if (lanes < 1U) {
+        lanes = 1U;
+    }
+    Lanes = (lanes > SHA256_MB_LANES) ? SHA256_MB_LANES : lanes;
+}
+
+const LmsStats *Lms_Stats(void) {
+    return &Stats;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file lms.h
+ * @brief LMS and HSS hash-based signature verification (RFC 8554, SP 800-208).
+ *
+ * LMS signs with one-time Winternitz (LM-OTS) keys at the leaves of a
+ * Merkle tree. Verification rebuilds the one-time public key from the
+ * signature, then climbs the authentication path to the root. HSS stacks
+ * LMS trees: each level signs the public key of the level below.
+ *
+ * Nearly all of the cost is the Winternitz chains. There are p
+ * independent chains of up to 2^w - 1 steps, and each step is one
+ * SHA-256 block. The chains run in parallel lanes through
+ * crypto/sha256_mb.h. A lane that finishes its chain takes the next
+ * chain at once, so lanes do not wait for the longest chain in a group.
+ * Only the chain ends are stored, in order: up to p x 32 bytes in a
+ * static working set, which is 8.5 KB for W1 and 2.1 KB for W4.
+ *
+ * Only SHA-256 with 32-byte outputs is supported: LMS_SHA256_M32_H5..H25
+ * with LMOTS_SHA256_N32_W1..W8. The message is hashed in a single
+ * streaming pass, so it can be a whole firmware image in place.
+ *
+ * Verification handles public data only and is not constant time.
+ * Signing is stateful and stays on the host: see tools/lms_sign.py.
+ */
+
+#ifndef LMS_H
+#define LMS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Algorithm Types (RFC 8554 Section 3.2) ---
+#define LMS_SHA256_M32_H5           5U
+#define LMS_SHA256_M32_H10          6U
+#define LMS_SHA256_M32_H15          7U
+#define LMS_SHA256_M32_H20          8U
+#define LMS_SHA256_M32_H25          9U
+
+#define LMOTS_SHA256_N32_W1         1U
+#define LMOTS_SHA256_N32_W2         2U
+#define LMOTS_SHA256_N32_W4         3U
+#define LMOTS_SHA256_N32_W8         4U
+
+#define LMS_PUBLIC_KEY_BYTES        56U     // lms type || ots type || I || T[1]
+#define HSS_PUBLIC_KEY_BYTES        (4U + LMS_PUBLIC_KEY_BYTES)
+#define HSS_MAX_LEVELS              8U
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t verified;              // Lms_Verify and Hss_Verify calls that held
+    uint32_t rejected;
+    uint32_t chain_steps;           // Winternitz chain hashes
+    uint32_t lane_batches;          // Multi-buffer digest calls
+} LmsStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Verifies an LMS signature over msg.
+ *
+ * @param pub LMS public key, LMS_PUBLIC_KEY_BYTES.
+ */
+bool Lms_Verify(const uint8_t *pub, uint32_t pub_len, const uint8_t *msg, uint32_t msg_len, const uint8_t *sig,
+                uint32_t sig_len);
+
+/**
+ * @brief Verifies an HSS signature over msg, every level down to the leaf.
+ *
+ * @param pub HSS public key: level count || top LMS public key.
+ */
+bool Hss_Verify(const uint8_t *pub, uint32_t pub_len, const uint8_t *msg, uint32_t msg_len, const uint8_t *sig,
+                uint32_t sig_len);
+
+/**
+ * @brief LMS signature size for a pair of types, or 0 if either is unsupported.
+ */
+uint32_t Lms_SignatureBytes(uint32_t lms_type, uint32_t ots_type);
+
+/**
+ * @brief Sets how many lanes the chains use (1 .. SHA256_MB_LANES).
+ *
+ * One lane is the sequential baseline, for benchmarks.
+ */
+void Lms_SetLanes(uint32_t lanes);
+
+const LmsStats *Lms_Stats(void);
+
+#endif // LMS_H
@@ -0,0 +1,505 @@
+/**
+ * @file ml_dsa.c
+ * @brief Implementation of ML-DSA-65.
+ */
+
+#include "ml_dsa.h"
+#include "pq_ntt.h"
+#include "sha3.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define K                           ML_DSA_65_K
+#define L                           ML_DSA_65_L
+#define ETA                         4
+#define TAU                         49U
+#define BETA                        ((int32_t)TAU * ETA)
+#define GAMMA1                      (1 << 19)
+#define GAMMA2                      ((ML_DSA_Q - 1) / 32)
+#define OMEGA                       55U
+#define D                           13U
+
+#define SEED_BYTES                  32U
+#define CRH_BYTES                   64U     // tr, mu, rho' and rho''
+#define CTILDE_BYTES                48U
+#define T1_POLY_BYTES               320U    // 10 bits per coefficient
+#define T0_POLY_BYTES               416U    // 13
+#define ETA_POLY_BYTES              128U    // 4
+#define Z_POLY_BYTES                640U    // 20
+#define W1_POLY_BYTES               128U    // 4
+
+// Key and signature layouts
+#define SK_TR                       (2U * SEED_BYTES)
+#define SK_S1                       (SK_TR + CRH_BYTES)
+#define SK_S2                       (SK_S1 + L * ETA_POLY_BYTES)
+#define SK_T0                       (SK_S2 + K * ETA_POLY_BYTES)
+#define SIG_Z                       CTILDE_BYTES
+#define SIG_H                       (SIG_Z + L * Z_POLY_BYTES)
+
+#define MAX_NONCE                   0xFFFFU // ExpandMask counters are 16 bits
+
+_Static_assert(SEED_BYTES + K * T1_POLY_BYTES == ML_DSA_65_PK_BYTES, "pk is rho || t1");
+_Static_assert(SK_T0 + K * T0_POLY_BYTES == ML_DSA_65_SK_BYTES, "sk is rho || K || tr || s1 || s2 || t0");
+_Static_assert(SIG_H + OMEGA + K == ML_DSA_65_SIG_BYTES, "sig is c~ || z || h");
+
+// --- Private Types ---
+
+typedef struct {
+    int32_t c[PQ_N];
+} Poly;
+
+// --- Private Helper Functions ---
+
+static void PolyAdd(Poly *r, const Poly *a) {
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        r->c[i] += a->c[i];
+    }
+}
+
+static void PolyReduce(Poly *a) {
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        a->c[i] = PqDsa_Reduce32(a->c[i]);
+    }
+}
+
+// r = a * b / 2^32 transformed back: the plain product when a and b are NTT outputs
+static void PolyMulInvNtt(Poly *r, const Poly *a, const Poly *b) {
+    PqDsa_PointwiseMul(r->c, a->c, b->c);
+    PqDsa_InvNtt(r->c);
+}
+
+// Whether every |a[i]| < bound, for reduced a. Leaks which coefficient
+// fails, which is independent of the key, but never the sign.
+static bool PolyNormBelow(const Poly *a, int32_t bound) {
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        int32_t t = a->c[i] >> 31;
+        t = a->c[i] - (t & (2 * a->c[i]));
+        if (t >= bound) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// FIPS 204 BitPack: packs centre - a[i] in bits each, or a[i] itself when centre is 0
+static void PackBits(uint8_t *r, const Poly *a, uint32_t bits, int32_t centre) {
+    uint32_t acc = 0;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        uint32_t v = (uint32_t)(centre != 0 ? centre - a->c[i] : a->c[i]);
+        acc |= v << n;
+        n += bits;
+        while (n >= 8U) {
+            *r++ = (uint8_t)acc;
+            acc >>= 8;
+            n -= 8U;
+        }
+    }
+}
+
+static void UnpackBits(Poly *r, const uint8_t *a, uint32_t bits, int32_t centre) {
+    uint32_t acc = 0;
+    uint32_t n = 0;
+    uint32_t mask = (1U << bits) - 1U;
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        while (n < bits) {
+            acc |= (uint32_t)*a++ << n;
+            n += 8U;
+        }
+        int32_t v = (int32_t)(acc & mask);
+        acc >>= bits;
+        n -= bits;
+        r->c[i] = centre != 0 ? centre - v : v;
+    }
+}
+
+// High bits a1 of a in [0, q), with a = a1 * 2 gamma2 + a0
+static int32_t Decompose(int32_t *a0, int32_t a) {
+    int32_t a1 = (a + 127) >> 7;
+    a1 = (a1 * 1025 + (1 << 21)) >> 22;
+    a1 &= 15;
+    *a0 = a - a1 * 2 * GAMMA2;
+    *a0 -= (((ML_DSA_Q - 1) / 2 - *a0) >> 31) & ML_DSA_Q;
+    return a1;
+}
+
+static uint32_t MakeHint(int32_t a0, int32_t a1) {
+    return (a0 > GAMMA2 || a0 < -GAMMA2 || (a0 == -GAMMA2 && a1 != 0)) ? 1U : 0U;
+}
+
+static int32_t UseHint(int32_t a, uint32_t hint) {
+    int32_t a0;
+    int32_t a1 = Decompose(&a0, a);
+    if (hint == 0) {
+        return a1;
+    }
+    return (a0 > 0) ? ((a1 + 1) & 15) : ((a1 - 1) & 15);
+}
+
+// A[i][j] = RejNTTPoly(rho || j || i)
+static void SampleUniform(Poly *a, const uint8_t rho[SEED_BYTES], uint32_t j, uint32_t i) {
+    Keccak k;
+    uint8_t idx[2] = { (uint8_t)j, (uint8_t)i };
+    Shake128_Init(&k);
+    Keccak_Absorb(&k, rho, SEED_BYTES);
+    Keccak_Absorb(&k, idx, sizeof(idx));
+    Keccak_Finalize(&k);
+
+    uint8_t buf[SHAKE128_RATE];
+    uint32_t n = 0;
+    while (n < PQ_N) {
+        Keccak_Squeeze(&k, buf, sizeof(buf));
+        for (uint32_t p = 0; p < sizeof(buf) && n < PQ_N; p += 3U) {
+            uint32_t t = buf[p] | ((uint32_t)buf[p + 1U] << 8) | ((uint32_t)(buf[p + 2U] & 0x7FU) << 16);
+            if (t < (uint32_t)ML_DSA_Q) {
+                a->c[n++] = (int32_t)t;
+            }
+        }
+    }
+}
+
+// RejBoundedPoly(rho' || nonce) for eta = 4
+static void SampleEta(Poly *a, const uint8_t rhop[CRH_BYTES], uint32_t nonce) {
+    Keccak k;
+    uint8_t idx[2] = { (uint8_t)nonce, (uint8_t)(nonce >> 8) };
+    Shake256_Init(&k);
+    Keccak_Absorb(&k, rhop, CRH_BYTES);
+    Keccak_Absorb(&k, idx, sizeof(idx));
+    Keccak_Finalize(&k);
+
+    uint8_t buf[SHAKE256_RATE];
+    uint32_t n = 0;
+    while (n < PQ_N) {
+        Keccak_Squeeze(&k, buf, sizeof(buf));
+        for (uint32_t p = 0; p < sizeof(buf) && n < PQ_N; p++) {
+            uint32_t z0 = buf[p] & 0x0FU;
+            uint32_t z1 = (uint32_t)buf[p] >> 4;
+            if (z0 < 9U) {
+                a->c[n++] = ETA - (int32_t)z0;
+            }
+            if (z1 < 9U && n < PQ_N) {
+                a->c[n++] = ETA - (int32_t)z1;
+            }
+        }
+    }
+    memset(buf, 0, sizeof(buf));
+    memset(&k, 0, sizeof(k));
+}
+
+// Entry nonce of ExpandMask(rho'', kappa): y = gamma1 - 20-bit values
+static void SampleMask(Poly *a, const uint8_t rhopp[CRH_BYTES], uint32_t nonce) {
+    uint8_t in[CRH_BYTES + 2U];
+    uint8_t buf[Z_POLY_BYTES];
+    memcpy(in, rhopp, CRH_BYTES);
+    in[CRH_BYTES] = (uint8_t)nonce;
+    in[CRH_BYTES + 1U] = (uint8_t)(nonce >> 8);
+    Shake256(buf, sizeof(buf), in, sizeof(in));
+    UnpackBits(a, buf, 20, GAMMA1);
+    memset(in, 0, sizeof(in));
+    memset(buf, 0, sizeof(buf));
+}
+
+// SampleInBall(c~): tau coefficients of +-1
+static void SampleInBall(Poly *c, const uint8_t ctilde[CTILDE_BYTES]) {
+    Keccak k;
+    Shake256_Init(&k);
+    Keccak_Absorb(&k, ctilde, CTILDE_BYTES);
+    Keccak_Finalize(&k);
+
+    uint8_t buf[SHAKE256_RATE];
+    Keccak_Squeeze(&k, buf, sizeof(buf));
+    uint64_t signs = 0;
+    for (uint32_t i = 0; i < 8U; i++) {
+        signs |= (uint64_t)buf[i] << (8U * i);
+    }
+    uint32_t pos = 8;
+
+    memset(c, 0, sizeof(*c));
+    for (uint32_t i = PQ_N - TAU; i < PQ_N; i++) {
+        uint32_t j;
+        do {
+            if (pos == sizeof(buf)) {
+                Keccak_Squeeze(&k, buf, sizeof(buf));
+                pos = 0;
+            }
+            j = buf[pos++];
+        } while (j > i);
+        c->c[i] = c->c[j];
+        c->c[j] = 1 - 2 * (int32_t)(signs & 1U);
+        signs >>= 1;
+    }
+}
+
+// mu = H(tr || 0 || |ctx| || ctx || msg, 64)
+static void MessageRepresentative(uint8_t mu[CRH_BYTES], const uint8_t tr[CRH_BYTES], const uint8_t *msg,
+                                  uint32_t msg_len, const uint8_t *ctx, uint32_t ctx_len) {
+    Keccak k;
+    uint8_t prefix[2] = { 0, (uint8_t)ctx_len };
+    Shake256_Init(&k);
+    Keccak_Absorb(&k, tr, CRH_BYTES);
+    Keccak_Absorb(&k, prefix, sizeof(prefix));
+    Keccak_Absorb(&k, ctx, ctx_len);
+    Keccak_Absorb(&k, msg, msg_len);
+    Keccak_Finalize(&k);
+    Keccak_Squeeze(&k, mu, CRH_BYTES);
+}
+
+// Checks HintBitUnpack's rules: per-row ends in order and within omega,
+// positions strictly increasing within a row, unused slots zero
+static bool HintsValid(const uint8_t *h) {
+    uint32_t index = 0;
+    for (uint32_t i = 0; i < K; i++) {
+        uint32_t end = h[OMEGA + i];
+        if (end < index || end > OMEGA) {
+            return false;
+        }
+        for (uint32_t j = index + 1U; j < end; j++) {
+            if (h[j] <= h[j - 1U]) {
+                return false;
+            }
+        }
+        index = end;
+    }
+    for (uint32_t j = index; j < OMEGA; j++) {
+        if (h[j] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One pass of the signing loop with mask counter kappa; fills sig on success
+static bool SignAttempt(uint8_t *sig, const uint8_t *sk, const uint8_t mu[CRH_BYTES],
+                        const uint8_t rhopp[CRH_BYTES], uint32_t kappa) {
+    const uint8_t *rho = sk;
+    Poly w[K], c, t, u;
+    bool ok = true;
+
+    // w = A y, a column at a time
+    memset(w, 0, sizeof(w));
+    for (uint32_t j = 0; j < L; j++) {
+        SampleMask(&t, rhopp, kappa + j);
+        PqDsa_Ntt(t.c);
+        for (uint32_t i = 0; i < K; i++) {
+            SampleUniform(&u, rho, j, i);
+            PqDsa_PointwiseMul(u.c, u.c, t.c);
+            PolyAdd(&w[i], &u);
+        }
+    }
+
+    // c~ = H(mu || w1Encode(w1)), hashed a row at a time
+    Keccak h;
+    uint8_t w1_bytes[W1_POLY_BYTES];
+    Shake256_Init(&h);
+    Keccak_Absorb(&h, mu, CRH_BYTES);
+    for (uint32_t i = 0; i < K; i++) {
+        PolyReduce(&w[i]);
+        PqDsa_InvNtt(w[i].c);
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            int32_t a0;
+            w[i].c[n] = PqDsa_AddQ(w[i].c[n]);
+            u.c[n] = Decompose(&a0, w[i].c[n]);
+        }
+        PackBits(w1_bytes, &u, 4, 0);
+        Keccak_Absorb(&h, w1_bytes, sizeof(w1_bytes));
+    }
+    Keccak_Finalize(&h);
+    Keccak_Squeeze(&h, sig, CTILDE_BYTES);
+    SampleInBall(&c, sig);
+    PqDsa_Ntt(c.c);
+
+    // z = y + c s1, written out as it passes
+    for (uint32_t j = 0; j < L && ok; j++) {
+        UnpackBits(&t, sk + SK_S1 + j * ETA_POLY_BYTES, 4, ETA);
+        PqDsa_Ntt(t.c);
+        PolyMulInvNtt(&t, &c, &t);
+        SampleMask(&u, rhopp, kappa + j);
+        PolyAdd(&t, &u);
+        PolyReduce(&t);
+        ok = PolyNormBelow(&t, GAMMA1 - BETA);
+        PackBits(sig + SIG_Z + j * Z_POLY_BYTES, &t, 20, GAMMA1);
+    }
+
+    // Hints, from r0 = LowBits(w - c s2) and c t0
+    uint8_t *hint = sig + SIG_H;
+    uint32_t hints = 0;
+    memset(hint, 0, OMEGA + K);
+    for (uint32_t i = 0; i < K && ok; i++) {
+        UnpackBits(&t, sk + SK_S2 + i * ETA_POLY_BYTES, 4, ETA);
+        PqDsa_Ntt(t.c);
+        PolyMulInvNtt(&t, &c, &t);
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            int32_t a0;
+            w[i].c[n] = Decompose(&a0, w[i].c[n]);
+            t.c[n] = PqDsa_Reduce32(a0 - t.c[n]);
+        }
+        ok = PolyNormBelow(&t, GAMMA2 - BETA);
+
+        UnpackBits(&u, sk + SK_T0 + i * T0_POLY_BYTES, D, 1 << (D - 1U));
+        PqDsa_Ntt(u.c);
+        PolyMulInvNtt(&u, &c, &u);
+        PolyReduce(&u);
+        ok = ok && PolyNormBelow(&u, GAMMA2);
+
+        for (uint32_t n = 0; n < PQ_N && ok; n++) {
+            if (MakeHint(t.c[n] + u.c[n], w[i].c[n]) != 0) {
+                if (hints == OMEGA) {
+                    ok = false;
+                    break;
+                }
+                hint[hints++] = (uint8_t)n;
+            }
+        }
+        hint[OMEGA + i] = (uint8_t)hints;
+    }
+
+    memset(w, 0, sizeof(w));
+    memset(&t, 0, sizeof(t));
+    memset(&u, 0, sizeof(u));
+    return ok;
+}
+
+// --- Public Function Implementations ---
+
+void MlDsa65_KeyGen(uint8_t pk[ML_DSA_65_PK_BYTES], uint8_t sk[ML_DSA_65_SK_BYTES],
+                    const uint8_t seed[ML_DSA_SEED_BYTES]) {
+    // (rho, rho', K) = H(xi || k || l, 128)
+    uint8_t in[SEED_BYTES + 2U];
+    uint8_t seeds[SEED_BYTES + CRH_BYTES + SEED_BYTES];
+    memcpy(in, seed, SEED_BYTES);
+    in[SEED_BYTES] = (uint8_t)K;
+    in[SEED_BYTES + 1U] = (uint8_t)L;
+    Shake256(seeds, sizeof(seeds), in, sizeof(in));
+    const uint8_t *rho = seeds;
+    const uint8_t *rhop = seeds + SEED_BYTES;
+    memcpy(pk, rho, SEED_BYTES);
+    memcpy(sk, rho, SEED_BYTES);
+    memcpy(sk + SEED_BYTES, seeds + SEED_BYTES + CRH_BYTES, SEED_BYTES);
+
+    Poly s1[L], acc, t;
+    for (uint32_t j = 0; j < L; j++) {
+        SampleEta(&s1[j], rhop, j);
+        PackBits(sk + SK_S1 + j * ETA_POLY_BYTES, &s1[j], 4, ETA);
+        PqDsa_Ntt(s1[j].c);
+    }
+
+    // t = A s1 + s2 = t1 2^d + t0, a row at a time
+    for (uint32_t i = 0; i < K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (uint32_t j = 0; j < L; j++) {
+            SampleUniform(&t, rho, j, i);
+            PqDsa_PointwiseMul(t.c, t.c, s1[j].c);
+            PolyAdd(&acc, &t);
+        }
+        PolyReduce(&acc);
+        PqDsa_InvNtt(acc.c);
+        SampleEta(&t, rhop, L + i);
+        PackBits(sk + SK_S2 + i * ETA_POLY_BYTES, &t, 4, ETA);
+        PolyAdd(&acc, &t);
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            int32_t a = PqDsa_Freeze(acc.c[n]);
+            acc.c[n] = (a + (1 << (D - 1U)) - 1) >> D;
+            t.c[n] = a - (acc.c[n] << D);
+        }
+        PackBits(pk + SEED_BYTES + i * T1_POLY_BYTES, &acc, 10, 0);
+        PackBits(sk + SK_T0 + i * T0_POLY_BYTES, &t, D, 1 << (D - 1U));
+    }
+    Shake256(sk + SK_TR, CRH_BYTES, pk, ML_DSA_65_PK_BYTES);
+
+    memset(in, 0, sizeof(in));
+    memset(seeds, 0, sizeof(seeds));
+    memset(s1, 0, sizeof(s1));
+    memset(&acc, 0, sizeof(acc));
+    memset(&t, 0, sizeof(t));
+}
+
+bool MlDsa65_Sign(uint8_t sig[ML_DSA_65_SIG_BYTES], const uint8_t *msg, uint32_t msg_len, const uint8_t *ctx,
+                  uint32_t ctx_len, const uint8_t sk[ML_DSA_65_SK_BYTES], const uint8_t rnd[ML_DSA_RND_BYTES]) {
+    if (ctx_len > ML_DSA_MAX_CONTEXT) {
+        return false;
+    }
+    uint8_t mu[CRH_BYTES];
+    uint8_t rhopp[CRH_BYTES];
+    MessageRepresentative(mu, sk + SK_TR, msg, msg_len, ctx, ctx_len);
+
+    // rho'' = H(K || rnd || mu, 64)
+    Keccak h;
+    Shake256_Init(&h);
+    Keccak_Absorb(&h, sk + SEED_BYTES, SEED_BYTES);
+    Keccak_Absorb(&h, rnd, ML_DSA_RND_BYTES);
+    Keccak_Absorb(&h, mu, CRH_BYTES);
+    Keccak_Finalize(&h);
+    Keccak_Squeeze(&h, rhopp, CRH_BYTES);
+
+    bool signed_ok = false;
+    for (uint32_t kappa = 0; !signed_ok && kappa + L - 1U <= MAX_NONCE; kappa += L) {
+        signed_ok = SignAttempt(sig, sk, mu, rhopp, kappa);
+    }
+
+    memset(rhopp, 0, sizeof(rhopp));
+    memset(&h, 0, sizeof(h));
+    return signed_ok;
+}
+
+bool MlDsa65_Verify(const uint8_t sig[ML_DSA_65_SIG_BYTES], const uint8_t *msg, uint32_t msg_len,
+                    const uint8_t *ctx, uint32_t ctx_len, const uint8_t pk[ML_DSA_65_PK_BYTES]) {
+    if (ctx_len > ML_DSA_MAX_CONTEXT || !HintsValid(sig + SIG_H)) {
+        return false;
+    }
+    Poly z[L], c, t, acc;
+    for (uint32_t j = 0; j < L; j++) {
+        UnpackBits(&z[j], sig + SIG_Z + j * Z_POLY_BYTES, 20, GAMMA1);
+        if (!PolyNormBelow(&z[j], GAMMA1 - BETA)) {
+            return false;
+        }
+        PqDsa_Ntt(z[j].c);
+    }
+
+    uint8_t tr[CRH_BYTES];
+    uint8_t mu[CRH_BYTES];
+    Shake256(tr, sizeof(tr), pk, ML_DSA_65_PK_BYTES);
+    MessageRepresentative(mu, tr, msg, msg_len, ctx, ctx_len);
+    SampleInBall(&c, sig);
+    PqDsa_Ntt(c.c);
+
+    // w1' = UseHint(h, A z - c t1 2^d), hashed a row at a time
+    const uint8_t *hint = sig + SIG_H;
+    uint32_t next = 0;
+    Keccak h;
+    uint8_t w1_bytes[W1_POLY_BYTES];
+    Shake256_Init(&h);
+    Keccak_Absorb(&h, mu, CRH_BYTES);
+    for (uint32_t i = 0; i < K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (uint32_t j = 0; j < L; j++) {
+            SampleUniform(&t, pk, j, i);
+            PqDsa_PointwiseMul(t.c, t.c, z[j].c);
+            PolyAdd(&acc, &t);
+        }
+        UnpackBits(&t, pk + SEED_BYTES + i * T1_POLY_BYTES, 10, 0);
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            t.c[n] <<= D;
+        }
+        PqDsa_Ntt(t.c);
+        PqDsa_PointwiseMul(t.c, c.c, t.c);
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            acc.c[n] -= t.c[n];
+        }
+        PolyReduce(&acc);
+        PqDsa_InvNtt(acc.c);
+
+        uint32_t end = hint[OMEGA + i];
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            uint32_t set = (next < end && hint[next] == n) ? 1U : 0U;
+            next += set;
+            acc.c[n] = UseHint(PqDsa_AddQ(acc.c[n]), set);
+        }
+        PackBits(w1_bytes, &acc, 4, 0);
+        Keccak_Absorb(&h, w1_bytes, sizeof(w1_bytes));
+    }
+    Keccak_Finalize(&h);
+    uint8_t ctilde[CTILDE_BYTES];
+    Keccak_Squeeze(&h, ctilde, sizeof(ctilde));
+    return memcmp(ctilde, sig, CTILDE_BYTES) == 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file ml_dsa.h
+ * @brief ML-DSA-65 signatures (FIPS 204).
+ *
+ * Pure ML-DSA with a context string of up to 255 bytes, as
+ * ML-DSA.Sign/Verify. Key generation and signing take their randomness as
+ * arguments, as in crypto/ml_kem.h. Pass an all-zero rnd for the
+ * deterministic variant.
+ *
+ * The code trades hashing for RAM, following the "compact" arrangement
+ * for small devices:
+ *  - The 6 x 5 public matrix (30 KB) is never stored. Each entry is
+ *    sampled from SHAKE128 when needed and used for one product.
+ *  - Signing keeps only w (6 polynomials) across an attempt. The mask y
+ *    is sampled again when z is formed, and the secrets are unpacked
+ *    and transformed one polynomial at a time.
+ *  - z and the hints are written straight into the signature. w1 is
+ *    hashed as it is produced.
+ * Peak stack is about 10 KB for signing and 8 KB for verification,
+ * against roughly 50 KB with the matrix and the transformed secrets held
+ * in memory. The price is resampling the matrix on every rejected
+ * attempt (about five per signature on average).
+ *
+ * Signing is not hardened against timing beyond what the algorithm
+ * gives: the rejection loop leaks only the number of attempts, which is
+ * independent of the key. Secret intermediates are cleared before
+ * returning.
+ */
+
+#ifndef ML_DSA_H
+#define ML_DSA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ML_DSA_65_K                 6U
+#define ML_DSA_65_L                 5U
+#define ML_DSA_65_PK_BYTES          1952U
+#define ML_DSA_65_SK_BYTES          4032U
+#define ML_DSA_65_SIG_BYTES         3309U
+#define ML_DSA_SEED_BYTES           32U     // xi
+#define ML_DSA_RND_BYTES            32U
+#define ML_DSA_MAX_CONTEXT          255U
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief ML-DSA.KeyGen_internal(xi).
+ */
+void MlDsa65_KeyGen(uint8_t pk[ML_DSA_65_PK_BYTES], uint8_t sk[ML_DSA_65_SK_BYTES],
+                    const uint8_t seed[ML_DSA_SEED_BYTES]);
+
+/**
+ * @brief Signs msg under context ctx.
+ * @return False if ctx is too long, or (never in practice) the attempt
+ *         counter runs out.
+ */
+bool MlDsa65_Sign(uint8_t sig[ML_DSA_65_SIG_BYTES], const uint8_t *msg, uint32_t msg_len, const uint8_t *ctx,
+                  uint32_t ctx_len, const uint8_t sk[ML_DSA_65_SK_BYTES], const uint8_t rnd[ML_DSA_RND_BYTES]);
+
+/**
+ * @brief Verifies sig over msg under context ctx.
+ */
+bool MlDsa65_Verify(const uint8_t sig[ML_DSA_65_SIG_BYTES], const uint8_t *msg, uint32_t msg_len,
+                    const uint8_t *ctx, uint32_t ctx_len, const uint8_t pk[ML_DSA_65_PK_BYTES]);
+
+#endif // ML_DSA_H
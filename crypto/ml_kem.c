@@ -0,0 +1,383 @@
+/**
+ * @file ml_kem.c
+ * @brief Implementation of ML-KEM-768.
+ */
+
+#include "ml_kem.h"
+#include "pq_ntt.h"
+#include "sha3.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define K                           ML_KEM_768_K
+#define POLY_BYTES                  384U    // 12 bits per coefficient
+#define POLYVEC_BYTES               (K * POLY_BYTES)
+#define DU                          10U
+#define DV                          4U
+#define DU_POLY_BYTES               (PQ_N * DU / 8U)
+#define DV_POLY_BYTES               (PQ_N * DV / 8U)
+#define SEED_BYTES                  32U
+#define MONT_SQ                     1353    // 2^32 mod q: Montgomery-multiplying by it cancels a 2^-16
+
+_Static_assert(POLYVEC_BYTES + SEED_BYTES == ML_KEM_768_EK_BYTES, "ek is t || rho");
+_Static_assert(K * DU_POLY_BYTES + DV_POLY_BYTES == ML_KEM_768_CT_BYTES, "ct is c1 || c2");
+_Static_assert(POLYVEC_BYTES + ML_KEM_768_EK_BYTES + 2U * SEED_BYTES == ML_KEM_768_DK_BYTES,
+               "dk is s || ek || H(ek) || z");
+
+// --- Private Types ---
+
+typedef struct {
+    int16_t c[PQ_N];
+} Poly;
+
+// --- Private Helper Functions ---
+
+static void PolyReduce(Poly *a) {
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        a->c[i] = PqKem_Reduce(a->c[i]);
+    }
+}
+
+static void PolyAdd(Poly *r, const Poly *a) {
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        r->c[i] = (int16_t)(r->c[i] + a->c[i]);
+    }
+}
+
+// NTT followed by a reduction, so products of two transformed polynomials stay in range
+static void PolyNtt(Poly *a) {
+    PqKem_Ntt(a->c);
+    PolyReduce(a);
+}
+
+// Representative in [0, q) of a in (-q, q)
+static uint32_t Canonical(int16_t a) {
+    return (uint32_t)(int32_t)(a + ((a >> 15) & ML_KEM_Q));
+}
+
+// round(2^d a / q) mod 2^d for a in (-q, q)
+static uint32_t Compress(int16_t a, uint32_t d) {
+    uint64_t t = ((uint64_t)Canonical(a) << d) + (ML_KEM_Q + 1) / 2;
+    return (uint32_t)((t * 1290167U) >> 32) & ((1U << d) - 1U);
+}
+
+static int16_t Decompress(uint32_t x, uint32_t d) {
+    return (int16_t)((x * ML_KEM_Q + (1U << (d - 1U))) >> d);
+}
+
+static void Encode12(uint8_t *r, const Poly *a) {
+    for (uint32_t i = 0; i < PQ_N / 2U; i++) {
+        uint32_t t0 = Canonical(a->c[2U * i]);
+        uint32_t t1 = Canonical(a->c[2U * i + 1U]);
+        r[3U * i] = (uint8_t)t0;
+        r[3U * i + 1U] = (uint8_t)((t0 >> 8) | (t1 << 4));
+        r[3U * i + 2U] = (uint8_t)(t1 >> 4);
+    }
+}
+
+// Returns false if any coefficient is >= q
+static bool Decode12(Poly *r, const uint8_t *a) {
+    uint32_t over = 0;
+    for (uint32_t i = 0; i < PQ_N / 2U; i++) {
+        uint32_t t0 = a[3U * i] | ((uint32_t)(a[3U * i + 1U] & 0x0FU) << 8);
+        uint32_t t1 = (uint32_t)(a[3U * i + 1U] >> 4) | ((uint32_t)a[3U * i + 2U] << 4);
+        over |= ((ML_KEM_Q - 1U - t0) | (ML_KEM_Q - 1U - t1)) >> 31;
+        r->c[2U * i] = (int16_t)t0;
+        r->c[2U * i + 1U] = (int16_t)t1;
+    }
+    return over == 0;
+}
+
+static void EncodeDu(uint8_t *r, const Poly *a) {
+    for (uint32_t i = 0; i < PQ_N / 4U; i++) {
+        uint32_t t[4];
+        for (uint32_t j = 0; j < 4U; j++) {
+            t[j] = Compress(a->c[4U * i + j], DU);
+        }
+        r[0] = (uint8_t)t[0];
+        r[1] = (uint8_t)((t[0] >> 8) | (t[1] << 2));
+        r[2] = (uint8_t)((t[1] >> 6) | (t[2] << 4));
+        r[3] = (uint8_t)((t[2] >> 4) | (t[3] << 6));
+        r[4] = (uint8_t)(t[3] >> 2);
+        r += 5;
+    }
+}
+
+static void DecodeDu(Poly *r, const uint8_t *a) {
+    for (uint32_t i = 0; i < PQ_N / 4U; i++) {
+        r->c[4U * i] = Decompress(a[0] | ((uint32_t)(a[1] & 0x03U) << 8), DU);
+        r->c[4U * i + 1U] = Decompress((uint32_t)(a[1] >> 2) | ((uint32_t)(a[2] & 0x0FU) << 6), DU);
+        r->c[4U * i + 2U] = Decompress((uint32_t)(a[2] >> 4) | ((uint32_t)(a[3] & 0x3FU) << 4), DU);
+        r->c[4U * i + 3U] = Decompress((uint32_t)(a[3] >> 6) | ((uint32_t)a[4] << 2), DU);
+        a += 5;
+    }
+}
+
+static void EncodeDv(uint8_t *r, const Poly *a) {
+    for (uint32_t i = 0; i < PQ_N / 2U; i++) {
+        r[i] = (uint8_t)(Compress(a->c[2U * i], DV) | (Compress(a->c[2U * i + 1U], DV) << 4));
+    }
+}
+
+static void DecodeDv(Poly *r, const uint8_t *a) {
+    for (uint32_t i = 0; i < PQ_N / 2U; i++) {
+        r->c[2U * i] = Decompress(a[i] & 0x0FU, DV);
+        r->c[2U * i + 1U] = Decompress((uint32_t)(a[i] >> 4), DV);
+    }
+}
+
+// SampleNTT(rho || x || y): entry A[i][j] is (x, y) = (j, i), its transpose (i, j)
+static void SampleNtt(Poly *a, const uint8_t rho[SEED_BYTES], uint8_t x, uint8_t y) {
+    Keccak k;
+    uint8_t idx[2] = { x, y };
+    Shake128_Init(&k);
+    Keccak_Absorb(&k, rho, SEED_BYTES);
+    Keccak_Absorb(&k, idx, sizeof(idx));
+    Keccak_Finalize(&k);
+
+    uint8_t buf[SHAKE128_RATE];
+    uint32_t n = 0;
+    while (n < PQ_N) {
+        Keccak_Squeeze(&k, buf, sizeof(buf));
+        for (uint32_t i = 0; i < sizeof(buf) && n < PQ_N; i += 3U) {
+            uint32_t d1 = buf[i] | ((uint32_t)(buf[i + 1U] & 0x0FU) << 8);
+            uint32_t d2 = (uint32_t)(buf[i + 1U] >> 4) | ((uint32_t)buf[i + 2U] << 4);
+            if (d1 < ML_KEM_Q) {
+                a->c[n++] = (int16_t)d1;
+            }
+            if (d2 < ML_KEM_Q && n < PQ_N) {
+                a->c[n++] = (int16_t)d2;
+            }
+        }
+    }
+}
+
+// SamplePolyCBD_2(PRF(sigma, nonce))
+static void SampleCbd(Poly *a, const uint8_t sigma[SEED_BYTES], uint8_t nonce) {
+    uint8_t in[SEED_BYTES + 1U];
+    uint8_t buf[PQ_N / 2U];
+    memcpy(in, sigma, SEED_BYTES);
+    in[SEED_BYTES] = nonce;
+    Shake256(buf, sizeof(buf), in, sizeof(in));
+    for (uint32_t i = 0; i < PQ_N / 8U; i++) {
+        uint32_t t = (uint32_t)buf[4U * i] | ((uint32_t)buf[4U * i + 1U] << 8) | ((uint32_t)buf[4U * i + 2U] << 16) |
+                     ((uint32_t)buf[4U * i + 3U] << 24);
+        uint32_t d = (t & 0x55555555U) + ((t >> 1) & 0x55555555U);
+        for (uint32_t j = 0; j < 8U; j++) {
+            int16_t x = (int16_t)((d >> (4U * j)) & 3U);
+            int16_t y = (int16_t)((d >> (4U * j + 2U)) & 3U);
+            a->c[8U * i + j] = (int16_t)(x - y);
+        }
+    }
+    memset(in, 0, sizeof(in));
+    memset(buf, 0, sizeof(buf));
+}
+
+// Copies bytes out, or with out == NULL returns nonzero if they differ from expect
+static uint8_t Emit(uint8_t *out, const uint8_t *expect, const uint8_t *bytes, uint32_t len) {
+    if (out != NULL) {
+        memcpy(out, bytes, len);
+        return 0;
+    }
+    uint8_t diff = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        diff |= (uint8_t)(expect[i] ^ bytes[i]);
+    }
+    return diff;
+}
+
+// K-PKE.Encrypt(ek, m, r) into out, or compared against expect (see Emit)
+static uint8_t Encrypt(uint8_t *out, const uint8_t *expect, const uint8_t *ek, const uint8_t m[SEED_BYTES],
+                       const uint8_t r[SEED_BYTES]) {
+    const uint8_t *rho = ek + POLYVEC_BYTES;
+    Poly y[K], a, acc, e;
+    uint8_t bytes[DU_POLY_BYTES];
+    uint8_t diff = 0;
+
+    for (uint32_t i = 0; i < K; i++) {
+        SampleCbd(&y[i], r, (uint8_t)i);
+        PolyNtt(&y[i]);
+    }
+
+    // u = NTT^-1(A^T y) + e1, one row at a time
+    for (uint32_t i = 0; i < K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (uint32_t j = 0; j < K; j++) {
+            SampleNtt(&a, rho, (uint8_t)i, (uint8_t)j);
+            PqKem_BaseMulAcc(acc.c, a.c, y[j].c);
+        }
+        PolyReduce(&acc);
+        PqKem_InvNtt(acc.c);
+        SampleCbd(&e, r, (uint8_t)(K + i));
+        PolyAdd(&acc, &e);
+        PolyReduce(&acc);
+        EncodeDu(bytes, &acc);
+        uint32_t at = i * DU_POLY_BYTES;
+        diff |= Emit(out != NULL ? out + at : NULL, expect != NULL ? expect + at : NULL, bytes, DU_POLY_BYTES);
+    }
+
+    // v = NTT^-1(t^T y) + e2 + Decompress_1(m)
+    memset(&acc, 0, sizeof(acc));
+    for (uint32_t j = 0; j < K; j++) {
+        Decode12(&a, ek + j * POLY_BYTES);
+        PqKem_BaseMulAcc(acc.c, a.c, y[j].c);
+    }
+    PolyReduce(&acc);
+    PqKem_InvNtt(acc.c);
+    SampleCbd(&e, r, (uint8_t)(2U * K));
+    PolyAdd(&acc, &e);
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        uint32_t bit = (m[i / 8U] >> (i % 8U)) & 1U;
+        acc.c[i] = (int16_t)(acc.c[i] + (int16_t)(-(int32_t)bit & ((ML_KEM_Q + 1) / 2)));
+    }
+    PolyReduce(&acc);
+    EncodeDv(bytes, &acc);
+    uint32_t at = K * DU_POLY_BYTES;
+    diff |= Emit(out != NULL ? out + at : NULL, expect != NULL ? expect + at : NULL, bytes, DV_POLY_BYTES);
+
+    memset(y, 0, sizeof(y));
+    memset(&acc, 0, sizeof(acc));
+    memset(&e, 0, sizeof(e));
+    return diff;
+}
+
+// K-PKE.Decrypt(dk_pke, c)
+static void Decrypt(uint8_t m[SEED_BYTES], const uint8_t *dk_pke, const uint8_t *ct) {
+    Poly acc, u, s;
+    memset(&acc, 0, sizeof(acc));
+    for (uint32_t j = 0; j < K; j++) {
+        DecodeDu(&u, ct + j * DU_POLY_BYTES);
+        PolyNtt(&u);
+        Decode12(&s, dk_pke + j * POLY_BYTES);
+        PqKem_BaseMulAcc(acc.c, s.c, u.c);
+    }
+    PolyReduce(&acc);
+    PqKem_InvNtt(acc.c);
+
+    // w = v - s^T u
+    DecodeDv(&u, ct + K * DU_POLY_BYTES);
+    memset(m, 0, SEED_BYTES);
+    for (uint32_t i = 0; i < PQ_N; i++) {
+        int16_t w = PqKem_Reduce((int16_t)(u.c[i] - acc.c[i]));
+        m[i / 8U] |= (uint8_t)(Compress(w, 1) << (i % 8U));
+    }
+    memset(&acc, 0, sizeof(acc));
+    memset(&s, 0, sizeof(s));
+}
+
+// --- Public Function Implementations ---
+
+void MlKem768_KeyGen(uint8_t ek[ML_KEM_768_EK_BYTES], uint8_t dk[ML_KEM_768_DK_BYTES],
+                     const uint8_t seed[ML_KEM_KEYGEN_SEED_BYTES]) {
+    // (rho, sigma) = G(d || k)
+    uint8_t g_in[SEED_BYTES + 1U];
+    uint8_t rho_sigma[SHA3_512_BYTES];
+    memcpy(g_in, seed, SEED_BYTES);
+    g_in[SEED_BYTES] = (uint8_t)K;
+    Sha3_512(g_in, sizeof(g_in), rho_sigma);
+    const uint8_t *rho = rho_sigma;
+    const uint8_t *sigma = rho_sigma + SEED_BYTES;
+
+    Poly s[K], a, acc, e;
+    for (uint32_t i = 0; i < K; i++) {
+        SampleCbd(&s[i], sigma, (uint8_t)i);
+        PolyNtt(&s[i]);
+    }
+
+    // t = A s + e, one row at a time
+    for (uint32_t i = 0; i < K; i++) {
+        memset(&acc, 0, sizeof(acc));
+        for (uint32_t j = 0; j < K; j++) {
+            SampleNtt(&a, rho, (uint8_t)j, (uint8_t)i);
+            PqKem_BaseMulAcc(acc.c, a.c, s[j].c);
+        }
+        for (uint32_t n = 0; n < PQ_N; n++) {
+            acc.c[n] = PqKem_MontMul(acc.c[n], MONT_SQ);
+        }
+        SampleCbd(&e, sigma, (uint8_t)(K + i));
+        PolyNtt(&e);
+        PolyAdd(&acc, &e);
+        PolyReduce(&acc);
+        Encode12(ek + i * POLY_BYTES, &acc);
+    }
+    memcpy(ek + POLYVEC_BYTES, rho, SEED_BYTES);
+
+    // dk = s || ek || H(ek) || z
+    for (uint32_t i = 0; i < K; i++) {
+        Encode12(dk + i * POLY_BYTES, &s[i]);
+    }
+    memcpy(dk + POLYVEC_BYTES, ek, ML_KEM_768_EK_BYTES);
+    Sha3_256(ek, ML_KEM_768_EK_BYTES, dk + POLYVEC_BYTES + ML_KEM_768_EK_BYTES);
+    memcpy(dk + POLYVEC_BYTES + ML_KEM_768_EK_BYTES + SHA3_256_BYTES, seed + SEED_BYTES, SEED_BYTES);
+
+    memset(g_in, 0, sizeof(g_in));
+    memset(rho_sigma, 0, sizeof(rho_sigma));
+    memset(s, 0, sizeof(s));
+    memset(&e, 0, sizeof(e));
+}
+
+bool MlKem768_Encaps(uint8_t ct[ML_KEM_768_CT_BYTES], uint8_t ss[ML_KEM_SS_BYTES],
+                     const uint8_t ek[ML_KEM_768_EK_BYTES], const uint8_t m[ML_KEM_ENCAPS_SEED_BYTES]) {
+    Poly t;
+    for (uint32_t i = 0; i < K; i++) {
+        if (!Decode12(&t, ek + i * POLY_BYTES)) {
+            return false;
+        }
+    }
+
+    // (K, r) = G(m || H(ek))
+    uint8_t g_in[2U * SEED_BYTES];
+    uint8_t kr[SHA3_512_BYTES];
+    memcpy(g_in, m, SEED_BYTES);
+    Sha3_256(ek, ML_KEM_768_EK_BYTES, g_in + SEED_BYTES);
+    Sha3_512(g_in, sizeof(g_in), kr);
+    Encrypt(ct, NULL, ek, m, kr + SEED_BYTES);
+    memcpy(ss, kr, ML_KEM_SS_BYTES);
+
+    memset(g_in, 0, sizeof(g_in));
+    memset(kr, 0, sizeof(kr));
+    return true;
+}
+
+bool MlKem768_Decaps(uint8_t ss[ML_KEM_SS_BYTES], const uint8_t ct[ML_KEM_768_CT_BYTES],
+                     const uint8_t dk[ML_KEM_768_DK_BYTES]) {
+    const uint8_t *ek = dk + POLYVEC_BYTES;
+    const uint8_t *h = ek + ML_KEM_768_EK_BYTES;
+    const uint8_t *z = h + SHA3_256_BYTES;
+
+    uint8_t check[SHA3_256_BYTES];
+    Sha3_256(ek, ML_KEM_768_EK_BYTES, check);
+    if (memcmp(check, h, SHA3_256_BYTES) != 0) {
+        return false;
+    }
+
+    // (K', r') = G(m' || h)
+    uint8_t g_in[2U * SEED_BYTES];
+    uint8_t kr[SHA3_512_BYTES];
+    Decrypt(g_in, dk, ct);
+    memcpy(g_in + SEED_BYTES, h, SEED_BYTES);
+    Sha3_512(g_in, sizeof(g_in), kr);
+
+    // Implicit rejection secret J(z || c)
+    uint8_t reject[ML_KEM_SS_BYTES];
+    Keccak j;
+    Shake256_Init(&j);
+    Keccak_Absorb(&j, z, SEED_BYTES);
+    Keccak_Absorb(&j, ct, ML_KEM_768_CT_BYTES);
+    Keccak_Finalize(&j);
+    Keccak_Squeeze(&j, reject, sizeof(reject));
+
+    // Re-encrypt and pick without branching on the outcome
+    uint8_t diff = Encrypt(NULL, ct, ek, g_in, kr + SEED_BYTES);
+    uint8_t mask = (uint8_t)(0U - (((uint32_t)diff + 0xFFU) >> 8));
+    for (uint32_t i = 0; i < ML_KEM_SS_BYTES; i++) {
+        ss[i] = (uint8_t)(kr[i] ^ (mask & (kr[i] ^ reject[i])));
+    }
+
+    memset(g_in, 0, sizeof(g_in));
+    memset(kr, 0, sizeof(kr));
+    memset(reject, 0, sizeof(reject));
+    memset(&j, 0, sizeof(j));
+    return true;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file ml_kem.h
+ * @brief ML-KEM-768 key encapsulation (FIPS 203).
+ *
+ * Key generation, encapsulation and decapsulation are deterministic
+ * functions of the randomness passed in, so the caller chooses the
+ * source (normally HMAC-DRBG) and the known-answer tests can replay it.
+ * Polynomial products go through crypto/pq_ntt.h.
+ *
+ * The code is arranged for small RAM rather than for the fewest hash
+ * calls:
+ *  - The public matrix A is never stored. Each 512-byte entry is sampled
+ *    from SHAKE128 when it is needed and dropped after one product.
+ *  - Ciphertext polynomials are compressed and written out one at a
+ *    time.
+ *  - Decapsulation re-encrypts and compares each polynomial against the
+ *    received ciphertext as it is produced, without a second ciphertext
+ *    buffer.
+ * Peak stack is about 4 KB. Secret intermediates are cleared before
+ * returning.
+ *
+ * Decapsulation is constant time in the ciphertext: an invalid one
+ * yields the implicit-rejection secret, selected without a branch.
+ */
+
+#ifndef ML_KEM_H
+#define ML_KEM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ML_KEM_768_K                3U
+#define ML_KEM_768_EK_BYTES         1184U   // Encapsulation (public) key
+#define ML_KEM_768_DK_BYTES         2400U   // Decapsulation (private) key
+#define ML_KEM_768_CT_BYTES         1088U
+#define ML_KEM_SS_BYTES             32U     // Shared secret
+#define ML_KEM_KEYGEN_SEED_BYTES    64U     // d || z
+#define ML_KEM_ENCAPS_SEED_BYTES    32U     // m
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief ML-KEM.KeyGen_internal(d, z) with seed = d || z.
+ */
+void MlKem768_KeyGen(uint8_t ek[ML_KEM_768_EK_BYTES], uint8_t dk[ML_KEM_768_DK_BYTES],
+                     const uint8_t seed[ML_KEM_KEYGEN_SEED_BYTES]);
+
+/**
+ * @brief ML-KEM.Encaps_internal(ek, m).
+ * @return False if ek fails the modulus check (a coefficient >= q).
+ */
+bool MlKem768_Encaps(uint8_t ct[ML_KEM_768_CT_BYTES], uint8_t ss[ML_KEM_SS_BYTES],
+                     const uint8_t ek[ML_KEM_768_EK_BYTES], const uint8_t m[ML_KEM_ENCAPS_SEED_BYTES]);
+
+/**
+ * @brief ML-KEM.Decaps_internal(dk, c).
+ * @return False if dk fails the hash check. A bad ciphertext still
+ *         returns true, with the implicit-rejection secret.
+ */
+bool MlKem768_Decaps(uint8_t ss[ML_KEM_SS_BYTES], const uint8_t ct[ML_KEM_768_CT_BYTES],
+                     const uint8_t dk[ML_KEM_768_DK_BYTES]);
+
+#endif // ML_KEM_H
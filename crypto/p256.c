@@ -0,0 +1,626 @@
+/**
+ * @file p256.c
+ * @brief Implementation of P-256 arithmetic and ECDSA.
+ */
+
+#include "p256.h"
+
+#include <string.h>
+
+// --- Curve Constants (little-endian limbs) ---
+static const BnLimb CurveP[P256_LIMBS] = { 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL,
+                                           0x00000000UL, 0x00000000UL, 0x00000001UL, 0xFFFFFFFFUL };
+static const BnLimb CurveN[P256_LIMBS] = { 0xFC632551UL, 0xF3B9CAC2UL, 0xA7179E84UL, 0xBCE6FAADUL,
+                                           0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL, 0xFFFFFFFFUL };
+static const BnLimb CurveB[P256_LIMBS] = { 0x27D2604BUL, 0x3BCE3C3EUL, 0xCC53B0F6UL, 0x651D06B0UL,
+                                           0x769886BCUL, 0xB3EBBD55UL, 0xAA3A93E7UL, 0x5AC635D8UL };
+static const BnLimb CurveGx[P256_LIMBS] = { 0xD898C296UL, 0xF4A13945UL, 0x2DEB33A0UL, 0x77037D81UL,
+                                            0x63A440F2UL, 0xF8BCE6E5UL, 0xE12C4247UL, 0x6B17D1F2UL };
+static const BnLimb CurveGy[P256_LIMBS] = { 0x37BF51F5UL, 0xCBB64068UL, 0x6B315ECEUL, 0x2BCE3357UL,
+                                            0x7C0F9E16UL, 0x8EE7EB4AUL, 0xFE1A7F9BUL, 0x4FE342E2UL };
+static const BnLimb CurveNm2[P256_LIMBS] = { 0xFC63254FUL, 0xF3B9CAC2UL, 0xA7179E84UL, 0xBCE6FAADUL,
+                                             0xFFFFFFFFUL, 0xFFFFFFFFUL, 0x00000000UL, 0xFFFFFFFFUL };
+
+// --- Private Defines ---
+#define WINDOW_BITS                 4U
+#define SCALAR_WINDOWS              (P256_LADDER_BITS / WINDOW_BITS)
+#define POINT_LIMBS                 (sizeof(P256Point) / sizeof(BnLimb))
+#define STRAUS_COST_PER_POINT       72U     // Table build, normalisation and 64 mixed adds, in adds
+
+_Static_assert(sizeof(P256Point) == 3U * P256_LIMBS * sizeof(BnLimb), "P256Point must be three packed limb arrays");
+
+// --- Private Types ---
+
+// Working set of P256_EcdsaVerifyBatch, one chunk at a time
+typedef struct {
+    BnLimb    w[P256_VERIFY_CHUNK][P256_LIMBS];     // s, then s^-1 (Montgomery form mod n)
+    BnLimb    r[P256_VERIFY_CHUNK][P256_LIMBS];
+    BnLimb    z[P256_VERIFY_CHUNK][P256_LIMBS];
+    P256Point sum[P256_VERIFY_CHUNK];               // u1 * G + u2 * Q
+    BnLimb    scratch[P256_VERIFY_CHUNK * P256_LIMBS];
+    P256Point table[2U * P256_WINDOW_POINTS];       // G multiples, then Q multiples
+} VerifyChunk;
+
+// --- Private Variables ---
+static BnMont Fp;                   // Field
+static BnMont Fn;                   // Group order
+static P256Point Generator;
+static P256Point GeneratorTable[P256_WINDOW_POINTS];    // 1..15 G, z = 1
+static BnLimb FieldB[P256_LIMBS];   // b, Montgomery form
+static VerifyChunk Verify;
+static bool Ready;
+
+// --- Private Helper Functions ---
+
+static void FMul(BnLimb *r, const BnLimb *a, const BnLimb *b) {
+    BnMont_Mul(&Fp, r, a, b);
+}
+
+static void FAdd(BnLimb *r, const BnLimb *a, const BnLimb *b) {
+    Bn_ModAdd(r, a, b, CurveP, P256_LIMBS);
+}
+
+static void FSub(BnLimb *r, const BnLimb *a, const BnLimb *b) {
+    Bn_ModSub(r, a, b, CurveP, P256_LIMBS);
+}
+
+// r = a^-1, Montgomery form in and out
+static void FInv(BnLimb *r, const BnLimb *a) {
+    BnMont_InvPrime(&Fp, r, a);
+}
+
+// r = a^-1 mod n, normal form
+static void NInv(BnLimb *r, const BnLimb *a) {
+    BnMont_Exp(&Fn, r, a, CurveNm2, P256_LIMBS);
+}
+
+// Values below 2n: one subtraction brings them under n
+static void ReduceOnceN(BnLimb *a) {
+    if (Bn_Cmp(a, CurveN, P256_LIMBS) >= 0) {
+        Bn_Sub(a, a, CurveN, P256_LIMBS);
+    }
+}
+
+static void PointSwap(P256Point *a, P256Point *b, BnLimb cond) {
+    BnLimb mask = (BnLimb)0 - cond;
+    BnLimb *pa = (BnLimb *)a;
+    BnLimb *pb = (BnLimb *)b;
+    for (uint32_t i = 0; i < sizeof(P256Point) / sizeof(BnLimb); i++) {
+        BnLimb t = (pa[i] ^ pb[i]) & mask;
+        pa[i] ^= t;
+        pb[i] ^= t;
+    }
+}
+
+// dbl-2001-b (a = -3); infinity maps to infinity
+static void PointDouble(P256Point *r, const P256Point *p) {
+    BnLimb delta[P256_LIMBS], gamma[P256_LIMBS], beta[P256_LIMBS], alpha[P256_LIMBS];
+    BnLimb t1[P256_LIMBS], t2[P256_LIMBS];
+
+    FMul(delta, p->z, p->z);
+    FMul(gamma, p->y, p->y);
+    FMul(beta, p->x, gamma);
+    FSub(t1, p->x, delta);
+    FAdd(t2, p->x, delta);
+    FMul(alpha, t1, t2);
+    FAdd(t1, alpha, alpha);
+    FAdd(alpha, t1, alpha);                 // 3 (x - delta)(x + delta)
+
+    FAdd(t1, p->y, p->z);
+    FMul(t1, t1, t1);
+    FSub(t1, t1, gamma);
+    FSub(r->z, t1, delta);                  // (y + z)^2 - gamma - delta
+
+    FAdd(beta, beta, beta);
+    FAdd(beta, beta, beta);                 // 4 beta
+    FMul(t1, alpha, alpha);
+    FAdd(t2, beta, beta);
+    FSub(r->x, t1, t2);                     // alpha^2 - 8 beta
+
+    FSub(t1, beta, r->x);
+    FMul(t1, alpha, t1);
+    FMul(gamma, gamma, gamma);
+    FAdd(gamma, gamma, gamma);
+    FAdd(gamma, gamma, gamma);
+    FAdd(gamma, gamma, gamma);              // 8 gamma^2
+    FSub(r->y, t1, gamma);
+}
+
+// add-2007-bl, for any inputs; the ladder uses it directly, so its path does not depend on z = 1
+static void PointAdd(P256Point *r, const P256Point *a, const P256Point *b) {
+    if (Bn_IsZero(a->z, P256_LIMBS)) {
+        *r = *b;
+        return;
+    }
+    if (Bn_IsZero(b->z, P256_LIMBS)) {
+        *r = *a;
+        return;
+    }
+    BnLimb z1z1[P256_LIMBS], z2z2[P256_LIMBS], u1[P256_LIMBS], u2[P256_LIMBS];
+    BnLimb s1[P256_LIMBS], s2[P256_LIMBS], h[P256_LIMBS], rr[P256_LIMBS];
+    BnLimb i[P256_LIMBS], j[P256_LIMBS], v[P256_LIMBS], t[P256_LIMBS];
+
+    FMul(z1z1, a->z, a->z);
+    FMul(z2z2, b->z, b->z);
+    FMul(u1, a->x, z2z2);
+    FMul(u2, b->x, z1z1);
+    FMul(s1, a->y, b->z);
+    FMul(s1, s1, z2z2);
+    FMul(s2, b->y, a->z);
+    FMul(s2, s2, z1z1);
+    FSub(h, u2, u1);
+    FSub(rr, s2, s1);
+    if (Bn_IsZero(h, P256_LIMBS)) {
+        if (Bn_IsZero(rr, P256_LIMBS)) {
+            PointDouble(r, a);
+        } else {
+            memset(r, 0, sizeof(*r));       // a == -b
+        }
+        return;
+    }
+    FAdd(rr, rr, rr);
+
+    FAdd(i, h, h);
+    FMul(i, i, i);
+    FMul(j, h, i);
+    FMul(v, u1, i);
+
+    P256Point out;
+    FMul(t, rr, rr);
+    FSub(t, t, j);
+    FSub(t, t, v);
+    FSub(out.x, t, v);                      // r^2 - J - 2V
+
+    FSub(t, v, out.x);
+    FMul(t, rr, t);
+    FMul(s1, s1, j);
+    FAdd(s1, s1, s1);
+    FSub(out.y, t, s1);                     // r (V - X3) - 2 S1 J
+
+    FAdd(t, a->z, b->z);
+    FMul(t, t, t);
+    FSub(t, t, z1z1);
+    FSub(t, t, z2z2);
+    FMul(out.z, t, h);                      // ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) H
+    *r = out;
+}
+
+static bool IsNormalized(const P256Point *p) {
+    return Bn_Cmp(p->z, Generator.z, P256_LIMBS) == 0;
+}
+
+// madd-2007-bl: b has z = 1, a is not infinity
+static void PointAddMixed(P256Point *r, const P256Point *a, const P256Point *b) {
+    BnLimb z1z1[P256_LIMBS], u2[P256_LIMBS], s2[P256_LIMBS], h[P256_LIMBS], hh[P256_LIMBS];
+    BnLimb rr[P256_LIMBS], i[P256_LIMBS], j[P256_LIMBS], v[P256_LIMBS], t[P256_LIMBS];
+
+    FMul(z1z1, a->z, a->z);
+    FMul(u2, b->x, z1z1);
+    FMul(s2, b->y, a->z);
+    FMul(s2, s2, z1z1);
+    FSub(h, u2, a->x);
+    FSub(rr, s2, a->y);
+    if (Bn_IsZero(h, P256_LIMBS)) {
+        if (Bn_IsZero(rr, P256_LIMBS)) {
+            PointDouble(r, b);
+        } else {
+            memset(r, 0, sizeof(*r));       // a == -b
+        }
+        return;
+    }
+    FAdd(rr, rr, rr);
+
+    FMul(hh, h, h);
+    FAdd(i, hh, hh);
+    FAdd(i, i, i);                          // 4 HH
+    FMul(j, h, i);
+    FMul(v, a->x, i);
+
+    P256Point out;
+    FMul(t, rr, rr);
+    FSub(t, t, j);
+    FSub(t, t, v);
+    FSub(out.x, t, v);                      // r^2 - J - 2V
+
+    FSub(t, v, out.x);
+    FMul(t, rr, t);
+    FMul(s2, a->y, j);
+    FAdd(s2, s2, s2);
+    FSub(out.y, t, s2);                     // r (V - X3) - 2 Y1 J
+
+    FAdd(t, a->z, h);
+    FMul(t, t, t);
+    FSub(t, t, z1z1);
+    FSub(out.z, t, hh);                     // (Z1 + H)^2 - Z1Z1 - HH
+    *r = out;
+}
+
+static void Normalize(P256Point *p, uint32_t count, BnLimb *scratch) {
+    BnMont_InvPrimeBatch(&Fp, p[0].z, POINT_LIMBS, count, scratch);
+    for (uint32_t i = 0; i < count; i++) {
+        if (Bn_IsZero(p[i].z, P256_LIMBS)) {
+            continue;
+        }
+        BnLimb zi2[P256_LIMBS];
+        FMul(zi2, p[i].z, p[i].z);
+        FMul(p[i].x, p[i].x, zi2);
+        FMul(zi2, zi2, p[i].z);
+        FMul(p[i].y, p[i].y, zi2);
+        memcpy(p[i].z, Generator.z, sizeof(p[i].z));
+    }
+}
+
+// table[d - 1] = d * p for d = 1..15
+static void BuildTable(P256Point *table, const P256Point *p) {
+    table[0] = *p;
+    PointDouble(&table[1], p);
+    for (uint32_t d = 2; d < P256_WINDOW_POINTS; d++) {
+        P256_Add(&table[d], &table[d - 1U], p);
+    }
+}
+
+static void EnsureReady(void) {
+    if (Ready) {
+        return;
+    }
+    BnMont_Init(&Fp, CurveP, P256_LIMBS);
+    BnMont_Init(&Fn, CurveN, P256_LIMBS);
+    BnLimb one[P256_LIMBS] = { 1 };
+    BnMont_ToMont(&Fp, Generator.x, CurveGx);
+    BnMont_ToMont(&Fp, Generator.y, CurveGy);
+    BnMont_ToMont(&Fp, Generator.z, one);
+    BnMont_ToMont(&Fp, FieldB, CurveB);
+
+    BnLimb scratch[P256_WINDOW_POINTS * P256_LIMBS];
+    BuildTable(GeneratorTable, &Generator);
+    Normalize(GeneratorTable, P256_WINDOW_POINTS, scratch);
+    Ready = true;
+}
+
+// c bits of k from bit pos, zero past bit 255
+static uint32_t Digit(const BnLimb *k, uint32_t pos, uint32_t c) {
+    uint32_t limb = pos / BN_LIMB_BITS;
+    uint32_t shift = pos % BN_LIMB_BITS;
+    if (limb >= P256_LIMBS) {
+        return 0;
+    }
+    uint64_t bits = k[limb];
+    if (limb + 1U < P256_LIMBS) {
+        bits |= (uint64_t)k[limb + 1U] << BN_LIMB_BITS;
+    }
+    return (uint32_t)(bits >> shift) & ((1U << c) - 1U);
+}
+
+// Interleaved 4-bit windows: the 256 doublings are shared by all terms
+static void StrausSum(P256Point *r, const BnLimb *k, const P256Point *tables, uint32_t count) {
+    P256Point acc;
+    memset(&acc, 0, sizeof(acc));
+    for (uint32_t w = SCALAR_WINDOWS; w > 0; w--) {
+        for (uint32_t s = 0; s < WINDOW_BITS; s++) {
+            PointDouble(&acc, &acc);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t d = Digit(&k[i * P256_LIMBS], (w - 1U) * WINDOW_BITS, WINDOW_BITS);
+            if (d != 0) {
+                P256_Add(&acc, &acc, &tables[i * P256_WINDOW_POINTS + d - 1U]);
+            }
+        }
+    }
+    *r = acc;
+}
+
+// Buckets of 2^c - 1 points per c-bit window, summed with a running total
+static void PippengerSum(P256Point *r, const BnLimb *k, const P256Point *p, uint32_t count, uint32_t c,
+                         P256Point *buckets) {
+    const uint32_t nbuckets = (1U << c) - 1U;
+    const uint32_t windows = (P256_LADDER_BITS + c - 1U) / c;
+    P256Point acc;
+    memset(&acc, 0, sizeof(acc));
+    for (uint32_t w = windows; w > 0; w--) {
+        for (uint32_t s = 0; s < c; s++) {
+            PointDouble(&acc, &acc);
+        }
+        memset(buckets, 0, nbuckets * sizeof(P256Point));
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t d = Digit(&k[i * P256_LIMBS], (w - 1U) * c, c);
+            if (d != 0) {
+                P256_Add(&buckets[d - 1U], &buckets[d - 1U], &p[i]);
+            }
+        }
+        // sum(d * bucket[d]) = sum over d of (bucket[nbuckets] + ... + bucket[d])
+        P256Point running, window;
+        memset(&running, 0, sizeof(running));
+        memset(&window, 0, sizeof(window));
+        for (uint32_t d = nbuckets; d > 0; d--) {
+            P256_Add(&running, &running, &buckets[d - 1U]);
+            P256_Add(&window, &window, &running);
+        }
+        P256_Add(&acc, &acc, &window);
+    }
+    *r = acc;
+}
+
+// Pippenger window for count terms, or 0 where Straus is cheaper
+static uint32_t MsmWindow(uint32_t count) {
+    uint64_t best = (uint64_t)count * STRAUS_COST_PER_POINT;
+    uint32_t window = 0;
+    for (uint32_t c = 2; c <= P256_PIPPENGER_MAX_WINDOW; c++) {
+        uint64_t cost = (uint64_t)((P256_LADDER_BITS + c - 1U) / c) * (count + (2U << c));
+        if (cost < best) {
+            best = cost;
+            window = c;
+        }
+    }
+    return window;
+}
+
+// u1 * G + u2 * q, with the G table precomputed
+static void VerifySum(P256Point *r, const BnLimb u1[P256_LIMBS], const BnLimb u2[P256_LIMBS], const P256Point *q) {
+    BnLimb k[2U * P256_LIMBS];
+    memcpy(k, u1, sizeof(BnLimb) * P256_LIMBS);
+    memcpy(&k[P256_LIMBS], u2, sizeof(BnLimb) * P256_LIMBS);
+    memcpy(Verify.table, GeneratorTable, sizeof(GeneratorTable));
+    BuildTable(&Verify.table[P256_WINDOW_POINTS], q);
+    StrausSum(r, k, Verify.table, 2U);
+}
+
+static void VerifyChunkRun(const P256VerifyItem *items, uint32_t count, bool *valid) {
+    // Scalars first: s goes into the batch in Montgomery form, 0 marks a reject
+    for (uint32_t i = 0; i < count; i++) {
+        BnLimb s[P256_LIMBS];
+        valid[i] = P256_ScalarFromBytes(Verify.r[i], items[i].sig) &&
+                   P256_ScalarFromBytes(s, items[i].sig + P256_BYTES);
+        if (valid[i]) {
+            BnMont_ToMont(&Fn, Verify.w[i], s);
+            Bn_FromBytes(Verify.z[i], P256_LIMBS, items[i].hash, P256_BYTES);
+            ReduceOnceN(Verify.z[i]);
+        } else {
+            memset(Verify.w[i], 0, sizeof(Verify.w[i]));
+        }
+    }
+    BnMont_InvPrimeBatch(&Fn, Verify.w[0], P256_LIMBS, count, Verify.scratch);
+
+    for (uint32_t i = 0; i < count; i++) {
+        P256Point q;
+        if (valid[i] && !P256_PointFromBytes(&q, items[i].pub)) {
+            valid[i] = false;
+        }
+        if (!valid[i]) {
+            memset(&Verify.sum[i], 0, sizeof(Verify.sum[i]));
+            continue;
+        }
+        BnLimb u1[P256_LIMBS], u2[P256_LIMBS];
+        BnMont_Mul(&Fn, u1, Verify.z[i], Verify.w[i]);     // z / s, normal form
+        BnMont_Mul(&Fn, u2, Verify.r[i], Verify.w[i]);     // r / s
+        VerifySum(&Verify.sum[i], u1, u2, &q);
+    }
+
+    // One inversion for all the affine x coordinates
+    BnMont_InvPrimeBatch(&Fp, Verify.sum[0].z, POINT_LIMBS, count, Verify.scratch);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!valid[i] || Bn_IsZero(Verify.sum[i].z, P256_LIMBS)) {
+            valid[i] = false;
+            continue;
+        }
+        BnLimb x[P256_LIMBS];
+        FMul(x, Verify.sum[i].z, Verify.sum[i].z);
+        FMul(x, Verify.sum[i].x, x);
+        BnMont_FromMont(&Fp, x, x);
+        ReduceOnceN(x);
+        valid[i] = Bn_Cmp(x, Verify.r[i], P256_LIMBS) == 0;
+    }
+}
+
+// --- Public Function Implementations ---
+
+bool P256_ScalarFromBytes(BnLimb k[P256_LIMBS], const uint8_t bytes[P256_BYTES]) {
+    Bn_FromBytes(k, P256_LIMBS, bytes, P256_BYTES);
+    return !Bn_IsZero(k, P256_LIMBS) && Bn_Cmp(k, CurveN, P256_LIMBS) < 0;
+}
+
+void P256_Add(P256Point *r, const P256Point *a, const P256Point *b) {
+    if (Bn_IsZero(a->z, P256_LIMBS) || Bn_IsZero(b->z, P256_LIMBS)) {
+        PointAdd(r, a, b);
+    } else if (IsNormalized(b)) {
+        PointAddMixed(r, a, b);
+    } else if (IsNormalized(a)) {
+        PointAddMixed(r, b, a);
+    } else {
+        PointAdd(r, a, b);
+    }
+}
+
+void P256_LadderStart(P256Ladder *l, const BnLimb k[P256_LIMBS], const P256Point *base) {
+    EnsureReady();
+    l->base = (base != NULL) ? *base : Generator;
+
+    // k + n, or k + 2n, has bit 256 set and no higher bit
+    BnLimb carry = Bn_Add(l->k, k, CurveN, P256_LIMBS);
+    BnLimb again[P256_LIMBS];
+    BnLimb carry2 = Bn_Add(again, l->k, CurveN, P256_LIMBS);
+    BnLimb use_again = carry ^ 1U;
+    BnLimb mask = (BnLimb)0 - use_again;
+    for (uint32_t i = 0; i < P256_LIMBS; i++) {
+        l->k[i] = (l->k[i] & ~mask) | (again[i] & mask);
+    }
+    l->k[P256_LIMBS] = (carry & ~mask) | (carry2 & mask);
+
+    l->r0 = l->base;
+    PointDouble(&l->r1, &l->base);
+    l->bit = P256_LADDER_BITS;
+}
+
+bool P256_LadderStep(P256Ladder *l, uint32_t bits) {
+    for (; bits > 0 && l->bit > 0; bits--) {
+        l->bit--;
+        BnLimb b = (l->k[l->bit / BN_LIMB_BITS] >> (l->bit % BN_LIMB_BITS)) & 1U;
+        PointSwap(&l->r0, &l->r1, b);
+        PointAdd(&l->r1, &l->r0, &l->r1);
+        PointDouble(&l->r0, &l->r0);
+        PointSwap(&l->r0, &l->r1, b);
+    }
+    return l->bit == 0;
+}
+
+void P256_ScalarMult(P256Point *r, const BnLimb k[P256_LIMBS], const P256Point *base) {
+    P256Ladder l;
+    P256_LadderStart(&l, k, base);
+    P256_LadderStep(&l, P256_LADDER_BITS);
+    *r = l.r0;
+}
+
+bool P256_ToAffine(const P256Point *p, BnLimb x[P256_LIMBS], BnLimb y[P256_LIMBS]) {
+    EnsureReady();
+    if (Bn_IsZero(p->z, P256_LIMBS)) {
+        return false;
+    }
+    BnLimb zi[P256_LIMBS], zi2[P256_LIMBS], t[P256_LIMBS];
+    FInv(zi, p->z);
+    FMul(zi2, zi, zi);
+    FMul(t, p->x, zi2);
+    BnMont_FromMont(&Fp, x, t);
+    if (y != NULL) {
+        FMul(zi2, zi2, zi);
+        FMul(t, p->y, zi2);
+        BnMont_FromMont(&Fp, y, t);
+    }
+    return true;
+}
+
+bool P256_PointFromBytes(P256Point *p, const uint8_t xy[2 * P256_BYTES]) {
+    EnsureReady();
+    BnLimb x[P256_LIMBS], y[P256_LIMBS], one[P256_LIMBS] = { 1 };
+    Bn_FromBytes(x, P256_LIMBS, xy, P256_BYTES);
+    Bn_FromBytes(y, P256_LIMBS, xy + P256_BYTES, P256_BYTES);
+    if (Bn_Cmp(x, CurveP, P256_LIMBS) >= 0 || Bn_Cmp(y, CurveP, P256_LIMBS) >= 0) {
+        return false;
+    }
+    BnMont_ToMont(&Fp, p->x, x);
+    BnMont_ToMont(&Fp, p->y, y);
+    BnMont_ToMont(&Fp, p->z, one);
+
+    // y^2 = x^3 - 3x + b
+    BnLimb lhs[P256_LIMBS], rhs[P256_LIMBS], t[P256_LIMBS];
+    FMul(lhs, p->y, p->y);
+    FMul(rhs, p->x, p->x);
+    FMul(rhs, rhs, p->x);
+    FAdd(t, p->x, p->x);
+    FAdd(t, t, p->x);
+    FSub(rhs, rhs, t);
+    FAdd(rhs, rhs, FieldB);
+    return Bn_Cmp(lhs, rhs, P256_LIMBS) == 0;
+}
+
+bool P256_PublicKey(const uint8_t priv[P256_BYTES], uint8_t pub[2 * P256_BYTES]) {
+    BnLimb d[P256_LIMBS], x[P256_LIMBS], y[P256_LIMBS];
+    if (!P256_ScalarFromBytes(d, priv)) {
+        return false;
+    }
+    P256Point q;
+    P256_ScalarMult(&q, d, NULL);
+    if (!P256_ToAffine(&q, x, y)) {
+        return false;
+    }
+    Bn_ToBytes(pub, P256_BYTES, x, P256_LIMBS);
+    Bn_ToBytes(pub + P256_BYTES, P256_BYTES, y, P256_LIMBS);
+    return true;
+}
+
+bool P256_TupleFinish(const P256Ladder *l, const BnLimb k[P256_LIMBS], P256SignTuple *t) {
+    if (!P256_ToAffine(&l->r0, t->r, NULL)) {
+        return false;
+    }
+    ReduceOnceN(t->r);
+    if (Bn_IsZero(t->r, P256_LIMBS)) {
+        return false;
+    }
+    BnLimb kinv[P256_LIMBS];
+    NInv(kinv, k);
+    BnMont_ToMont(&Fn, t->kinv, kinv);
+    BnMont_ToMont(&Fn, t->r_mont, t->r);
+    return true;
+}
+
+bool P256_EcdsaSignTuple(const P256SignTuple *t, const uint8_t priv[P256_BYTES], const uint8_t hash[P256_BYTES],
+                         uint8_t sig[2 * P256_BYTES]) {
+    EnsureReady();
+    BnLimb d[P256_LIMBS], z[P256_LIMBS], s[P256_LIMBS];
+    if (!P256_ScalarFromBytes(d, priv)) {
+        return false;
+    }
+    Bn_FromBytes(z, P256_LIMBS, hash, P256_BYTES);
+    ReduceOnceN(z);
+
+    BnMont_Mul(&Fn, s, t->r_mont, d);       // r d
+    Bn_ModAdd(s, s, z, CurveN, P256_LIMBS);  // z + r d
+    BnMont_Mul(&Fn, s, t->kinv, s);         // k^-1 (z + r d)
+    memset(d, 0, sizeof(d));
+    if (Bn_IsZero(s, P256_LIMBS)) {
+        return false;
+    }
+    Bn_ToBytes(sig, P256_BYTES, t->r, P256_LIMBS);
+    Bn_ToBytes(sig + P256_BYTES, P256_BYTES, s, P256_LIMBS);
+    return true;
+}
+
+bool P256_EcdsaVerify(const uint8_t pub[2 * P256_BYTES], const uint8_t hash[P256_BYTES],
+                      const uint8_t sig[2 * P256_BYTES]) {
+    P256VerifyItem item = { pub, hash, sig };
+    bool valid;
+    return P256_EcdsaVerifyBatch(&item, 1, &valid) == 1U;
+}
+
+uint32_t P256_EcdsaVerifyBatch(const P256VerifyItem *items, uint32_t count, bool *valid) {
+    EnsureReady();
+    uint32_t passed = 0;
+    for (uint32_t base = 0; base < count; base += P256_VERIFY_CHUNK) {
+        uint32_t n = (count - base < P256_VERIFY_CHUNK) ? count - base : P256_VERIFY_CHUNK;
+        VerifyChunkRun(&items[base], n, &valid[base]);
+        for (uint32_t i = 0; i < n; i++) {
+            passed += valid[base + i] ? 1U : 0U;
+        }
+    }
+    return passed;
+}
+
+// --- Batch Inversion and Multi-Scalar Multiplication ---
+
+void P256_FieldInvertBatch(BnLimb *values, uint32_t stride, uint32_t count, BnLimb *scratch) {
+    EnsureReady();
+    BnMont_InvPrimeBatch(&Fp, values, stride, count, scratch);
+}
+
+void P256_NormalizeBatch(P256Point *p, uint32_t count, BnLimb *scratch) {
+    EnsureReady();
+    Normalize(p, count, scratch);
+}
+
+uint32_t P256_MsmScratchPoints(uint32_t count) {
+    uint32_t c = MsmWindow(count);
+    if (c != 0) {
+        return (1U << c) - 1U;
+    }
+    // Tables, then the normalisation scratch: one point holds three field elements
+    uint32_t table = count * P256_WINDOW_POINTS;
+    return table + (table + 2U) / 3U;
+}
+
+bool P256_MultiScalarMult(P256Point *r, const BnLimb *k, const P256Point *p, uint32_t count, P256Point *scratch,
+                          uint32_t scratch_points) {
+    EnsureReady();
+    if (scratch_points < P256_MsmScratchPoints(count)) {
+        return false;
+    }
+    uint32_t c = MsmWindow(count);
+    if (c != 0) {
+        PippengerSum(r, k, p, count, c, scratch);
+        return true;
+    }
+    uint32_t table = count * P256_WINDOW_POINTS;
+    for (uint32_t i = 0; i < count; i++) {
+        BuildTable(&scratch[i * P256_WINDOW_POINTS], &p[i]);
+    }
+    Normalize(scratch, table, scratch[table].x);
+    StrausSum(r, k, scratch, count);
+    return true;
+}
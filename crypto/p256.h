@@ -0,0 +1,192 @@
+/**
+ * @file p256.h
+ * @brief NIST P-256 point arithmetic and ECDSA signing and verification.
+ *
+ * Points are kept in Jacobian coordinates, in Montgomery form over the
+ * field prime (crypto/bignum.h), and converted to affine only for output.
+ * Scalar multiplication is a Montgomery ladder over the scalar padded
+ * to a fixed bit length (k + n or k + 2n), so its length does not leak
+ * the leading zeros of a nonce. The ladder can be run in slices with
+ * P256_LadderStep, so an idle-time caller can bound each slice.
+ *
+ * ECDSA signing is split. The expensive part depends only on the nonce k:
+ * r = x(k * G) mod n and k^-1 mod n, kept in a P256SignTuple. The part
+ * that depends on the key and the message costs two multiplications mod n:
+ *
+ *     s = k^-1 * (z + r * d) mod n
+ *
+ * A tuple must be used for exactly one signature.
+ *
+ * Verification works on public data only and is not constant time. It
+ * computes u1 * G + u2 * Q as one two-scalar Straus sum, sharing the
+ * doublings, over a fixed table of multiples of G. Work that would need
+ * an inversion per item is batched with Montgomery's trick: N field
+ * inversions cost one inversion and 3 (N - 1) multiplications.
+ * P256_EcdsaVerifyBatch applies it to s^-1 and to the final affine
+ * conversion, so each chunk of up to P256_VERIFY_CHUNK signatures pays two
+ * inversions, not 2N. The saving stops there: the inversions are the only
+ * shared work, and at 16 signatures they are already small next to the
+ * per-signature Straus sum. Larger batches cost the same per signature.
+ *
+ * P256_MultiScalarMult computes sum(k_i * P_i), also variable time. It
+ * picks Straus interleaved windows or Pippenger buckets from a cost
+ * model; with Pippenger the cost per point falls as the count grows.
+ */
+
+#ifndef P256_H
+#define P256_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bignum.h"
+
+#define P256_LIMBS                  8U
+#define P256_BYTES                  32U
+#define P256_LADDER_BITS            256U    // Ladder iterations per scalar multiplication
+#define P256_WINDOW_POINTS          15U     // Straus table entries per point (1..15 P)
+#define P256_PIPPENGER_MAX_WINDOW   8U
+#define P256_VERIFY_CHUNK           16U     // Signatures sharing one pair of inversions; caps the gain
+
+// --- Public Types ---
+
+typedef struct {
+    BnLimb x[P256_LIMBS];
+    BnLimb y[P256_LIMBS];
+    BnLimb z[P256_LIMBS];           // Zero for the point at infinity
+} P256Point;
+
+typedef struct {
+    P256Point r0;
+    P256Point r1;
+    P256Point base;
+    BnLimb    k[P256_LIMBS + 1];    // Padded scalar; bit 256 is always set
+    uint32_t  bit;                  // Next bit to process, counting down
+} P256Ladder;
+
+typedef struct {
+    BnLimb kinv[P256_LIMBS];        // k^-1 mod n, Montgomery form
+    BnLimb r[P256_LIMBS];           // x(k * G) mod n
+    BnLimb r_mont[P256_LIMBS];      // r, Montgomery form
+} P256SignTuple;
+
+typedef struct {
+    const uint8_t *pub;             // x || y
+    const uint8_t *hash;
+    const uint8_t *sig;             // r || s
+} P256VerifyItem;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Loads a big-endian scalar.
+ *
+ * @return False unless 1 <= k < n.
+ */
+bool P256_ScalarFromBytes(BnLimb k[P256_LIMBS], const uint8_t bytes[P256_BYTES]);
+
+/**
+ * @brief Starts k * base; base NULL selects the generator.
+ */
+void P256_LadderStart(P256Ladder *l, const BnLimb k[P256_LIMBS], const P256Point *base);
+
+/**
+ * @brief Runs up to bits ladder iterations.
+ *
+ * @return True once the result is in l->r0.
+ */
+bool P256_LadderStep(P256Ladder *l, uint32_t bits);
+
+/**
+ * @brief r = k * base, in one call.
+ */
+void P256_ScalarMult(P256Point *r, const BnLimb k[P256_LIMBS], const P256Point *base);
+
+/**
+ * @brief r = a + b, any inputs including infinity and a == b.
+ */
+void P256_Add(P256Point *r, const P256Point *a, const P256Point *b);
+
+/**
+ * @brief Converts to affine x and y, normal form.
+ *
+ * @return False for the point at infinity.
+ */
+bool P256_ToAffine(const P256Point *p, BnLimb x[P256_LIMBS], BnLimb y[P256_LIMBS]);
+
+/**
+ * @brief Loads an affine point (x || y, big-endian) and checks it is on the curve.
+ */
+bool P256_PointFromBytes(P256Point *p, const uint8_t xy[2 * P256_BYTES]);
+
+/**
+ * @brief pub = x || y of priv * G.
+ */
+bool P256_PublicKey(const uint8_t priv[P256_BYTES], uint8_t pub[2 * P256_BYTES]);
+
+/**
+ * @brief Completes a nonce tuple from a finished ladder over G.
+ *
+ * @param k The nonce the ladder was started with.
+ * @return False if r came out zero; draw another nonce.
+ */
+bool P256_TupleFinish(const P256Ladder *l, const BnLimb k[P256_LIMBS], P256SignTuple *t);
+
+/**
+ * @brief Signs a hash with a precomputed tuple: sig = r || s, big-endian.
+ *
+ * @return False if s came out zero; sign again with another tuple.
+ */
+bool P256_EcdsaSignTuple(const P256SignTuple *t, const uint8_t priv[P256_BYTES], const uint8_t hash[P256_BYTES],
+                         uint8_t sig[2 * P256_BYTES]);
+
+bool P256_EcdsaVerify(const uint8_t pub[2 * P256_BYTES], const uint8_t hash[P256_BYTES],
+                      const uint8_t sig[2 * P256_BYTES]);
+
+/**
+ * @brief Verifies count signatures, each with its own key and hash.
+ *
+ * Items are processed P256_VERIFY_CHUNK at a time with shared inversions,
+ * so the cost per signature stops falling at that batch size.
+ * Uses a static working set: call from one context only.
+ *
+ * @param valid Per-item result, count entries.
+ * @return Number of valid signatures.
+ */
+uint32_t P256_EcdsaVerifyBatch(const P256VerifyItem *items, uint32_t count, bool *valid);
+
+// --- Batch Inversion and Multi-Scalar Multiplication ---
+
+/**
+ * @brief Inverts count field elements (Montgomery form) in place, stride limbs apart.
+ *
+ * @param scratch count * P256_LIMBS limbs.
+ */
+void P256_FieldInvertBatch(BnLimb *values, uint32_t stride, uint32_t count, BnLimb *scratch);
+
+/**
+ * @brief Rescales count points to z = 1 with one shared inversion.
+ *
+ * Infinity is left as it is. Adding a normalised point is cheaper
+ * (P256_Add detects z = 1 and uses mixed coordinates).
+ *
+ * @param scratch count * P256_LIMBS limbs.
+ */
+void P256_NormalizeBatch(P256Point *p, uint32_t count, BnLimb *scratch);
+
+/**
+ * @brief Scratch points P256_MultiScalarMult needs for count terms.
+ */
+uint32_t P256_MsmScratchPoints(uint32_t count);
+
+/**
+ * @brief r = sum(k_i * p_i) for count terms. Variable time: public scalars only.
+ *
+ * @param k       count scalars of P256_LIMBS limbs each, back to back.
+ * @param scratch At least P256_MsmScratchPoints(count) points.
+ * @return False if the scratch is too small.
+ */
+bool P256_MultiScalarMult(P256Point *r, const BnLimb *k, const P256Point *p, uint32_t count, P256Point *scratch,
+                          uint32_t scratch_points);
+
+#endif // P256_H
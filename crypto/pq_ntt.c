@@ -0,0 +1,539 @@
+/**
+ * @file pq_ntt.c
+ * @brief Implementation of the ML-KEM and ML-DSA transforms.
+ */
+
+#include "pq_ntt.h"
+#include "ramfunc.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && defined(__ARM_FEATURE_SIMD32)
+#define PQ_NTT_DSP
+#include <arm_acle.h>
+#elif defined(__AVX2__)
+#define PQ_NTT_AVX2
+#include <immintrin.h>
+#endif
+
+// --- Private Defines ---
+#define KEM_INV_F                   1441        // 2^32 / 128 mod q: undoes R^-1 and scales by 1/128
+#define DSA_INV_F                   41978       // 2^64 / 256 mod q
+
+// --- Twiddle Factors ---
+// zeta^brv7(i) * 2^16 mod q, centred (zeta = 17)
+static const int16_t KemZetas[128] RAMFUNC_TABLE = {
+    -1044,  -758,  -359, -1517,  1493,  1422,   287,   202,  -171,   622,  1577,   182,   962, -1202, -1474,  1468,
+      573, -1325,   264,   383,  -829,  1458, -1602,  -130,  -681,  1017,   732,   608, -1542,   411,  -205, -1571,
+     1223,   652,  -552,  1015, -1293,  1491,  -282, -1544,   516,    -8,  -320,  -666, -1618, -1162,   126,  1469,
+     -853,   -90,  -271,   830,   107, -1421,  -247,  -951,  -398,   961, -1508,  -725,   448, -1065,   677, -1275,
+    -1103,   430,   555,   843, -1251,   871,  1550,   105,   422,   587,   177,  -235,  -291,  -460,  1574,  1653,
+     -246,   778,  1159,  -147,  -777,  1483,  -602,  1119, -1590,   644,  -872,   349,   418,   329,  -156,   -75,
+      817,  1097,   603,   610,  1322, -1285, -1465,   384, -1215,  -136,  1218, -1335,  -874,   220, -1187, -1659,
+    -1185, -1530, -1278,   794, -1510,  -854,  -870,   478,  -108,  -308,   996,   991,   958, -1460,  1522,  1628,
+};
+
+// zeta^brv8(i) * 2^32 mod q, centred (zeta = 1753); entry 0 is unused
+static const int32_t DsaZetas[256] RAMFUNC_TABLE = {
+           0,    25847, -2608894,  -518909,   237124,  -777960,  -876248,   466468,
+     1826347,  2353451,  -359251, -2091905,  3119733, -2884855,  3111497,  2680103,
+     2725464,  1024112, -1079900,  3585928,  -549488, -1119584,  2619752, -2108549,
+    -2118186, -3859737, -1399561, -3277672,  1757237,   -19422,  4010497,   280005,
+     2706023,    95776,  3077325,  3530437, -1661693, -3592148, -2537516,  3915439,
+    -3861115, -3043716,  3574422, -2867647,  3539968,  -300467,  2348700,  -539299,
+    -1699267, -1643818,  3505694, -3821735,  3507263, -2140649, -1600420,  3699596,
+      811944,   531354,   954230,  3881043,  3900724, -2556880,  2071892, -2797779,
+    -3930395, -1528703, -3677745, -3041255, -1452451,  3475950,  2176455, -1585221,
+    -1257611,  1939314, -4083598, -1000202, -3190144, -3157330, -3632928,   126922,
+     3412210,  -983419,  2147896,  2715295, -2967645, -3693493,  -411027, -2477047,
+     -671102, -1228525,   -22981, -1308169,  -381987,  1349076,  1852771, -1430430,
+    -3343383,   264944,   508951,  3097992,    44288, -1100098,   904516,  3958618,
+    -3724342,    -8578,  1653064, -3249728,  2389356,  -210977,   759969, -1316856,
+      189548, -3553272,  3159746, -1851402, -2409325,  -177440,  1315589,  1341330,
+     1285669, -1584928,  -812732, -1439742, -3019102, -3881060, -3628969,  3839961,
+     2091667,  3407706,  2316500,  3817976, -3342478,  2244091, -2446433, -3562462,
+      266997,  2434439, -1235728,  3513181, -3520352, -3759364, -1197226, -3193378,
+      900702,  1859098,   909542,   819034,   495491, -1613174,   -43260,  -522500,
+     -655327, -3122442,  2031748,  3207046, -3556995,  -525098,  -768622, -3595838,
+      342297,   286988, -2437823,  4108315,  3437287, -3342277,  1735879,   203044,
+     2842341,  2691481, -2590150,  1265009,  4055324,  1247620,  2486353,  1595974,
+    -3767016,  1250494,  2635921, -3548272, -2994039,  1869119,  1903435, -1050970,
+    -1333058,  1237275, -3318210, -1430225,  -451100,  1312455,  3306115, -1962642,
+    -1279661,  1917081, -2546312, -1374803,  1500165,   777191,  2235880,  3406031,
+     -542412, -2831860, -1671176, -1846953, -2584293, -3724270,   594136, -3776993,
+    -2013608,  2432395,  2454455,  -164721,  1957272,  3369112,   185531, -1207385,
+    -3183426,   162844,  1616392,  3014001,   810149,  1652634, -3694233, -1799107,
+    -3038916,  3523897,  3866901,   269760,  2213111,  -975884,  1717735,   472078,
+     -426683,  1723600, -1803090,  1910376, -1667432, -1104333,  -260646, -3833893,
+    -2939036, -2235985,  -420899, -2286327,   183443,  -976891,  1612842, -3545687,
+     -554416,  3919660,   -48306, -1362209,  3937738,  1400424,  -846154,  1976782,
+};
+
+// --- Base Multiplication (all backends) ---
+
+// (a0 + a1 X)(b0 + b1 X) mod (X^2 - zeta), divided by 2^16
+static void BaseMulPair(int16_t r[2], const int16_t a[2], const int16_t b[2], int16_t zeta) {
+    int16_t r0 = PqKem_MontMul(a[1], b[1]);
+    r0 = (int16_t)(PqKem_MontMul(r0, zeta) + PqKem_MontMul(a[0], b[0]));
+    int16_t r1 = (int16_t)(PqKem_MontMul(a[0], b[1]) + PqKem_MontMul(a[1], b[0]));
+    r[0] = r0;
+    r[1] = r1;
+}
+
+void PqKem_BaseMul(int16_t r[PQ_N], const int16_t a[PQ_N], const int16_t b[PQ_N]) {
+    for (uint32_t i = 0; i < PQ_N / 4U; i++) {
+        int16_t zeta = KemZetas[64U + i];
+        BaseMulPair(&r[4U * i], &a[4U * i], &b[4U * i], zeta);
+        BaseMulPair(&r[4U * i + 2U], &a[4U * i + 2U], &b[4U * i + 2U], (int16_t)-zeta);
+    }
+}
+
+void PqKem_BaseMulAcc(int16_t r[PQ_N], const int16_t a[PQ_N], const int16_t b[PQ_N]) {
+    int16_t t[4];
+    for (uint32_t i = 0; i < PQ_N / 4U; i++) {
+        int16_t zeta = KemZetas[64U + i];
+        BaseMulPair(&t[0], &a[4U * i], &b[4U * i], zeta);
+        BaseMulPair(&t[2], &a[4U * i + 2U], &b[4U * i + 2U], (int16_t)-zeta);
+        for (uint32_t j = 0; j < 4U; j++) {
+            r[4U * i + j] = (int16_t)(r[4U * i + j] + t[j]);
+        }
+    }
+}
+
+// --- Transform Backends ---
+
+#if defined(PQ_NTT_DSP)
+
+const char *PqNtt_BackendName(void) {
+    return "cortex-m4 dsp";
+}
+
+// Montgomery products of both halves of b with zeta (bottom half), packed
+static inline int16x2_t DspMontMulPair(int16x2_t b, int32_t zeta) {
+    int32_t lo = __smulbb(b, zeta);
+    int32_t hi = __smultb(b, zeta);
+    // lo - t q, with t = (int16)(lo * qinv); the result is the top half
+    lo = __smlabb(__smulbb(lo, ML_KEM_QINV), -ML_KEM_Q, lo);
+    hi = __smlabb(__smulbb(hi, ML_KEM_QINV), -ML_KEM_Q, hi);
+    // ACLE has no pack intrinsic; GCC and Clang match this to PKHTB
+    return (int16x2_t)(((uint32_t)hi & 0xFFFF0000UL) | ((uint32_t)lo >> 16));
+}
+
+static inline int16x2_t LoadPair(const int16_t *p) {
+    int16x2_t v;
+    memcpy(&v, p, sizeof(v));       // Unaligned-safe, compiles to LDR on M4
+    return v;
+}
+
+static inline void StorePair(int16_t *p, int16x2_t v) {
+    memcpy(p, &v, sizeof(v));
+}
+
+RAMFUNC void PqKem_Ntt(int16_t a[PQ_N]) {
+    uint32_t k = 1;
+    for (uint32_t len = 128; len >= 2U; len >>= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int32_t zeta = KemZetas[k++];
+            for (uint32_t j = start; j < start + len; j += 2U) {
+                int16x2_t x = LoadPair(&a[j]);
+                int16x2_t t = DspMontMulPair(LoadPair(&a[j + len]), zeta);
+                StorePair(&a[j + len], __ssub16(x, t));
+                StorePair(&a[j], __sadd16(x, t));
+            }
+        }
+    }
+}
+
+RAMFUNC void PqKem_InvNtt(int16_t a[PQ_N]) {
+    uint32_t k = 127;
+    for (uint32_t len = 2; len <= 128U; len <<= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int32_t zeta = KemZetas[k--];
+            for (uint32_t j = start; j < start + len; j += 2U) {
+                int16x2_t x = LoadPair(&a[j]);
+                int16x2_t y = LoadPair(&a[j + len]);
+                int16x2_t sum = __sadd16(x, y);
+                StorePair(&a[j + len], DspMontMulPair(__ssub16(y, x), zeta));
+                a[j] = PqKem_Reduce((int16_t)sum);
+                a[j + 1U] = PqKem_Reduce((int16_t)(sum >> 16));
+            }
+        }
+    }
+    for (uint32_t j = 0; j < PQ_N; j += 2U) {
+        StorePair(&a[j], DspMontMulPair(LoadPair(&a[j]), KEM_INV_F));
+    }
+}
+
+#elif defined(PQ_NTT_AVX2)
+
+const char *PqNtt_BackendName(void) {
+    return "avx2";
+}
+
+// Twiddle vectors for the layers shorter than a vector, by 32- or
+// 16-coefficient group: [forward, inverse][layer][group][lane]
+static int16_t KemLaneZetas[2][3][8][16];
+static int32_t DsaLaneZetas[2][3][16][8];
+static bool LaneZetasReady;
+
+// Which block of the group each lane of the split vector X belongs to
+static const uint8_t KemLaneBlocks[3][16] = {
+    { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 },     // len 8
+    { 0, 0, 0, 0, 2, 2, 2, 2, 1, 1, 1, 1, 3, 3, 3, 3 },     // len 4
+    { 0, 0, 1, 1, 4, 4, 5, 5, 2, 2, 3, 3, 6, 6, 7, 7 },     // len 2
+};
+static const uint8_t DsaLaneBlocks[3][8] = {
+    { 0, 0, 0, 0, 1, 1, 1, 1 },                             // len 4
+    { 0, 0, 2, 2, 1, 1, 3, 3 },                             // len 2
+    { 0, 1, 4, 5, 2, 3, 6, 7 },                             // len 1
+};
+
+// Zeta index of a block: counting up from 128 / len forward, down from 256 / len - 1 inverse
+static uint32_t ZetaIndex(uint32_t len, uint32_t block, uint32_t inverse) {
+    uint32_t base = 128U / len;
+    return inverse ? 2U * base - 1U - block : base + block;
+}
+
+static void LaneZetasInit(void) {
+    for (uint32_t inv = 0; inv < 2U; inv++) {
+        for (uint32_t layer = 0; layer < 3U; layer++) {
+            uint32_t len = 8U >> layer;
+            for (uint32_t g = 0; g < 8U; g++) {
+                for (uint32_t lane = 0; lane < 16U; lane++) {
+                    uint32_t block = g * (16U / len) + KemLaneBlocks[layer][lane];
+                    KemLaneZetas[inv][layer][g][lane] = KemZetas[ZetaIndex(len, block, inv)];
+                }
+            }
+            len = 4U >> layer;
+            for (uint32_t g = 0; g < 16U; g++) {
+                for (uint32_t lane = 0; lane < 8U; lane++) {
+                    uint32_t block = g * (8U / len) + DsaLaneBlocks[layer][lane];
+                    int32_t zeta = DsaZetas[ZetaIndex(len, block, inv)];
+                    DsaLaneZetas[inv][layer][g][lane] = inv ? -zeta : zeta;
+                }
+            }
+        }
+    }
+    LaneZetasReady = true;
+}
+
+// Same result as PqKem_MontMul on every lane
+static inline __m256i KemMontMul(__m256i a, __m256i zeta) {
+    __m256i zeta_qinv = _mm256_mullo_epi16(zeta, _mm256_set1_epi16(ML_KEM_QINV));
+    __m256i hi = _mm256_mulhi_epi16(a, zeta);
+    __m256i t = _mm256_mullo_epi16(a, zeta_qinv);
+    t = _mm256_mulhi_epi16(t, _mm256_set1_epi16(ML_KEM_Q));
+    return _mm256_sub_epi16(hi, t);
+}
+
+// Same result as PqKem_Reduce on every lane
+static inline __m256i KemReduce(__m256i a) {
+    const int16_t v = (int16_t)(((1 << 26) + ML_KEM_Q / 2) / ML_KEM_Q);
+    __m256i t = _mm256_mulhi_epi16(a, _mm256_set1_epi16(v));
+    t = _mm256_srai_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(1 << 9)), 10);
+    return _mm256_sub_epi16(a, _mm256_mullo_epi16(t, _mm256_set1_epi16(ML_KEM_Q)));
+}
+
+static inline void KemFwdButterfly(__m256i *x, __m256i *y, __m256i zeta) {
+    __m256i t = KemMontMul(*y, zeta);
+    *y = _mm256_sub_epi16(*x, t);
+    *x = _mm256_add_epi16(*x, t);
+}
+
+static inline void KemInvButterfly(__m256i *x, __m256i *y, __m256i zeta) {
+    __m256i d = _mm256_sub_epi16(*y, *x);
+    *x = KemReduce(_mm256_add_epi16(*x, *y));
+    *y = KemMontMul(d, zeta);
+}
+
+// Splits 32 coefficients into first (x) and second (y) butterfly inputs, and back
+static inline void KemSplit(uint32_t len, __m256i a, __m256i b, __m256i *x, __m256i *y) {
+    if (len == 8U) {
+        *x = _mm256_permute2x128_si256(a, b, 0x20);
+        *y = _mm256_permute2x128_si256(a, b, 0x31);
+    } else {
+        if (len == 2U) {
+            a = _mm256_shuffle_epi32(a, 0xD8);
+            b = _mm256_shuffle_epi32(b, 0xD8);
+        }
+        *x = _mm256_unpacklo_epi64(a, b);
+        *y = _mm256_unpackhi_epi64(a, b);
+    }
+}
+
+static inline void KemJoin(uint32_t len, __m256i x, __m256i y, __m256i *a, __m256i *b) {
+    if (len == 8U) {
+        *a = _mm256_permute2x128_si256(x, y, 0x20);
+        *b = _mm256_permute2x128_si256(x, y, 0x31);
+    } else {
+        *a = _mm256_unpacklo_epi64(x, y);
+        *b = _mm256_unpackhi_epi64(x, y);
+        if (len == 2U) {
+            *a = _mm256_shuffle_epi32(*a, 0xD8);
+            *b = _mm256_shuffle_epi32(*b, 0xD8);
+        }
+    }
+}
+
+static void KemShortLayer(int16_t a[PQ_N], uint32_t layer, uint32_t inverse) {
+    uint32_t len = 8U >> layer;
+    for (uint32_t g = 0; g < 8U; g++) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)&a[32U * g]);
+        __m256i hi = _mm256_loadu_si256((const __m256i *)&a[32U * g + 16U]);
+        __m256i zeta = _mm256_loadu_si256((const __m256i *)KemLaneZetas[inverse][layer][g]);
+        __m256i x, y;
+        KemSplit(len, lo, hi, &x, &y);
+        if (inverse) {
+            KemInvButterfly(&x, &y, zeta);
+        } else {
+            KemFwdButterfly(&x, &y, zeta);
+        }
+        KemJoin(len, x, y, &lo, &hi);
+        _mm256_storeu_si256((__m256i *)&a[32U * g], lo);
+        _mm256_storeu_si256((__m256i *)&a[32U * g + 16U], hi);
+    }
+}
+
+RAMFUNC void PqKem_Ntt(int16_t a[PQ_N]) {
+    if (!LaneZetasReady) {
+        LaneZetasInit();
+    }
+    uint32_t k = 1;
+    for (uint32_t len = 128; len >= 16U; len >>= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            __m256i zeta = _mm256_set1_epi16(KemZetas[k++]);
+            for (uint32_t j = start; j < start + len; j += 16U) {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+                __m256i y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+                KemFwdButterfly(&x, &y, zeta);
+                _mm256_storeu_si256((__m256i *)&a[j], x);
+                _mm256_storeu_si256((__m256i *)&a[j + len], y);
+            }
+        }
+    }
+    for (uint32_t layer = 0; layer < 3U; layer++) {
+        KemShortLayer(a, layer, 0);
+    }
+}
+
+RAMFUNC void PqKem_InvNtt(int16_t a[PQ_N]) {
+    if (!LaneZetasReady) {
+        LaneZetasInit();
+    }
+    for (uint32_t layer = 3; layer > 0; layer--) {
+        KemShortLayer(a, layer - 1U, 1);
+    }
+    uint32_t k = 15;
+    for (uint32_t len = 16; len <= 128U; len <<= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            __m256i zeta = _mm256_set1_epi16(KemZetas[k--]);
+            for (uint32_t j = start; j < start + len; j += 16U) {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+                __m256i y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+                KemInvButterfly(&x, &y, zeta);
+                _mm256_storeu_si256((__m256i *)&a[j], x);
+                _mm256_storeu_si256((__m256i *)&a[j + len], y);
+            }
+        }
+    }
+    __m256i f = _mm256_set1_epi16(KEM_INV_F);
+    for (uint32_t j = 0; j < PQ_N; j += 16U) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+        _mm256_storeu_si256((__m256i *)&a[j], KemMontMul(x, f));
+    }
+}
+
+// Same result as PqDsa_MontReduce(a * b) on every lane
+static inline __m256i DsaMontMul(__m256i a, __m256i b) {
+    const __m256i q = _mm256_set1_epi32(ML_DSA_Q);
+    __m256i t = _mm256_mullo_epi32(_mm256_mullo_epi32(a, b), _mm256_set1_epi32(ML_DSA_QINV));
+    __m256i p_even = _mm256_mul_epi32(a, b);
+    __m256i p_odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    __m256i r_even = _mm256_sub_epi64(p_even, _mm256_mul_epi32(t, q));
+    __m256i r_odd = _mm256_sub_epi64(p_odd, _mm256_mul_epi32(_mm256_srli_epi64(t, 32), q));
+    // The low halves cancel; the results are the high halves
+    return _mm256_blend_epi32(_mm256_srli_epi64(r_even, 32), r_odd, 0xAA);
+}
+
+static inline void DsaFwdButterfly(__m256i *x, __m256i *y, __m256i zeta) {
+    __m256i t = DsaMontMul(*y, zeta);
+    *y = _mm256_sub_epi32(*x, t);
+    *x = _mm256_add_epi32(*x, t);
+}
+
+// zeta is already negated
+static inline void DsaInvButterfly(__m256i *x, __m256i *y, __m256i zeta) {
+    __m256i d = _mm256_sub_epi32(*x, *y);
+    *x = _mm256_add_epi32(*x, *y);
+    *y = DsaMontMul(d, zeta);
+}
+
+// As KemSplit, for 16 int32 coefficients (len 4, 2, 1)
+static inline void DsaSplit(uint32_t len, __m256i a, __m256i b, __m256i *x, __m256i *y) {
+    KemSplit(2U * len, a, b, x, y);
+}
+
+static inline void DsaJoin(uint32_t len, __m256i x, __m256i y, __m256i *a, __m256i *b) {
+    KemJoin(2U * len, x, y, a, b);
+}
+
+static void DsaShortLayer(int32_t a[PQ_N], uint32_t layer, uint32_t inverse) {
+    uint32_t len = 4U >> layer;
+    for (uint32_t g = 0; g < 16U; g++) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)&a[16U * g]);
+        __m256i hi = _mm256_loadu_si256((const __m256i *)&a[16U * g + 8U]);
+        __m256i zeta = _mm256_loadu_si256((const __m256i *)DsaLaneZetas[inverse][layer][g]);
+        __m256i x, y;
+        DsaSplit(len, lo, hi, &x, &y);
+        if (inverse) {
+            DsaInvButterfly(&x, &y, zeta);
+        } else {
+            DsaFwdButterfly(&x, &y, zeta);
+        }
+        DsaJoin(len, x, y, &lo, &hi);
+        _mm256_storeu_si256((__m256i *)&a[16U * g], lo);
+        _mm256_storeu_si256((__m256i *)&a[16U * g + 8U], hi);
+    }
+}
+
+RAMFUNC void PqDsa_Ntt(int32_t a[PQ_N]) {
+    if (!LaneZetasReady) {
+        LaneZetasInit();
+    }
+    uint32_t k = 1;
+    for (uint32_t len = 128; len >= 8U; len >>= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            __m256i zeta = _mm256_set1_epi32(DsaZetas[k++]);
+            for (uint32_t j = start; j < start + len; j += 8U) {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+                __m256i y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+                DsaFwdButterfly(&x, &y, zeta);
+                _mm256_storeu_si256((__m256i *)&a[j], x);
+                _mm256_storeu_si256((__m256i *)&a[j + len], y);
+            }
+        }
+    }
+    for (uint32_t layer = 0; layer < 3U; layer++) {
+        DsaShortLayer(a, layer, 0);
+    }
+}
+
+RAMFUNC void PqDsa_InvNtt(int32_t a[PQ_N]) {
+    if (!LaneZetasReady) {
+        LaneZetasInit();
+    }
+    for (uint32_t layer = 3; layer > 0; layer--) {
+        DsaShortLayer(a, layer - 1U, 1);
+    }
+    uint32_t k = 32;
+    for (uint32_t len = 8; len < PQ_N; len <<= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            __m256i zeta = _mm256_set1_epi32(-DsaZetas[--k]);
+            for (uint32_t j = start; j < start + len; j += 8U) {
+                __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+                __m256i y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+                DsaInvButterfly(&x, &y, zeta);
+                _mm256_storeu_si256((__m256i *)&a[j], x);
+                _mm256_storeu_si256((__m256i *)&a[j + len], y);
+            }
+        }
+    }
+    __m256i f = _mm256_set1_epi32(DSA_INV_F);
+    for (uint32_t j = 0; j < PQ_N; j += 8U) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+        _mm256_storeu_si256((__m256i *)&a[j], DsaMontMul(x, f));
+    }
+}
+
+void PqDsa_PointwiseMul(int32_t r[PQ_N], const int32_t a[PQ_N], const int32_t b[PQ_N]) {
+    for (uint32_t j = 0; j < PQ_N; j += 8U) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&a[j]);
+        __m256i y = _mm256_loadu_si256((const __m256i *)&b[j]);
+        _mm256_storeu_si256((__m256i *)&r[j], DsaMontMul(x, y));
+    }
+}
+
+#endif
+
+// --- Portable Transforms ---
+
+#if !defined(PQ_NTT_DSP) && !defined(PQ_NTT_AVX2)
+
+const char *PqNtt_BackendName(void) {
+    return "portable";
+}
+
+RAMFUNC void PqKem_Ntt(int16_t a[PQ_N]) {
+    uint32_t k = 1;
+    for (uint32_t len = 128; len >= 2U; len >>= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int16_t zeta = KemZetas[k++];
+            for (uint32_t j = start; j < start + len; j++) {
+                int16_t t = PqKem_MontMul(zeta, a[j + len]);
+                a[j + len] = (int16_t)(a[j] - t);
+                a[j] = (int16_t)(a[j] + t);
+            }
+        }
+    }
+}
+
+RAMFUNC void PqKem_InvNtt(int16_t a[PQ_N]) {
+    uint32_t k = 127;
+    for (uint32_t len = 2; len <= 128U; len <<= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int16_t zeta = KemZetas[k--];
+            for (uint32_t j = start; j < start + len; j++) {
+                int16_t t = a[j];
+                a[j] = PqKem_Reduce((int16_t)(t + a[j + len]));
+                a[j + len] = PqKem_MontMul(zeta, (int16_t)(a[j + len] - t));
+            }
+        }
+    }
+    for (uint32_t j = 0; j < PQ_N; j++) {
+        a[j] = PqKem_MontMul(a[j], KEM_INV_F);
+    }
+}
+
+#endif
+
+#if !defined(PQ_NTT_AVX2)
+
+RAMFUNC void PqDsa_Ntt(int32_t a[PQ_N]) {
+    uint32_t k = 0;
+    for (uint32_t len = 128; len > 0; len >>= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int32_t zeta = DsaZetas[++k];
+            for (uint32_t j = start; j < start + len; j++) {
+                int32_t t = PqDsa_MontReduce((int64_t)zeta * a[j + len]);
+                a[j + len] = a[j] - t;
+                a[j] = a[j] + t;
+            }
+        }
+    }
+}
+
+RAMFUNC void PqDsa_InvNtt(int32_t a[PQ_N]) {
+    uint32_t k = 256;
+    for (uint32_t len = 1; len < PQ_N; len <<= 1) {
+        for (uint32_t start = 0; start < PQ_N; start += 2U * len) {
+            int32_t zeta = -DsaZetas[--k];
+            for (uint32_t j = start; j < start + len; j++) {
+                int32_t t = a[j];
+                a[j] = t + a[j + len];
+                a[j + len] = PqDsa_MontReduce((int64_t)zeta * (t - a[j + len]));
+            }
+        }
+    }
+    for (uint32_t j = 0; j < PQ_N; j++) {
+        a[j] = PqDsa_MontReduce((int64_t)DSA_INV_F * a[j]);
+    }
+}
+
+void PqDsa_PointwiseMul(int32_t r[PQ_N], const int32_t a[PQ_N], const int32_t b[PQ_N]) {
+    for (uint32_t j = 0; j < PQ_N; j++) {
+        r[j] = PqDsa_MontReduce((int64_t)a[j] * b[j]);
+    }
+}
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file pq_ntt.h
+ * @brief Number-theoretic transforms and modular arithmetic for ML-KEM and ML-DSA.
+ *
+ * Both schemes multiply polynomials of 256 coefficients through an NTT.
+ * ML-KEM works mod 3329 on int16 coefficients with a 7-layer transform;
+ * products pair up coefficients (degree-1 base multiplication). ML-DSA
+ * works mod 8380417 on int32 coefficients with a full 8-layer transform.
+ * Multiplications are Montgomery reductions (R = 2^16 and 2^32), as in the
+ * reference implementations. The constant tables hold the twiddle factors
+ * in Montgomery form and in bit-reversed order.
+ *
+ * Value ranges follow the reference code:
+ *  - Forward transforms take |a| < q and return |a| < 9q (ML-KEM: 8q).
+ *  - Inverse transforms take |a| < q and return |a| < q, already
+ *    multiplied by R. A base or pointwise product (which divides by R)
+ *    followed by an inverse transform therefore yields the plain product.
+ *  - Forward and inverse transforms compute the same values on every
+ *    backend.
+ *
+ * Backends, chosen at compile time as in ml/ml_kernels.c:
+ *  - Cortex-M4 DSP: ML-KEM butterflies on two packed int16 coefficients
+ *    per word (SMULBB/SMULTB, SMLABB, SADD16/SSUB16).
+ *  - AVX2: 16 ML-KEM or 8 ML-DSA coefficients per vector.
+ *  - Portable C.
+ * On the M4 the ML-DSA transform is the portable C, which GCC already
+ * compiles to SMULL/SMLAL. The transforms are RAMFUNC, like the other hot
+ * kernels.
+ */
+
+#ifndef PQ_NTT_H
+#define PQ_NTT_H
+
+#include <stdint.h>
+
+#define PQ_N                        256U
+
+#define ML_KEM_Q                    3329
+#define ML_KEM_QINV                 (-3327)     // q^-1 mod 2^16
+#define ML_KEM_MONT                 (-1044)     // 2^16 mod q
+
+#define ML_DSA_Q                    8380417
+#define ML_DSA_QINV                 58728449    // q^-1 mod 2^32
+#define ML_DSA_MONT                 (-4186625)  // 2^32 mod q
+
+// --- Scalar Arithmetic ---
+
+/**
+ * @brief a / 2^16 mod q for |a| < q * 2^15; result in (-q, q).
+ */
+static inline int16_t PqKem_MontReduce(int32_t a) {
+    int16_t t = (int16_t)((int16_t)a * ML_KEM_QINV);
+    return (int16_t)((a - (int32_t)t * ML_KEM_Q) >> 16);
+}
+
+static inline int16_t PqKem_MontMul(int16_t a, int16_t b) {
+    return PqKem_MontReduce((int32_t)a * b);
+}
+
+/**
+ * @brief Centred representative of a mod q, in [-(q - 1) / 2, (q - 1) / 2].
+ */
+static inline int16_t PqKem_Reduce(int16_t a) {
+    const int16_t v = (int16_t)(((1 << 26) + ML_KEM_Q / 2) / ML_KEM_Q);
+    int16_t t = (int16_t)(((int32_t)v * a + (1 << 25)) >> 26);
+    return (int16_t)(a - t * ML_KEM_Q);
+}
+
+/**
+ * @brief a / 2^32 mod q for |a| < q * 2^31; result in (-q, q).
+ */
+static inline int32_t PqDsa_MontReduce(int64_t a) {
+    int32_t t = (int32_t)((uint32_t)a * (uint32_t)ML_DSA_QINV);
+    return (int32_t)((a - (int64_t)t * ML_DSA_Q) >> 32);
+}
+
+/**
+ * @brief a mod q in [-6283008, 6283008], for a <= 2^31 - 2^22 - 1.
+ */
+static inline int32_t PqDsa_Reduce32(int32_t a) {
+    int32_t t = (a + (1 << 22)) >> 23;
+    return a - t * ML_DSA_Q;
+}
+
+/**
+ * @brief Adds q to a negative a.
+ */
+static inline int32_t PqDsa_AddQ(int32_t a) {
+    return a + ((a >> 31) & ML_DSA_Q);
+}
+
+/**
+ * @brief Canonical representative in [0, q).
+ */
+static inline int32_t PqDsa_Freeze(int32_t a) {
+    return PqDsa_AddQ(PqDsa_Reduce32(a));
+}
+
+// --- Transforms ---
+
+void PqKem_Ntt(int16_t a[PQ_N]);
+void PqKem_InvNtt(int16_t a[PQ_N]);
+
+/**
+ * @brief r = a * b / 2^16 in the NTT domain (degree-1 products mod X^2 - zeta).
+ */
+void PqKem_BaseMul(int16_t r[PQ_N], const int16_t a[PQ_N], const int16_t b[PQ_N]);
+
+/**
+ * @brief r += a * b / 2^16 in the NTT domain, for matrix-vector rows.
+ */
+void PqKem_BaseMulAcc(int16_t r[PQ_N], const int16_t a[PQ_N], const int16_t b[PQ_N]);
+
+void PqDsa_Ntt(int32_t a[PQ_N]);
+void PqDsa_InvNtt(int32_t a[PQ_N]);
+
+/**
+ * @brief r = a * b / 2^32 coefficient-wise in the NTT domain.
+ */
+void PqDsa_PointwiseMul(int32_t r[PQ_N], const int32_t a[PQ_N], const int32_t b[PQ_N]);
+
+/**
+ * @brief Name of the compiled-in transform backend, for reports.
+ */
+const char *PqNtt_BackendName(void);
+
+#endif // PQ_NTT_H
@@ -0,0 +1,82 @@
+/**
+ * @file rsa.c
+ * @brief Implementation of the blinded RSA private-key operation.
+ */
+
+#include "rsa.h"
+
+#include <string.h>
+
+// --- Private Helper Functions ---
+
+static uint32_t Limbs(const RsaKey *key) {
+    return key->mont.n;
+}
+
+// Loads a representative; it must be below n
+static bool LoadInput(const RsaKey *key, BnLimb *x, const uint8_t *in) {
+    Bn_FromBytes(x, Limbs(key), in, key->bytes);
+    return Bn_Cmp(x, key->mont.m, Limbs(key)) < 0;
+}
+
+// --- Public Function Implementations ---
+
+bool Rsa_Init(RsaKey *key, const uint8_t *n, const uint8_t *d, uint32_t bytes, uint32_t e) {
+    if (bytes == 0 || bytes > RSA_MAX_BYTES || bytes % sizeof(BnLimb) != 0 || (e & 1U) == 0) {
+        return false;
+    }
+    BnLimb m[BN_MAX_LIMBS];
+    uint32_t limbs = bytes / (uint32_t)sizeof(BnLimb);
+    Bn_FromBytes(m, limbs, n, bytes);
+    if (!BnMont_Init(&key->mont, m, limbs)) {
+        return false;
+    }
+    Bn_FromBytes(key->d, limbs, d, bytes);
+    key->e = e;
+    key->bytes = bytes;
+    return true;
+}
+
+bool Rsa_MakeBlinding(const RsaKey *key, const uint8_t *random, RsaBlinding *b) {
+    const uint32_t n = Limbs(key);
+    BnLimb r[BN_MAX_LIMBS];
+    BnLimb t[BN_MAX_LIMBS];
+    Bn_FromBytes(r, n, random, key->bytes - 1U);
+    if (Bn_IsZero(r, n)) {
+        return false;
+    }
+    BnLimb e[1] = { key->e };
+    BnMont_Exp(&key->mont, t, r, e, 1);
+    BnMont_ToMont(&key->mont, b->r_e, t);
+    bool ok = Bn_ModInv(t, r, key->mont.m, n);
+    if (ok) {
+        BnMont_ToMont(&key->mont, b->r_inv, t);
+    }
+    memset(r, 0, sizeof(r));
+    memset(t, 0, sizeof(t));
+    return ok;
+}
+
+bool Rsa_Public(const RsaKey *key, const uint8_t *in, uint8_t *out) {
+    BnLimb x[BN_MAX_LIMBS];
+    if (!LoadInput(key, x, in)) {
+        return false;
+    }
+    BnLimb e[1] = { key->e };
+    BnMont_Exp(&key->mont, x, x, e, 1);
+    Bn_ToBytes(out, key->bytes, x, Limbs(key));
+    return true;
+}
+
+bool Rsa_PrivateBlinded(const RsaKey *key, const RsaBlinding *b, const uint8_t *in, uint8_t *out) {
+    BnLimb x[BN_MAX_LIMBS];
+    if (!LoadInput(key, x, in)) {
+        return false;
+    }
+    BnMont_Mul(&key->mont, x, x, b->r_e);           // m r^e
+    BnMont_Exp(&key->mont, x, x, key->d, Limbs(key)); // m^d r
+    BnMont_Mul(&key->mont, x, x, b->r_inv);         // m^d
+    Bn_ToBytes(out, key->bytes, x, Limbs(key));
+    memset(x, 0, sizeof(x));
+    return true;
+}
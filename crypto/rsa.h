@@ -0,0 +1,66 @@
+/**
+ * @file rsa.h
+ * @brief RSA private-key operation with precomputed blinding, up to 2048 bits.
+ *
+ * Raw RSA: inputs are already-encoded message representatives (e.g. a
+ * PKCS#1 v1.5 or PSS encoding) of the modulus length, big-endian.
+ *
+ * The private operation is blinded. The message is multiplied by r^e
+ * before the exponentiation with d, and the result by r^-1 after, so the
+ * exponentiation never sees the caller's value. Building a blinding pair
+ * costs an exponentiation by e and an inversion mod n, but it depends on
+ * nothing but r. It can therefore be prepared ahead of time, and the
+ * online cost is two multiplications. Each pair must be used once.
+ */
+
+#ifndef RSA_H
+#define RSA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bignum.h"
+
+#define RSA_MAX_BYTES               (BN_MAX_LIMBS * sizeof(BnLimb))
+
+// --- Public Types ---
+
+typedef struct {
+    BnMont   mont;                  // Modulus n
+    BnLimb   d[BN_MAX_LIMBS];       // Private exponent; secret
+    uint32_t e;
+    uint32_t bytes;                 // Modulus length
+} RsaKey;
+
+typedef struct {
+    BnLimb r_e[BN_MAX_LIMBS];       // r^e mod n, Montgomery form
+    BnLimb r_inv[BN_MAX_LIMBS];     // r^-1 mod n, Montgomery form
+} RsaBlinding;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Loads a key; n and d are big-endian, bytes long, bytes a multiple of 4.
+ */
+bool Rsa_Init(RsaKey *key, const uint8_t *n, const uint8_t *d, uint32_t bytes, uint32_t e);
+
+/**
+ * @brief Builds a blinding pair from key->bytes - 1 random bytes.
+ *
+ * One byte shorter than n, r is always below n.
+ *
+ * @return False if r is zero or shares a factor with n; draw again.
+ */
+bool Rsa_MakeBlinding(const RsaKey *key, const uint8_t *random, RsaBlinding *b);
+
+/**
+ * @brief out = in^e mod n.
+ */
+bool Rsa_Public(const RsaKey *key, const uint8_t *in, uint8_t *out);
+
+/**
+ * @brief out = in^d mod n, blinded with a pair that is then spent.
+ */
+bool Rsa_PrivateBlinded(const RsaKey *key, const RsaBlinding *b, const uint8_t *in, uint8_t *out);
+
+#endif // RSA_H
@@ -0,0 +1,146 @@
+/**
+ * @file sha256.c
+ * @brief Implementation of SHA-256.
+ */
+
+#include "sha256.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define ROTR(x, n)                  (((x) >> (n)) | ((x) << (32U - (n))))
+#define CH(x, y, z)                 (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z)                (((x) & (y)) | ((z) & ((x) | (y))))
+#define BSIG0(x)                    (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define BSIG1(x)                    (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define SSIG0(x)                    (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define SSIG1(x)                    (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+// --- Private Variables ---
+static const uint32_t Sha256K[64] = {
+    0x428A2F98UL, 0x71374491UL, 0xB5C0FBCFUL, 0xE9B5DBA5UL, 0x3956C25BUL, 0x59F111F1UL, 0x923F82A4UL, 0xAB1C5ED5UL,
+    0xD807AA98UL, 0x12835B01UL, 0x243185BEUL, 0x550C7DC3UL, 0x72BE5D74UL, 0x80DEB1FEUL, 0x9BDC06A7UL, 0xC19BF174UL,
+    0xE49B69C1UL, 0xEFBE4786UL, 0x0FC19DC6UL, 0x240CA1CCUL, 0x2DE92C6FUL, 0x4A7484AAUL, 0x5CB0A9DCUL, 0x76F988DAUL,
+    0x983E5152UL, 0xA831C66DUL, 0xB00327C8UL, 0xBF597FC7UL, 0xC6E00BF3UL, 0xD5A79147UL, 0x06CA6351UL, 0x14292967UL,
+    0x27B70A85UL, 0x2E1B2138UL, 0x4D2C6DFCUL, 0x53380D13UL, 0x650A7354UL, 0x766A0ABBUL, 0x81C2C92EUL, 0x92722C85UL,
+    0xA2BFE8A1UL, 0xA81A664BUL, 0xC24B8B70UL, 0xC76C51A3UL, 0xD192E819UL, 0xD6990624UL, 0xF40E3585UL, 0x106AA070UL,
+    0x19A4C116UL, 0x1E376C08UL, 0x2748774CUL, 0x34B0BCB5UL, 0x391C0CB3UL, 0x4ED8AA4AUL, 0x5B9CCA4FUL, 0x682E6FF3UL,
+    0x748F82EEUL, 0x78A5636FUL, 0x84C87814UL, 0x8CC70208UL, 0x90BEFFFAUL, 0xA4506CEBUL, 0xBEF9A3F7UL, 0xC67178F2UL,
+};
+
+static const uint32_t Sha256Iv[8] = {
+    0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+    0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL,
+};
+
+// --- Private Helper Functions ---
+
+static uint32_t LoadBe32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void StoreBe32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+// --- Public Function Implementations ---
+
+void Sha256_Compress(uint32_t state[8], const uint8_t *data, uint32_t blocks) {
+    uint32_t w[16];
+    for (; blocks > 0; blocks--, data += SHA256_BLOCK_BYTES) {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        // The message schedule lives in a 16-word window
+        for (uint32_t t = 0; t < 64; t++) {
+            uint32_t wt;
+            if (t < 16) {
+                wt = LoadBe32(&data[t * 4]);
+            } else {
+                wt = SSIG1(w[(t - 2) & 15]) + w[(t - 7) & 15] + SSIG0(w[(t - 15) & 15]) + w[t & 15];
+            }
+            w[t & 15] = wt;
+            uint32_t t1 = h + BSIG1(e) + CH(e, f, g) + Sha256K[t] + wt;
+            uint32_t t2 = BSIG0(a) + MAJ(a, b, c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+void Sha256_Init(Sha256Ctx *ctx) {
+    memcpy(ctx->state, Sha256Iv, sizeof(Sha256Iv));
+    ctx->length = 0;
+    ctx->buffered = 0;
+}
+
+void Sha256_Update(Sha256Ctx *ctx, const void *data, uint32_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    ctx->length += len;
+    if (ctx->buffered > 0) {
+        uint32_t take = SHA256_BLOCK_BYTES - ctx->buffered;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(&ctx->buffer[ctx->buffered], p, take);
+        ctx->buffered += take;
+        p += take;
+        len -= take;
+        if (ctx->buffered < SHA256_BLOCK_BYTES) {
+            return;
+        }
+        Sha256_Compress(ctx->state, ctx->buffer, 1);
+        ctx->buffered = 0;
+    }
+    // Whole blocks straight from the caller's buffer
+    uint32_t blocks = len / SHA256_BLOCK_BYTES;
+    if (blocks > 0) {
+        Sha256_Compress(ctx->state, p, blocks);
+        p += blocks * SHA256_BLOCK_BYTES;
+        len -= blocks * SHA256_BLOCK_BYTES;
+    }
+    memcpy(ctx->buffer, p, len);
+    ctx->buffered = len;
+}
+
+void Sha256_Final(Sha256Ctx *ctx, uint8_t digest[SHA256_DIGEST_BYTES]) {
+    uint64_t bits = ctx->length * 8U;
+    ctx->buffer[ctx->buffered++] = 0x80;
+    if (ctx->buffered > SHA256_BLOCK_BYTES - 8) {
+        memset(&ctx->buffer[ctx->buffered], 0, SHA256_BLOCK_BYTES - ctx->buffered);
+        Sha256_Compress(ctx->state, ctx->buffer, 1);
+        ctx->buffered = 0;
+    }
+    memset(&ctx->buffer[ctx->buffered], 0, SHA256_BLOCK_BYTES - 8 - ctx->buffered);
+    StoreBe32(&ctx->buffer[56], (uint32_t)(bits >> 32));
+    StoreBe32(&ctx->buffer[60], (uint32_t)bits);
+    Sha256_Compress(ctx->state, ctx->buffer, 1);
+    for (uint32_t i = 0; i < 8; i++) {
+        StoreBe32(&digest[i * 4], ctx->state[i]);
+    }
+}
+
+void Sha256_Digest(const void *data, uint32_t len, uint8_t digest[SHA256_DIGEST_BYTES]) {
+    Sha256Ctx ctx;
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, data, len);
+    Sha256_Final(&ctx, digest);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file sha256.h
+ * @brief SHA-256 (FIPS 180-4), streaming and one-shot.
+ *
+ * Portable C, one 64-byte block per compression call. The round loop is
+ * written so GCC keeps the working variables in registers on Cortex-M4.
+ */
+
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stdint.h>
+
+#define SHA256_BLOCK_BYTES          64U
+#define SHA256_DIGEST_BYTES         32U
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;                    // Bytes absorbed
+    uint8_t  buffer[SHA256_BLOCK_BYTES];
+    uint32_t buffered;
+} Sha256Ctx;
+
+// --- Public Function Declarations ---
+
+void Sha256_Init(Sha256Ctx *ctx);
+void Sha256_Update(Sha256Ctx *ctx, const void *data, uint32_t len);
+
+/**
+ * @brief Pads, writes the digest and leaves ctx unusable until Sha256_Init.
+ */
+void Sha256_Final(Sha256Ctx *ctx, uint8_t digest[SHA256_DIGEST_BYTES]);
+
+void Sha256_Digest(const void *data, uint32_t len, uint8_t digest[SHA256_DIGEST_BYTES]);
+
+/**
+ * @brief Applies the compression function to whole blocks.
+ *
+ * @param blocks Number of 64-byte blocks at data.
+ */
+void Sha256_Compress(uint32_t state[8], const uint8_t *data, uint32_t blocks);
+
+#endif // SHA256_H
@@ -0,0 +1,169 @@
+/**
+ * @file sha256_mb.c
+ * @brief Implementation of multi-buffer SHA-256.
+ */
+
+#include "sha256_mb.h"
+#include "ramfunc.h"
+
+#include <string.h>
+
+#if defined(__AVX2__)
+#define SHA256_MB_AVX2
+#include <immintrin.h>
+#endif
+
+// --- Private Variables ---
+static const uint32_t Sha256Iv[8] = {
+    0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+    0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL,
+};
+
+// --- Public Function Implementations ---
+
+void Sha256Mb_Pad(uint8_t block[SHA256_BLOCK_BYTES], uint32_t len) {
+    uint32_t bits = len * 8U;
+    block[len] = 0x80;
+    memset(&block[len + 1U], 0, SHA256_BLOCK_BYTES - 3U - len);
+    block[SHA256_BLOCK_BYTES - 2U] = (uint8_t)(bits >> 8);
+    block[SHA256_BLOCK_BYTES - 1U] = (uint8_t)bits;
+}
+
+// One lane at a time through the scalar compression function
+static void DigestScalar(const uint8_t *const block[], uint8_t *const digest[], uint32_t count) {
+    uint32_t state[SHA256_MB_LANES][8];
+    for (uint32_t l = 0; l < count; l++) {
+        memcpy(state[l], Sha256Iv, sizeof(Sha256Iv));
+        Sha256_Compress(state[l], block[l], 1);
+    }
+    for (uint32_t l = 0; l < count; l++) {
+        for (uint32_t i = 0; i < 8U; i++) {
+            digest[l][4U * i] = (uint8_t)(state[l][i] >> 24);
+            digest[l][4U * i + 1U] = (uint8_t)(state[l][i] >> 16);
+            digest[l][4U * i + 2U] = (uint8_t)(state[l][i] >> 8);
+            digest[l][4U * i + 3U] = (uint8_t)state[l][i];
+        }
+    }
+}
+
+// --- Digest Backends ---
+
+#if defined(SHA256_MB_AVX2)
+
+#define ROTR_V(x, n)                _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+#define BSIG0_V(x)                  _mm256_xor_si256(_mm256_xor_si256(ROTR_V(x, 2), ROTR_V(x, 13)), ROTR_V(x, 22))
+#define BSIG1_V(x)                  _mm256_xor_si256(_mm256_xor_si256(ROTR_V(x, 6), ROTR_V(x, 11)), ROTR_V(x, 25))
+#define SSIG0_V(x)                  _mm256_xor_si256(_mm256_xor_si256(ROTR_V(x, 7), ROTR_V(x, 18)), \
+                                                     _mm256_srli_epi32(x, 3))
+#define SSIG1_V(x)                  _mm256_xor_si256(_mm256_xor_si256(ROTR_V(x, 17), ROTR_V(x, 19)), \
+                                                     _mm256_srli_epi32(x, 10))
+
+static const uint32_t RoundK[64] = {
+    0x428A2F98UL, 0x71374491UL, 0xB5C0FBCFUL, 0xE9B5DBA5UL, 0x3956C25BUL, 0x59F111F1UL, 0x923F82A4UL, 0xAB1C5ED5UL,
+    0xD807AA98UL, 0x12835B01UL, 0x243185BEUL, 0x550C7DC3UL, 0x72BE5D74UL, 0x80DEB1FEUL, 0x9BDC06A7UL, 0xC19BF174UL,
+    0xE49B69C1UL, 0xEFBE4786UL, 0x0FC19DC6UL, 0x240CA1CCUL, 0x2DE92C6FUL, 0x4A7484AAUL, 0x5CB0A9DCUL, 0x76F988DAUL,
+    0x983E5152UL, 0xA831C66DUL, 0xB00327C8UL, 0xBF597FC7UL, 0xC6E00BF3UL, 0xD5A79147UL, 0x06CA6351UL, 0x14292967UL,
+    0x27B70A85UL, 0x2E1B2138UL, 0x4D2C6DFCUL, 0x53380D13UL, 0x650A7354UL, 0x766A0ABBUL, 0x81C2C92EUL, 0x92722C85UL,
+    0xA2BFE8A1UL, 0xA81A664BUL, 0xC24B8B70UL, 0xC76C51A3UL, 0xD192E819UL, 0xD6990624UL, 0xF40E3585UL, 0x106AA070UL,
+    0x19A4C116UL, 0x1E376C08UL, 0x2748774CUL, 0x34B0BCB5UL, 0x391C0CB3UL, 0x4ED8AA4AUL, 0x5B9CCA4FUL, 0x682E6FF3UL,
+    0x748F82EEUL, 0x78A5636FUL, 0x84C87814UL, 0x8CC70208UL, 0x90BEFFFAUL, 0xA4506CEBUL, 0xBEF9A3F7UL, 0xC67178F2UL,
+};
+
+const char *Sha256Mb_BackendName(void) {
+    return "avx2 x8";
+}
+
+// Rows of 8 words become columns: r[i][j] <- r[j][i]
+static inline void Transpose8(__m256i r[8]) {
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+RAMFUNC void Sha256Mb_Digest(const uint8_t *const block[], uint8_t *const digest[], uint32_t count) {
+    // A lone message is cheaper in scalar code than in eight lanes
+    if (count == 1U) {
+        DigestScalar(block, digest, count);
+        return;
+    }
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    // Unused lanes repeat lane 0
+    __m256i w[16];
+    for (uint32_t half = 0; half < 2U; half++) {
+        __m256i r[8];
+        for (uint32_t l = 0; l < SHA256_MB_LANES; l++) {
+            const uint8_t *p = block[l < count ? l : 0] + 32U * half;
+            r[l] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)p), bswap);
+        }
+        Transpose8(r);
+        memcpy(&w[8U * half], r, sizeof(r));
+    }
+
+    __m256i a = _mm256_set1_epi32((int)Sha256Iv[0]), b = _mm256_set1_epi32((int)Sha256Iv[1]);
+    __m256i c = _mm256_set1_epi32((int)Sha256Iv[2]), d = _mm256_set1_epi32((int)Sha256Iv[3]);
+    __m256i e = _mm256_set1_epi32((int)Sha256Iv[4]), f = _mm256_set1_epi32((int)Sha256Iv[5]);
+    __m256i g = _mm256_set1_epi32((int)Sha256Iv[6]), h = _mm256_set1_epi32((int)Sha256Iv[7]);
+    for (uint32_t t = 0; t < 64U; t++) {
+        if (t >= 16U) {
+            w[t & 15U] = _mm256_add_epi32(_mm256_add_epi32(SSIG1_V(w[(t - 2U) & 15U]), w[(t - 7U) & 15U]),
+                                          _mm256_add_epi32(SSIG0_V(w[(t - 15U) & 15U]), w[t & 15U]));
+        }
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, BSIG1_V(e)),
+                                      _mm256_add_epi32(_mm256_add_epi32(ch, w[t & 15U]),
+                                                       _mm256_set1_epi32((int)RoundK[t])));
+        __m256i t2 = _mm256_add_epi32(BSIG0_V(a), maj);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    __m256i s[8] = { a, b, c, d, e, f, g, h };
+    for (uint32_t i = 0; i < 8U; i++) {
+        s[i] = _mm256_add_epi32(s[i], _mm256_set1_epi32((int)Sha256Iv[i]));
+    }
+    Transpose8(s);
+    for (uint32_t l = 0; l < count; l++) {
+        _mm256_storeu_si256((__m256i *)digest[l], _mm256_shuffle_epi8(s[l], bswap));
+    }
+}
+
+#else
+
+const char *Sha256Mb_BackendName(void) {
+    return "portable";
+}
+
+RAMFUNC void Sha256Mb_Digest(const uint8_t *const block[], uint8_t *const digest[], uint32_t count) {
+    DigestScalar(block, digest, count);
+}
+
+#endif
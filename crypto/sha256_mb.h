@@ -0,0 +1,51 @@
+/**
+ * @file sha256_mb.h
+ * @brief Multi-buffer SHA-256 over independent single-block messages.
+ *
+ * Hash-based signatures spend nearly all their time on short, independent
+ * hashes: each Winternitz chain step hashes 55 bytes, one padded block.
+ * Sha256Mb_Digest hashes up to SHA256_MB_LANES such messages together.
+ *
+ * Backends, chosen at compile time as in ml/ml_kernels.c:
+ *  - AVX2: one message per 32-bit lane of a 256-bit vector. Blocks are
+ *    loaded and stored with an 8 x 8 word transpose. A single message
+ *    takes the scalar path, which is cheaper than eight lanes.
+ *  - Portable C: the lanes go through Sha256_Compress in turn. The
+ *    Cortex-M4 has no 32-bit SIMD lanes, so this is its path too. Lanes
+ *    give no speed-up there, but callers stay the same on every target.
+ */
+
+#ifndef SHA256_MB_H
+#define SHA256_MB_H
+
+#include <stdint.h>
+
+#include "sha256.h"
+
+#define SHA256_MB_LANES             8U
+#define SHA256_MB_MAX_MESSAGE       55U     // Longest message that pads into one block
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Pads a message of len <= SHA256_MB_MAX_MESSAGE bytes, already at
+ *        the start of block, into a single final block.
+ */
+void Sha256Mb_Pad(uint8_t block[SHA256_BLOCK_BYTES], uint32_t len);
+
+/**
+ * @brief Digests count padded single-block messages.
+ *
+ * Each digest may overlap its own block (or any other input): every block
+ * is read before any digest is written.
+ *
+ * @param count Up to SHA256_MB_LANES.
+ */
+void Sha256Mb_Digest(const uint8_t *const block[], uint8_t *const digest[], uint32_t count);
+
+/**
+ * @brief Name of the compiled-in backend, for reports.
+ */
+const char *Sha256Mb_BackendName(void);
+
+#endif // SHA256_MB_H
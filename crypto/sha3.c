@@ -0,0 +1,173 @@
+/**
+ * @file sha3.c
+ * @brief Implementation of the Keccak sponge and the SHA-3 functions.
+ */
+
+#include "sha3.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define KECCAK_ROUNDS               24U
+#define ROTL64(x, n)                (((x) << (n)) | ((x) >> (64U - (n))))
+
+#define PAD_SHA3                    0x06U
+#define PAD_SHAKE                   0x1FU
+
+// --- Private Variables ---
+static const uint64_t RoundConstants[KECCAK_ROUNDS] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+    0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+    0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+// Rho offsets and pi destinations, walking the lanes from (1, 0)
+static const uint8_t RhoOffsets[24] = { 1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+                                        27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44 };
+static const uint8_t PiLanes[24] = { 10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+                                     15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1 };
+
+// --- Private Helper Functions ---
+
+static void Permute(uint64_t a[25]) {
+    for (uint32_t round = 0; round < KECCAK_ROUNDS; round++) {
+        // Theta
+        uint64_t c[5];
+        for (uint32_t x = 0; x < 5; x++) {
+            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        }
+        for (uint32_t x = 0; x < 5; x++) {
+            uint64_t d = c[(x + 4U) % 5U] ^ ROTL64(c[(x + 1U) % 5U], 1U);
+            for (uint32_t y = 0; y < 25; y += 5) {
+                a[y + x] ^= d;
+            }
+        }
+        // Rho and pi
+        uint64_t carry = a[1];
+        for (uint32_t i = 0; i < 24; i++) {
+            uint32_t lane = PiLanes[i];
+            uint64_t t = a[lane];
+            a[lane] = ROTL64(carry, RhoOffsets[i]);
+            carry = t;
+        }
+        // Chi
+        for (uint32_t y = 0; y < 25; y += 5) {
+            uint64_t row[5];
+            memcpy(row, &a[y], sizeof(row));
+            for (uint32_t x = 0; x < 5; x++) {
+                a[y + x] = row[x] ^ (~row[(x + 1U) % 5U] & row[(x + 2U) % 5U]);
+            }
+        }
+        // Iota
+        a[0] ^= RoundConstants[round];
+    }
+}
+
+static void Init(Keccak *k, uint32_t rate, uint8_t pad) {
+    memset(k->lane, 0, sizeof(k->lane));
+    k->rate = rate;
+    k->pos = 0;
+    k->pad = pad;
+    k->squeezing = 0;
+}
+
+static void XorByte(Keccak *k, uint32_t pos, uint8_t byte) {
+    k->lane[pos / 8U] ^= (uint64_t)byte << (8U * (pos % 8U));
+}
+
+// --- Public Function Implementations ---
+
+void Shake128_Init(Keccak *k) {
+    Init(k, SHAKE128_RATE, PAD_SHAKE);
+}
+
+void Shake256_Init(Keccak *k) {
+    Init(k, SHAKE256_RATE, PAD_SHAKE);
+}
+
+void Sha3_256_Init(Keccak *k) {
+    Init(k, 200U - 2U * SHA3_256_BYTES, PAD_SHA3);
+}
+
+void Sha3_512_Init(Keccak *k) {
+    Init(k, 200U - 2U * SHA3_512_BYTES, PAD_SHA3);
+}
+
+void Keccak_Absorb(Keccak *k, const void *data, uint32_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len > 0) {
+        // Whole aligned lanes, then bytes
+        if (k->pos % 8U == 0 && len >= 8U && k->pos + 8U <= k->rate) {
+            uint64_t v = 0;
+            for (uint32_t i = 0; i < 8; i++) {
+                v |= (uint64_t)p[i] << (8U * i);
+            }
+            k->lane[k->pos / 8U] ^= v;
+            k->pos += 8U;
+            p += 8;
+            len -= 8U;
+        } else {
+            XorByte(k, k->pos++, *p++);
+            len--;
+        }
+        if (k->pos == k->rate) {
+            Permute(k->lane);
+            k->pos = 0;
+        }
+    }
+}
+
+void Keccak_Finalize(Keccak *k) {
+    XorByte(k, k->pos, k->pad);
+    XorByte(k, k->rate - 1U, 0x80U);
+    Permute(k->lane);
+    k->pos = 0;
+    k->squeezing = 1;
+}
+
+void Keccak_Squeeze(Keccak *k, uint8_t *out, uint32_t len) {
+    while (len > 0) {
+        if (k->pos == k->rate) {
+            Permute(k->lane);
+            k->pos = 0;
+        }
+        uint32_t n = k->rate - k->pos;
+        if (n > len) {
+            n = len;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t pos = k->pos + i;
+            out[i] = (uint8_t)(k->lane[pos / 8U] >> (8U * (pos % 8U)));
+        }
+        k->pos += n;
+        out += n;
+        len -= n;
+    }
+}
+
+void Sha3_256(const void *data, uint32_t len, uint8_t digest[SHA3_256_BYTES]) {
+    Keccak k;
+    Sha3_256_Init(&k);
+    Keccak_Absorb(&k, data, len);
+    Keccak_Finalize(&k);
+    Keccak_Squeeze(&k, digest, SHA3_256_BYTES);
+}
+
+void Sha3_512(const void *data, uint32_t len, uint8_t digest[SHA3_512_BYTES]) {
+    Keccak k;
+    Sha3_512_Init(&k);
+    Keccak_Absorb(&k, data, len);
+    Keccak_Finalize(&k);
+    Keccak_Squeeze(&k, digest, SHA3_512_BYTES);
+}
+
+void Shake256(uint8_t *out, uint32_t out_len, const void *data, uint32_t len) {
+    Keccak k;
+    Shake256_Init(&k);
+    Keccak_Absorb(&k, data, len);
+    Keccak_Finalize(&k);
+    Keccak_Squeeze(&k, out, out_len);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file sha3.h
+ * @brief SHA3-256, SHA3-512, SHAKE128 and SHAKE256 (FIPS 202).
+ *
+ * One Keccak sponge type serves all four; they differ only in rate and
+ * padding byte. A sponge absorbs any number of times, is finalised once,
+ * then squeezes any number of times. ML-KEM and ML-DSA use SHAKE as a
+ * stream: matrix entries and noise are sampled straight from the squeeze,
+ * a block at a time, without materialising the output.
+ *
+ * Portable C on 64-bit lanes. On Cortex-M4 each lane operation becomes a
+ * pair of 32-bit ones.
+ */
+
+#ifndef SHA3_H
+#define SHA3_H
+
+#include <stdint.h>
+
+#define SHA3_256_BYTES              32U
+#define SHA3_512_BYTES              64U
+#define SHAKE128_RATE               168U
+#define SHAKE256_RATE               136U
+
+// --- Public Types ---
+
+typedef struct {
+    uint64_t lane[25];
+    uint32_t rate;                  // Bytes
+    uint32_t pos;                   // Byte offset in the current block
+    uint8_t  pad;                   // Domain and first padding bit
+    uint8_t  squeezing;
+} Keccak;
+
+// --- Public Function Declarations ---
+
+void Shake128_Init(Keccak *k);
+void Shake256_Init(Keccak *k);
+void Sha3_256_Init(Keccak *k);
+void Sha3_512_Init(Keccak *k);
+
+void Keccak_Absorb(Keccak *k, const void *data, uint32_t len);
+
+/**
+ * @brief Pads the input; call once, between absorbing and squeezing.
+ */
+void Keccak_Finalize(Keccak *k);
+
+void Keccak_Squeeze(Keccak *k, uint8_t *out, uint32_t len);
+
+void Sha3_256(const void *data, uint32_t len, uint8_t digest[SHA3_256_BYTES]);
+void Sha3_512(const void *data, uint32_t len, uint8_t digest[SHA3_512_BYTES]);
+void Shake256(uint8_t *out, uint32_t out_len, const void *data, uint32_t len);
+
+#endif // SHA3_H
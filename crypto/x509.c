@@ -0,0 +1,260 @@
+/**
+ * @file x509.c
+ * @brief Implementation of the zero-copy X.509 parser.
+ */
+
+#include "x509.h"
+#include "der.h"
+#include "sha256.h"
+
+#include <string.h>
+
+// --- OID Content Octets ---
+static const uint8_t OidEcdsaSha256[] = { 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02 };   // 1.2.840.10045.4.3.2
+static const uint8_t OidEcPublicKey[] = { 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01 };         // 1.2.840.10045.2.1
+static const uint8_t OidPrime256v1[] = { 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07 };    // 1.2.840.10045.3.1.7
+static const uint8_t OidBasicConstraints[] = { 0x55, 0x1D, 0x13 };                          // 2.5.29.19
+static const uint8_t OidKeyUsage[] = { 0x55, 0x1D, 0x0F };                                  // 2.5.29.15
+
+#define X509_VERSION_3              2U
+#define EC_POINT_UNCOMPRESSED       0x04U
+
+// --- Private Helper Functions ---
+
+static X509Span Whole(const DerItem *item) {
+    X509Span s = { item->start, Der_Size(item) };
+    return s;
+}
+
+// AlgorithmIdentifier with ecdsa-with-SHA256 and absent parameters
+static bool ParseSigAlg(DerReader *r) {
+    DerItem alg, oid;
+    DerReader in;
+    if (!Der_Expect(r, DER_TAG_SEQUENCE, &alg)) {
+        return false;
+    }
+    Der_Enter(&alg, &in);
+    return Der_Expect(&in, DER_TAG_OID, &oid) && Der_OidEquals(&oid, OidEcdsaSha256, sizeof(OidEcdsaSha256)) &&
+           Der_AtEnd(&in);
+}
+
+static bool ParsePublicKey(DerReader *r, X509Cert *c) {
+    DerItem spki, alg, oid, key;
+    DerReader in, alg_in;
+    if (!Der_Expect(r, DER_TAG_SEQUENCE, &spki)) {
+        return false;
+    }
+    Der_Enter(&spki, &in);
+    if (!Der_Expect(&in, DER_TAG_SEQUENCE, &alg)) {
+        return false;
+    }
+    Der_Enter(&alg, &alg_in);
+    if (!Der_Expect(&alg_in, DER_TAG_OID, &oid) || !Der_OidEquals(&oid, OidEcPublicKey, sizeof(OidEcPublicKey)) ||
+        !Der_Expect(&alg_in, DER_TAG_OID, &oid) || !Der_OidEquals(&oid, OidPrime256v1, sizeof(OidPrime256v1)) ||
+        !Der_AtEnd(&alg_in)) {
+        return false;
+    }
+    // BIT STRING: no unused bits, then 04 || x || y
+    if (!Der_Expect(&in, DER_TAG_BIT_STRING, &key) || !Der_AtEnd(&in) || key.len != 2U + 2U * P256_BYTES ||
+        key.value[0] != 0 || key.value[1] != EC_POINT_UNCOMPRESSED) {
+        return false;
+    }
+    c->pub = key.value + 2;
+    return true;
+}
+
+static bool ParseBasicConstraints(const DerItem *value, X509Cert *c) {
+    DerItem seq, item;
+    DerReader outer, in;
+    Der_Enter(value, &outer);
+    if (!Der_Expect(&outer, DER_TAG_SEQUENCE, &seq) || !Der_AtEnd(&outer)) {
+        return false;
+    }
+    Der_Enter(&seq, &in);
+    if (Der_Optional(&in, DER_TAG_BOOLEAN, &item)) {
+        // DER omits a FALSE default, so a present cA must be TRUE
+        if (item.len != 1U || item.value[0] != 0xFFU) {
+            return false;
+        }
+        c->is_ca = true;
+    }
+    if (Der_Optional(&in, DER_TAG_INTEGER, &item)) {
+        uint32_t path_len;
+        if (!c->is_ca || !Der_ToUint32(&item, &path_len) || path_len > INT32_MAX) {
+            return false;
+        }
+        c->path_len = (int32_t)path_len;
+    }
+    return Der_AtEnd(&in);
+}
+
+static bool ParseKeyUsage(const DerItem *value, X509Cert *c) {
+    DerItem bits;
+    DerReader in;
+    Der_Enter(value, &in);
+    if (!Der_Expect(&in, DER_TAG_BIT_STRING, &bits) || !Der_AtEnd(&in) || bits.len < 2U || bits.value[0] > 7U) {
+        return false;
+    }
+    c->key_usage = bits.value[1];
+    c->has_key_usage = true;
+    return true;
+}
+
+static bool ParseExtensions(const DerItem *wrapper, X509Cert *c) {
+    DerItem list, ext, oid, flag, value;
+    DerReader outer, in, fields;
+    Der_Enter(wrapper, &outer);
+    if (!Der_Expect(&outer, DER_TAG_SEQUENCE, &list) || !Der_AtEnd(&outer)) {
+        return false;
+    }
+    Der_Enter(&list, &in);
+    while (Der_Next(&in, &ext)) {
+        if (ext.tag != DER_TAG_SEQUENCE) {
+            return false;
+        }
+        Der_Enter(&ext, &fields);
+        if (!Der_Expect(&fields, DER_TAG_OID, &oid)) {
+            return false;
+        }
+        bool critical = false;
+        if (Der_Optional(&fields, DER_TAG_BOOLEAN, &flag)) {
+            if (flag.len != 1U || flag.value[0] != 0xFFU) {
+                return false;               // FALSE is the default and must be omitted
+            }
+            critical = true;
+        }
+        if (!Der_Expect(&fields, DER_TAG_OCTET_STRING, &value) || !Der_AtEnd(&fields)) {
+            return false;
+        }
+        bool ok;
+        if (Der_OidEquals(&oid, OidBasicConstraints, sizeof(OidBasicConstraints))) {
+            ok = ParseBasicConstraints(&value, c);
+        } else if (Der_OidEquals(&oid, OidKeyUsage, sizeof(OidKeyUsage))) {
+            ok = ParseKeyUsage(&value, c);
+        } else {
+            ok = !critical;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return Der_AtEnd(&in);
+}
+
+static bool ParseTbs(const DerItem *tbs, X509Cert *c) {
+    DerItem item;
+    DerReader r, in;
+    Der_Enter(tbs, &r);
+
+    // [0] EXPLICIT version; extensions need v3
+    uint32_t version = 0;
+    if (Der_Optional(&r, DER_TAG_CONTEXT(0U), &item)) {
+        DerItem v;
+        Der_Enter(&item, &in);
+        if (!Der_Expect(&in, DER_TAG_INTEGER, &v) || !Der_ToUint32(&v, &version) || !Der_AtEnd(&in) ||
+            version > X509_VERSION_3) {
+            return false;
+        }
+    }
+    if (!Der_Expect(&r, DER_TAG_INTEGER, &item)) {
+        return false;
+    }
+    c->serial.ptr = item.value;
+    c->serial.len = item.len;
+    if (!ParseSigAlg(&r) || !Der_Expect(&r, DER_TAG_SEQUENCE, &item)) {
+        return false;
+    }
+    c->issuer = Whole(&item);
+    if (!Der_Expect(&r, DER_TAG_SEQUENCE, &item)) {
+        return false;
+    }
+    c->validity.ptr = item.value;
+    c->validity.len = item.len;
+    if (!Der_Expect(&r, DER_TAG_SEQUENCE, &item)) {
+        return false;
+    }
+    c->subject = Whole(&item);
+    if (!ParsePublicKey(&r, c)) {
+        return false;
+    }
+    // issuerUniqueID [1] and subjectUniqueID [2] are skipped
+    Der_Optional(&r, 0x81U, &item);
+    Der_Optional(&r, 0x82U, &item);
+    if (Der_Optional(&r, DER_TAG_CONTEXT(3U), &item)) {
+        if (version != X509_VERSION_3 || !ParseExtensions(&item, c)) {
+            return false;
+        }
+    }
+    return Der_AtEnd(&r);
+}
+
+// Big-endian INTEGER content into a fixed 32-byte field
+static bool IntegerToFixed(const DerItem *item, uint8_t out[P256_BYTES]) {
+    const uint8_t *v = item->value;
+    uint32_t len = item->len;
+    if (item->tag != DER_TAG_INTEGER || len == 0 || (v[0] & 0x80U)) {
+        return false;
+    }
+    if (len > 1U && v[0] == 0) {
+        if ((v[1] & 0x80U) == 0) {
+            return false;                   // Non-minimal
+        }
+        v++;
+        len--;
+    }
+    if (len > P256_BYTES) {
+        return false;
+    }
+    memset(out, 0, P256_BYTES - len);
+    memcpy(out + P256_BYTES - len, v, len);
+    return true;
+}
+
+// --- Public Function Implementations ---
+
+bool X509_Parse(X509Cert *c, const uint8_t *der, uint32_t len) {
+    DerItem cert, tbs, sig;
+    DerReader r, in;
+    memset(c, 0, sizeof(*c));
+    c->path_len = X509_NO_PATH_LEN;
+
+    Der_Init(&r, der, len);
+    if (!Der_Expect(&r, DER_TAG_SEQUENCE, &cert) || !Der_AtEnd(&r)) {
+        return false;
+    }
+    c->raw = Whole(&cert);
+    Der_Enter(&cert, &in);
+    if (!Der_Expect(&in, DER_TAG_SEQUENCE, &tbs) || !ParseTbs(&tbs, c)) {
+        return false;
+    }
+    c->tbs = Whole(&tbs);
+
+    // The outer algorithm must match the signed one; both are ecdsa-with-SHA256
+    if (!ParseSigAlg(&in) || !Der_Expect(&in, DER_TAG_BIT_STRING, &sig) || !Der_AtEnd(&in) || sig.len < 1U ||
+        sig.value[0] != 0) {
+        return false;
+    }
+    c->sig.ptr = sig.value + 1;
+    c->sig.len = sig.len - 1U;
+    return true;
+}
+
+bool X509_SignatureRS(const X509Cert *c, uint8_t rs[2 * P256_BYTES]) {
+    DerItem seq, r_item, s_item;
+    DerReader r, in;
+    Der_Init(&r, c->sig.ptr, c->sig.len);
+    if (!Der_Expect(&r, DER_TAG_SEQUENCE, &seq) || !Der_AtEnd(&r)) {
+        return false;
+    }
+    Der_Enter(&seq, &in);
+    return Der_Expect(&in, DER_TAG_INTEGER, &r_item) && Der_Expect(&in, DER_TAG_INTEGER, &s_item) &&
+           Der_AtEnd(&in) && IntegerToFixed(&r_item, rs) && IntegerToFixed(&s_item, rs + P256_BYTES);
+}
+
+void X509_TbsDigest(const X509Cert *c, uint8_t digest[P256_BYTES]) {
+    Sha256_Digest(c->tbs.ptr, c->tbs.len, digest);
+}
+
+bool X509_NameEquals(const X509Span *a, const X509Span *b) {
+    return a->len == b->len && memcmp(a->ptr, b->ptr, a->len) == 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file x509.h
+ * @brief Zero-copy X.509 certificate parsing for ECDSA P-256 chains.
+ *
+ * X509_Parse reads a DER certificate with the streaming reader
+ * (crypto/der.h). It fills an X509Cert with views into the caller's
+ * buffer: the signed TBS bytes, the issuer and subject names, the
+ * subject's public key and the signature. Nothing is decoded further
+ * than a chain check needs, and nothing is copied, so the buffer must
+ * outlive the X509Cert.
+ *
+ * Only what this device uses is accepted:
+ *  - ecdsa-with-SHA256 signatures;
+ *  - id-ecPublicKey keys on prime256v1 in uncompressed form.
+ * Anything else fails the parse. Of the extensions, basicConstraints
+ * and keyUsage are decoded. Any other extension marked critical fails
+ * the parse, as RFC 5280 requires. Validity dates are exposed but not
+ * checked: the part has no trusted clock.
+ */
+
+#ifndef X509_H
+#define X509_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "p256.h"
+
+#define X509_KEY_USAGE_DIGITAL_SIGNATURE 0x80U  // First keyUsage octet, bit 0
+#define X509_KEY_USAGE_KEY_CERT_SIGN     0x04U  // Bit 5
+#define X509_NO_PATH_LEN                 (-1)
+
+// --- Public Types ---
+
+typedef struct {
+    const uint8_t *ptr;
+    uint32_t       len;
+} X509Span;
+
+typedef struct {
+    X509Span       raw;             // Whole certificate
+    X509Span       tbs;             // Signed part, header included
+    X509Span       serial;          // INTEGER content
+    X509Span       issuer;          // Name, header included
+    X509Span       subject;
+    X509Span       validity;        // Validity SEQUENCE content, unchecked
+    X509Span       sig;             // Ecdsa-Sig-Value, header included
+    const uint8_t *pub;             // x || y, 2 * P256_BYTES
+    int32_t        path_len;        // basicConstraints pathLenConstraint or X509_NO_PATH_LEN
+    uint8_t        key_usage;       // First keyUsage octet; valid if has_key_usage
+    bool           has_key_usage;
+    bool           is_ca;
+} X509Cert;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Parses one DER certificate; der must hold exactly the certificate.
+ */
+bool X509_Parse(X509Cert *c, const uint8_t *der, uint32_t len);
+
+/**
+ * @brief Converts the DER signature to fixed-width r || s for P256_EcdsaVerify.
+ */
+bool X509_SignatureRS(const X509Cert *c, uint8_t rs[2 * P256_BYTES]);
+
+/**
+ * @brief SHA-256 of the TBS part: the hash the issuer signed.
+ */
+void X509_TbsDigest(const X509Cert *c, uint8_t digest[P256_BYTES]);
+
+/**
+ * @brief Byte comparison of two encoded names, as for DER from one issuer.
+ */
+bool X509_NameEquals(const X509Span *a, const X509Span *b);
+
+#endif // X509_H
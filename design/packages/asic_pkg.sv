@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------
+// asic_pkg.sv
+// Shared address map and register definitions.
+//
+// GENERATED by tools/gen_regmap.py from design/registers/asic_regs.json. Do not edit.
+// -----------------------------------------------------------------------------
+
+package asic_pkg;
+
+  localparam logic [31:0] RAM_BASE_ADDR  = 32'h20000000;
+  localparam int unsigned RAM_SIZE_BYTES = 131072;
+
+  // --- PERIPH: Peripheral interface controller (peripheral_if_controller.sv) ---
+  localparam logic [31:0] PERIPH_BASE_ADDR = 32'h40000000;
+
+  // ID (RO): Block identifier
+  localparam logic [7:0]  PERIPH_ID_OFFSET = 8'h00;
+  localparam logic [31:0] PERIPH_ID_RESET  = 32'hA51C0001;
+  localparam int unsigned PERIPH_ID_VALUE_LSB   = 0;
+  localparam int unsigned PERIPH_ID_VALUE_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   value;
+  } periph_id_t;
+
+  // CTRL (RW): Block control
+  localparam logic [7:0]  PERIPH_CTRL_OFFSET = 8'h04;
+  localparam logic [31:0] PERIPH_CTRL_RESET  = 32'h00000000;
+  localparam int unsigned PERIPH_CTRL_ENABLE_LSB   = 0;
+  localparam int unsigned PERIPH_CTRL_ENABLE_WIDTH = 1;
+  localparam int unsigned PERIPH_CTRL_IRQ_EN_LSB   = 1;
+  localparam int unsigned PERIPH_CTRL_IRQ_EN_WIDTH = 1;
+  typedef struct packed {
+    logic [29:0]   reserved_2;
+    logic          irq_en;
+    logic          enable;
+  } periph_ctrl_t;
+
+  // STATUS (RO): Block status
+  localparam logic [7:0]  PERIPH_STATUS_OFFSET = 8'h08;
+  localparam logic [31:0] PERIPH_STATUS_RESET  = 32'h00000000;
+  localparam int unsigned PERIPH_STATUS_ENABLED_LSB   = 0;
+  localparam int unsigned PERIPH_STATUS_ENABLED_WIDTH = 1;
+  localparam int unsigned PERIPH_STATUS_TX_COUNT_LSB   = 16;
+  localparam int unsigned PERIPH_STATUS_TX_COUNT_WIDTH = 16;
+  typedef struct packed {
+    logic [15:0]   tx_count;
+    logic [14:0]   reserved_1;
+    logic          enabled;
+  } periph_status_t;
+
+  // SCRATCH (RW): Free for firmware use
+  localparam logic [7:0]  PERIPH_SCRATCH_OFFSET = 8'h0C;
+  localparam logic [31:0] PERIPH_SCRATCH_RESET  = 32'h00000000;
+  localparam int unsigned PERIPH_SCRATCH_VALUE_LSB   = 0;
+  localparam int unsigned PERIPH_SCRATCH_VALUE_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   value;
+  } periph_scratch_t;
+
+  // IRQ_STATUS (W1C): Interrupt status, write 1 to clear
+  localparam logic [7:0]  PERIPH_IRQ_STATUS_OFFSET = 8'h10;
+  localparam logic [31:0] PERIPH_IRQ_STATUS_RESET  = 32'h00000000;
+  localparam int unsigned PERIPH_IRQ_STATUS_TX_DONE_LSB   = 0;
+  localparam int unsigned PERIPH_IRQ_STATUS_TX_DONE_WIDTH = 1;
+  typedef struct packed {
+    logic [30:0]   reserved_1;
+    logic          tx_done;
+  } periph_irq_status_t;
+
+  // TX_DATA (WO): Transmit data, each write sends one word
+  localparam logic [7:0]  PERIPH_TX_DATA_OFFSET = 8'h14;
+  localparam logic [31:0] PERIPH_TX_DATA_RESET  = 32'h00000000;
+  localparam int unsigned PERIPH_TX_DATA_DATA_LSB   = 0;
+  localparam int unsigned PERIPH_TX_DATA_DATA_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   data;
+  } periph_tx_data_t;
+
+  // --- MLACC: ML accelerator (ml_accelerator.sv), int8 fully-connected offload ---
+  localparam logic [31:0] MLACC_BASE_ADDR = 32'h40001000;
+
+  // CTRL (RW): Job control
+  localparam logic [7:0]  MLACC_CTRL_OFFSET = 8'h00;
+  localparam logic [31:0] MLACC_CTRL_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_CTRL_START_LSB   = 0;
+  localparam int unsigned MLACC_CTRL_START_WIDTH = 1;
+  localparam int unsigned MLACC_CTRL_IRQ_EN_LSB   = 1;
+  localparam int unsigned MLACC_CTRL_IRQ_EN_WIDTH = 1;
+  localparam int unsigned MLACC_CTRL_ABORT_LSB   = 2;
+  localparam int unsigned MLACC_CTRL_ABORT_WIDTH = 1;
+  typedef struct packed {
+    logic [28:0]   reserved_3;
+    logic          abort;
+    logic          irq_en;
+    logic          start;
+  } mlacc_ctrl_t;
+
+  // STATUS (W1C): Job status, write 1 to clear DONE or ERROR; START clears both
+  localparam logic [7:0]  MLACC_STATUS_OFFSET = 8'h04;
+  localparam logic [31:0] MLACC_STATUS_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_STATUS_BUSY_LSB   = 0;
+  localparam int unsigned MLACC_STATUS_BUSY_WIDTH = 1;
+  localparam int unsigned MLACC_STATUS_DONE_LSB   = 1;
+  localparam int unsigned MLACC_STATUS_DONE_WIDTH = 1;
+  localparam int unsigned MLACC_STATUS_ERROR_LSB   = 2;
+  localparam int unsigned MLACC_STATUS_ERROR_WIDTH = 1;
+  typedef struct packed {
+    logic [28:0]   reserved_3;
+    logic          error;
+    logic          done;
+    logic          busy;
+  } mlacc_status_t;
+
+  // SRC_ADDR (RW): Input activations (int8)
+  localparam logic [7:0]  MLACC_SRC_ADDR_OFFSET = 8'h08;
+  localparam logic [31:0] MLACC_SRC_ADDR_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_SRC_ADDR_ADDR_LSB   = 0;
+  localparam int unsigned MLACC_SRC_ADDR_ADDR_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   addr;
+  } mlacc_src_addr_t;
+
+  // WEIGHT_ADDR (RW): Weights, row-major [out][in] (int8)
+  localparam logic [7:0]  MLACC_WEIGHT_ADDR_OFFSET = 8'h0C;
+  localparam logic [31:0] MLACC_WEIGHT_ADDR_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_WEIGHT_ADDR_ADDR_LSB   = 0;
+  localparam int unsigned MLACC_WEIGHT_ADDR_ADDR_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   addr;
+  } mlacc_weight_addr_t;
+
+  // BIAS_ADDR (RW): Folded bias per output (int32)
+  localparam logic [7:0]  MLACC_BIAS_ADDR_OFFSET = 8'h10;
+  localparam logic [31:0] MLACC_BIAS_ADDR_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_BIAS_ADDR_ADDR_LSB   = 0;
+  localparam int unsigned MLACC_BIAS_ADDR_ADDR_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   addr;
+  } mlacc_bias_addr_t;
+
+  // DST_ADDR (RW): Output activations (int8)
+  localparam logic [7:0]  MLACC_DST_ADDR_OFFSET = 8'h14;
+  localparam logic [31:0] MLACC_DST_ADDR_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_DST_ADDR_ADDR_LSB   = 0;
+  localparam int unsigned MLACC_DST_ADDR_ADDR_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   addr;
+  } mlacc_dst_addr_t;
+
+  // DIMS (RW): Layer dimensions
+  localparam logic [7:0]  MLACC_DIMS_OFFSET = 8'h18;
+  localparam logic [31:0] MLACC_DIMS_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_DIMS_OUT_FEATURES_LSB   = 0;
+  localparam int unsigned MLACC_DIMS_OUT_FEATURES_WIDTH = 16;
+  localparam int unsigned MLACC_DIMS_IN_FEATURES_LSB   = 16;
+  localparam int unsigned MLACC_DIMS_IN_FEATURES_WIDTH = 16;
+  typedef struct packed {
+    logic [15:0]   in_features;
+    logic [15:0]   out_features;
+  } mlacc_dims_t;
+
+  // OUT_MULT (RW): Requantization multiplier (Q31)
+  localparam logic [7:0]  MLACC_OUT_MULT_OFFSET = 8'h1C;
+  localparam logic [31:0] MLACC_OUT_MULT_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_OUT_MULT_VALUE_LSB   = 0;
+  localparam int unsigned MLACC_OUT_MULT_VALUE_WIDTH = 32;
+  typedef struct packed {
+    logic [31:0]   value;
+  } mlacc_out_mult_t;
+
+  // QUANT (RW): Requantization parameters
+  localparam logic [7:0]  MLACC_QUANT_OFFSET = 8'h20;
+  localparam logic [31:0] MLACC_QUANT_RESET  = 32'h00000000;
+  localparam int unsigned MLACC_QUANT_SHIFT_LSB   = 0;
+  localparam int unsigned MLACC_QUANT_SHIFT_WIDTH = 8;
+  localparam int unsigned MLACC_QUANT_OUT_ZP_LSB   = 8;
+  localparam int unsigned MLACC_QUANT_OUT_ZP_WIDTH = 8;
+  localparam int unsigned MLACC_QUANT_ACT_MIN_LSB   = 16;
+  localparam int unsigned MLACC_QUANT_ACT_MIN_WIDTH = 8;
+  localparam int unsigned MLACC_QUANT_ACT_MAX_LSB   = 24;
+  localparam int unsigned MLACC_QUANT_ACT_MAX_WIDTH = 8;
+  typedef struct packed {
+    logic [7:0]    act_max;
+    logic [7:0]    act_min;
+    logic [7:0]    out_zp;
+    logic [7:0]    shift;
+  } mlacc_quant_t;
+
+endpackage
@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------
+// asic_top.sv
+// ASIC top level.
+//
+// Exposes the system bus as a simple valid/ready request/response interface
+// so that either processor_core or, in co-simulation, a bus-functional model
+// driven by host-built firmware can act as the bus master.
+//
+// Address map (asic_pkg, generated from design/registers/asic_regs.json):
+//   0x2000_0000 - 0x2001_FFFF  On-chip SRAM    (mem_controller)
+//   0x4000_0000 - 0x4000_00FF  Peripheral regs (peripheral_if_controller)
+//   anything else              Decode error, answered in one cycle
+//
+// Responses are returned in request order. Requests may be pipelined back to
+// back to the same target; a request to a different target waits until all
+// outstanding responses have drained.
+// -----------------------------------------------------------------------------
+
+module asic_top
+  import asic_pkg::*;
+#(
+  parameter int MEM_WORD_ADDR_WIDTH = 15,
+  parameter int MEM_LATENCY         = 2
+) (
+  input  logic        clk_i,
+  input  logic        rst_ni,
+
+  // System bus (master side is outside this module)
+  input  logic        bus_req_valid_i,
+  output logic        bus_req_ready_o,
+  input  logic        bus_req_we_i,
+  input  logic [31:0] bus_req_addr_i,
+  input  logic [31:0] bus_req_wdata_i,
+  input  logic [3:0]  bus_req_be_i,
+  output logic        bus_rsp_valid_o,
+  output logic [31:0] bus_rsp_rdata_o,
+  output logic        bus_rsp_err_o,
+
+  output logic        irq_o
+);
+
+  typedef enum logic [1:0] { TGT_MEM, TGT_PERIPH, TGT_ERR } target_e;
+
+  // --- Address decode ---
+  target_e req_target;
+  always_comb begin
+    if (bus_req_addr_i[31:MEM_WORD_ADDR_WIDTH+2] == (RAM_BASE_ADDR >> (MEM_WORD_ADDR_WIDTH+2)))
+      req_target = TGT_MEM;
+    else if (bus_req_addr_i[31:8] == PERIPH_BASE_ADDR[31:8])
+      req_target = TGT_PERIPH;
+    else
+      req_target = TGT_ERR;
+  end
+
+  // --- Ordering: only one target may have responses in flight ---
+  logic [7:0] outstanding_q;
+  target_e    active_target_q;
+  logic       accept;
+  logic       rsp_any;
+
+  assign bus_req_ready_o = (outstanding_q == 0) || (active_target_q == req_target);
+  assign accept          = bus_req_valid_i && bus_req_ready_o;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      outstanding_q   <= '0;
+      active_target_q <= TGT_MEM;
+    end else begin
+      outstanding_q <= outstanding_q + 8'(accept) - 8'(rsp_any);
+      if (accept) active_target_q <= req_target;
+    end
+  end
+
+  // --- SRAM ---
+  logic        mem_rsp_valid;
+  logic [31:0] mem_rsp_rdata;
+  logic        mem_req_ready;
+
+  mem_controller #(
+    .WORD_ADDR_WIDTH (MEM_WORD_ADDR_WIDTH),
+    .LATENCY         (MEM_LATENCY)
+  ) u_mem_controller (
+    .clk_i       (clk_i),
+    .rst_ni      (rst_ni),
+    .req_valid_i (accept && req_target == TGT_MEM),
+    .req_ready_o (mem_req_ready),
+    .req_we_i    (bus_req_we_i),
+    .req_addr_i  (bus_req_addr_i),
+    .req_wdata_i (bus_req_wdata_i),
+    .req_be_i    (bus_req_be_i),
+    .rsp_valid_o (mem_rsp_valid),
+    .rsp_rdata_o (mem_rsp_rdata)
+  );
+
+  // --- Peripherals ---
+  logic        per_rsp_valid;
+  logic [31:0] per_rsp_rdata;
+  logic        per_rsp_err;
+  logic        per_req_ready;
+
+  peripheral_if_controller u_peripheral_if_controller (
+    .clk_i       (clk_i),
+    .rst_ni      (rst_ni),
+    .req_valid_i (accept && req_target == TGT_PERIPH),
+    .req_ready_o (per_req_ready),
+    .req_we_i    (bus_req_we_i),
+    .req_addr_i  (bus_req_addr_i),
+    .req_wdata_i (bus_req_wdata_i),
+    .req_be_i    (bus_req_be_i),
+    .rsp_valid_o (per_rsp_valid),
+    .rsp_rdata_o (per_rsp_rdata),
+    .rsp_err_o   (per_rsp_err),
+    .irq_o       (irq_o)
+  );
+
+  // --- Decode-error responder ---
+  logic err_rsp_valid_q;
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) err_rsp_valid_q <= 1'b0;
+    else         err_rsp_valid_q <= accept && req_target == TGT_ERR;
+  end
+
+  // --- Response mux ---
+  assign rsp_any         = mem_rsp_valid || per_rsp_valid || err_rsp_valid_q;
+  assign bus_rsp_valid_o = rsp_any;
+  assign bus_rsp_rdata_o = mem_rsp_valid ? mem_rsp_rdata :
+                           per_rsp_valid ? per_rsp_rdata : '0;
+  assign bus_rsp_err_o   = err_rsp_valid_q || (per_rsp_valid && per_rsp_err);
+
+  // Both targets accept every cycle; the ready outputs are kept for future
+  // back-pressuring targets.
+  logic unused_ready;
+  assign unused_ready = mem_req_ready & per_req_ready;
+
+endmodule
@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------
+// mem_controller.sv
+// On-chip SRAM controller.
+//
+// Accepts one 32-bit request per cycle on a simple valid/ready bus and returns
+// read data (or a write acknowledge) LATENCY cycles later, in order. Byte
+// enables apply to writes. The array is sized for the 128 KB RAM region from
+// config.json; the word address is taken from the low address bits, so the
+// top-level decoder is responsible for selecting the RAM window.
+// -----------------------------------------------------------------------------
+
+module mem_controller #(
+  parameter int WORD_ADDR_WIDTH = 15,  // 2^15 words = 128 KB
+  parameter int LATENCY         = 2    // Request-to-response cycles, >= 1
+) (
+  input  logic        clk_i,
+  input  logic        rst_ni,
+
+  // Request channel
+  input  logic        req_valid_i,
+  output logic        req_ready_o,
+  input  logic        req_we_i,
+  input  logic [31:0] req_addr_i,
+  input  logic [31:0] req_wdata_i,
+  input  logic [3:0]  req_be_i,
+
+  // Response channel
+  output logic        rsp_valid_o,
+  output logic [31:0] rsp_rdata_o
+);
+
+  logic [31:0] mem_q [2**WORD_ADDR_WIDTH];
+
+  logic [WORD_ADDR_WIDTH-1:0] word_addr;
+  assign word_addr   = req_addr_i[WORD_ADDR_WIDTH+1:2];
+  assign req_ready_o = 1'b1;  // Single-ported, fully pipelined
+
+  // --- Array access and latency pipeline ---
+  // Stage 0 is the array read; the remaining LATENCY-1 stages are flops.
+  logic        valid_q [LATENCY];
+  logic [31:0] data_q  [LATENCY];
+
+  always_ff @(posedge clk_i) begin
+    if (req_valid_i && req_we_i) begin
+      for (int b = 0; b < 4; b++) begin
+        if (req_be_i[b]) mem_q[word_addr][8*b +: 8] <= req_wdata_i[8*b +: 8];
+      end
+    end
+    data_q[0] <= mem_q[word_addr];
+    for (int s = 1; s < LATENCY; s++) data_q[s] <= data_q[s-1];
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      for (int s = 0; s < LATENCY; s++) valid_q[s] <= 1'b0;
+    end else begin
+      valid_q[0] <= req_valid_i;
+      for (int s = 1; s < LATENCY; s++) valid_q[s] <= valid_q[s-1];
+    end
+  end
+
+  assign rsp_valid_o = valid_q[LATENCY-1];
+  assign rsp_rdata_o = data_q[LATENCY-1];
+
+endmodule
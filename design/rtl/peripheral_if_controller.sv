@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------
+// peripheral_if_controller.sv
+// Memory-mapped peripheral register block.
+//
+// The register map (offsets, reset values, field positions) comes from
+// asic_pkg, which is generated from design/registers/asic_regs.json together
+// with the firmware header hal/asic_regs.h.
+//
+// Every request is answered one cycle later; unknown offsets read as zero
+// and are flagged with rsp_err_o.
+// -----------------------------------------------------------------------------
+
+module peripheral_if_controller
+  import asic_pkg::*;
+#(
+  parameter logic [31:0] BLOCK_ID = PERIPH_ID_RESET
+) (
+  input  logic        clk_i,
+  input  logic        rst_ni,
+
+  // Request channel
+  input  logic        req_valid_i,
+  output logic        req_ready_o,
+  input  logic        req_we_i,
+  input  logic [31:0] req_addr_i,
+  input  logic [31:0] req_wdata_i,
+  input  logic [3:0]  req_be_i,
+
+  // Response channel
+  output logic        rsp_valid_o,
+  output logic [31:0] rsp_rdata_o,
+  output logic        rsp_err_o,
+
+  output logic        irq_o
+);
+
+  periph_ctrl_t ctrl_q;
+  logic [31:0]  scratch_q, tx_count_q;
+  logic         irq_tx_q;
+
+  logic [7:0] offset;
+  assign offset      = req_addr_i[7:0];
+  assign req_ready_o = 1'b1;
+
+  // Byte-enable merge for full-width RW registers
+  function automatic logic [31:0] apply_be(logic [31:0] old_val, logic [31:0] new_val, logic [3:0] be);
+    for (int b = 0; b < 4; b++) begin
+      if (be[b]) old_val[8*b +: 8] = new_val[8*b +: 8];
+    end
+    return old_val;
+  endfunction
+
+  // --- Register writes ---
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      ctrl_q     <= PERIPH_CTRL_RESET;
+      scratch_q  <= '0;
+      tx_count_q <= '0;
+      irq_tx_q   <= 1'b0;
+    end else if (req_valid_i && req_we_i) begin
+      unique case (offset)
+        PERIPH_CTRL_OFFSET: if (req_be_i[0]) begin
+          // Only defined fields are stored; reserved bits read as zero
+          ctrl_q.enable <= req_wdata_i[PERIPH_CTRL_ENABLE_LSB];
+          ctrl_q.irq_en <= req_wdata_i[PERIPH_CTRL_IRQ_EN_LSB];
+        end
+        PERIPH_SCRATCH_OFFSET:    scratch_q <= apply_be(scratch_q, req_wdata_i, req_be_i);
+        PERIPH_IRQ_STATUS_OFFSET: if (req_be_i[0] && req_wdata_i[0]) irq_tx_q <= 1'b0;
+        PERIPH_TX_DATA_OFFSET: begin
+          if (ctrl_q.enable) begin
+            tx_count_q <= tx_count_q + 1;
+            irq_tx_q   <= 1'b1;
+          end
+        end
+        default: ;
+      endcase
+    end
+  end
+
+  // --- Read data and response ---
+  logic [31:0] rdata_d;
+  logic        err_d;
+  always_comb begin
+    rdata_d = '0;
+    err_d   = 1'b0;
+    unique case (offset)
+      PERIPH_ID_OFFSET:         rdata_d = BLOCK_ID;
+      PERIPH_CTRL_OFFSET:       rdata_d = ctrl_q;
+      PERIPH_STATUS_OFFSET:     rdata_d = periph_status_t'{tx_count: tx_count_q[15:0], enabled: ctrl_q.enable, default: '0};
+      PERIPH_SCRATCH_OFFSET:    rdata_d = scratch_q;
+      PERIPH_IRQ_STATUS_OFFSET: rdata_d = {31'b0, irq_tx_q};
+      PERIPH_TX_DATA_OFFSET:    rdata_d = '0;
+      default:                  err_d   = 1'b1;
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      rsp_valid_o <= 1'b0;
+      rsp_rdata_o <= '0;
+      rsp_err_o   <= 1'b0;
+    end else begin
+      rsp_valid_o <= req_valid_i;
+      rsp_rdata_o <= rdata_d;
+      rsp_err_o   <= req_valid_i && err_d;
+    end
+  end
+
+  assign irq_o = ctrl_q.irq_en && irq_tx_q;
+
+endmodule
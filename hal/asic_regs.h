@@ -0,0 +1,607 @@
+/**
+ * @file asic_regs.h
+ * @brief Register offsets, field masks and accessors for firmware.
+ *
+ * GENERATED by tools/gen_regmap.py from design/registers/asic_regs.json. Do not edit.
+ *
+ * Multi-field updates are staged into an AsicRegBatch and committed once:
+ *
+ *     AsicRegBatch b = ASIC_REG_BATCH_INIT;
+ *     PeriphCtrl_StageEnable(&b, 1);
+ *     PeriphCtrl_StageIrqEn(&b, 1);
+ *     PeriphCtrl_Commit(&b);   // one bus write
+ */
+
+#ifndef ASIC_REGS_H
+#define ASIC_REGS_H
+
+#include <stdint.h>
+
+#include "asic_bus.h"
+
+/**
+ * @brief Pending field updates for one register.
+ */
+typedef struct {
+    uint32_t mask;      // Bits that have been staged
+    uint32_t value;     // Staged bit values, already shifted into place
+} AsicRegBatch;
+
+#define ASIC_REG_BATCH_INIT         { 0U, 0U }
+
+// --- PERIPH: Peripheral interface controller (peripheral_if_controller.sv) ---
+#define PERIPH_BASE_ADDR                     (0x40000000UL)
+
+// ID (RO): Block identifier
+#define PERIPH_ID_OFFSET                     (0x00UL)
+#define PERIPH_ID_ADDR                       (PERIPH_BASE_ADDR + PERIPH_ID_OFFSET)
+#define PERIPH_ID_RESET                      (0xA51C0001UL)
+#define PERIPH_ID_VALUE_SHIFT                (0U)
+#define PERIPH_ID_VALUE_MASK                 (0xFFFFFFFFUL)
+
+static inline uint32_t PeriphId_Read(void) {
+    return AsicBus_Read32(PERIPH_ID_ADDR);
+}
+
+static inline uint32_t PeriphId_GetValue(uint32_t reg) {
+    return (reg & PERIPH_ID_VALUE_MASK) >> PERIPH_ID_VALUE_SHIFT;
+}
+
+// CTRL (RW): Block control
+#define PERIPH_CTRL_OFFSET                   (0x04UL)
+#define PERIPH_CTRL_ADDR                     (PERIPH_BASE_ADDR + PERIPH_CTRL_OFFSET)
+#define PERIPH_CTRL_RESET                    (0x00000000UL)
+#define PERIPH_CTRL_ENABLE_SHIFT             (0U)
+#define PERIPH_CTRL_ENABLE_MASK              (0x00000001UL)
+#define PERIPH_CTRL_IRQ_EN_SHIFT             (1U)
+#define PERIPH_CTRL_IRQ_EN_MASK              (0x00000002UL)
+
+static inline uint32_t PeriphCtrl_Read(void) {
+    return AsicBus_Read32(PERIPH_CTRL_ADDR);
+}
+
+static inline uint32_t PeriphCtrl_GetEnable(uint32_t reg) {
+    return (reg & PERIPH_CTRL_ENABLE_MASK) >> PERIPH_CTRL_ENABLE_SHIFT;
+}
+
+static inline uint32_t PeriphCtrl_GetIrqEn(uint32_t reg) {
+    return (reg & PERIPH_CTRL_IRQ_EN_MASK) >> PERIPH_CTRL_IRQ_EN_SHIFT;
+}
+
+static inline void PeriphCtrl_Write(uint32_t value) {
+    AsicBus_Write32(PERIPH_CTRL_ADDR, value);
+}
+
+static inline void PeriphCtrl_StageEnable(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= PERIPH_CTRL_ENABLE_MASK;
+    batch->value = (batch->value & ~PERIPH_CTRL_ENABLE_MASK) | ((value << PERIPH_CTRL_ENABLE_SHIFT) & PERIPH_CTRL_ENABLE_MASK);
+}
+
+static inline void PeriphCtrl_StageIrqEn(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= PERIPH_CTRL_IRQ_EN_MASK;
+    batch->value = (batch->value & ~PERIPH_CTRL_IRQ_EN_MASK) | ((value << PERIPH_CTRL_IRQ_EN_SHIFT) & PERIPH_CTRL_IRQ_EN_MASK);
+}
+
+static inline void PeriphCtrl_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0x00000003UL) != 0x00000003UL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(PERIPH_CTRL_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(PERIPH_CTRL_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// STATUS (RO): Block status
+#define PERIPH_STATUS_OFFSET                 (0x08UL)
+#define PERIPH_STATUS_ADDR                   (PERIPH_BASE_ADDR + PERIPH_STATUS_OFFSET)
+#define PERIPH_STATUS_RESET                  (0x00000000UL)
+#define PERIPH_STATUS_ENABLED_SHIFT          (0U)
+#define PERIPH_STATUS_ENABLED_MASK           (0x00000001UL)
+#define PERIPH_STATUS_TX_COUNT_SHIFT         (16U)
+#define PERIPH_STATUS_TX_COUNT_MASK          (0xFFFF0000UL)
+
+static inline uint32_t PeriphStatus_Read(void) {
+    return AsicBus_Read32(PERIPH_STATUS_ADDR);
+}
+
+static inline uint32_t PeriphStatus_GetEnabled(uint32_t reg) {
+    return (reg & PERIPH_STATUS_ENABLED_MASK) >> PERIPH_STATUS_ENABLED_SHIFT;
+}
+
+static inline uint32_t PeriphStatus_GetTxCount(uint32_t reg) {
+    return (reg & PERIPH_STATUS_TX_COUNT_MASK) >> PERIPH_STATUS_TX_COUNT_SHIFT;
+}
+
+// SCRATCH (RW): Free for firmware use
+#define PERIPH_SCRATCH_OFFSET                (0x0CUL)
+#define PERIPH_SCRATCH_ADDR                  (PERIPH_BASE_ADDR + PERIPH_SCRATCH_OFFSET)
+#define PERIPH_SCRATCH_RESET                 (0x00000000UL)
+#define PERIPH_SCRATCH_VALUE_SHIFT           (0U)
+#define PERIPH_SCRATCH_VALUE_MASK            (0xFFFFFFFFUL)
+
+static inline uint32_t PeriphScratch_Read(void) {
+    return AsicBus_Read32(PERIPH_SCRATCH_ADDR);
+}
+
+static inline uint32_t PeriphScratch_GetValue(uint32_t reg) {
+    return (reg & PERIPH_SCRATCH_VALUE_MASK) >> PERIPH_SCRATCH_VALUE_SHIFT;
+}
+
+static inline void PeriphScratch_Write(uint32_t value) {
+    AsicBus_Write32(PERIPH_SCRATCH_ADDR, value);
+}
+
+static inline void PeriphScratch_StageValue(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= PERIPH_SCRATCH_VALUE_MASK;
+    batch->value = (batch->value & ~PERIPH_SCRATCH_VALUE_MASK) | ((value << PERIPH_SCRATCH_VALUE_SHIFT) & PERIPH_SCRATCH_VALUE_MASK);
+}
+
+static inline void PeriphScratch_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(PERIPH_SCRATCH_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(PERIPH_SCRATCH_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// IRQ_STATUS (W1C): Interrupt status, write 1 to clear
+#define PERIPH_IRQ_STATUS_OFFSET             (0x10UL)
+#define PERIPH_IRQ_STATUS_ADDR               (PERIPH_BASE_ADDR + PERIPH_IRQ_STATUS_OFFSET)
+#define PERIPH_IRQ_STATUS_RESET              (0x00000000UL)
+#define PERIPH_IRQ_STATUS_TX_DONE_SHIFT      (0U)
+#define PERIPH_IRQ_STATUS_TX_DONE_MASK       (0x00000001UL)
+
+static inline uint32_t PeriphIrqStatus_Read(void) {
+    return AsicBus_Read32(PERIPH_IRQ_STATUS_ADDR);
+}
+
+static inline uint32_t PeriphIrqStatus_GetTxDone(uint32_t reg) {
+    return (reg & PERIPH_IRQ_STATUS_TX_DONE_MASK) >> PERIPH_IRQ_STATUS_TX_DONE_SHIFT;
+}
+
+static inline void PeriphIrqStatus_Write(uint32_t value) {
+    AsicBus_Write32(PERIPH_IRQ_STATUS_ADDR, value);
+}
+
+static inline void PeriphIrqStatus_StageTxDone(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= PERIPH_IRQ_STATUS_TX_DONE_MASK;
+    batch->value = (batch->value & ~PERIPH_IRQ_STATUS_TX_DONE_MASK) | ((value << PERIPH_IRQ_STATUS_TX_DONE_SHIFT) & PERIPH_IRQ_STATUS_TX_DONE_MASK);
+}
+
+static inline void PeriphIrqStatus_Commit(AsicRegBatch *batch) {
+    // Zeros are ignored by write-1-to-clear bits, so no read is needed
+    AsicBus_Write32(PERIPH_IRQ_STATUS_ADDR, batch->value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// TX_DATA (WO): Transmit data, each write sends one word
+#define PERIPH_TX_DATA_OFFSET                (0x14UL)
+#define PERIPH_TX_DATA_ADDR                  (PERIPH_BASE_ADDR + PERIPH_TX_DATA_OFFSET)
+#define PERIPH_TX_DATA_RESET                 (0x00000000UL)
+#define PERIPH_TX_DATA_DATA_SHIFT            (0U)
+#define PERIPH_TX_DATA_DATA_MASK             (0xFFFFFFFFUL)
+
+static inline void PeriphTxData_Write(uint32_t value) {
+    AsicBus_Write32(PERIPH_TX_DATA_ADDR, value);
+}
+
+static inline void PeriphTxData_StageData(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= PERIPH_TX_DATA_DATA_MASK;
+    batch->value = (batch->value & ~PERIPH_TX_DATA_DATA_MASK) | ((value << PERIPH_TX_DATA_DATA_SHIFT) & PERIPH_TX_DATA_DATA_MASK);
+}
+
+static inline void PeriphTxData_Commit(AsicRegBatch *batch) {
+    AsicBus_Write32(PERIPH_TX_DATA_ADDR, batch->value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// --- MLACC: ML accelerator (ml_accelerator.sv), int8 fully-connected offload ---
+#define MLACC_BASE_ADDR                      (0x40001000UL)
+
+// CTRL (RW): Job control
+#define MLACC_CTRL_OFFSET                    (0x00UL)
+#define MLACC_CTRL_ADDR                      (MLACC_BASE_ADDR + MLACC_CTRL_OFFSET)
+#define MLACC_CTRL_RESET                     (0x00000000UL)
+#define MLACC_CTRL_START_SHIFT               (0U)
+#define MLACC_CTRL_START_MASK                (0x00000001UL)
+#define MLACC_CTRL_IRQ_EN_SHIFT              (1U)
+#define MLACC_CTRL_IRQ_EN_MASK               (0x00000002UL)
+#define MLACC_CTRL_ABORT_SHIFT               (2U)
+#define MLACC_CTRL_ABORT_MASK                (0x00000004UL)
+
+static inline uint32_t MlaccCtrl_Read(void) {
+    return AsicBus_Read32(MLACC_CTRL_ADDR);
+}
+
+static inline uint32_t MlaccCtrl_GetStart(uint32_t reg) {
+    return (reg & MLACC_CTRL_START_MASK) >> MLACC_CTRL_START_SHIFT;
+}
+
+static inline uint32_t MlaccCtrl_GetIrqEn(uint32_t reg) {
+    return (reg & MLACC_CTRL_IRQ_EN_MASK) >> MLACC_CTRL_IRQ_EN_SHIFT;
+}
+
+static inline uint32_t MlaccCtrl_GetAbort(uint32_t reg) {
+    return (reg & MLACC_CTRL_ABORT_MASK) >> MLACC_CTRL_ABORT_SHIFT;
+}
+
+static inline void MlaccCtrl_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_CTRL_ADDR, value);
+}
+
+static inline void MlaccCtrl_StageStart(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_CTRL_START_MASK;
+    batch->value = (batch->value & ~MLACC_CTRL_START_MASK) | ((value << MLACC_CTRL_START_SHIFT) & MLACC_CTRL_START_MASK);
+}
+
+static inline void MlaccCtrl_StageIrqEn(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_CTRL_IRQ_EN_MASK;
+    batch->value = (batch->value & ~MLACC_CTRL_IRQ_EN_MASK) | ((value << MLACC_CTRL_IRQ_EN_SHIFT) & MLACC_CTRL_IRQ_EN_MASK);
+}
+
+static inline void MlaccCtrl_StageAbort(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_CTRL_ABORT_MASK;
+    batch->value = (batch->value & ~MLACC_CTRL_ABORT_MASK) | ((value << MLACC_CTRL_ABORT_SHIFT) & MLACC_CTRL_ABORT_MASK);
+}
+
+static inline void MlaccCtrl_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0x00000007UL) != 0x00000007UL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_CTRL_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_CTRL_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// STATUS (W1C): Job status, write 1 to clear DONE or ERROR; START clears both
+#define MLACC_STATUS_OFFSET                  (0x04UL)
+#define MLACC_STATUS_ADDR                    (MLACC_BASE_ADDR + MLACC_STATUS_OFFSET)
+#define MLACC_STATUS_RESET                   (0x00000000UL)
+#define MLACC_STATUS_BUSY_SHIFT              (0U)
+#define MLACC_STATUS_BUSY_MASK               (0x00000001UL)
+#define MLACC_STATUS_DONE_SHIFT              (1U)
+#define MLACC_STATUS_DONE_MASK               (0x00000002UL)
+#define MLACC_STATUS_ERROR_SHIFT             (2U)
+#define MLACC_STATUS_ERROR_MASK              (0x00000004UL)
+
+static inline uint32_t MlaccStatus_Read(void) {
+    return AsicBus_Read32(MLACC_STATUS_ADDR);
+}
+
+static inline uint32_t MlaccStatus_GetBusy(uint32_t reg) {
+    return (reg & MLACC_STATUS_BUSY_MASK) >> MLACC_STATUS_BUSY_SHIFT;
+}
+
+static inline uint32_t MlaccStatus_GetDone(uint32_t reg) {
+    return (reg & MLACC_STATUS_DONE_MASK) >> MLACC_STATUS_DONE_SHIFT;
+}
+
+static inline uint32_t MlaccStatus_GetError(uint32_t reg) {
+    return (reg & MLACC_STATUS_ERROR_MASK) >> MLACC_STATUS_ERROR_SHIFT;
+}
+
+static inline void MlaccStatus_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_STATUS_ADDR, value);
+}
+
+static inline void MlaccStatus_StageBusy(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_STATUS_BUSY_MASK;
+    batch->value = (batch->value & ~MLACC_STATUS_BUSY_MASK) | ((value << MLACC_STATUS_BUSY_SHIFT) & MLACC_STATUS_BUSY_MASK);
+}
+
+static inline void MlaccStatus_StageDone(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_STATUS_DONE_MASK;
+    batch->value = (batch->value & ~MLACC_STATUS_DONE_MASK) | ((value << MLACC_STATUS_DONE_SHIFT) & MLACC_STATUS_DONE_MASK);
+}
+
+static inline void MlaccStatus_StageError(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_STATUS_ERROR_MASK;
+    batch->value = (batch->value & ~MLACC_STATUS_ERROR_MASK) | ((value << MLACC_STATUS_ERROR_SHIFT) & MLACC_STATUS_ERROR_MASK);
+}
+
+static inline void MlaccStatus_Commit(AsicRegBatch *batch) {
+    // Zeros are ignored by write-1-to-clear bits, so no read is needed
+    AsicBus_Write32(MLACC_STATUS_ADDR, batch->value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// SRC_ADDR (RW): Input activations (int8)
+#define MLACC_SRC_ADDR_OFFSET                (0x08UL)
+#define MLACC_SRC_ADDR_ADDR                  (MLACC_BASE_ADDR + MLACC_SRC_ADDR_OFFSET)
+#define MLACC_SRC_ADDR_RESET                 (0x00000000UL)
+#define MLACC_SRC_ADDR_ADDR_SHIFT            (0U)
+#define MLACC_SRC_ADDR_ADDR_MASK             (0xFFFFFFFFUL)
+
+static inline uint32_t MlaccSrcAddr_Read(void) {
+    return AsicBus_Read32(MLACC_SRC_ADDR_ADDR);
+}
+
+static inline uint32_t MlaccSrcAddr_GetAddr(uint32_t reg) {
+    return (reg & MLACC_SRC_ADDR_ADDR_MASK) >> MLACC_SRC_ADDR_ADDR_SHIFT;
+}
+
+static inline void MlaccSrcAddr_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_SRC_ADDR_ADDR, value);
+}
+
+static inline void MlaccSrcAddr_StageAddr(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_SRC_ADDR_ADDR_MASK;
+    batch->value = (batch->value & ~MLACC_SRC_ADDR_ADDR_MASK) | ((value << MLACC_SRC_ADDR_ADDR_SHIFT) & MLACC_SRC_ADDR_ADDR_MASK);
+}
+
+static inline void MlaccSrcAddr_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_SRC_ADDR_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_SRC_ADDR_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// WEIGHT_ADDR (RW): Weights, row-major [out][in] (int8)
+#define MLACC_WEIGHT_ADDR_OFFSET             (0x0CUL)
+#define MLACC_WEIGHT_ADDR_ADDR               (MLACC_BASE_ADDR + MLACC_WEIGHT_ADDR_OFFSET)
+#define MLACC_WEIGHT_ADDR_RESET              (0x00000000UL)
+#define MLACC_WEIGHT_ADDR_ADDR_SHIFT         (0U)
+#define MLACC_WEIGHT_ADDR_ADDR_MASK          (0xFFFFFFFFUL)
+
+static inline uint32_t MlaccWeightAddr_Read(void) {
+    return AsicBus_Read32(MLACC_WEIGHT_ADDR_ADDR);
+}
+
+static inline uint32_t MlaccWeightAddr_GetAddr(uint32_t reg) {
+    return (reg & MLACC_WEIGHT_ADDR_ADDR_MASK) >> MLACC_WEIGHT_ADDR_ADDR_SHIFT;
+}
+
+static inline void MlaccWeightAddr_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_WEIGHT_ADDR_ADDR, value);
+}
+
+static inline void MlaccWeightAddr_StageAddr(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_WEIGHT_ADDR_ADDR_MASK;
+    batch->value = (batch->value & ~MLACC_WEIGHT_ADDR_ADDR_MASK) | ((value << MLACC_WEIGHT_ADDR_ADDR_SHIFT) & MLACC_WEIGHT_ADDR_ADDR_MASK);
+}
+
+static inline void MlaccWeightAddr_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_WEIGHT_ADDR_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_WEIGHT_ADDR_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// BIAS_ADDR (RW): Folded bias per output (int32)
+#define MLACC_BIAS_ADDR_OFFSET               (0x10UL)
+#define MLACC_BIAS_ADDR_ADDR                 (MLACC_BASE_ADDR + MLACC_BIAS_ADDR_OFFSET)
+#define MLACC_BIAS_ADDR_RESET                (0x00000000UL)
+#define MLACC_BIAS_ADDR_ADDR_SHIFT           (0U)
+#define MLACC_BIAS_ADDR_ADDR_MASK            (0xFFFFFFFFUL)
+
+static inline uint32_t MlaccBiasAddr_Read(void) {
+    return AsicBus_Read32(MLACC_BIAS_ADDR_ADDR);
+}
+
+static inline uint32_t MlaccBiasAddr_GetAddr(uint32_t reg) {
+    return (reg & MLACC_BIAS_ADDR_ADDR_MASK) >> MLACC_BIAS_ADDR_ADDR_SHIFT;
+}
+
+static inline void MlaccBiasAddr_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_BIAS_ADDR_ADDR, value);
+}
+
+static inline void MlaccBiasAddr_StageAddr(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_BIAS_ADDR_ADDR_MASK;
+    batch->value = (batch->value & ~MLACC_BIAS_ADDR_ADDR_MASK) | ((value << MLACC_BIAS_ADDR_ADDR_SHIFT) & MLACC_BIAS_ADDR_ADDR_MASK);
+}
+
+static inline void MlaccBiasAddr_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_BIAS_ADDR_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_BIAS_ADDR_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// DST_ADDR (RW): Output activations (int8)
+#define MLACC_DST_ADDR_OFFSET                (0x14UL)
+#define MLACC_DST_ADDR_ADDR                  (MLACC_BASE_ADDR + MLACC_DST_ADDR_OFFSET)
+#define MLACC_DST_ADDR_RESET                 (0x00000000UL)
+#define MLACC_DST_ADDR_ADDR_SHIFT            (0U)
+#define MLACC_DST_ADDR_ADDR_MASK             (0xFFFFFFFFUL)
+
+static inline uint32_t MlaccDstAddr_Read(void) {
+    return AsicBus_Read32(MLACC_DST_ADDR_ADDR);
+}
+
+static inline uint32_t MlaccDstAddr_GetAddr(uint32_t reg) {
+    return (reg & MLACC_DST_ADDR_ADDR_MASK) >> MLACC_DST_ADDR_ADDR_SHIFT;
+}
+
+static inline void MlaccDstAddr_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_DST_ADDR_ADDR, value);
+}
+
+static inline void MlaccDstAddr_StageAddr(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_DST_ADDR_ADDR_MASK;
+    batch->value = (batch->value & ~MLACC_DST_ADDR_ADDR_MASK) | ((value << MLACC_DST_ADDR_ADDR_SHIFT) & MLACC_DST_ADDR_ADDR_MASK);
+}
+
+static inline void MlaccDstAddr_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_DST_ADDR_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_DST_ADDR_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// DIMS (RW): Layer dimensions
+#define MLACC_DIMS_OFFSET                    (0x18UL)
+#define MLACC_DIMS_ADDR                      (MLACC_BASE_ADDR + MLACC_DIMS_OFFSET)
+#define MLACC_DIMS_RESET                     (0x00000000UL)
+#define MLACC_DIMS_OUT_FEATURES_SHIFT        (0U)
+#define MLACC_DIMS_OUT_FEATURES_MASK         (0x0000FFFFUL)
+#define MLACC_DIMS_IN_FEATURES_SHIFT         (16U)
+#define MLACC_DIMS_IN_FEATURES_MASK          (0xFFFF0000UL)
+
+static inline uint32_t MlaccDims_Read(void) {
+    return AsicBus_Read32(MLACC_DIMS_ADDR);
+}
+
+static inline uint32_t MlaccDims_GetOutFeatures(uint32_t reg) {
+    return (reg & MLACC_DIMS_OUT_FEATURES_MASK) >> MLACC_DIMS_OUT_FEATURES_SHIFT;
+}
+
+static inline uint32_t MlaccDims_GetInFeatures(uint32_t reg) {
+    return (reg & MLACC_DIMS_IN_FEATURES_MASK) >> MLACC_DIMS_IN_FEATURES_SHIFT;
+}
+
+static inline void MlaccDims_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_DIMS_ADDR, value);
+}
+
+static inline void MlaccDims_StageOutFeatures(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_DIMS_OUT_FEATURES_MASK;
+    batch->value = (batch->value & ~MLACC_DIMS_OUT_FEATURES_MASK) | ((value << MLACC_DIMS_OUT_FEATURES_SHIFT) & MLACC_DIMS_OUT_FEATURES_MASK);
+}
+
+static inline void MlaccDims_StageInFeatures(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_DIMS_IN_FEATURES_MASK;
+    batch->value = (batch->value & ~MLACC_DIMS_IN_FEATURES_MASK) | ((value << MLACC_DIMS_IN_FEATURES_SHIFT) & MLACC_DIMS_IN_FEATURES_MASK);
+}
+
+static inline void MlaccDims_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_DIMS_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_DIMS_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// OUT_MULT (RW): Requantization multiplier (Q31)
+#define MLACC_OUT_MULT_OFFSET                (0x1CUL)
+#define MLACC_OUT_MULT_ADDR                  (MLACC_BASE_ADDR + MLACC_OUT_MULT_OFFSET)
+#define MLACC_OUT_MULT_RESET                 (0x00000000UL)
+#define MLACC_OUT_MULT_VALUE_SHIFT           (0U)
+#define MLACC_OUT_MULT_VALUE_MASK            (0xFFFFFFFFUL)
+
+static inline uint32_t MlaccOutMult_Read(void) {
+    return AsicBus_Read32(MLACC_OUT_MULT_ADDR);
+}
+
+static inline uint32_t MlaccOutMult_GetValue(uint32_t reg) {
+    return (reg & MLACC_OUT_MULT_VALUE_MASK) >> MLACC_OUT_MULT_VALUE_SHIFT;
+}
+
+static inline void MlaccOutMult_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_OUT_MULT_ADDR, value);
+}
+
+static inline void MlaccOutMult_StageValue(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_OUT_MULT_VALUE_MASK;
+    batch->value = (batch->value & ~MLACC_OUT_MULT_VALUE_MASK) | ((value << MLACC_OUT_MULT_VALUE_SHIFT) & MLACC_OUT_MULT_VALUE_MASK);
+}
+
+static inline void MlaccOutMult_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_OUT_MULT_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_OUT_MULT_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+// QUANT (RW): Requantization parameters
+#define MLACC_QUANT_OFFSET                   (0x20UL)
+#define MLACC_QUANT_ADDR                     (MLACC_BASE_ADDR + MLACC_QUANT_OFFSET)
+#define MLACC_QUANT_RESET                    (0x00000000UL)
+#define MLACC_QUANT_SHIFT_SHIFT              (0U)
+#define MLACC_QUANT_SHIFT_MASK               (0x000000FFUL)
+#define MLACC_QUANT_OUT_ZP_SHIFT             (8U)
+#define MLACC_QUANT_OUT_ZP_MASK              (0x0000FF00UL)
+#define MLACC_QUANT_ACT_MIN_SHIFT            (16U)
+#define MLACC_QUANT_ACT_MIN_MASK             (0x00FF0000UL)
+#define MLACC_QUANT_ACT_MAX_SHIFT            (24U)
+#define MLACC_QUANT_ACT_MAX_MASK             (0xFF000000UL)
+
+static inline uint32_t MlaccQuant_Read(void) {
+    return AsicBus_Read32(MLACC_QUANT_ADDR);
+}
+
+static inline uint32_t MlaccQuant_GetShift(uint32_t reg) {
+    return (reg & MLACC_QUANT_SHIFT_MASK) >> MLACC_QUANT_SHIFT_SHIFT;
+}
+
+static inline uint32_t MlaccQuant_GetOutZp(uint32_t reg) {
+    return (reg & MLACC_QUANT_OUT_ZP_MASK) >> MLACC_QUANT_OUT_ZP_SHIFT;
+}
+
+static inline uint32_t MlaccQuant_GetActMin(uint32_t reg) {
+    return (reg & MLACC_QUANT_ACT_MIN_MASK) >> MLACC_QUANT_ACT_MIN_SHIFT;
+}
+
+static inline uint32_t MlaccQuant_GetActMax(uint32_t reg) {
+    return (reg & MLACC_QUANT_ACT_MAX_MASK) >> MLACC_QUANT_ACT_MAX_SHIFT;
+}
+
+static inline void MlaccQuant_Write(uint32_t value) {
+    AsicBus_Write32(MLACC_QUANT_ADDR, value);
+}
+
+static inline void MlaccQuant_StageShift(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_QUANT_SHIFT_MASK;
+    batch->value = (batch->value & ~MLACC_QUANT_SHIFT_MASK) | ((value << MLACC_QUANT_SHIFT_SHIFT) & MLACC_QUANT_SHIFT_MASK);
+}
+
+static inline void MlaccQuant_StageOutZp(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_QUANT_OUT_ZP_MASK;
+    batch->value = (batch->value & ~MLACC_QUANT_OUT_ZP_MASK) | ((value << MLACC_QUANT_OUT_ZP_SHIFT) & MLACC_QUANT_OUT_ZP_MASK);
+}
+
+static inline void MlaccQuant_StageActMin(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_QUANT_ACT_MIN_MASK;
+    batch->value = (batch->value & ~MLACC_QUANT_ACT_MIN_MASK) | ((value << MLACC_QUANT_ACT_MIN_SHIFT) & MLACC_QUANT_ACT_MIN_MASK);
+}
+
+static inline void MlaccQuant_StageActMax(AsicRegBatch *batch, uint32_t value) {
+    batch->mask |= MLACC_QUANT_ACT_MAX_MASK;
+    batch->value = (batch->value & ~MLACC_QUANT_ACT_MAX_MASK) | ((value << MLACC_QUANT_ACT_MAX_SHIFT) & MLACC_QUANT_ACT_MAX_MASK);
+}
+
+static inline void MlaccQuant_Commit(AsicRegBatch *batch) {
+    uint32_t value = batch->value;
+    if ((batch->mask & 0xFFFFFFFFUL) != 0xFFFFFFFFUL) {
+        // Partial update: one read keeps the fields that were not staged
+        value |= AsicBus_Read32(MLACC_QUANT_ADDR) & ~batch->mask;
+    }
+    AsicBus_Write32(MLACC_QUANT_ADDR, value);
+    batch->mask = 0U;
+    batch->value = 0U;
+}
+
+#endif // ASIC_REGS_H
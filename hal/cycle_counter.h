@@ -0,0 +1,70 @@
+/**
+ * @file cycle_counter.h
+ * @brief Free-running cycle counter for on-device and host measurements.
+ *
+ * On Cortex-M4 this is the DWT cycle counter, which counts core clock
+ * cycles and wraps every 2^32 cycles (about 35 s at 120 MHz), so measured
+ * intervals must be shorter than that. On the host build it is backed by the
+ * C11 wall clock with one tick per nanosecond and wraps about every 4.3 s.
+ * CYCLE_COUNTER_HZ gives the tick rate either way, so results can be
+ * converted to seconds or rates.
+ */
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <stdint.h>
+
+#if defined(__ARM_ARCH_7EM__)
+
+// --- Cortex-M4 Data Watchpoint and Trace unit ---
+// Variant builds define ASIC_SYSTEM_CLOCK_HZ; shared objects read the linked-in value
+#if defined(ASIC_SYSTEM_CLOCK_HZ)
+#define CYCLE_COUNTER_HZ            (ASIC_SYSTEM_CLOCK_HZ)
+#else
+#include "asic_variant.h"
+#define CYCLE_COUNTER_HZ            (AsicVariant_SystemClockHz)
+#endif
+
+#define DWT_CTRL_REG                (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT_REG              (*(volatile uint32_t *)0xE0001004UL)
+#define CORE_DEMCR_REG              (*(volatile uint32_t *)0xE000EDFCUL)
+#define CORE_DEMCR_TRCENA           (1UL << 24)
+#define DWT_CTRL_CYCCNTENA          (1UL << 0)
+
+static inline void CycleCounter_Init(void) {
+    CORE_DEMCR_REG |= CORE_DEMCR_TRCENA;
+    DWT_CYCCNT_REG = 0;
+    DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t CycleCounter_Read(void) {
+    return DWT_CYCCNT_REG;
+}
+
+#else
+
+// --- Host build: nanosecond ticks ---
+#include <time.h>
+
+#define CYCLE_COUNTER_HZ            (1000000000UL)
+
+static inline void CycleCounter_Init(void) {
+}
+
+static inline uint32_t CycleCounter_Read(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+#endif
+
+/**
+ * @brief Ticks elapsed since an earlier reading, correct across one wrap.
+ */
+static inline uint32_t CycleCounter_Elapsed(uint32_t start) {
+    return CycleCounter_Read() - start;
+}
+
+#endif // CYCLE_COUNTER_H
@@ -0,0 +1,58 @@
+/**
+ * @file flash.h
+ * @brief On-chip NOR flash: erase, program and memory-mapped read.
+ *
+ * Flash is execute-in-place, so on the target reading is a plain pointer
+ * dereference and Flash_Map() is a cast. Erase sets a whole sector to 0xFF;
+ * program can only clear bits. Modules that keep data in flash (runtime
+ * config, fault journal) use these three calls only.
+ *
+ * With ASIC_FLASH_SIM defined, the calls go to the host flash simulator in
+ * sim/flash/flash_sim.c instead. The simulator keeps the array in RAM,
+ * counts erases per sector and can inject a power loss mid-write.
+ *
+ * Target builds link hal/flash_target.c. The RTL has no flash controller
+ * yet, so there erase and program always fail and flash is read-only.
+ */
+
+#ifndef FLASH_H
+#define FLASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Geometry (config.json memory_map_defaults, overridden per variant) ---
+#if defined(ASIC_FLASH_BASE_ADDR) && defined(ASIC_FLASH_SIZE_BYTES)
+#define FLASH_BASE_ADDR             (ASIC_FLASH_BASE_ADDR)
+#define FLASH_SIZE_BYTES            (ASIC_FLASH_SIZE_BYTES)
+#else
+#define FLASH_BASE_ADDR             (0x08000000UL)
+#define FLASH_SIZE_BYTES            (1048576UL)
+#endif
+#define FLASH_SECTOR_BYTES          (4096UL)
+#define FLASH_SECTOR_COUNT          (FLASH_SIZE_BYTES / FLASH_SECTOR_BYTES)
+#define FLASH_ERASED_BYTE           0xFF
+
+/**
+ * @brief Erases the sector containing address.
+ *
+ * @return True on success.
+ */
+bool Flash_EraseSector(uint32_t address);
+
+/**
+ * @brief Programs len bytes at address. Bits can only go from 1 to 0.
+ *
+ * @return True on success.
+ */
+bool Flash_Program(uint32_t address, const void *data, uint32_t len);
+
+#ifdef ASIC_FLASH_SIM
+const void *Flash_Map(uint32_t address);
+#else
+static inline const void *Flash_Map(uint32_t address) {
+    return (const void *)(uintptr_t)address;
+}
+#endif
+
+#endif // FLASH_H
@@ -0,0 +1,54 @@
+/**
+ * @file flash_target.c
+ * @brief Target back end of hal/flash.h until the flash controller exists.
+ *
+ * The RTL has no flash program or erase path yet (design/rtl has no flash
+ * controller and asic_regs.json no register block for one). Until it does,
+ * erase and program fail without touching the array, so nothing in flash
+ * can be corrupted. Reads are unaffected: the array is execute-in-place
+ * and Flash_Map() is a cast.
+ *
+ * Callers already treat a failure as a normal outcome:
+ *  - runtime config keeps the active image and rejects staging;
+ *  - the fault journal counts the batch as lost and keeps running.
+ *
+ * Replace this file with the controller driver when the block is added.
+ */
+
+#include "flash.h"
+
+#define LOG_MODULE  LOG_MODULE_FLASH
+#include "log.h"
+
+#include <stdio.h>
+
+// --- Private Variables ---
+static bool Reported;
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] FLASH: %s\n", level, message);
+}
+
+static bool Unsupported(void) {
+    if (!Reported) {
+        Reported = true;
+        LOG_WARN("No flash controller: erase and program are unavailable.");
+    }
+    return false;
+}
+
+// --- Flash Interface ---
+
+bool Flash_EraseSector(uint32_t address) {
+    (void)address;
+    return Unsupported();
+}
+
+bool Flash_Program(uint32_t address, const void *data, uint32_t len) {
+    (void)address;
+    (void)data;
+    (void)len;
+    return Unsupported();
+}
@@ -0,0 +1,42 @@
+/**
+ * @file ramfunc.h
+ * @brief Placing functions and tables in RAM so they run without flash wait states.
+ *
+ * RAMFUNC on a function definition, or RAMFUNC_TABLE on a const table, puts
+ * it in the .ramfunc output section of the linker script
+ * (conf/linker_default.ld). The section is linked at its RAM (or TCM)
+ * address and loaded in flash. SystemManager() in main.c copies it at boot
+ * and verifies the copy before any of it runs. The linker script also pulls
+ * profiled-hot functions into .ramfunc; RAMFUNC is for code that must run
+ * from RAM whatever the profile says (crypto inner loops, kernels).
+ *
+ * Calls between flash and RAM are out of Thumb BL range; the linker inserts
+ * long-branch veneers for them, so callers need no changes. Keep RAMFUNC
+ * code leaf-like: a veneer on every inner-loop call costs more than the
+ * wait states saved.
+ *
+ * Off target (host builds), or with ASIC_RAMFUNC_DISABLE defined, the
+ * macros expand to nothing and everything stays where the compiler puts it.
+ */
+
+#ifndef RAMFUNC_H
+#define RAMFUNC_H
+
+#include <stdint.h>
+
+#if defined(__ARM_ARCH_7EM__) && !defined(ASIC_RAMFUNC_DISABLE)
+#define RAMFUNC_ENABLED             1
+#define RAMFUNC                     __attribute__((section(".ramfunc"), noinline))
+#define RAMFUNC_TABLE               __attribute__((section(".ramfunc.rodata")))
+
+// --- Linker Script Symbols ---
+extern uint32_t __ramfunc_start[];
+extern uint32_t __ramfunc_end[];
+extern const uint32_t __ramfunc_load_start[];
+#else
+#define RAMFUNC_ENABLED             0
+#define RAMFUNC
+#define RAMFUNC_TABLE
+#endif
+
+#endif // RAMFUNC_H
@@ -0,0 +1,88 @@
+/**
+ * @file tamper.h
+ * @brief Glitch detectors and the debounce timer behind the tamper monitor.
+ *
+ * The voltage, clock and temperature detectors each drive one output that
+ * is high while the condition lasts. A rising edge sets the sensor's bit in
+ * the latched status and, if the sensor is enabled, raises the sensor
+ * interrupt. The latch is set even while the sensor is disabled.
+ *
+ * A one-shot timer at TAMPER_TIMER_HZ raises the timer interrupt when it
+ * expires. It runs from its own clock, so a clock glitch on the core does
+ * not shorten the debounce.
+ *
+ * Host builds link the simulator in sim/tamper/tamper_sim.c instead. It
+ * drives the detector outputs from a script and calls the two interrupt
+ * handlers as the hardware would.
+ *
+ * Target gap: the RTL has no detectors or debounce timer yet, and the
+ * tree has no startup code or vector table for the two handlers. Target
+ * builds link hal/tamper_target.c, which reports no sensors fitted, so
+ * TamperMonitor_Init arms nothing and glitches do not wipe keys. The
+ * driver and the vector entries land with the detector block.
+ */
+
+#ifndef TAMPER_H
+#define TAMPER_H
+
+#include <stdint.h>
+
+// --- Sensors ---
+#define TAMPER_SENSOR_VOLTAGE       (1UL << 0)
+#define TAMPER_SENSOR_CLOCK         (1UL << 1)
+#define TAMPER_SENSOR_TEMP          (1UL << 2)
+#define TAMPER_SENSOR_COUNT         3
+#define TAMPER_SENSOR_ALL           ((1UL << TAMPER_SENSOR_COUNT) - 1U)
+
+// --- Debounce Timer ---
+#define TAMPER_TIMER_HZ             (1000000UL)     // 1 us ticks
+
+// --- Detector Interface ---
+
+/**
+ * @brief Sensors fitted to this part; the others never assert.
+ */
+uint32_t Tamper_HwPresent(void);
+
+/**
+ * @brief Unmasks the sensor interrupt for the given sensors.
+ */
+void Tamper_HwEnable(uint32_t sensors);
+
+/**
+ * @brief Masks the sensor interrupt for the given sensors.
+ */
+void Tamper_HwDisable(uint32_t sensors);
+
+/**
+ * @brief Sensors that have had a rising edge since their bit was cleared.
+ */
+uint32_t Tamper_HwLatched(void);
+
+/**
+ * @brief Clears latched bits (write 1 to clear).
+ */
+void Tamper_HwClear(uint32_t sensors);
+
+/**
+ * @brief Current detector outputs.
+ */
+uint32_t Tamper_HwLevel(void);
+
+// --- Timer Interface ---
+
+/**
+ * @brief Starts the one-shot timer, replacing any running count.
+ */
+void Tamper_HwStartTimer(uint32_t ticks);
+
+/**
+ * @brief Free-running timer count, in TAMPER_TIMER_HZ ticks.
+ */
+uint32_t Tamper_HwTimerNow(void);
+
+// --- Interrupt Handlers (implemented by security/tamper_monitor.c) ---
+void Tamper_SensorIrqHandler(void);
+void Tamper_TimerIrqHandler(void);
+
+#endif // TAMPER_H
@@ -0,0 +1,49 @@
+/**
+ * @file tamper_target.c
+ * @brief Target back end of hal/tamper.h until the detector block exists.
+ *
+ * The RTL has no voltage, clock or temperature detectors and no debounce
+ * timer, so this part reports no sensors fitted. TamperMonitor_Init then
+ * refuses to arm, and the rest of the interface does nothing: no sensor
+ * latches, and the timer never runs or expires.
+ *
+ * Replace this file with the detector driver, and enter
+ * Tamper_SensorIrqHandler and Tamper_TimerIrqHandler in the vector table,
+ * when the block is added.
+ */
+
+#include "tamper.h"
+
+// --- Tamper Interface ---
+
+uint32_t Tamper_HwPresent(void) {
+    return 0;
+}
+
+void Tamper_HwEnable(uint32_t sensors) {
+    (void)sensors;
+}
+
+void Tamper_HwDisable(uint32_t sensors) {
+    (void)sensors;
+}
+
+uint32_t Tamper_HwLatched(void) {
+    return 0;
+}
+
+void Tamper_HwClear(uint32_t sensors) {
+    (void)sensors;
+}
+
+uint32_t Tamper_HwLevel(void) {
+    return 0;
+}
+
+void Tamper_HwStartTimer(uint32_t ticks) {
+    (void)ticks;
+}
+
+uint32_t Tamper_HwTimerNow(void) {
+    return 0;
+}
@@ -0,0 +1,659 @@
+/**
+ * @file connectivity.c
+ * @brief Implementation of layout connectivity extraction.
+ *
+ * Pipeline:
+ *  1. Flatten the hierarchy below the top structure, keeping only shapes on
+ *     layers named by the via rules, and sort them by layer. Paths are cut
+ *     into one rectangle per segment and Manhattan polygons into horizontal
+ *     slabs, so an L or U never covers the space inside its bend.
+ *  2. Build one packed R-tree per layer.
+ *  3. Worker threads claim chunks of shapes and, for each shape, query the
+ *     trees of its own layer and of every layer it connects to. Touching
+ *     pairs are merged in a shared union-find.
+ *  4. Roots are renumbered into dense net ids.
+ *
+ * The union-find is lock-free: parents are atomics, find() uses path
+ * halving with compare-and-swap, and union() always links the larger root
+ * index under the smaller one so concurrent links cannot form a cycle.
+ */
+
+#include "connectivity.h"
+#include "rtree.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Private Defines and Constants ---
+#define CONNECTIVITY_MAX_DEPTH      64      // Guards against recursive references
+#define CONNECTIVITY_MAX_LAYERS     64
+#define CONNECTIVITY_CHUNK_SHAPES   256     // Shapes claimed per work item
+
+#define GDS_STRANS_REFLECT          0x8000
+#define CONNECTIVITY_PI             3.14159265358979323846
+
+// --- Private Types ---
+
+/**
+ * @brief Affine transform: p' = [a b; c d] * p + (tx, ty).
+ */
+typedef struct {
+    double a, b, c, d;
+    double tx, ty;
+} Transform;
+
+typedef struct {
+    uint16_t layer;
+    uint32_t begin;         // First shape on this layer
+    uint32_t count;
+    Rtree    tree;
+    uint16_t neighbours[CONNECTIVITY_MAX_LAYERS];   // Layer slots this layer connects to
+    uint32_t neighbour_count;
+} LayerSlot;
+
+typedef struct {
+    const LayoutNetlist *netlist;
+    LayerSlot           *slots;
+    uint32_t             slot_count;
+    _Atomic uint32_t    *parent;
+    _Atomic uint32_t     next_chunk;
+} ExtractContext;
+
+typedef struct {
+    int32_t x_min;
+    int32_t x_max;
+    int32_t y_min;
+} OpenSlab;
+
+/**
+ * @brief Scratch for polygon decomposition, grown to the largest polygon seen.
+ */
+typedef struct {
+    int32_t  *ys;
+    int32_t  *xs;
+    OpenSlab *open;
+    OpenSlab *next;
+    uint32_t  capacity;     // Points
+} DecomposeScratch;
+
+typedef struct {
+    ExtractContext *ctx;
+    uint32_t        shape;
+    uint32_t        slot_begin;     // Offset of the queried layer in the netlist
+} QueryContext;
+
+// --- Lock-free Union-Find ---
+
+static uint32_t UnionFindFind(_Atomic uint32_t *parent, uint32_t x) {
+    for (;;) {
+        uint32_t p = atomic_load_explicit(&parent[x], memory_order_acquire);
+        if (p == x) {
+            return x;
+        }
+        uint32_t gp = atomic_load_explicit(&parent[p], memory_order_acquire);
+        if (gp != p) {
+            // Path halving; losing the race is harmless
+            atomic_compare_exchange_weak_explicit(&parent[x], &p, gp,
+                                                  memory_order_release, memory_order_relaxed);
+        }
+        x = gp;
+    }
+}
+
+static void UnionFindUnion(_Atomic uint32_t *parent, uint32_t a, uint32_t b) {
+    for (;;) {
+        a = UnionFindFind(parent, a);
+        b = UnionFindFind(parent, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            uint32_t t = a;
+            a = b;
+            b = t;
+        }
+        uint32_t expected = a;
+        if (atomic_compare_exchange_strong_explicit(&parent[a], &expected, b,
+                                                    memory_order_acq_rel, memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+// --- Flattening ---
+
+static Transform TransformCompose(const Transform *outer, const Transform *inner) {
+    Transform t;
+    t.a = outer->a * inner->a + outer->b * inner->c;
+    t.b = outer->a * inner->b + outer->b * inner->d;
+    t.c = outer->c * inner->a + outer->d * inner->c;
+    t.d = outer->c * inner->b + outer->d * inner->d;
+    t.tx = outer->a * inner->tx + outer->b * inner->ty + outer->tx;
+    t.ty = outer->c * inner->tx + outer->d * inner->ty + outer->ty;
+    return t;
+}
+
+static Transform ReferenceTransform(const GdsElement *el, double ox, double oy) {
+    double rad = el->angle_deg * (CONNECTIVITY_PI / 180.0);
+    double cs = cos(rad) * el->magnification;
+    double sn = sin(rad) * el->magnification;
+    double fy = (el->strans & GDS_STRANS_REFLECT) ? -1.0 : 1.0;
+    // Reflection about x is applied before rotation
+    Transform t = { cs, -sn * fy, sn, cs * fy, ox, oy };
+    return t;
+}
+
+static GdsBBox TransformBBox(const Transform *t, const GdsBBox *box) {
+    double xs[4] = { box->x_min, box->x_max, box->x_max, box->x_min };
+    double ys[4] = { box->y_min, box->y_min, box->y_max, box->y_max };
+    double x_min = INFINITY, y_min = INFINITY, x_max = -INFINITY, y_max = -INFINITY;
+    for (int i = 0; i < 4; i++) {
+        double x = t->a * xs[i] + t->b * ys[i] + t->tx;
+        double y = t->c * xs[i] + t->d * ys[i] + t->ty;
+        x_min = fmin(x_min, x);
+        y_min = fmin(y_min, y);
+        x_max = fmax(x_max, x);
+        y_max = fmax(y_max, y);
+    }
+    GdsBBox out = { (int32_t)floor(x_min + 0.5), (int32_t)floor(y_min + 0.5),
+                    (int32_t)floor(x_max + 0.5), (int32_t)floor(y_max + 0.5) };
+    return out;
+}
+
+static bool LayerIsExtracted(const ConnectivityConfig *config, uint16_t layer) {
+    for (uint32_t i = 0; i < config->via_rule_count; i++) {
+        const ConnectivityViaRule *r = &config->via_rules[i];
+        if (r->lower == layer || r->via == layer || r->upper == layer) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool AppendShape(LayoutNetlist *netlist, const GdsBBox *box, uint16_t layer, uint32_t element) {
+    if (netlist->shape_count == netlist->shape_capacity) {
+        uint32_t cap = netlist->shape_capacity ? netlist->shape_capacity * 2 : 1024;
+        GdsBBox *boxes = realloc(netlist->boxes, (size_t)cap * sizeof(GdsBBox));
+        if (boxes != NULL) netlist->boxes = boxes;
+        uint16_t *layers = realloc(netlist->layers, (size_t)cap * sizeof(uint16_t));
+        if (layers != NULL) netlist->layers = layers;
+        uint32_t *src = realloc(netlist->source_elements, (size_t)cap * sizeof(uint32_t));
+        if (src != NULL) netlist->source_elements = src;
+        if (boxes == NULL || layers == NULL || src == NULL) {
+            return false;
+        }
+        netlist->shape_capacity = cap;
+    }
+    netlist->boxes[netlist->shape_count] = *box;
+    netlist->layers[netlist->shape_count] = layer;
+    netlist->source_elements[netlist->shape_count] = element;
+    netlist->shape_count++;
+    return true;
+}
+
+// --- Shape Decomposition ---
+
+static bool AppendRect(LayoutNetlist *netlist, const Transform *xf, int32_t x_min, int32_t y_min,
+                       int32_t x_max, int32_t y_max, uint16_t layer, uint32_t element) {
+    GdsBBox local = { x_min, y_min, x_max, y_max };
+    GdsBBox box = TransformBBox(xf, &local);
+    return AppendShape(netlist, &box, layer, element);
+}
+
+/**
+ * @brief One rectangle per path segment.
+ *
+ * Segments are extended by half the width at interior points so the
+ * rectangles overlap at each bend, and at the two ends unless the path is
+ * flush. Round and custom ends are treated as extended, which can only
+ * over-merge. Diagonal segments keep their bounding box.
+ */
+static bool AppendPathRects(const GdsStructure *st, const GdsElement *el, const Transform *xf,
+                            LayoutNetlist *netlist, uint32_t index) {
+    const GdsPoint *pts = &st->points[el->point_offset];
+    int32_t half = (el->width >= 0 ? el->width : -el->width) / 2;
+    int32_t end_ext = (el->path_type == GDS_PATH_FLUSH) ? 0 : half;
+
+    if (el->point_count == 1) {
+        return AppendRect(netlist, xf, pts[0].x - half, pts[0].y - half, pts[0].x + half, pts[0].y + half,
+                          el->layer, index);
+    }
+    for (uint32_t i = 0; i + 1 < el->point_count; i++) {
+        GdsPoint a = pts[i];
+        GdsPoint b = pts[i + 1];
+        int32_t ext_a = (i == 0) ? end_ext : half;
+        int32_t ext_b = (i + 2 == el->point_count) ? end_ext : half;
+        if (a.x > b.x || a.y > b.y) {
+            GdsPoint t = a;
+            a = b;
+            b = t;
+            int32_t e = ext_a;
+            ext_a = ext_b;
+            ext_b = e;
+        }
+        bool ok;
+        if (a.y == b.y) {
+            ok = AppendRect(netlist, xf, a.x - ext_a, a.y - half, b.x + ext_b, b.y + half, el->layer, index);
+        } else if (a.x == b.x) {
+            ok = AppendRect(netlist, xf, a.x - half, a.y - ext_a, b.x + half, b.y + ext_b, el->layer, index);
+        } else {
+            ok = AppendRect(netlist, xf, (a.x < b.x ? a.x : b.x) - half, (a.y < b.y ? a.y : b.y) - half,
+                            (a.x > b.x ? a.x : b.x) + half, (a.y > b.y ? a.y : b.y) + half, el->layer, index);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool ReserveScratch(DecomposeScratch *scratch, uint32_t points) {
+    if (points <= scratch->capacity) {
+        return true;
+    }
+    int32_t *ys = realloc(scratch->ys, (size_t)points * sizeof(int32_t));
+    if (ys != NULL) scratch->ys = ys;
+    int32_t *xs = realloc(scratch->xs, (size_t)points * sizeof(int32_t));
+    if (xs != NULL) scratch->xs = xs;
+    OpenSlab *open = realloc(scratch->open, (size_t)points * sizeof(OpenSlab));
+    if (open != NULL) scratch->open = open;
+    OpenSlab *next = realloc(scratch->next, (size_t)points * sizeof(OpenSlab));
+    if (next != NULL) scratch->next = next;
+    if (ys == NULL || xs == NULL || open == NULL || next == NULL) {
+        return false;
+    }
+    scratch->capacity = points;
+    return true;
+}
+
+static int CompareInt32(const void *a, const void *b) {
+    int32_t x = *(const int32_t *)a;
+    int32_t y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Cuts a Manhattan polygon into rectangles.
+ *
+ * Between consecutive vertex y coordinates the polygon is a set of x
+ * intervals bounded by its vertical edges (even-odd rule). Intervals that
+ * continue unchanged into the next slab are extended rather than cut, so a
+ * rectangle stays one shape. Polygons with a diagonal edge keep their
+ * bounding box.
+ */
+static bool AppendBoundaryRects(const GdsStructure *st, const GdsElement *el, const Transform *xf,
+                                LayoutNetlist *netlist, uint32_t index, DecomposeScratch *scratch) {
+    const GdsPoint *pts = &st->points[el->point_offset];
+    uint32_t n = el->point_count;
+    const GdsBBox *bb = &el->bbox;
+
+    bool manhattan = true;
+    for (uint32_t i = 0; i < n && manhattan; i++) {
+        const GdsPoint *a = &pts[i];
+        const GdsPoint *b = &pts[(i + 1) % n];
+        manhattan = a->x == b->x || a->y == b->y;
+    }
+    // Four corners (five with the closing point) can only be a rectangle
+    if (!manhattan || n <= 5) {
+        return AppendRect(netlist, xf, bb->x_min, bb->y_min, bb->x_max, bb->y_max, el->layer, index);
+    }
+    if (!ReserveScratch(scratch, n)) {
+        return false;
+    }
+
+    uint32_t y_count = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        scratch->ys[y_count++] = pts[i].y;
+    }
+    qsort(scratch->ys, y_count, sizeof(int32_t), CompareInt32);
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < y_count; i++) {
+        if (unique == 0 || scratch->ys[unique - 1] != scratch->ys[i]) {
+            scratch->ys[unique++] = scratch->ys[i];
+        }
+    }
+
+    uint32_t open_count = 0;
+    for (uint32_t k = 0; k + 1 < unique; k++) {
+        int32_t y0 = scratch->ys[k];
+        int32_t y1 = scratch->ys[k + 1];
+        uint32_t x_count = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            const GdsPoint *a = &pts[i];
+            const GdsPoint *b = &pts[(i + 1) % n];
+            if (a->x == b->x && a->y != b->y &&
+                (a->y < b->y ? a->y : b->y) <= y0 && (a->y > b->y ? a->y : b->y) >= y1) {
+                scratch->xs[x_count++] = a->x;
+            }
+        }
+        qsort(scratch->xs, x_count, sizeof(int32_t), CompareInt32);
+
+        // Carry on the intervals that match one in the previous slab, close the rest
+        uint32_t next_count = 0;
+        for (uint32_t j = 0; j + 1 < x_count; j += 2) {
+            OpenSlab slab = { scratch->xs[j], scratch->xs[j + 1], y0 };
+            for (uint32_t o = 0; o < open_count; o++) {
+                if (scratch->open[o].x_min == slab.x_min && scratch->open[o].x_max == slab.x_max) {
+                    slab.y_min = scratch->open[o].y_min;
+                    scratch->open[o].x_max = scratch->open[o].x_min - 1;   // Taken
+                    break;
+                }
+            }
+            scratch->next[next_count++] = slab;
+        }
+        for (uint32_t o = 0; o < open_count; o++) {
+            const OpenSlab *slab = &scratch->open[o];
+            if (slab->x_max >= slab->x_min &&
+                !AppendRect(netlist, xf, slab->x_min, slab->y_min, slab->x_max, y0, el->layer, index)) {
+                return false;
+            }
+        }
+        OpenSlab *t = scratch->open;
+        scratch->open = scratch->next;
+        scratch->next = t;
+        open_count = next_count;
+    }
+    for (uint32_t o = 0; o < open_count; o++) {
+        const OpenSlab *slab = &scratch->open[o];
+        if (!AppendRect(netlist, xf, slab->x_min, slab->y_min, slab->x_max, scratch->ys[unique - 1],
+                        el->layer, index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- Hierarchy Walk ---
+
+static bool FlattenHandler(const GdsLibrary *lib, int32_t structure, const Transform *xf,
+                           const ConnectivityConfig *config, LayoutNetlist *netlist,
+                           DecomposeScratch *scratch, uint32_t depth) {
+    if (depth > CONNECTIVITY_MAX_DEPTH) {
+        fprintf(stderr, "[ERROR] CONNECTIVITY: hierarchy deeper than %d levels.\n", CONNECTIVITY_MAX_DEPTH);
+        return false;
+    }
+    const GdsStructure *st = &lib->structures[structure];
+    for (uint32_t i = 0; i < st->element_count; i++) {
+        uint32_t index = st->element_offset + i;
+        const GdsElement *el = &st->elements[i];
+
+        if (el->kind == GDS_ELEM_SREF || el->kind == GDS_ELEM_AREF) {
+            int32_t child = GdsiiReader_FindStructure(lib, st->names + el->ref_name);
+            if (child < 0 || el->point_count == 0) {
+                continue; // Unresolved references are reported by DRC, not here
+            }
+            const GdsPoint *pts = &st->points[el->point_offset];
+            uint32_t cols = 1, rows = 1;
+            double col_dx = 0, col_dy = 0, row_dx = 0, row_dy = 0;
+            if (el->kind == GDS_ELEM_AREF && el->point_count >= 3 && el->columns && el->rows) {
+                cols = el->columns;
+                rows = el->rows;
+                col_dx = (double)(pts[1].x - pts[0].x) / cols;
+                col_dy = (double)(pts[1].y - pts[0].y) / cols;
+                row_dx = (double)(pts[2].x - pts[0].x) / rows;
+                row_dy = (double)(pts[2].y - pts[0].y) / rows;
+            }
+            for (uint32_t r = 0; r < rows; r++) {
+                for (uint32_t c = 0; c < cols; c++) {
+                    Transform local = ReferenceTransform(el, pts[0].x + c * col_dx + r * row_dx,
+                                                         pts[0].y + c * col_dy + r * row_dy);
+                    Transform combined = TransformCompose(xf, &local);
+                    if (!FlattenHandler(lib, child, &combined, config, netlist, scratch, depth + 1)) {
+                        return false;
+                    }
+                }
+            }
+        } else if (el->point_count > 0 && LayerIsExtracted(config, el->layer)) {
+            const GdsBBox *bb = &el->bbox;
+            bool ok;
+            if (el->kind == GDS_ELEM_PATH) {
+                ok = AppendPathRects(st, el, xf, netlist, index);
+            } else if (el->kind == GDS_ELEM_BOUNDARY) {
+                ok = AppendBoundaryRects(st, el, xf, netlist, index, scratch);
+            } else {
+                ok = AppendRect(netlist, xf, bb->x_min, bb->y_min, bb->x_max, bb->y_max, el->layer, index);
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Stable counting sort of the flattened shapes by layer slot.
+ */
+static bool GroupByLayerHandler(LayoutNetlist *netlist, LayerSlot *slots, uint32_t *slot_count) {
+    *slot_count = 0;
+    uint32_t *slot_of = malloc((size_t)(netlist->shape_count ? netlist->shape_count : 1) * sizeof(uint32_t));
+    if (slot_of == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < netlist->shape_count; i++) {
+        uint32_t s = 0;
+        while (s < *slot_count && slots[s].layer != netlist->layers[i]) {
+            s++;
+        }
+        if (s == *slot_count) {
+            if (*slot_count == CONNECTIVITY_MAX_LAYERS) {
+                free(slot_of);
+                return false;
+            }
+            memset(&slots[s], 0, sizeof(slots[s]));
+            slots[s].layer = netlist->layers[i];
+            (*slot_count)++;
+        }
+        slots[s].count++;
+        slot_of[i] = s;
+    }
+
+    uint32_t running = 0;
+    for (uint32_t s = 0; s < *slot_count; s++) {
+        slots[s].begin = running;
+        running += slots[s].count;
+    }
+
+    size_t n = netlist->shape_count ? netlist->shape_count : 1;
+    GdsBBox *boxes = malloc(n * sizeof(GdsBBox));
+    uint16_t *layers = malloc(n * sizeof(uint16_t));
+    uint32_t *src = malloc(n * sizeof(uint32_t));
+    uint32_t fill[CONNECTIVITY_MAX_LAYERS] = { 0 };
+    if (boxes == NULL || layers == NULL || src == NULL) {
+        free(boxes);
+        free(layers);
+        free(src);
+        free(slot_of);
+        return false;
+    }
+    for (uint32_t i = 0; i < netlist->shape_count; i++) {
+        uint32_t dst = slots[slot_of[i]].begin + fill[slot_of[i]]++;
+        boxes[dst] = netlist->boxes[i];
+        layers[dst] = netlist->layers[i];
+        src[dst] = netlist->source_elements[i];
+    }
+    free(netlist->boxes);
+    free(netlist->layers);
+    free(netlist->source_elements);
+    netlist->boxes = boxes;
+    netlist->layers = layers;
+    netlist->source_elements = src;
+    netlist->shape_capacity = netlist->shape_count;
+    free(slot_of);
+    return true;
+}
+
+static int32_t FindSlot(const LayerSlot *slots, uint32_t slot_count, uint16_t layer) {
+    for (uint32_t s = 0; s < slot_count; s++) {
+        if (slots[s].layer == layer) {
+            return (int32_t)s;
+        }
+    }
+    return -1;
+}
+
+static void AddNeighbour(LayerSlot *slot, int32_t other) {
+    if (other < 0) {
+        return;
+    }
+    for (uint32_t i = 0; i < slot->neighbour_count; i++) {
+        if (slot->neighbours[i] == (uint16_t)other) {
+            return;
+        }
+    }
+    slot->neighbours[slot->neighbour_count++] = (uint16_t)other;
+}
+
+// --- Parallel Merge ---
+
+static bool MergeVisitor(uint32_t item, void *arg) {
+    QueryContext *q = arg;
+    uint32_t other = q->slot_begin + item;
+    // Each touching pair is seen from both sides; only the lower index merges
+    if (other > q->shape) {
+        UnionFindUnion(q->ctx->parent, q->shape, other);
+    }
+    return true;
+}
+
+static void *MergeWorker(void *arg) {
+    ExtractContext *ctx = arg;
+    const LayoutNetlist *netlist = ctx->netlist;
+
+    for (;;) {
+        uint32_t chunk = atomic_fetch_add_explicit(&ctx->next_chunk, 1, memory_order_relaxed);
+        uint32_t begin = chunk * CONNECTIVITY_CHUNK_SHAPES;
+        if (begin >= netlist->shape_count) {
+            break;
+        }
+        uint32_t end = begin + CONNECTIVITY_CHUNK_SHAPES;
+        if (end > netlist->shape_count) {
+            end = netlist->shape_count;
+        }
+
+        uint32_t s = 0;
+        for (uint32_t i = begin; i < end; i++) {
+            while (i >= ctx->slots[s].begin + ctx->slots[s].count) {
+                s++;
+            }
+            const LayerSlot *slot = &ctx->slots[s];
+            for (uint32_t n = 0; n < slot->neighbour_count; n++) {
+                const LayerSlot *target = &ctx->slots[slot->neighbours[n]];
+                QueryContext q = { ctx, i, target->begin };
+                Rtree_Query(&target->tree, &netlist->boxes[target->begin], &netlist->boxes[i],
+                            MergeVisitor, &q);
+            }
+        }
+    }
+    return NULL;
+}
+
+// --- Public Function Implementations ---
+
+bool ConnectivityExtractor_Run(const GdsLibrary *lib, const char *top_name,
+                               const ConnectivityConfig *config, LayoutNetlist *netlist) {
+    memset(netlist, 0, sizeof(*netlist));
+
+    int32_t top = GdsiiReader_FindStructure(lib, top_name);
+    if (top < 0) {
+        fprintf(stderr, "[ERROR] CONNECTIVITY: top structure '%s' not found.\n", top_name);
+        return false;
+    }
+
+    Transform identity = { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+    DecomposeScratch scratch = { 0 };
+    LayerSlot *slots = calloc(CONNECTIVITY_MAX_LAYERS, sizeof(LayerSlot));
+    uint32_t slot_count = 0;
+    bool flattened = slots != NULL && FlattenHandler(lib, top, &identity, config, netlist, &scratch, 0);
+    free(scratch.ys);
+    free(scratch.xs);
+    free(scratch.open);
+    free(scratch.next);
+    if (!flattened || !GroupByLayerHandler(netlist, slots, &slot_count)) {
+        free(slots);
+        ConnectivityExtractor_Free(netlist);
+        return false;
+    }
+
+    // Conductors connect to themselves; vias connect to themselves and both neighbours
+    bool ok = true;
+    for (uint32_t s = 0; s < slot_count; s++) {
+        AddNeighbour(&slots[s], (int32_t)s);
+    }
+    for (uint32_t r = 0; r < config->via_rule_count; r++) {
+        // Links are recorded in both directions so each pair is seen by its lower index
+        int32_t via = FindSlot(slots, slot_count, config->via_rules[r].via);
+        int32_t lower = FindSlot(slots, slot_count, config->via_rules[r].lower);
+        int32_t upper = FindSlot(slots, slot_count, config->via_rules[r].upper);
+        if (via >= 0) {
+            AddNeighbour(&slots[via], lower);
+            AddNeighbour(&slots[via], upper);
+            if (lower >= 0) AddNeighbour(&slots[lower], via);
+            if (upper >= 0) AddNeighbour(&slots[upper], via);
+        }
+    }
+    for (uint32_t s = 0; ok && s < slot_count; s++) {
+        ok = Rtree_Build(&slots[s].tree, &netlist->boxes[slots[s].begin], slots[s].count);
+    }
+
+    uint32_t n = netlist->shape_count;
+    _Atomic uint32_t *parent = ok ? malloc((size_t)(n ? n : 1) * sizeof(*parent)) : NULL;
+    netlist->net_ids = ok ? malloc((size_t)(n ? n : 1) * sizeof(uint32_t)) : NULL;
+    ok = ok && parent != NULL && netlist->net_ids != NULL;
+
+    if (ok) {
+        for (uint32_t i = 0; i < n; i++) {
+            atomic_init(&parent[i], i);
+        }
+
+        ExtractContext ctx = { netlist, slots, slot_count, parent, 0 };
+        uint32_t threads = config->thread_count;
+        if (threads > CONNECTIVITY_MAX_THREADS) threads = CONNECTIVITY_MAX_THREADS;
+        pthread_t workers[CONNECTIVITY_MAX_THREADS];
+        uint32_t started = 0;
+        for (uint32_t t = 1; t < threads; t++) {
+            if (pthread_create(&workers[started], NULL, MergeWorker, &ctx) == 0) {
+                started++;
+            }
+        }
+        MergeWorker(&ctx); // The calling thread works too
+        for (uint32_t t = 0; t < started; t++) {
+            pthread_join(workers[t], NULL);
+        }
+
+        // Renumber roots densely in shape order so net ids are deterministic
+        for (uint32_t i = 0; i < n; i++) {
+            netlist->net_ids[i] = UINT32_MAX;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t root = UnionFindFind(parent, i);
+            if (netlist->net_ids[root] == UINT32_MAX) {
+                netlist->net_ids[root] = netlist->net_count++;
+            }
+            netlist->net_ids[i] = netlist->net_ids[root];
+        }
+    }
+
+    free(parent);
+    for (uint32_t s = 0; s < slot_count; s++) {
+        Rtree_Free(&slots[s].tree);
+    }
+    free(slots);
+    if (!ok) {
+        fprintf(stderr, "[ERROR] CONNECTIVITY: out of memory.\n");
+        ConnectivityExtractor_Free(netlist);
+    }
+    return ok;
+}
+
+void ConnectivityExtractor_Free(LayoutNetlist *netlist) {
+    free(netlist->boxes);
+    free(netlist->layers);
+    free(netlist->source_elements);
+    free(netlist->net_ids);
+    memset(netlist, 0, sizeof(*netlist));
+}
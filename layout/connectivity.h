@@ -0,0 +1,81 @@
+/**
+ * @file connectivity.h
+ * @brief Layout connectivity (net) extraction over the layout database.
+ *
+ * Flattens a top structure into per-layer shapes, finds touching shapes
+ * through a packed R-tree per layer and merges them into nets with a
+ * lock-free union-find that several worker threads update concurrently.
+ * The result is one compact net id per shape, suitable for LVS-style
+ * comparisons against the schematic netlist.
+ *
+ * Shapes are rectangles. Boxes are kept as they are, paths are cut into one
+ * rectangle per segment and Manhattan polygons (L, U and other rectilinear
+ * shapes) into horizontal slabs, so extraction is exact for routing and via
+ * layers. Only diagonal segments and polygons with a diagonal edge fall
+ * back to their bounding box, which is conservative (may over-merge).
+ */
+
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gdsii.h"
+
+#define CONNECTIVITY_MAX_THREADS    64      // Larger thread counts are clamped to this
+
+/**
+ * @brief One step of the connected layer stack: a via layer joining two conductors.
+ */
+typedef struct {
+    uint16_t lower;         // Conductor below the via (e.g. M1)
+    uint16_t via;           // Cut layer (e.g. VIA1)
+    uint16_t upper;         // Conductor above the via (e.g. M2)
+} ConnectivityViaRule;
+
+/**
+ * @brief Extraction settings.
+ */
+typedef struct {
+    const ConnectivityViaRule *via_rules;
+    uint32_t                   via_rule_count;
+    uint32_t                   thread_count;   // 0 or 1 runs single-threaded; net ids do not depend on it
+} ConnectivityConfig;
+
+/**
+ * @brief Flattened shapes of the top structure and their net assignment.
+ *
+ * Shapes are grouped by layer. Only layers that appear in the via rules are
+ * extracted; everything else (implants, markers, text) is ignored.
+ */
+typedef struct {
+    GdsBBox  *boxes;            // Shape bounds in top-level coordinates
+    uint16_t *layers;
+    uint32_t *source_elements;  // Library-wide element number; a path or polygon yields several shapes
+    uint32_t *net_ids;          // Dense net id per shape, 0..net_count-1
+    uint32_t  shape_count;
+    uint32_t  shape_capacity;
+    uint32_t  net_count;
+} LayoutNetlist;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Extracts nets for a top structure.
+ *
+ * @param lib      A loaded layout database.
+ * @param top_name Name of the structure to flatten and extract.
+ * @param config   Layer stack and threading settings.
+ * @param netlist  Output netlist. Must be zero-initialized or freed.
+ * @return True on success, false if the structure is missing or memory runs out.
+ */
+bool ConnectivityExtractor_Run(const GdsLibrary *lib, const char *top_name,
+                               const ConnectivityConfig *config, LayoutNetlist *netlist);
+
+/**
+ * @brief Releases memory owned by a netlist.
+ */
+void ConnectivityExtractor_Free(LayoutNetlist *netlist);
+
+#endif // CONNECTIVITY_H
@@ -0,0 +1,881 @@
+/**
+ * @file gdsii.c
+ * @brief Implementation of the GDSII stream reader and structure cache.
+ *
+ * Loading happens in two passes over the mmapped stream:
+ *  1. A pre-scan walks the record headers, records the byte span of every
+ *     structure and computes a 64-bit hash over STRNAME..ENDSTR, eight bytes
+ *     per step. BGNSTR is skipped because it only carries modification
+ *     timestamps, which layout tools rewrite even when a cell is untouched.
+ *  2. Each structure is either used in place from the cache image (hash
+ *     hit) or decoded from its span in the stream into the library's pools
+ *     (hash miss). The image stays mapped for as long as the library.
+ *
+ * The cache image is a flat, host-endian file: a header, one relocatable
+ * blob per structure holding its elements, points and reference names, then
+ * an index sorted by hash. After a drop with changes, only the new blobs and
+ * a new index are appended, and the header is rewritten last to point at
+ * that index; nothing a reader may still use is overwritten. Once dead
+ * blobs and old indexes outweigh the live data, the image is compacted:
+ * written in full to a temporary file and renamed into place.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "gdsii.h"
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// --- Private Defines and Constants ---
+
+// GDSII record types used by the reader
+#define GDS_REC_HEADER      0x00
+#define GDS_REC_BGNLIB      0x01
+#define GDS_REC_LIBNAME     0x02
+#define GDS_REC_UNITS       0x03
+#define GDS_REC_ENDLIB      0x04
+#define GDS_REC_BGNSTR      0x05
+#define GDS_REC_STRNAME     0x06
+#define GDS_REC_ENDSTR      0x07
+#define GDS_REC_BOUNDARY    0x08
+#define GDS_REC_PATH        0x09
+#define GDS_REC_SREF        0x0A
+#define GDS_REC_AREF        0x0B
+#define GDS_REC_TEXT        0x0C
+#define GDS_REC_LAYER       0x0D
+#define GDS_REC_DATATYPE    0x0E
+#define GDS_REC_WIDTH       0x0F
+#define GDS_REC_XY          0x10
+#define GDS_REC_ENDEL       0x11
+#define GDS_REC_SNAME       0x12
+#define GDS_REC_COLROW      0x13
+#define GDS_REC_NODE        0x15
+#define GDS_REC_STRANS      0x1A
+#define GDS_REC_MAG         0x1B
+#define GDS_REC_ANGLE       0x1C
+#define GDS_REC_PATHTYPE    0x21
+#define GDS_REC_BOX         0x2D
+#define GDS_REC_BOXTYPE     0x2E
+
+#define GDS_RECORD_HEADER_SIZE  4
+
+#define HASH_SEED           (0x9E3779B97F4A7C15ULL)
+#define HASH_MULTIPLIER     (0xFF51AFD7ED558CCDULL)
+
+#define GDS_CACHE_MAGIC     (0x43534447UL) // "GDSC" in host byte order
+#define GDS_CACHE_VERSION   (4UL)
+#define GDS_CACHE_ALIGN     (8U)
+
+// --- Private Types ---
+
+typedef struct {
+    const uint8_t *data;
+    size_t         size;
+} MappedFile;
+
+typedef struct {
+    uint64_t hash;
+    size_t   begin;   // Offset of the BGNSTR record
+    size_t   end;     // Offset just past the ENDSTR record
+} StructureSpan;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t element_size;  // sizeof(GdsElement), guards against ABI drift
+    uint32_t entry_count;
+    uint64_t index_offset;  // The current index, after the blobs it lists
+    uint64_t index_hash;    // ContentHash of that index; catches a torn header
+} CacheHeader;
+
+typedef struct {
+    uint64_t hash;
+    uint64_t offset;        // Blob offset from the start of the image
+    uint64_t size;
+} CacheIndexEntry;
+
+typedef struct {
+    char     name[GDS_NAME_MAX + 1];
+    uint8_t  reserved[3];
+    uint32_t element_count;
+    uint32_t point_count;
+    uint32_t names_size;
+    uint32_t reserved2[2];
+} CacheBlobHeader;
+
+// The element array follows the blob header and holds doubles
+_Static_assert(sizeof(CacheBlobHeader) % GDS_CACHE_ALIGN == 0, "CacheBlobHeader must keep GdsElement aligned");
+_Static_assert(sizeof(CacheHeader) % GDS_CACHE_ALIGN == 0 && sizeof(CacheIndexEntry) % GDS_CACHE_ALIGN == 0,
+               "Cache index must keep blobs aligned");
+
+// --- Private Helper Functions ---
+
+static bool MapFileHandler(const char *path, MappedFile *file) {
+    file->data = NULL;
+    file->size = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return false;
+    }
+    file->data = (const uint8_t *)p;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+static void UnmapFileHandler(MappedFile *file) {
+    if (file->data != NULL) {
+        munmap((void *)file->data, file->size);
+    }
+    file->data = NULL;
+    file->size = 0;
+}
+
+static uint16_t ReadBe16(const uint8_t *p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static int16_t ReadBe16Signed(const uint8_t *p) {
+    return (int16_t)ReadBe16(p);
+}
+
+static int32_t ReadBe32Signed(const uint8_t *p) {
+    return (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+                     ((uint32_t)p[2] << 8) | (uint32_t)p[3]);
+}
+
+/**
+ * @brief Decodes a GDSII 8-byte excess-64 base-16 real.
+ */
+static double ReadGdsReal8(const uint8_t *p) {
+    int sign = (p[0] & 0x80) ? -1 : 1;
+    int exponent = (p[0] & 0x7F) - 64;
+    uint64_t mantissa = 0;
+    for (int i = 1; i < 8; i++) {
+        mantissa = (mantissa << 8) | p[i];
+    }
+    return sign * ((double)mantissa / 72057594037927936.0) * pow(16.0, exponent); // 2^56
+}
+
+/**
+ * @brief 64-bit content hash, one multiply per eight bytes.
+ *
+ * Runs over every byte of every drop, so it is the floor of a load that
+ * takes everything from the cache. The shift folds the high product bits
+ * back down, so a change anywhere in a word reaches the whole state.
+ */
+static uint64_t ContentHash(const uint8_t *data, size_t len) {
+    uint64_t hash = HASH_SEED ^ len;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * HASH_MULTIPLIER;
+        hash ^= hash >> 32;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, data + i, len - i);
+    hash = (hash ^ tail) * HASH_MULTIPLIER;
+    return hash ^ (hash >> 29);
+}
+
+static void CopyGdsString(char *dst, const uint8_t *src, size_t len) {
+    if (len > GDS_NAME_MAX) {
+        len = GDS_NAME_MAX;
+    }
+    // Odd-length strings carry a NUL pad byte, which terminates dst early
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static bool GrowPool(void **pool, uint32_t *capacity, uint32_t needed, size_t elem_size) {
+    if (needed <= *capacity) {
+        return true;
+    }
+    uint32_t new_capacity = (*capacity != 0) ? *capacity : 64;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    void *p = realloc(*pool, (size_t)new_capacity * elem_size);
+    if (p == NULL) {
+        return false;
+    }
+    *pool = p;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool ReserveStructures(GdsLibrary *lib, uint32_t extra) {
+    return GrowPool((void **)&lib->structures, &lib->structure_capacity,
+                    lib->structure_count + extra, sizeof(GdsStructure));
+}
+
+static bool ReserveElements(GdsLibrary *lib, uint32_t extra) {
+    return GrowPool((void **)&lib->elements, &lib->element_capacity,
+                    lib->element_count + extra, sizeof(GdsElement));
+}
+
+static bool ReservePoints(GdsLibrary *lib, uint32_t extra) {
+    return GrowPool((void **)&lib->points, &lib->point_capacity,
+                    lib->point_count + extra, sizeof(GdsPoint));
+}
+
+static bool ReserveNames(GdsLibrary *lib, uint32_t extra) {
+    return GrowPool((void **)&lib->names, &lib->names_capacity,
+                    lib->names_size + extra, sizeof(char));
+}
+
+// --- Pre-scan ---
+
+/**
+ * @brief Walks the stream once, collecting library metadata and structure spans.
+ */
+static bool PrescanHandler(GdsLibrary *lib, const MappedFile *gds,
+                           StructureSpan **spans_out, uint32_t *span_count_out) {
+    StructureSpan *spans = NULL;
+    uint32_t span_count = 0;
+    uint32_t span_capacity = 0;
+    bool in_structure = false;
+    size_t hash_begin = 0;
+    size_t pos = 0;
+
+    while (pos + GDS_RECORD_HEADER_SIZE <= gds->size) {
+        const uint8_t *rec = gds->data + pos;
+        uint16_t length = ReadBe16(rec);
+        uint8_t type = rec[2];
+        if (length < GDS_RECORD_HEADER_SIZE || pos + length > gds->size) {
+            // Some writers pad the tail of the file with zeros after ENDLIB
+            break;
+        }
+        const uint8_t *payload = rec + GDS_RECORD_HEADER_SIZE;
+        size_t payload_len = length - GDS_RECORD_HEADER_SIZE;
+
+        switch (type) {
+            case GDS_REC_LIBNAME:
+                CopyGdsString(lib->library_name, payload, payload_len);
+                break;
+            case GDS_REC_UNITS:
+                if (payload_len >= 16) {
+                    lib->user_units_per_db = ReadGdsReal8(payload);
+                    lib->meters_per_db = ReadGdsReal8(payload + 8);
+                }
+                break;
+            case GDS_REC_BGNSTR:
+                if (!GrowPool((void **)&spans, &span_capacity, span_count + 1, sizeof(StructureSpan))) {
+                    free(spans);
+                    return false;
+                }
+                spans[span_count].begin = pos;
+                in_structure = true;
+                hash_begin = pos + length;
+                break;
+            case GDS_REC_ENDSTR:
+                if (in_structure) {
+                    spans[span_count].end = pos + length;
+                    spans[span_count].hash = ContentHash(gds->data + hash_begin, pos + length - hash_begin);
+                    span_count++;
+                    in_structure = false;
+                }
+                break;
+            default:
+                break;
+        }
+        pos += length;
+        if (type == GDS_REC_ENDLIB) {
+            break;
+        }
+    }
+
+    if (in_structure) {
+        fprintf(stderr, "[ERROR] GDSII: truncated structure at offset %zu.\n", spans[span_count].begin);
+        free(spans);
+        return false;
+    }
+    *spans_out = spans;
+    *span_count_out = span_count;
+    return true;
+}
+
+// --- Stream Decoding ---
+
+static void ComputeElementBBox(const GdsLibrary *lib, GdsElement *el) {
+    GdsBBox box = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+    for (uint32_t i = 0; i < el->point_count; i++) {
+        const GdsPoint *pt = &lib->points[el->point_offset + i];
+        if (pt->x < box.x_min) box.x_min = pt->x;
+        if (pt->y < box.y_min) box.y_min = pt->y;
+        if (pt->x > box.x_max) box.x_max = pt->x;
+        if (pt->y > box.y_max) box.y_max = pt->y;
+    }
+    if (el->kind == GDS_ELEM_PATH && el->point_count > 0) {
+        // Conservative: grow by half the width on every side
+        int32_t half = (el->width >= 0 ? el->width : -el->width) / 2;
+        box.x_min -= half;
+        box.y_min -= half;
+        box.x_max += half;
+        box.y_max += half;
+    }
+    el->bbox = box;
+}
+
+/**
+ * @brief Decodes one structure span from the stream into the library.
+ */
+static bool ParseStructureHandler(GdsLibrary *lib, const MappedFile *gds, const StructureSpan *span) {
+    if (!ReserveStructures(lib, 1)) {
+        return false;
+    }
+    GdsStructure *st = &lib->structures[lib->structure_count];
+    memset(st, 0, sizeof(*st));
+    st->content_hash = span->hash;
+    st->element_offset = lib->element_count;
+
+    GdsElement el;
+    bool in_element = false;
+    bool skip_element = false;
+    size_t pos = span->begin;
+
+    while (pos < span->end) {
+        const uint8_t *rec = gds->data + pos;
+        uint16_t length = ReadBe16(rec);
+        uint8_t type = rec[2];
+        const uint8_t *payload = rec + GDS_RECORD_HEADER_SIZE;
+        size_t payload_len = length - GDS_RECORD_HEADER_SIZE;
+
+        switch (type) {
+            case GDS_REC_STRNAME:
+                CopyGdsString(st->name, payload, payload_len);
+                break;
+            case GDS_REC_BOUNDARY:
+            case GDS_REC_PATH:
+            case GDS_REC_BOX:
+            case GDS_REC_SREF:
+            case GDS_REC_AREF:
+                memset(&el, 0, sizeof(el));
+                el.kind = (type == GDS_REC_BOUNDARY) ? GDS_ELEM_BOUNDARY :
+                          (type == GDS_REC_PATH)     ? GDS_ELEM_PATH :
+                          (type == GDS_REC_BOX)      ? GDS_ELEM_BOX :
+                          (type == GDS_REC_SREF)     ? GDS_ELEM_SREF : GDS_ELEM_AREF;
+                el.magnification = 1.0;
+                el.point_offset = lib->point_count;
+                in_element = true;
+                skip_element = false;
+                break;
+            case GDS_REC_TEXT:
+            case GDS_REC_NODE:
+                // Text and node elements carry no geometry the database needs
+                in_element = true;
+                skip_element = true;
+                break;
+            case GDS_REC_LAYER:
+                if (in_element && payload_len >= 2) el.layer = (uint16_t)ReadBe16Signed(payload);
+                break;
+            case GDS_REC_DATATYPE:
+            case GDS_REC_BOXTYPE:
+                if (in_element && payload_len >= 2) el.datatype = (uint16_t)ReadBe16Signed(payload);
+                break;
+            case GDS_REC_WIDTH:
+                if (in_element && payload_len >= 4) el.width = ReadBe32Signed(payload);
+                break;
+            case GDS_REC_PATHTYPE:
+                if (in_element && payload_len >= 2) el.path_type = (uint8_t)ReadBe16(payload);
+                break;
+            case GDS_REC_STRANS:
+                if (in_element && payload_len >= 2) el.strans = ReadBe16(payload);
+                break;
+            case GDS_REC_MAG:
+                if (in_element && payload_len >= 8) el.magnification = ReadGdsReal8(payload);
+                break;
+            case GDS_REC_ANGLE:
+                if (in_element && payload_len >= 8) el.angle_deg = ReadGdsReal8(payload);
+                break;
+            case GDS_REC_COLROW:
+                if (in_element && payload_len >= 4) {
+                    el.columns = ReadBe16(payload);
+                    el.rows = ReadBe16(payload + 2);
+                }
+                break;
+            case GDS_REC_SNAME:
+                if (in_element && !skip_element) {
+                    char name[GDS_NAME_MAX + 1];
+                    CopyGdsString(name, payload, payload_len);
+                    uint32_t len = (uint32_t)strlen(name) + 1;
+                    if (!ReserveNames(lib, len)) {
+                        return false;
+                    }
+                    el.ref_name = lib->names_size;
+                    memcpy(lib->names + lib->names_size, name, len);
+                    lib->names_size += len;
+                }
+                break;
+            case GDS_REC_XY:
+                if (in_element && !skip_element) {
+                    uint32_t count = (uint32_t)(payload_len / 8);
+                    if (!ReservePoints(lib, count)) {
+                        return false;
+                    }
+                    for (uint32_t i = 0; i < count; i++) {
+                        lib->points[lib->point_count + i].x = ReadBe32Signed(payload + i * 8);
+                        lib->points[lib->point_count + i].y = ReadBe32Signed(payload + i * 8 + 4);
+                    }
+                    lib->point_count += count;
+                    el.point_count += count;
+                }
+                break;
+            case GDS_REC_ENDEL:
+                if (in_element && !skip_element) {
+                    if (!ReserveElements(lib, 1)) {
+                        return false;
+                    }
+                    ComputeElementBBox(lib, &el);
+                    lib->elements[lib->element_count++] = el;
+                    st->element_count++;
+                }
+                in_element = false;
+                break;
+            default:
+                break;
+        }
+        pos += length;
+    }
+
+    lib->bytes_parsed += span->end - span->begin;
+    lib->structures_parsed++;
+    lib->structure_count++;
+    return true;
+}
+
+// --- Structure Cache ---
+
+static const CacheIndexEntry *CacheIndex(const MappedFile *cache) {
+    return (const CacheIndexEntry *)(cache->data + ((const CacheHeader *)cache->data)->index_offset);
+}
+
+static const CacheIndexEntry *CacheLookup(const MappedFile *cache, uint64_t hash) {
+    if (cache->data == NULL) {
+        return NULL;
+    }
+    const CacheHeader *hdr = (const CacheHeader *)cache->data;
+    const CacheIndexEntry *index = CacheIndex(cache);
+    uint32_t lo = 0;
+    uint32_t hi = hdr->entry_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (index[mid].hash < hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lo < hdr->entry_count && index[lo].hash == hash) ? &index[lo] : NULL;
+}
+
+static bool CacheOpen(const char *cache_path, MappedFile *cache) {
+    if (!MapFileHandler(cache_path, cache)) {
+        return false;
+    }
+    const CacheHeader *hdr = (const CacheHeader *)cache->data;
+    if (cache->size < sizeof(CacheHeader) ||
+        hdr->magic != GDS_CACHE_MAGIC ||
+        hdr->version != GDS_CACHE_VERSION ||
+        hdr->element_size != sizeof(GdsElement) ||
+        hdr->index_offset % GDS_CACHE_ALIGN != 0 ||
+        hdr->index_offset < sizeof(CacheHeader) || hdr->index_offset > cache->size ||
+        (cache->size - hdr->index_offset) / sizeof(CacheIndexEntry) < hdr->entry_count) {
+        UnmapFileHandler(cache);
+        return false;
+    }
+    const CacheIndexEntry *index = CacheIndex(cache);
+    if (ContentHash((const uint8_t *)index, (size_t)hdr->entry_count * sizeof(CacheIndexEntry)) != hdr->index_hash) {
+        UnmapFileHandler(cache);
+        return false;
+    }
+    // Every blob must hold at least its header, aligned, ahead of the index;
+    // CachedBlob reads the counts before anything else
+    for (uint32_t i = 0; i < hdr->entry_count; i++) {
+        if (index[i].offset % GDS_CACHE_ALIGN != 0 || index[i].size < sizeof(CacheBlobHeader) ||
+            index[i].offset < sizeof(CacheHeader) || index[i].offset > hdr->index_offset ||
+            index[i].size > hdr->index_offset - index[i].offset) {
+            UnmapFileHandler(cache);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Header of an entry's blob, or NULL if its counts overrun the entry.
+ */
+static const CacheBlobHeader *CachedBlob(const MappedFile *cache, const CacheIndexEntry *entry) {
+    const CacheBlobHeader *bh = (const CacheBlobHeader *)(cache->data + entry->offset);
+    size_t needed = sizeof(*bh) + (size_t)bh->element_count * sizeof(GdsElement) +
+                    (size_t)bh->point_count * sizeof(GdsPoint) + bh->names_size;
+    return (entry->size >= needed) ? bh : NULL;
+}
+
+/**
+ * @brief Adds a cached structure that points into the cache image.
+ *
+ * Every element's points and name must lie inside the blob, so a corrupt
+ * image is parsed again rather than read out of bounds.
+ */
+static bool LoadCachedStructureHandler(GdsLibrary *lib, const MappedFile *cache,
+                                       const CacheIndexEntry *entry) {
+    const CacheBlobHeader *bh = CachedBlob(cache, entry);
+    if (bh == NULL || !ReserveStructures(lib, 1)) {
+        return false;
+    }
+    const GdsElement *elements = (const GdsElement *)(bh + 1);
+    const GdsPoint *points = (const GdsPoint *)(elements + bh->element_count);
+    const char *names = (const char *)(points + bh->point_count);
+    if (bh->names_size > 0 && names[bh->names_size - 1] != '\0') {
+        return false;
+    }
+    for (uint32_t i = 0; i < bh->element_count; i++) {
+        const GdsElement *el = &elements[i];
+        if (el->point_offset > bh->point_count || el->point_count > bh->point_count - el->point_offset ||
+            ((el->kind == GDS_ELEM_SREF || el->kind == GDS_ELEM_AREF) && el->ref_name >= bh->names_size)) {
+            return false;
+        }
+    }
+
+    GdsStructure *st = &lib->structures[lib->structure_count++];
+    memset(st, 0, sizeof(*st));
+    memcpy(st->name, bh->name, sizeof(st->name));
+    st->name[GDS_NAME_MAX] = '\0';
+    st->content_hash = entry->hash;
+    st->element_count = bh->element_count;
+    st->elements = elements;
+    st->points = points;
+    st->names = names;
+    st->from_cache = true;
+    lib->structures_cached++;
+    return true;
+}
+
+/**
+ * @brief Points the decoded structures at the final pools and numbers the elements.
+ *
+ * Until the load ends the pools may move, so decoded structures hold their
+ * pool index in element_offset.
+ */
+static void ResolveStructures(GdsLibrary *lib) {
+    uint32_t number = 0;
+    for (uint32_t s = 0; s < lib->structure_count; s++) {
+        GdsStructure *st = &lib->structures[s];
+        if (!st->from_cache) {
+            st->elements = (st->element_count > 0) ? &lib->elements[st->element_offset] : NULL;
+            st->points = lib->points;
+            st->names = lib->names;
+        }
+        st->element_offset = number;
+        number += st->element_count;
+    }
+    lib->element_total = number;
+}
+
+static int CompareIndexByHash(const void *a, const void *b) {
+    uint64_t ha = ((const CacheIndexEntry *)a)->hash;
+    uint64_t hb = ((const CacheIndexEntry *)b)->hash;
+    return (ha > hb) - (ha < hb);
+}
+
+static size_t AlignUp(size_t value) {
+    return (value + GDS_CACHE_ALIGN - 1) & ~(size_t)(GDS_CACHE_ALIGN - 1);
+}
+
+/**
+ * @brief Gathers the point/name range used by a structure's elements.
+ */
+static void StructureExtents(const GdsStructure *st,
+                             uint32_t *pt_begin, uint32_t *pt_end,
+                             uint32_t *name_begin, uint32_t *name_end) {
+    *pt_begin = UINT32_MAX;
+    *pt_end = 0;
+    *name_begin = UINT32_MAX;
+    *name_end = 0;
+    for (uint32_t i = 0; i < st->element_count; i++) {
+        const GdsElement *el = &st->elements[i];
+        if (el->point_offset < *pt_begin) *pt_begin = el->point_offset;
+        if (el->point_offset + el->point_count > *pt_end) *pt_end = el->point_offset + el->point_count;
+        if (el->kind == GDS_ELEM_SREF || el->kind == GDS_ELEM_AREF) {
+            uint32_t len = (uint32_t)strlen(st->names + el->ref_name) + 1;
+            if (el->ref_name < *name_begin) *name_begin = el->ref_name;
+            if (el->ref_name + len > *name_end) *name_end = el->ref_name + len;
+        }
+    }
+    if (*pt_begin > *pt_end) *pt_begin = *pt_end = 0;
+    if (*name_begin > *name_end) *name_begin = *name_end = 0;
+}
+
+/**
+ * @brief Serialises one structure into buf as a blob, padded to GDS_CACHE_ALIGN.
+ *
+ * Point and name offsets are rebased to the blob, so it loads anywhere.
+ *
+ * @return Blob size in bytes, or 0 if out of memory.
+ */
+static size_t BuildBlobHandler(const GdsStructure *st, uint8_t **buf, uint32_t *capacity) {
+    uint32_t pb, pe, nb, ne;
+    StructureExtents(st, &pb, &pe, &nb, &ne);
+    size_t element_bytes = (size_t)st->element_count * sizeof(GdsElement);
+    size_t point_bytes = (size_t)(pe - pb) * sizeof(GdsPoint);
+    size_t used = sizeof(CacheBlobHeader) + element_bytes + point_bytes + (ne - nb);
+    size_t size = AlignUp(used);
+    if (size > UINT32_MAX || !GrowPool((void **)buf, capacity, (uint32_t)size, 1)) {
+        return 0;
+    }
+
+    CacheBlobHeader *bh = (CacheBlobHeader *)*buf;
+    memset(bh, 0, sizeof(*bh));
+    memcpy(bh->name, st->name, sizeof(bh->name));
+    bh->element_count = st->element_count;
+    bh->point_count = pe - pb;
+    bh->names_size = ne - nb;
+
+    GdsElement *elements = (GdsElement *)(bh + 1);
+    if (element_bytes > 0) {
+        memcpy(elements, st->elements, element_bytes);
+    }
+    for (uint32_t i = 0; i < st->element_count; i++) {
+        elements[i].point_offset -= pb;
+        elements[i].ref_name = (elements[i].kind == GDS_ELEM_SREF || elements[i].kind == GDS_ELEM_AREF)
+                                   ? elements[i].ref_name - nb : 0;
+    }
+    uint8_t *tail = (uint8_t *)(elements + st->element_count);
+    if (point_bytes > 0) {
+        memcpy(tail, &st->points[pb], point_bytes);
+    }
+    if (ne > nb) {
+        memcpy(tail + point_bytes, st->names + nb, ne - nb);
+    }
+    memset(*buf + used, 0, size - used);
+    return size;
+}
+
+/**
+ * @brief Writes the sorted index at offset, then the header pointing at it.
+ *
+ * The index reaches the file before the header does, and index_hash lets a
+ * reader reject a header that does not match the index it names.
+ */
+static bool CacheWriteIndex(FILE *fp, CacheHeader *hdr, CacheIndexEntry *index, uint32_t count, size_t offset) {
+    qsort(index, count, sizeof(CacheIndexEntry), CompareIndexByHash);
+    hdr->entry_count = count;
+    hdr->index_offset = offset;
+    hdr->index_hash = ContentHash((const uint8_t *)index, (size_t)count * sizeof(CacheIndexEntry));
+    return fseek(fp, (long)offset, SEEK_SET) == 0 &&
+           fwrite(index, sizeof(CacheIndexEntry), count, fp) == count &&
+           fflush(fp) == 0 &&
+           fseek(fp, 0, SEEK_SET) == 0 &&
+           fwrite(hdr, sizeof(*hdr), 1, fp) == 1;
+}
+
+/**
+ * @brief Appends the structures a load parsed, and a new index, to the cache.
+ *
+ * kept[s] is the entry structure s came from, or has size 0 if it was
+ * parsed; the parsed ones get their new entries. The structures the drop
+ * no longer uses become dead space.
+ *
+ * @param loaded Header of the cache image the load read.
+ * @return False, before writing anything, if the image should be compacted
+ *         or another load has updated it since; false also on a write error.
+ */
+static bool CacheUpdateHandler(const GdsLibrary *lib, const char *cache_path, CacheIndexEntry *kept,
+                               const CacheHeader *loaded) {
+    FILE *fp = fopen(cache_path, "r+b");
+    if (fp == NULL) {
+        return false;
+    }
+    // One writer at a time; readers never wait
+    struct flock lock;
+    memset(&lock, 0, sizeof(lock));
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    CacheHeader hdr;
+    bool ok = fcntl(fileno(fp), F_SETLKW, &lock) == 0 &&
+              fread(&hdr, sizeof(hdr), 1, fp) == 1 &&
+              hdr.index_offset == loaded->index_offset && hdr.index_hash == loaded->index_hash &&
+              fseek(fp, 0, SEEK_END) == 0;
+    long end = ok ? ftell(fp) : -1;
+    ok = ok && end > 0 && (size_t)end % GDS_CACHE_ALIGN == 0;
+
+    size_t live = 0;
+    for (uint32_t s = 0; ok && s < lib->structure_count; s++) {
+        live += kept[s].size;
+    }
+    // Compact once dead blobs and indexes outweigh what this drop still uses
+    ok = ok && (size_t)end - sizeof(CacheHeader) <= 2U * live;
+
+    uint8_t *blob = NULL;
+    uint32_t capacity = 0;
+    size_t offset = ok ? (size_t)end : 0;
+    for (uint32_t s = 0; ok && s < lib->structure_count; s++) {
+        if (kept[s].size != 0) {
+            continue;
+        }
+        size_t size = BuildBlobHandler(&lib->structures[s], &blob, &capacity);
+        ok = size != 0 && fwrite(blob, 1, size, fp) == size;
+        kept[s].hash = lib->structures[s].content_hash;
+        kept[s].offset = offset;
+        kept[s].size = size;
+        offset += size;
+    }
+    ok = ok && CacheWriteIndex(fp, &hdr, kept, lib->structure_count, offset);
+    free(blob);
+    // Closing releases the lock
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+    return ok;
+}
+
+// --- Public Function Implementations ---
+
+bool GdsiiCache_Write(const GdsLibrary *lib, const char *cache_path) {
+    CacheIndexEntry *index = calloc(lib->structure_count ? lib->structure_count : 1, sizeof(CacheIndexEntry));
+    if (index == NULL) {
+        return false;
+    }
+
+    char tmp_path[4096];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", cache_path);
+    FILE *fp = fopen(tmp_path, "wb");
+    if (fp == NULL) {
+        free(index);
+        return false;
+    }
+
+    // The header is written again, complete, once the index is in place
+    CacheHeader hdr = { GDS_CACHE_MAGIC, GDS_CACHE_VERSION, sizeof(GdsElement), 0, 0, 0 };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+    uint8_t *blob = NULL;
+    uint32_t capacity = 0;
+    size_t offset = sizeof(CacheHeader);
+    for (uint32_t s = 0; ok && s < lib->structure_count; s++) {
+        size_t size = BuildBlobHandler(&lib->structures[s], &blob, &capacity);
+        ok = size != 0 && fwrite(blob, 1, size, fp) == size;
+        index[s].hash = lib->structures[s].content_hash;
+        index[s].offset = offset;
+        index[s].size = size;
+        offset += size;
+    }
+    ok = ok && CacheWriteIndex(fp, &hdr, index, lib->structure_count, offset);
+
+    free(blob);
+    free(index);
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+    if (ok && rename(tmp_path, cache_path) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        remove(tmp_path);
+    }
+    return ok;
+}
+
+bool GdsiiReader_Load(GdsLibrary *lib, const char *gds_path, const char *cache_path) {
+    memset(lib, 0, sizeof(*lib));
+
+    MappedFile gds;
+    if (!MapFileHandler(gds_path, &gds)) {
+        fprintf(stderr, "[ERROR] GDSII: cannot map '%s'.\n", gds_path);
+        return false;
+    }
+
+    StructureSpan *spans = NULL;
+    uint32_t span_count = 0;
+    if (!PrescanHandler(lib, &gds, &spans, &span_count)) {
+        UnmapFileHandler(&gds);
+        return false;
+    }
+
+    MappedFile cache = { NULL, 0 };
+    CacheHeader loaded;
+    // A missing or stale cache just means a full parse
+    bool cache_valid = cache_path != NULL && CacheOpen(cache_path, &cache);
+    if (cache_valid) {
+        memcpy(&loaded, cache.data, sizeof(loaded));
+    }
+
+    // kept[i] remembers the entry structure i came from, for the cache update
+    CacheIndexEntry *kept = calloc(span_count ? span_count : 1, sizeof(CacheIndexEntry));
+    bool ok = kept != NULL && ReserveStructures(lib, span_count);
+    for (uint32_t i = 0; ok && i < span_count; i++) {
+        const CacheIndexEntry *entry = CacheLookup(&cache, spans[i].hash);
+        if (entry != NULL && LoadCachedStructureHandler(lib, &cache, entry)) {
+            kept[i] = *entry;
+            continue;
+        }
+        ok = ParseStructureHandler(lib, &gds, &spans[i]);
+    }
+
+    // Cached structures point into the image, so it lives as long as the library
+    if (lib->structures_cached > 0) {
+        lib->cache_image = cache.data;
+        lib->cache_image_size = cache.size;
+    } else {
+        UnmapFileHandler(&cache);
+    }
+    UnmapFileHandler(&gds);
+    free(spans);
+
+    if (!ok) {
+        fprintf(stderr, "[ERROR] GDSII: out of memory while loading '%s'.\n", gds_path);
+        free(kept);
+        GdsiiReader_Free(lib);
+        return false;
+    }
+    ResolveStructures(lib);
+
+    // Only touch the cache if this drop actually changed something, and then
+    // only append what changed unless the image is due for compaction
+    if (cache_path != NULL && lib->structures_parsed > 0) {
+        bool updated = cache_valid && CacheUpdateHandler(lib, cache_path, kept, &loaded);
+        if (!updated && !GdsiiCache_Write(lib, cache_path)) {
+            fprintf(stderr, "[WARN] GDSII: could not update cache '%s'.\n", cache_path);
+        }
+    }
+    free(kept);
+    return true;
+}
+
+void GdsiiReader_Free(GdsLibrary *lib) {
+    if (lib->cache_image != NULL) {
+        munmap((void *)lib->cache_image, lib->cache_image_size);
+    }
+    free(lib->structures);
+    free(lib->elements);
+    free(lib->points);
+    free(lib->names);
+    memset(lib, 0, sizeof(*lib));
+}
+
+int32_t GdsiiReader_FindStructure(const GdsLibrary *lib, const char *name) {
+    for (uint32_t i = 0; i < lib->structure_count; i++) {
+        if (strcmp(lib->structures[i].name, name) == 0) {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file gdsii.h
+ * @brief GDSII stream reader and in-memory layout database.
+ *
+ * This file declares a small host-side reader for GDSII stream files as
+ * produced by the physical design flow. The reader builds a flat layout
+ * database (structures, elements and a shared point pool) that other
+ * layout utilities can walk without touching the stream format again.
+ *
+ * During ECO loops only a handful of cells change between layout drops, so
+ * the reader supports an optional on-disk structure cache. A single pre-scan
+ * pass hashes the contents of every structure; structures whose hash is
+ * already in the cache are used in place from the mmapped cache image, and
+ * only new or modified structures are decoded from the stream. Afterwards
+ * only those are appended to the cache, so a load costs the pre-scan plus
+ * work in proportion to what changed.
+ */
+
+#ifndef GDSII_H
+#define GDSII_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- Limits ---
+#define GDS_NAME_MAX                32  // Structure names are limited to 32 chars by the format
+
+// --- Element Kinds ---
+#define GDS_ELEM_BOUNDARY           0x01
+#define GDS_ELEM_PATH               0x02
+#define GDS_ELEM_BOX                0x03
+#define GDS_ELEM_SREF               0x04
+#define GDS_ELEM_AREF               0x05
+
+// --- Path End Types (PATHTYPE) ---
+#define GDS_PATH_FLUSH              0   // Ends at the first and last point (the default)
+#define GDS_PATH_ROUND              1
+#define GDS_PATH_EXTENDED           2   // Extends half the width past each end
+#define GDS_PATH_CUSTOM             4
+
+// --- Public Types ---
+
+/**
+ * @brief A point in database units.
+ */
+typedef struct {
+    int32_t x;
+    int32_t y;
+} GdsPoint;
+
+/**
+ * @brief Axis-aligned bounding box in database units.
+ */
+typedef struct {
+    int32_t x_min;
+    int32_t y_min;
+    int32_t x_max;
+    int32_t y_max;
+} GdsBBox;
+
+/**
+ * @brief A single layout element.
+ *
+ * Offsets index into the owning structure's points and names, which are the
+ * library's pools or part of the cache image. Geometry elements use
+ * layer/datatype/points; reference elements use ref_name and the transform
+ * fields. The layout is fixed-size so the structure cache can store it as-is.
+ */
+typedef struct {
+    uint8_t  kind;          // One of GDS_ELEM_*
+    uint8_t  path_type;     // One of GDS_PATH_* (paths only)
+    uint16_t layer;
+    uint16_t datatype;      // DATATYPE or BOXTYPE
+    uint16_t strans;        // STRANS flags for references
+    int32_t  width;         // PATH width (0 for other kinds)
+    uint16_t columns;       // AREF columns
+    uint16_t rows;          // AREF rows
+    uint32_t point_offset;  // First point in GdsStructure.points
+    uint32_t point_count;
+    uint32_t ref_name;      // Offset into GdsStructure.names (references only)
+    double   magnification;
+    double   angle_deg;
+    GdsBBox  bbox;          // Bounds of the element's own points
+} GdsElement;
+
+/**
+ * @brief A structure (cell) in the library.
+ *
+ * Elements are numbered across the library in structure order: element i
+ * of a structure is number element_offset + i.
+ */
+typedef struct {
+    char              name[GDS_NAME_MAX + 1];
+    uint64_t          content_hash;   // Hash of STRNAME..ENDSTR, excludes timestamps
+    uint32_t          element_offset; // Library-wide number of the first element
+    uint32_t          element_count;
+    const GdsElement *elements;       // In GdsLibrary.elements or the cache image
+    const GdsPoint   *points;         // Base of the elements' point_offset
+    const char       *names;          // Base of the elements' ref_name
+    bool              from_cache;     // True if used from the structure cache
+} GdsStructure;
+
+/**
+ * @brief The in-memory layout database.
+ *
+ * The pools hold the structures decoded from the stream. Cached structures
+ * point into the cache image, which stays mapped until GdsiiReader_Free.
+ */
+typedef struct {
+    char          library_name[GDS_NAME_MAX + 1];
+    double        user_units_per_db;  // First UNITS value
+    double        meters_per_db;      // Second UNITS value
+
+    GdsStructure *structures;
+    uint32_t      structure_count;
+    uint32_t      structure_capacity;
+
+    GdsElement   *elements;           // Decoded structures only, as are points and names
+    uint32_t      element_count;
+    uint32_t      element_capacity;
+
+    GdsPoint     *points;
+    uint32_t      point_count;
+    uint32_t      point_capacity;
+
+    char         *names;              // NUL-separated reference names
+    uint32_t      names_size;
+    uint32_t      names_capacity;
+
+    const void   *cache_image;        // Mapped structure cache, or NULL
+    size_t        cache_image_size;
+    uint32_t      element_total;      // Elements in all structures
+
+    // Load statistics for the most recent GdsiiReader_Load call
+    uint32_t      structures_parsed;
+    uint32_t      structures_cached;
+    uint64_t      bytes_parsed;
+} GdsLibrary;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Loads a GDSII stream file into a layout database.
+ *
+ * If cache_path is non-NULL, unchanged structures are taken from the cache
+ * image at that path, and structures that had to be decoded are appended to
+ * it afterwards. A missing or stale cache is not an error. Cached
+ * structures point into the mapped image until GdsiiReader_Free; the file
+ * may be appended to or replaced meanwhile, but must not be truncated.
+ *
+ * @param lib        Library to populate. Must be zero-initialized or freed.
+ * @param gds_path   Path to the GDSII stream file.
+ * @param cache_path Path to the structure cache, or NULL to disable caching.
+ * @return True if the stream was loaded successfully, false otherwise.
+ */
+bool GdsiiReader_Load(GdsLibrary *lib, const char *gds_path, const char *cache_path);
+
+/**
+ * @brief Releases all memory owned by a layout database.
+ *
+ * @param lib The library to free. It is left zero-initialized.
+ */
+void GdsiiReader_Free(GdsLibrary *lib);
+
+/**
+ * @brief Looks up a structure by name.
+ *
+ * @param lib  The library to search.
+ * @param name The structure name.
+ * @return The structure index, or -1 if not found.
+ */
+int32_t GdsiiReader_FindStructure(const GdsLibrary *lib, const char *name);
+
+/**
+ * @brief Writes the whole structure cache for a loaded library.
+ *
+ * GdsiiReader_Load calls it when there is no usable cache, and to compact
+ * one that is mostly dead space; otherwise it only appends. The cache is
+ * written to a temporary file and renamed into place so a concurrent reader
+ * never observes a partial image.
+ *
+ * @param lib        The loaded library.
+ * @param cache_path Destination path for the cache image.
+ * @return True if the cache was written successfully, false otherwise.
+ */
+bool GdsiiCache_Write(const GdsLibrary *lib, const char *cache_path);
+
+#endif // GDSII_H
@@ -0,0 +1,188 @@
+/**
+ * @file rtree.c
+ * @brief Implementation of the static packed R-tree.
+ *
+ * Sort-Tile-Recursive (STR) packing: entries are sorted by the x centre,
+ * cut into vertical slabs of sqrt(P) nodes, each slab is sorted by the y
+ * centre and packed RTREE_FANOUT at a time. The same step is applied to the
+ * resulting nodes until a single root remains.
+ */
+
+#include "rtree.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Private Types ---
+
+typedef struct {
+    int64_t  cx;        // Doubled centre, avoids rounding
+    int64_t  cy;
+    uint32_t id;
+} SortEntry;
+
+// --- Private Helper Functions ---
+
+static int CompareByX(const void *a, const void *b) {
+    const SortEntry *ea = a;
+    const SortEntry *eb = b;
+    return (ea->cx > eb->cx) - (ea->cx < eb->cx);
+}
+
+static int CompareByY(const void *a, const void *b) {
+    const SortEntry *ea = a;
+    const SortEntry *eb = b;
+    return (ea->cy > eb->cy) - (ea->cy < eb->cy);
+}
+
+static void BBoxUnion(GdsBBox *dst, const GdsBBox *src) {
+    if (src->x_min < dst->x_min) dst->x_min = src->x_min;
+    if (src->y_min < dst->y_min) dst->y_min = src->y_min;
+    if (src->x_max > dst->x_max) dst->x_max = src->x_max;
+    if (src->y_max > dst->y_max) dst->y_max = src->y_max;
+}
+
+static bool BBoxTouches(const GdsBBox *a, const GdsBBox *b) {
+    return a->x_min <= b->x_max && b->x_min <= a->x_max &&
+           a->y_min <= b->y_max && b->y_min <= a->y_max;
+}
+
+/**
+ * @brief Orders entries in STR tile order.
+ */
+static void StrSortHandler(SortEntry *entries, uint32_t count) {
+    uint32_t groups = (count + RTREE_FANOUT - 1) / RTREE_FANOUT;
+    uint32_t slabs = (uint32_t)ceil(sqrt((double)groups));
+    uint32_t slab_size = slabs * RTREE_FANOUT;
+
+    qsort(entries, count, sizeof(SortEntry), CompareByX);
+    for (uint32_t start = 0; start < count; start += slab_size) {
+        uint32_t n = (count - start < slab_size) ? count - start : slab_size;
+        qsort(entries + start, n, sizeof(SortEntry), CompareByY);
+    }
+}
+
+// --- Public Function Implementations ---
+
+bool Rtree_Build(Rtree *tree, const GdsBBox *boxes, uint32_t count) {
+    memset(tree, 0, sizeof(*tree));
+    if (count == 0) {
+        return true;
+    }
+
+    // Upper bound on node count: a full level plus a geometric tail
+    uint32_t max_nodes = 1;
+    for (uint32_t level = count; level > 1; level = (level + RTREE_FANOUT - 1) / RTREE_FANOUT) {
+        max_nodes += (level + RTREE_FANOUT - 1) / RTREE_FANOUT;
+    }
+
+    SortEntry *entries = malloc((size_t)count * sizeof(SortEntry));
+    tree->items = malloc((size_t)count * sizeof(uint32_t));
+    tree->nodes = malloc((size_t)max_nodes * sizeof(RtreeNode));
+    if (entries == NULL || tree->items == NULL || tree->nodes == NULL) {
+        free(entries);
+        Rtree_Free(tree);
+        return false;
+    }
+
+    // Leaf level
+    for (uint32_t i = 0; i < count; i++) {
+        entries[i].cx = (int64_t)boxes[i].x_min + boxes[i].x_max;
+        entries[i].cy = (int64_t)boxes[i].y_min + boxes[i].y_max;
+        entries[i].id = i;
+    }
+    StrSortHandler(entries, count);
+    for (uint32_t i = 0; i < count; i++) {
+        tree->items[i] = entries[i].id;
+    }
+    tree->item_count = count;
+
+    uint32_t level_begin = 0;
+    for (uint32_t i = 0; i < count; i += RTREE_FANOUT) {
+        RtreeNode *node = &tree->nodes[tree->node_count++];
+        node->first_child = i;
+        node->child_count = (uint16_t)((count - i < RTREE_FANOUT) ? count - i : RTREE_FANOUT);
+        node->is_leaf = 1;
+        node->bbox = boxes[tree->items[i]];
+        for (uint32_t c = 1; c < node->child_count; c++) {
+            BBoxUnion(&node->bbox, &boxes[tree->items[i + c]]);
+        }
+    }
+
+    // Inner levels: pack the previous level's nodes until one root remains
+    while (tree->node_count - level_begin > 1) {
+        uint32_t level_count = tree->node_count - level_begin;
+        for (uint32_t i = 0; i < level_count; i++) {
+            const GdsBBox *b = &tree->nodes[level_begin + i].bbox;
+            entries[i].cx = (int64_t)b->x_min + b->x_max;
+            entries[i].cy = (int64_t)b->y_min + b->y_max;
+            entries[i].id = level_begin + i;
+        }
+        StrSortHandler(entries, level_count);
+
+        // Children of a node must be contiguous, so reorder the level in place
+        RtreeNode *scratch = malloc((size_t)level_count * sizeof(RtreeNode));
+        if (scratch == NULL) {
+            free(entries);
+            Rtree_Free(tree);
+            return false;
+        }
+        for (uint32_t i = 0; i < level_count; i++) {
+            scratch[i] = tree->nodes[entries[i].id];
+        }
+        memcpy(&tree->nodes[level_begin], scratch, (size_t)level_count * sizeof(RtreeNode));
+        free(scratch);
+
+        uint32_t next_begin = tree->node_count;
+        for (uint32_t i = 0; i < level_count; i += RTREE_FANOUT) {
+            RtreeNode *node = &tree->nodes[tree->node_count++];
+            node->first_child = level_begin + i;
+            node->child_count = (uint16_t)((level_count - i < RTREE_FANOUT) ? level_count - i : RTREE_FANOUT);
+            node->is_leaf = 0;
+            node->bbox = tree->nodes[level_begin + i].bbox;
+            for (uint32_t c = 1; c < node->child_count; c++) {
+                BBoxUnion(&node->bbox, &tree->nodes[level_begin + i + c].bbox);
+            }
+        }
+        level_begin = next_begin;
+    }
+
+    tree->root = tree->node_count - 1;
+    free(entries);
+    return true;
+}
+
+void Rtree_Query(const Rtree *tree, const GdsBBox *boxes, const GdsBBox *query,
+                 RtreeVisitor visitor, void *ctx) {
+    if (tree->node_count == 0) {
+        return;
+    }
+    // Depth is log16(n); 64 levels of RTREE_FANOUT children is far beyond any layout
+    uint32_t stack[64 * RTREE_FANOUT];
+    uint32_t depth = 0;
+    stack[depth++] = tree->root;
+
+    while (depth > 0) {
+        const RtreeNode *node = &tree->nodes[stack[--depth]];
+        if (!BBoxTouches(&node->bbox, query)) {
+            continue;
+        }
+        for (uint32_t c = 0; c < node->child_count; c++) {
+            if (node->is_leaf) {
+                uint32_t item = tree->items[node->first_child + c];
+                if (BBoxTouches(&boxes[item], query) && !visitor(item, ctx)) {
+                    return;
+                }
+            } else {
+                stack[depth++] = node->first_child + c;
+            }
+        }
+    }
+}
+
+void Rtree_Free(Rtree *tree) {
+    free(tree->nodes);
+    free(tree->items);
+    memset(tree, 0, sizeof(*tree));
+}
@@ -0,0 +1,76 @@
+/**
+ * @file rtree.h
+ * @brief Static packed R-tree over layout bounding boxes.
+ *
+ * The tree is bulk-loaded once with Sort-Tile-Recursive packing and is then
+ * read-only, which makes concurrent queries from several threads safe
+ * without locking. Nodes are stored in one flat array, level by level, so
+ * a query touches contiguous memory.
+ */
+
+#ifndef RTREE_H
+#define RTREE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gdsii.h"
+
+#define RTREE_FANOUT                16
+
+/**
+ * @brief A node in the packed tree. Leaves reference items, inner nodes reference nodes.
+ */
+typedef struct {
+    GdsBBox  bbox;
+    uint32_t first_child;   // Index into items (leaf) or nodes (inner)
+    uint16_t child_count;
+    uint16_t is_leaf;
+} RtreeNode;
+
+/**
+ * @brief The packed R-tree.
+ */
+typedef struct {
+    RtreeNode *nodes;
+    uint32_t   node_count;
+    uint32_t   root;
+    uint32_t  *items;       // Caller item ids, in leaf order
+    uint32_t   item_count;
+} Rtree;
+
+/**
+ * @brief Query callback. Return false to stop the query early.
+ */
+typedef bool (*RtreeVisitor)(uint32_t item, void *ctx);
+
+/**
+ * @brief Bulk-loads a tree from an array of bounding boxes.
+ *
+ * Item i in the tree refers to boxes[i]; the boxes array must outlive the tree.
+ *
+ * @param tree  Tree to build. Must be zero-initialized or freed.
+ * @param boxes Bounding boxes to index.
+ * @param count Number of boxes.
+ * @return True on success, false on allocation failure.
+ */
+bool Rtree_Build(Rtree *tree, const GdsBBox *boxes, uint32_t count);
+
+/**
+ * @brief Visits every item whose box touches or overlaps the query box.
+ *
+ * @param tree    The tree to query.
+ * @param boxes   The boxes array the tree was built from.
+ * @param query   The query box (edges are inclusive).
+ * @param visitor Called once per hit.
+ * @param ctx     Opaque pointer passed to the visitor.
+ */
+void Rtree_Query(const Rtree *tree, const GdsBBox *boxes, const GdsBBox *query,
+                 RtreeVisitor visitor, void *ctx);
+
+/**
+ * @brief Releases the tree's memory.
+ */
+void Rtree_Free(Rtree *tree);
+
+#endif // RTREE_H
@@ -15,6 +15,20 @@
 #include <stdint.h> // Standard integer types (e.g., uint32_t)
 #include <stdbool.h> // Boolean type (e.g., bool)
 
+#include "constraint_sweeper.h" // Periodic health checks
+#include "constraints.h"
+#include "crc32.h"   // Verifies the RAM code copy
+#include "cycle_counter.h"
+#include "fault_log.h"
+#include "cert_cache.h" // Verified certificate links, wiped on tamper
+#include "log.h"     // Runtime log levels
+#include "precompute_pool.h" // Signing nonces and blinding, built in idle time
+#include "ramfunc.h" // RAMFUNC section and its linker symbols
+#include "runtime_config.h"
+#include "secure_trace.h" // Sealed from the superloop once keyed
+#include "tamper_monitor.h" // Glitch detectors, interrupt driven
+#include "zeroize.h"        // Registry of key material wiped on tamper
+
 // --- Include ASIC-Specific Header Files ---
 // These headers would define functions for initializing hardware,
 // handling peripherals, and containing your core application logic.
@@ -30,6 +44,62 @@ static void SystemManager();
 static void HardwareManager();
 static void ApplicationManager();
 
+// --- Health Checks ---
+// Checks share a fixed slice of every superloop pass (see constraint_sweeper.h)
+#define HEALTH_SWEEP_BUDGET_CYCLES  2000U
+#define HEALTH_PERIOD_COMM_BUFFER   (CYCLE_COUNTER_HZ / 200U)   // 5 ms
+
+static ConstraintSweeper HealthSweeper;
+
+// --- Idle Precomputation ---
+// Spare time at the end of each pass fills the signing pool (see
+// precompute_pool.h). Nothing seeds it yet: the part has no entropy source
+// (no TRNG in design/registers/asic_regs.json), and a fixed seed would make
+// every nonce predictable. Until one lands, PrecomputePool_Init is never
+// called, the pool stays inactive on target and PrecomputePool_Idle
+// returns at once.
+#define PRECOMPUTE_IDLE_BUDGET_CYCLES   (CYCLE_COUNTER_HZ / 1000U)  // 1 ms
+
+// --- Tamper Response ---
+// Runs from the debounce timer interrupt (see tamper_monitor.h): seal the
+// trace with a TAMPER record while its key still exists, then wipe the
+// registered key material and nothing else, so the response stays bounded.
+static void TamperResponseHandler(uint32_t sensors, void *ctx) {
+    (void)ctx;
+    SecureTrace_Tamper(sensors);
+    Zeroize_All();
+    SecureTrace_Zeroize(); // Its key is gone; stop tracing
+}
+
+// --- Runtime Configuration ---
+static uint32_t SeenDebugVersion;   // Debug section version the log levels were taken from
+
+#if RAMFUNC_ENABLED
+/**
+ * @brief Copies the .ramfunc section from flash to RAM and verifies it.
+ *
+ * Runs before anything in .ramfunc may be called. The CRC-32 of the RAM
+ * copy is compared with that of the flash image, which catches bus faults
+ * and bad RAM cells before code runs from them. The CRC routine itself
+ * executes from flash.
+ *
+ * @return True if the copy matches the flash image.
+ */
+static bool RamFuncCopy(void) {
+    const uint32_t *src = __ramfunc_load_start;
+    uint32_t *dst = __ramfunc_start;
+    uint32_t bytes = (uint32_t)((uintptr_t)__ramfunc_end - (uintptr_t)__ramfunc_start);
+    for (uint32_t i = 0; i < bytes / sizeof(uint32_t); i++) {
+        dst[i] = src[i];
+    }
+    // The copied words are instructions: complete the writes, then refetch
+    __asm volatile("dsb\n\tisb" ::: "memory");
+
+    uint32_t expected = Crc32_Update(CRC32_INIT, src, bytes);
+    return Crc32_Update(CRC32_INIT, dst, bytes) == expected;
+}
+#endif
+
 /**
  * @brief Initializes the core system clock and power management.
  *
@@ -40,6 +110,15 @@ static void ApplicationManager();
  * @return true if system initialization is successful, false otherwise.
  */
 static void SystemManager() {
+#if RAMFUNC_ENABLED
+    // Hot kernels run from RAM (see hal/ramfunc.h). Nothing in .ramfunc may
+    // be called before this; a bad copy is not safe to execute, so halt.
+    if (!RamFuncCopy()) {
+        while (1) {
+        }
+    }
+#endif
+
     // Placeholder for actual system clock and power initialization.
     // Example:
     // system_clock_config(SYS_CLK_FREQ_MHZ);
@@ -80,6 +159,26 @@ static void HardwareManager() {
     //
     // For demonstration:
     // printf("HardwareManager: All hardware peripherals initialized.\n");
+
+    // Log levels follow the active image; the superloop applies them
+    RuntimeConfig_Init();
+    FaultLog_Init();
+
+    // Glitch detectors interrupt on their own; the superloop does not poll them.
+    // The target has no detectors yet (see hal/tamper.h): this arms nothing
+    // there, TamperMonitor_Armed() stays false and keys are not wiped on tamper.
+    TamperMonitor_Init(TAMPER_MONITOR_DEBOUNCE_TICKS, TamperResponseHandler, NULL);
+
+    // Peer chains skip signatures already verified since the last wipe
+    CertCache_Init();
+
+    // The traffic anomaly detector (ml/anomaly_detector.h) is not started: its
+    // model still has placeholder weights and no crypto sessions feed it yet.
+
+    // Periodic resource health checks, run from the superloop
+    CycleCounter_Init();
+    ConstraintSweeper_Init(&HealthSweeper, HEALTH_SWEEP_BUDGET_CYCLES);
+    ConstraintSweeper_RegisterResource(&HealthSweeper, CONSTRAINT_ID_COMM_BUFFER_FULL, HEALTH_PERIOD_COMM_BUFFER);
 }
 
 /**
@@ -113,6 +212,21 @@ static void ApplicationManager() {
     // For demonstration:
     // printf("ApplicationManager: Executing application tasks.\n");
     // (In a real system, you wouldn't typically print inside a tight loop)
+
+    if (RuntimeConfig_SectionChanged(RUNTIME_CONFIG_SECTION_DEBUG, &SeenDebugVersion)) {
+        Log_SetLevel(LOG_MODULE_ALL, RuntimeConfig_Get()->debug.default_log_level);
+    }
+
+    // Due health checks, within a fixed slice of this pass
+    uint32_t now = CycleCounter_Read();
+    ConstraintSweeper_Run(&HealthSweeper, now);
+    ConstraintsManager_PollViolationLog(now);
+    FaultLog_Poll(now);
+    TamperMonitor_Poll();
+    SecureTrace_Poll();
+
+    // Whatever is left of the pass is idle: precompute signing material
+    PrecomputePool_Idle(PRECOMPUTE_IDLE_BUDGET_CYCLES);
 }
 
 /**
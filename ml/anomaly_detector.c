@@ -0,0 +1,68 @@
+/**
+ * @file anomaly_detector.c
+ * @brief Implementation of the anomaly detector glue.
+ */
+
+#include "anomaly_detector.h"
+#include "anomaly_model.h"
+#include "constraints.h"
+#include "cycle_counter.h"
+
+#include <string.h>
+
+_Static_assert(ANOMALY_FEATURE_COUNT == ANOMALY_MODEL_FEATURES, "feature vector must match model input");
+_Static_assert(ANOMALY_FEATURE_HISTORY == ANOMALY_MODEL_WINDOW, "feature window must match model input");
+_Static_assert(ANOMALY_MODEL_INPUT_BYTES == ANOMALY_FEATURE_HISTORY * ANOMALY_FEATURE_COUNT,
+               "planned input tensor must hold one feature window");
+
+// --- Private Helper Functions ---
+
+static void ClassifyHandler(void *ctx, uint32_t session_id, const int8_t *window) {
+    AnomalyDetector *det = (AnomalyDetector *)ctx;
+    memcpy(MlRuntime_Input(&det->runtime), window, ANOMALY_MODEL_INPUT_BYTES);
+    if (!MlRuntime_Invoke(&det->runtime)) {
+        return;
+    }
+    det->inferences++;
+
+    const int8_t *logits = MlRuntime_Output(&det->runtime);
+    if (logits[1] > logits[0]) {
+        det->detections++;
+        det->last_flagged_session = session_id;
+        ConstraintsManager_ReportViolationFmt(CONSTRAINT_ID_TRAFFIC_ANOMALY, "Traffic anomaly on session %lu.",
+                                              (unsigned long)session_id);
+    }
+}
+
+static void ViolationHandler(uint32_t constraint_id, void *ctx) {
+    AnomalyDetector *det = (AnomalyDetector *)ctx;
+    // Our own detections must not feed back into the features
+    if (constraint_id != CONSTRAINT_ID_TRAFFIC_ANOMALY) {
+        AnomalyFeatures_RecordViolation(&det->features, constraint_id, CycleCounter_Read());
+    }
+}
+
+// --- Public Function Implementations ---
+
+bool AnomalyDetector_Init(AnomalyDetector *det, const AnomalyFeaturesConfig *config,
+                          uint8_t *arena, uint32_t arena_size, uint32_t now) {
+    det->inferences = 0;
+    det->detections = 0;
+    det->last_flagged_session = 0;
+    if (!ANOMALY_MODEL_TRAINED) {
+        return false; // Placeholder weights flag traffic at random
+    }
+    if (!MlRuntime_Init(&det->runtime, &AnomalyModel, arena, arena_size)) {
+        return false;
+    }
+    if (!AnomalyFeatures_Init(&det->features, config, now, ClassifyHandler, det)) {
+        return false;
+    }
+    ConstraintsManager_SetViolationObserver(ViolationHandler, det);
+    return true;
+}
+
+void AnomalyDetector_Shutdown(AnomalyDetector *det) {
+    (void)det;
+    ConstraintsManager_SetViolationObserver(NULL, NULL);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file anomaly_detector.h
+ * @brief Connects the anomaly feature extractor to the inference runtime.
+ *
+ * Every full feature window is run through AnomalyModel. When the anomalous
+ * logit wins, the detector raises CONSTRAINT_ID_TRAFFIC_ANOMALY. The
+ * detector also registers itself as the constraints violation observer, so
+ * violations feed the system-wide feature.
+ *
+ * Inactive until a trained model lands. AnomalyModel still has placeholder
+ * weights (ANOMALY_MODEL_TRAINED is 0), and their verdicts would raise
+ * violations at random, so AnomalyDetector_Init fails and main.c does not
+ * call it. Nothing feeds AnomalyFeatures_RecordCryptoJob yet either; the
+ * firmware has no crypto session layer. The bench drives the extractor
+ * and the runtime on their own.
+ */
+
+#ifndef ANOMALY_DETECTOR_H
+#define ANOMALY_DETECTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "anomaly_features.h"
+#include "ml_runtime.h"
+
+typedef struct {
+    AnomalyFeatures features;
+    MlRuntime       runtime;
+    uint32_t        inferences;
+    uint32_t        detections;
+    uint32_t        last_flagged_session;
+} AnomalyDetector;
+
+/**
+ * @brief Initializes features and model and hooks the constraints module.
+ *
+ * @param arena      Arena for AnomalyModel, at least ANOMALY_MODEL_ARENA_BYTES.
+ * @param now        Current CycleCounter reading.
+ * @return True on success; false if the model is untrained or does not fit.
+ */
+bool AnomalyDetector_Init(AnomalyDetector *det, const AnomalyFeaturesConfig *config,
+                          uint8_t *arena, uint32_t arena_size, uint32_t now);
+
+/**
+ * @brief Unhooks the detector from the constraints module.
+ */
+void AnomalyDetector_Shutdown(AnomalyDetector *det);
+
+#endif // ANOMALY_DETECTOR_H
@@ -0,0 +1,299 @@
+/**
+ * @file anomaly_features.c
+ * @brief Implementation of the streaming anomaly feature extractor.
+ */
+
+#include "anomaly_features.h"
+#include "cycle_counter.h"
+
+#include <string.h>
+
+// --- Private Defines and Constants ---
+#define FEATURE_ZERO_POINT          (-128)
+#define EWMA_MAX_DIFF               (1ULL << 27)    // Keeps diff^2 in Q8 within 64 bits
+
+// --- Private Helper Functions ---
+
+/**
+ * @brief Maps 0..2^31 onto 0..255 as 8 * log2 with three fractional bits.
+ */
+static uint8_t LogScale(uint64_t x) {
+    if (x == 0) {
+        return 0;
+    }
+    uint32_t n = 0;
+    while ((x >> n) > 1) {
+        n++;
+    }
+    uint32_t frac = (uint32_t)((n >= 3) ? (x >> (n - 3)) : (x << (3 - n))) & 0x7;
+    uint32_t scaled = 8 * (n + 1) + frac;
+    return (uint8_t)(scaled > 255 ? 255 : scaled);
+}
+
+static uint64_t ISqrt(uint64_t x) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+static int8_t ToFeature(uint32_t value) {
+    return (int8_t)((value > 255 ? 255 : (int32_t)value) + FEATURE_ZERO_POINT);
+}
+
+static void EwmaInit(AnomalyEwma *e, uint32_t x) {
+    e->mean_q8 = (int64_t)x << 8;
+    e->var_q8 = 0;
+}
+
+static void EwmaUpdate(AnomalyEwma *e, uint32_t x, uint8_t shift) {
+    int64_t diff = ((int64_t)x << 8) - e->mean_q8;
+    e->mean_q8 += diff / (1LL << shift);
+
+    // var += a * (diff^2 - var), the usual incremental EW variance
+    uint64_t d = (uint64_t)(diff < 0 ? -diff : diff) >> 8;
+    if (d > EWMA_MAX_DIFF) {
+        d = EWMA_MAX_DIFF;
+    }
+    uint64_t sq_q8 = (d * d) << 8;
+    e->var_q8 = e->var_q8 - (e->var_q8 >> shift) + (sq_q8 >> shift);
+}
+
+static uint8_t EwmaMeanFeature(const AnomalyEwma *e) {
+    return LogScale((uint64_t)(e->mean_q8 < 0 ? 0 : e->mean_q8) >> 8);
+}
+
+static uint8_t EwmaStddevFeature(const AnomalyEwma *e) {
+    return LogScale(ISqrt(e->var_q8) >> 4);
+}
+
+static void WindowReset(AnomalyWindow *w, uint32_t now) {
+    memset(w, 0, sizeof(*w));
+    w->bucket_start = now;
+}
+
+/**
+ * @brief Rotates expired buckets out of the window, O(buckets) worst case.
+ */
+static void WindowAdvance(AnomalyWindow *w, uint32_t bucket_ticks, uint32_t now) {
+    uint32_t elapsed = now - w->bucket_start;
+    if (elapsed < bucket_ticks) {
+        return;
+    }
+    uint32_t steps = elapsed / bucket_ticks;
+    if (steps >= ANOMALY_WINDOW_BUCKETS) {
+        uint8_t head = w->head;
+        WindowReset(w, now - elapsed % bucket_ticks);
+        w->head = head;
+        return;
+    }
+    for (uint32_t s = 0; s < steps; s++) {
+        w->head = (uint8_t)((w->head + 1) % ANOMALY_WINDOW_BUCKETS);
+        for (uint32_t c = 0; c < ANOMALY_COUNTER_COUNT; c++) {
+            w->sums[c] -= w->buckets[w->head][c];
+            w->buckets[w->head][c] = 0;
+        }
+    }
+    w->bucket_start += steps * bucket_ticks;
+}
+
+static void WindowCount(AnomalyWindow *w, uint32_t counter) {
+    if (w->buckets[w->head][counter] != UINT16_MAX) {
+        w->buckets[w->head][counter]++;
+        w->sums[counter]++;
+    }
+}
+
+static AnomalySession *FindSession(AnomalyFeatures *fx, uint32_t session_id, uint32_t now) {
+    AnomalySession *victim = NULL;
+    for (uint32_t i = 0; i < ANOMALY_MAX_SESSIONS; i++) {
+        AnomalySession *s = &fx->sessions[i];
+        if (s->active && s->session_id == session_id) {
+            return s;
+        }
+        if (!s->active) {
+            if (victim == NULL || victim->active) {
+                victim = s;
+            }
+        } else if (victim == NULL ||
+                   (victim->active && now - s->last_activity_tick > now - victim->last_activity_tick)) {
+            victim = s;
+        }
+    }
+
+    if (victim->active) {
+        fx->sessions_evicted++;
+    }
+    memset(victim, 0, sizeof(*victim));
+    victim->session_id = session_id;
+    victim->active = true;
+    victim->last_activity_tick = now;
+    WindowReset(&victim->window, now);
+    return victim;
+}
+
+static void BuildVector(const AnomalyFeatures *fx, const AnomalySession *s, int8_t *out) {
+    const uint32_t *sums = s->window.sums;
+    uint32_t jobs = sums[ANOMALY_COUNTER_JOBS];
+
+    out[ANOMALY_F_JOBS] = ToFeature(LogScale(jobs));
+    out[ANOMALY_F_TAG_FAILS] = ToFeature(LogScale(sums[ANOMALY_COUNTER_TAG_FAILS]));
+    out[ANOMALY_F_REPLAYS] = ToFeature(LogScale(sums[ANOMALY_COUNTER_REPLAYS]));
+    out[ANOMALY_F_ERRORS] = ToFeature(LogScale(sums[ANOMALY_COUNTER_ERRORS]));
+    out[ANOMALY_F_TAG_FAIL_RATIO] = ToFeature(jobs ? sums[ANOMALY_COUNTER_TAG_FAILS] * 255U / jobs : 0);
+    out[ANOMALY_F_REPLAY_RATIO] = ToFeature(jobs ? sums[ANOMALY_COUNTER_REPLAYS] * 255U / jobs : 0);
+    out[ANOMALY_F_BYTES_MEAN] = ToFeature(EwmaMeanFeature(&s->bytes));
+    out[ANOMALY_F_BYTES_STDDEV] = ToFeature(EwmaStddevFeature(&s->bytes));
+    out[ANOMALY_F_GAP_MEAN] = ToFeature(EwmaMeanFeature(&s->gap));
+    out[ANOMALY_F_GAP_STDDEV] = ToFeature(EwmaStddevFeature(&s->gap));
+    out[ANOMALY_F_LATENCY_MEAN] = ToFeature(EwmaMeanFeature(&s->latency));
+    out[ANOMALY_F_LATENCY_STDDEV] = ToFeature(EwmaStddevFeature(&s->latency));
+    out[ANOMALY_F_VIOLATIONS] = ToFeature(LogScale(fx->system.sums[ANOMALY_COUNTER_VIOLATIONS]));
+
+    uint32_t burst = 0;
+    for (uint32_t b = 0; b < ANOMALY_WINDOW_BUCKETS; b++) {
+        const uint16_t *bucket = s->window.buckets[b];
+        uint32_t fails = (uint32_t)bucket[ANOMALY_COUNTER_TAG_FAILS] +
+                         bucket[ANOMALY_COUNTER_REPLAYS] + bucket[ANOMALY_COUNTER_ERRORS];
+        if (fails > burst) {
+            burst = fails;
+        }
+    }
+    out[ANOMALY_F_FAIL_BURST] = ToFeature(LogScale(burst));
+
+    // The head bucket is still filling, so compare the last complete one
+    uint32_t prev = (s->window.head + ANOMALY_WINDOW_BUCKETS - 1) % ANOMALY_WINDOW_BUCKETS;
+    uint32_t recent = s->window.buckets[prev][ANOMALY_COUNTER_JOBS];
+    out[ANOMALY_F_RATE_TREND] = ToFeature(jobs ? recent * ANOMALY_WINDOW_BUCKETS * 128U / jobs : 128);
+
+    out[ANOMALY_F_SESSION_AGE] = ToFeature(s->periods);
+}
+
+static void EmitSession(AnomalyFeatures *fx, AnomalySession *s) {
+    BuildVector(fx, s, s->history[s->history_head]);
+    s->history_head = (uint8_t)((s->history_head + 1) % ANOMALY_FEATURE_HISTORY);
+    if (s->history_count < ANOMALY_FEATURE_HISTORY) {
+        s->history_count++;
+    }
+    if (s->periods < UINT16_MAX) {
+        s->periods++;
+    }
+    fx->vectors_emitted++;
+
+    if (s->history_count == ANOMALY_FEATURE_HISTORY && fx->classifier != NULL) {
+        // history_head now points at the oldest vector
+        int8_t window[ANOMALY_FEATURE_HISTORY][ANOMALY_FEATURE_COUNT];
+        uint32_t first = ANOMALY_FEATURE_HISTORY - s->history_head;
+        memcpy(window[0], s->history[s->history_head], first * ANOMALY_FEATURE_COUNT);
+        memcpy(window[first], s->history[0], (size_t)s->history_head * ANOMALY_FEATURE_COUNT);
+        fx->classifier(fx->classifier_ctx, s->session_id, &window[0][0]);
+        fx->windows_classified++;
+    }
+}
+
+// --- Public Function Implementations ---
+
+void AnomalyFeatures_DefaultConfig(AnomalyFeaturesConfig *config) {
+    config->cadence_ticks = CYCLE_COUNTER_HZ / 10;
+    config->window_ticks = CYCLE_COUNTER_HZ;
+    config->ewma_shift = 4;
+}
+
+bool AnomalyFeatures_Init(AnomalyFeatures *fx, const AnomalyFeaturesConfig *config, uint32_t now,
+                          AnomalyClassifierFn classifier, void *classifier_ctx) {
+    memset(fx, 0, sizeof(*fx));
+    if (config->cadence_ticks == 0 || config->window_ticks < ANOMALY_WINDOW_BUCKETS ||
+        config->ewma_shift == 0 || config->ewma_shift > 16) {
+        return false;
+    }
+    fx->config = *config;
+    fx->bucket_ticks = config->window_ticks / ANOMALY_WINDOW_BUCKETS;
+    fx->last_emit_tick = now;
+    fx->classifier = classifier;
+    fx->classifier_ctx = classifier_ctx;
+    WindowReset(&fx->system, now);
+    return true;
+}
+
+void AnomalyFeatures_RecordCryptoJob(AnomalyFeatures *fx, uint32_t session_id, uint8_t outcome,
+                                     uint32_t bytes, uint32_t latency_ticks, uint32_t now) {
+    AnomalySession *s = FindSession(fx, session_id, now);
+    WindowAdvance(&s->window, fx->bucket_ticks, now);
+
+    WindowCount(&s->window, ANOMALY_COUNTER_JOBS);
+    switch (outcome) {
+        case ANOMALY_JOB_OK:
+            break;
+        case ANOMALY_JOB_TAG_FAIL:
+            WindowCount(&s->window, ANOMALY_COUNTER_TAG_FAILS);
+            break;
+        case ANOMALY_JOB_REPLAY:
+            WindowCount(&s->window, ANOMALY_COUNTER_REPLAYS);
+            break;
+        default:
+            WindowCount(&s->window, ANOMALY_COUNTER_ERRORS);
+            break;
+    }
+
+    uint8_t shift = fx->config.ewma_shift;
+    if (s->job_samples == 0) {
+        EwmaInit(&s->bytes, bytes);
+        EwmaInit(&s->latency, latency_ticks);
+        s->job_samples = 1;
+    } else {
+        EwmaUpdate(&s->bytes, bytes, shift);
+        EwmaUpdate(&s->latency, latency_ticks, shift);
+        if (s->job_samples == 1) {
+            EwmaInit(&s->gap, now - s->last_job_tick);
+            s->job_samples = 2;
+        } else {
+            EwmaUpdate(&s->gap, now - s->last_job_tick, shift);
+        }
+    }
+    s->last_job_tick = now;
+    s->last_activity_tick = now;
+}
+
+void AnomalyFeatures_RecordViolation(AnomalyFeatures *fx, uint32_t constraint_id, uint32_t now) {
+    (void)constraint_id;
+    WindowAdvance(&fx->system, fx->bucket_ticks, now);
+    WindowCount(&fx->system, ANOMALY_COUNTER_VIOLATIONS);
+}
+
+bool AnomalyFeatures_Poll(AnomalyFeatures *fx, uint32_t now) {
+    uint32_t cadence = fx->config.cadence_ticks;
+    if (now - fx->last_emit_tick < cadence) {
+        return false;
+    }
+    fx->last_emit_tick += cadence;
+    if (now - fx->last_emit_tick >= cadence) {
+        fx->last_emit_tick = now; // Fell behind; skip the missed periods
+    }
+
+    WindowAdvance(&fx->system, fx->bucket_ticks, now);
+    uint32_t idle_limit = fx->config.window_ticks * ANOMALY_IDLE_WINDOWS;
+    for (uint32_t i = 0; i < ANOMALY_MAX_SESSIONS; i++) {
+        AnomalySession *s = &fx->sessions[i];
+        if (!s->active) {
+            continue;
+        }
+        if (now - s->last_activity_tick > idle_limit) {
+            s->active = false;
+            continue;
+        }
+        WindowAdvance(&s->window, fx->bucket_ticks, now);
+        EmitSession(fx, s);
+    }
+    return true;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file anomaly_features.h
+ * @brief Streaming feature extractor for on-device traffic anomaly detection.
+ *
+ * The crypto path reports each job outcome, and the constraints module
+ * reports each violation. Both updates are O(1) and touch only fixed-size
+ * state. For each session, the extractor keeps:
+ *  - sliding-window counters (jobs, tag failures, replay rejects and other
+ *    errors), held in a ring of time buckets with running sums;
+ *  - exponentially weighted mean and variance of job size, inter-arrival
+ *    time and job latency.
+ *
+ * Once per cadence, every active session gets a fixed-size feature vector.
+ * The vector is appended to that session's history. When the history is
+ * full, the last ANOMALY_FEATURE_HISTORY vectors are handed to the
+ * classifier callback, oldest first.
+ *
+ * Memory use is fixed by ANOMALY_MAX_SESSIONS. When the table is full, a new
+ * session evicts the one that has been idle longest. Sessions idle for
+ * ANOMALY_IDLE_WINDOWS windows are retired.
+ *
+ * Timestamps are CycleCounter ticks and must not go backwards between calls.
+ * Intervals are computed modulo 2^32, so the window length times
+ * ANOMALY_IDLE_WINDOWS must stay below 2^32 ticks.
+ */
+
+#ifndef ANOMALY_FEATURES_H
+#define ANOMALY_FEATURES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Sizing ---
+#define ANOMALY_MAX_SESSIONS        8
+#define ANOMALY_WINDOW_BUCKETS      8   // Sliding-window resolution
+#define ANOMALY_FEATURE_COUNT       16  // Matches ANOMALY_MODEL_FEATURES
+#define ANOMALY_FEATURE_HISTORY     8   // Matches ANOMALY_MODEL_WINDOW
+#define ANOMALY_IDLE_WINDOWS        4
+
+// --- Crypto Job Outcomes ---
+#define ANOMALY_JOB_OK              0x00
+#define ANOMALY_JOB_TAG_FAIL        0x01    // AEAD tag / MAC verification failed
+#define ANOMALY_JOB_REPLAY          0x02    // Nonce or sequence number rejected
+#define ANOMALY_JOB_ERROR           0x03    // Any other job failure
+
+// --- Feature Vector Layout (each entry int8, zero point -128) ---
+#define ANOMALY_F_JOBS              0   // Jobs in window
+#define ANOMALY_F_TAG_FAILS         1   // Tag failures in window
+#define ANOMALY_F_REPLAYS           2   // Replay rejects in window
+#define ANOMALY_F_ERRORS            3   // Other failures in window
+#define ANOMALY_F_TAG_FAIL_RATIO    4   // Tag failures / jobs
+#define ANOMALY_F_REPLAY_RATIO      5   // Replays / jobs
+#define ANOMALY_F_BYTES_MEAN        6   // log2 scale
+#define ANOMALY_F_BYTES_STDDEV      7
+#define ANOMALY_F_GAP_MEAN          8   // Inter-arrival ticks, log2 scale
+#define ANOMALY_F_GAP_STDDEV        9
+#define ANOMALY_F_LATENCY_MEAN      10  // Job latency ticks, log2 scale
+#define ANOMALY_F_LATENCY_STDDEV    11
+#define ANOMALY_F_VIOLATIONS        12  // System-wide constraint violations in window
+#define ANOMALY_F_FAIL_BURST        13  // Peak failures in one bucket
+#define ANOMALY_F_RATE_TREND        14  // Last full bucket vs window average, 128 = steady
+#define ANOMALY_F_SESSION_AGE       15  // Cadence periods observed, saturating
+
+// --- Public Types ---
+
+/**
+ * @brief Receives one full feature window for a session.
+ *
+ * @param ctx        Context given to AnomalyFeatures_Init.
+ * @param session_id Session the window belongs to.
+ * @param window     ANOMALY_FEATURE_HISTORY * ANOMALY_FEATURE_COUNT values,
+ *                   oldest vector first.
+ */
+typedef void (*AnomalyClassifierFn)(void *ctx, uint32_t session_id, const int8_t *window);
+
+typedef struct {
+    uint32_t cadence_ticks;     // Feature vector period
+    uint32_t window_ticks;      // Sliding-window length
+    uint8_t  ewma_shift;        // EWMA weight is 1 / 2^ewma_shift
+} AnomalyFeaturesConfig;
+
+/**
+ * @brief Exponentially weighted mean and variance, Q8 fixed point.
+ */
+typedef struct {
+    int64_t  mean_q8;
+    uint64_t var_q8;
+} AnomalyEwma;
+
+enum {
+    ANOMALY_COUNTER_JOBS,
+    ANOMALY_COUNTER_TAG_FAILS,
+    ANOMALY_COUNTER_REPLAYS,
+    ANOMALY_COUNTER_ERRORS,
+    ANOMALY_COUNTER_VIOLATIONS,
+    ANOMALY_COUNTER_COUNT
+};
+
+/**
+ * @brief Counters over the last window_ticks, in ANOMALY_WINDOW_BUCKETS buckets.
+ */
+typedef struct {
+    uint16_t buckets[ANOMALY_WINDOW_BUCKETS][ANOMALY_COUNTER_COUNT];
+    uint32_t sums[ANOMALY_COUNTER_COUNT];
+    uint32_t bucket_start;      // Tick at which the head bucket began
+    uint8_t  head;
+} AnomalyWindow;
+
+typedef struct {
+    uint32_t      session_id;
+    bool          active;
+    uint8_t       job_samples;  // Saturates at 2; the first gap needs two jobs
+    uint32_t      last_job_tick;
+    uint32_t      last_activity_tick;
+    uint16_t      periods;      // Cadence periods since the session appeared
+    AnomalyWindow window;
+    AnomalyEwma   bytes;
+    AnomalyEwma   gap;
+    AnomalyEwma   latency;
+    int8_t        history[ANOMALY_FEATURE_HISTORY][ANOMALY_FEATURE_COUNT];
+    uint8_t       history_head; // Next slot to write
+    uint8_t       history_count;
+} AnomalySession;
+
+typedef struct {
+    AnomalyFeaturesConfig config;
+    uint32_t              bucket_ticks;
+    uint32_t              last_emit_tick;
+    AnomalySession        sessions[ANOMALY_MAX_SESSIONS];
+    AnomalyWindow         system;   // Constraint violations, not tied to a session
+    AnomalyClassifierFn   classifier;
+    void                 *classifier_ctx;
+    uint32_t              vectors_emitted;
+    uint32_t              windows_classified;
+    uint32_t              sessions_evicted;
+} AnomalyFeatures;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Default cadence of 100 ms over a 1 s window, EWMA weight 1/16.
+ */
+void AnomalyFeatures_DefaultConfig(AnomalyFeaturesConfig *config);
+
+/**
+ * @brief Initializes the extractor.
+ *
+ * @return False if the configuration is unusable (zero cadence or a window
+ *         shorter than ANOMALY_WINDOW_BUCKETS ticks).
+ */
+bool AnomalyFeatures_Init(AnomalyFeatures *fx, const AnomalyFeaturesConfig *config, uint32_t now,
+                          AnomalyClassifierFn classifier, void *classifier_ctx);
+
+/**
+ * @brief Records one completed crypto job.
+ *
+ * @param outcome       One of ANOMALY_JOB_*.
+ * @param bytes         Payload length.
+ * @param latency_ticks Time the job took.
+ * @param now           Current CycleCounter reading.
+ */
+void AnomalyFeatures_RecordCryptoJob(AnomalyFeatures *fx, uint32_t session_id, uint8_t outcome,
+                                     uint32_t bytes, uint32_t latency_ticks, uint32_t now);
+
+/**
+ * @brief Records a constraint violation (system-wide feature).
+ */
+void AnomalyFeatures_RecordViolation(AnomalyFeatures *fx, uint32_t constraint_id, uint32_t now);
+
+/**
+ * @brief Emits feature vectors if a cadence period has elapsed.
+ *
+ * Call from the main loop. At most one period is emitted per call, even if
+ * several have elapsed. This bounds the time spent in the call.
+ *
+ * @return True if vectors were emitted.
+ */
+bool AnomalyFeatures_Poll(AnomalyFeatures *fx, uint32_t now);
+
+#endif // ANOMALY_FEATURES_H
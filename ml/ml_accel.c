@@ -0,0 +1,98 @@
+/**
+ * @file ml_accel.c
+ * @brief Implementation of the ml_accelerator offload backend.
+ */
+
+#include "ml_accel.h"
+#include "asic_regs.h"
+
+// --- Private Defines and Constants ---
+#define ML_ACCEL_TIMEOUT_POLLS      100000U
+#define ML_ACCEL_ABORT_POLLS        1000U
+#define ML_ACCEL_MAX_FEATURES       0xFFFFU
+
+// --- Private Helper Functions ---
+
+static uint32_t BusAddress(const void *p) {
+    return (uint32_t)(uintptr_t)p;
+}
+
+// DONE and ERROR are sticky; clear them so the next DONE belongs to our job
+static bool ClearStatus(void) {
+    AsicRegBatch status = ASIC_REG_BATCH_INIT;
+    MlaccStatus_StageDone(&status, 1);
+    MlaccStatus_StageError(&status, 1);
+    MlaccStatus_Commit(&status);
+
+    uint32_t now = MlaccStatus_Read();
+    return !MlaccStatus_GetDone(now) && !MlaccStatus_GetError(now);
+}
+
+// Stops a failed or late job before the CPU writes the same output buffer
+static void Abort(void) {
+    AsicRegBatch ctrl = ASIC_REG_BATCH_INIT;
+    MlaccCtrl_StageStart(&ctrl, 0);
+    MlaccCtrl_StageIrqEn(&ctrl, 0);
+    MlaccCtrl_StageAbort(&ctrl, 1);
+    MlaccCtrl_Commit(&ctrl);
+
+    for (uint32_t poll = 0; poll < ML_ACCEL_ABORT_POLLS; poll++) {
+        if (!MlaccStatus_GetBusy(MlaccStatus_Read())) {
+            break;
+        }
+    }
+    (void)ClearStatus();
+}
+
+// --- Public Function Implementations ---
+
+bool MlAccel_FullyConnected(const int8_t *input, const int8_t *weights, const int32_t *bias,
+                            uint32_t in_features, uint32_t out_features,
+                            const MlRequant *rq, int8_t *output) {
+    if (in_features > ML_ACCEL_MAX_FEATURES || out_features > ML_ACCEL_MAX_FEATURES) {
+        return false;
+    }
+    if (MlaccStatus_GetBusy(MlaccStatus_Read())) {
+        return false; // Another job owns the block; the CPU path is faster than waiting
+    }
+    if (!ClearStatus()) {
+        return false; // A stale DONE would pass for this job's
+    }
+
+    MlaccSrcAddr_Write(BusAddress(input));
+    MlaccWeightAddr_Write(BusAddress(weights));
+    MlaccBiasAddr_Write(BusAddress(bias));
+    MlaccDstAddr_Write(BusAddress(output));
+
+    AsicRegBatch dims = ASIC_REG_BATCH_INIT;
+    MlaccDims_StageInFeatures(&dims, in_features);
+    MlaccDims_StageOutFeatures(&dims, out_features);
+    MlaccDims_Commit(&dims);
+
+    MlaccOutMult_Write((uint32_t)rq->multiplier);
+
+    AsicRegBatch quant = ASIC_REG_BATCH_INIT;
+    MlaccQuant_StageShift(&quant, (uint8_t)rq->shift);
+    MlaccQuant_StageOutZp(&quant, (uint8_t)rq->output_zero_point);
+    MlaccQuant_StageActMin(&quant, (uint8_t)rq->activation_min);
+    MlaccQuant_StageActMax(&quant, (uint8_t)rq->activation_max);
+    MlaccQuant_Commit(&quant);
+
+    AsicRegBatch ctrl = ASIC_REG_BATCH_INIT;
+    MlaccCtrl_StageStart(&ctrl, 1);
+    MlaccCtrl_StageIrqEn(&ctrl, 0);
+    MlaccCtrl_StageAbort(&ctrl, 0);
+    MlaccCtrl_Commit(&ctrl);
+
+    for (uint32_t poll = 0; poll < ML_ACCEL_TIMEOUT_POLLS; poll++) {
+        uint32_t status = MlaccStatus_Read();
+        if (MlaccStatus_GetError(status)) {
+            break;
+        }
+        if (MlaccStatus_GetDone(status)) {
+            return true;
+        }
+    }
+    Abort();
+    return false;
+}
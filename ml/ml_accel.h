@@ -0,0 +1,35 @@
+/**
+ * @file ml_accel.h
+ * @brief Offload backend for the ml_accelerator block.
+ *
+ * Programs one fully-connected job through the MLACC registers (see
+ * design/registers/asic_regs.json) and waits for completion. The buffers
+ * must live in bus-addressable RAM or flash; the accelerator reads weights
+ * and bias directly and writes the output activations itself.
+ *
+ * STATUS.DONE and STATUS.ERROR are sticky. They are cleared before each
+ * job, so a DONE left by an earlier job is never taken for this one. A job
+ * that reports an error or times out is aborted before returning, so the
+ * block cannot write the output buffer while the CPU fallback fills it.
+ */
+
+#ifndef ML_ACCEL_H
+#define ML_ACCEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ml_kernels.h"
+
+/**
+ * @brief Runs a fully-connected layer on the accelerator.
+ *
+ * @return True if the job completed; false if the block was busy, or on
+ *         error or timeout, in which case the job has been aborted and the
+ *         caller should run the layer on the CPU.
+ */
+bool MlAccel_FullyConnected(const int8_t *input, const int8_t *weights, const int32_t *bias,
+                            uint32_t in_features, uint32_t out_features,
+                            const MlRequant *rq, int8_t *output);
+
+#endif // ML_ACCEL_H
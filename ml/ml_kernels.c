@@ -0,0 +1,201 @@
+/**
+ * @file ml_kernels.c
+ * @brief Implementation of the int8 neural-network kernels.
+ */
+
+#include "ml_kernels.h"
+#include "ramfunc.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && defined(__ARM_FEATURE_SIMD32)
+#define ML_KERNEL_SMLAD
+#include <arm_acle.h>
+#elif defined(__AVXVNNI__) || (defined(__AVX512VNNI__) && defined(__AVX512VL__))
+#define ML_KERNEL_VNNI
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define ML_KERNEL_AVX2
+#include <immintrin.h>
+#endif
+
+// --- Dot Product Backends ---
+
+#if defined(ML_KERNEL_SMLAD)
+
+const char *MlKernel_BackendName(void) {
+    return "cortex-m4 smlad";
+}
+
+RAMFUNC int32_t MlKernel_DotS8(const int8_t *a, const int8_t *b, uint32_t n) {
+    int32_t acc = 0;
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t va, vb;
+        memcpy(&va, a + i, sizeof(va)); // Unaligned-safe, compiles to LDR on M4
+        memcpy(&vb, b + i, sizeof(vb));
+        // SXTB16 widens bytes 0 and 2; rotating by 8 first picks bytes 1 and 3
+        int16x2_t a_even = __sxtb16(va);
+        int16x2_t a_odd = __sxtb16(__ror((uint32_t)va, 8));
+        int16x2_t b_even = __sxtb16(vb);
+        int16x2_t b_odd = __sxtb16(__ror((uint32_t)vb, 8));
+        acc = __smlad(a_even, b_even, acc);
+        acc = __smlad(a_odd, b_odd, acc);
+    }
+    for (; i < n; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return acc;
+}
+
+#elif defined(ML_KERNEL_VNNI)
+
+#if defined(__AVXVNNI__)
+#define ML_DPBUSD(acc, u, s)        _mm256_dpbusd_avx_epi32((acc), (u), (s))
+#else
+#define ML_DPBUSD(acc, u, s)        _mm256_dpbusd_epi32((acc), (u), (s))
+#endif
+
+const char *MlKernel_BackendName(void) {
+    return "avx-vnni";
+}
+
+static int32_t HorizontalSum(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+RAMFUNC int32_t MlKernel_DotS8(const int8_t *a, const int8_t *b, uint32_t n) {
+    // VPDPBUSD multiplies unsigned by signed bytes. Flipping the sign bit maps
+    // a to a + 128; the extra 128 * sum(b) is accumulated separately and removed.
+    const __m256i sign = _mm256_set1_epi8((char)0x80);
+    const __m256i ones = _mm256_set1_epi8(1);
+    __m256i acc = _mm256_setzero_si256();
+    __m256i bsum = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i)), sign);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        acc = ML_DPBUSD(acc, va, vb);
+        bsum = ML_DPBUSD(bsum, ones, vb);
+    }
+    // Layers are often 16 channels wide; take a half-width AVX2 step before the scalar tail
+    for (; i + 16 <= n; i += 16) {
+        __m256i wa = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i wb = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + i)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(wa, wb));
+    }
+    int32_t total = HorizontalSum(acc) - 128 * HorizontalSum(bsum);
+    for (; i < n; i++) {
+        total += (int32_t)a[i] * b[i];
+    }
+    return total;
+}
+
+#elif defined(ML_KERNEL_AVX2)
+
+const char *MlKernel_BackendName(void) {
+    return "avx2";
+}
+
+static int32_t HorizontalSum(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+RAMFUNC int32_t MlKernel_DotS8(const int8_t *a, const int8_t *b, uint32_t n) {
+    // Widening to int16 before VPMADDWD avoids the saturation of VPMADDUBSW
+    __m256i acc = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i va = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i vb = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + i)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(va, vb));
+    }
+    int32_t total = HorizontalSum(acc);
+    for (; i < n; i++) {
+        total += (int32_t)a[i] * b[i];
+    }
+    return total;
+}
+
+#else
+
+const char *MlKernel_BackendName(void) {
+    return "portable";
+}
+
+RAMFUNC int32_t MlKernel_DotS8(const int8_t *a, const int8_t *b, uint32_t n) {
+    int32_t acc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return acc;
+}
+
+#endif
+
+// --- Requantization ---
+
+RAMFUNC int8_t MlKernel_Requantize(int32_t acc, const MlRequant *rq) {
+    int left = rq->shift < 0 ? -rq->shift : 0;
+    int right = rq->shift > 0 ? rq->shift : 0;
+
+    // Rounding doubling high multiply (Q31)
+    int64_t product = ((int64_t)acc * (1LL << left)) * rq->multiplier;
+    int32_t scaled = (int32_t)((product + (1LL << 30)) >> 31);
+
+    // Rounding arithmetic right shift, ties away from zero
+    if (right > 0) {
+        int32_t mask = (int32_t)((1UL << right) - 1);
+        int32_t remainder = scaled & mask;
+        int32_t threshold = (mask >> 1) + (scaled < 0 ? 1 : 0);
+        scaled = (scaled >> right) + (remainder > threshold ? 1 : 0);
+    }
+
+    int32_t out = scaled + rq->output_zero_point;
+    if (out < rq->activation_min) out = rq->activation_min;
+    if (out > rq->activation_max) out = rq->activation_max;
+    return (int8_t)out;
+}
+
+// --- Layers ---
+
+RAMFUNC void MlKernel_FullyConnected(const int8_t *input, const int8_t *weights, const int32_t *bias,
+                                     uint32_t in_features, uint32_t out_features,
+                                     const MlRequant *rq, int8_t *output) {
+    for (uint32_t o = 0; o < out_features; o++) {
+        int32_t acc = bias[o] + MlKernel_DotS8(input, weights + (size_t)o * in_features, in_features);
+        output[o] = MlKernel_Requantize(acc, rq);
+    }
+}
+
+RAMFUNC void MlKernel_Conv2d(const int8_t *input, uint32_t in_h, uint32_t in_w, uint32_t in_c,
+                             const int8_t *filters, const int32_t *bias,
+                             uint32_t kernel_h, uint32_t kernel_w, uint32_t out_c,
+                             uint32_t stride_h, uint32_t stride_w,
+                             const MlRequant *rq, int8_t *output) {
+    uint32_t out_h = (in_h - kernel_h) / stride_h + 1;
+    uint32_t out_w = (in_w - kernel_w) / stride_w + 1;
+    // In NHWC, kernel_w neighbouring pixels form one contiguous run of kernel_w * in_c bytes
+    uint32_t run = kernel_w * in_c;
+    uint32_t filter_size = kernel_h * run;
+
+    for (uint32_t oy = 0; oy < out_h; oy++) {
+        for (uint32_t ox = 0; ox < out_w; ox++) {
+            const int8_t *patch = input + ((size_t)(oy * stride_h) * in_w + ox * stride_w) * in_c;
+            for (uint32_t oc = 0; oc < out_c; oc++) {
+                const int8_t *filter = filters + (size_t)oc * filter_size;
+                int32_t acc = bias[oc];
+                for (uint32_t ky = 0; ky < kernel_h; ky++) {
+                    acc += MlKernel_DotS8(patch + (size_t)ky * in_w * in_c, filter + (size_t)ky * run, run);
+                }
+                *output++ = MlKernel_Requantize(acc, rq);
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file ml_kernels.h
+ * @brief Int8 neural-network kernels for the inference runtime.
+ *
+ * Activations are int8 with a per-tensor zero point, weights are symmetric
+ * int8, accumulators are int32. The input zero-point contribution
+ * (-input_zp * sum(weights)) is folded into the bias when a model is
+ * exported, so the inner loops are plain int8 dot products.
+ *
+ * The dot product is selected at compile time:
+ *  - Cortex-M4 (__ARM_FEATURE_DSP): SXTB16 + SMLAD, two MACs per instruction.
+ *  - Host with AVX-VNNI or AVX512-VNNI: VPDPBUSD, 32 MACs per instruction.
+ *  - Host with AVX2: sign-extend to int16 + VPMADDWD, 16 MACs per instruction.
+ *  - Otherwise a portable C loop.
+ *
+ * On target the kernels are RAMFUNC (hal/ramfunc.h) and run from RAM.
+ */
+
+#ifndef ML_KERNELS_H
+#define ML_KERNELS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Output requantization: out = clamp(zp + (acc * multiplier) >> shift).
+ *
+ * multiplier is a Q31 fixed-point value in [0.5, 1); shift is the total right
+ * shift applied after the Q31 product (negative for a left shift).
+ */
+typedef struct {
+    int32_t multiplier;
+    int8_t  shift;
+    int8_t  output_zero_point;
+    int8_t  activation_min;
+    int8_t  activation_max;
+} MlRequant;
+
+/**
+ * @brief Name of the dot-product implementation compiled in.
+ */
+const char *MlKernel_BackendName(void);
+
+/**
+ * @brief Int8 dot product with int32 accumulation.
+ */
+int32_t MlKernel_DotS8(const int8_t *a, const int8_t *b, uint32_t n);
+
+/**
+ * @brief Applies requantization and clamping to one accumulator.
+ */
+int8_t MlKernel_Requantize(int32_t acc, const MlRequant *rq);
+
+/**
+ * @brief Fully-connected layer (GEMV): out[o] = rq(bias[o] + dot(in, weights[o])).
+ *
+ * @param input        in_features int8 activations.
+ * @param weights      Row-major [out_features][in_features].
+ * @param bias         Folded bias, out_features entries.
+ * @param in_features  Input length.
+ * @param out_features Output length.
+ * @param rq           Output requantization.
+ * @param output       out_features int8 activations.
+ */
+void MlKernel_FullyConnected(const int8_t *input, const int8_t *weights, const int32_t *bias,
+                             uint32_t in_features, uint32_t out_features,
+                             const MlRequant *rq, int8_t *output);
+
+/**
+ * @brief 2D convolution, NHWC layout, batch 1, VALID padding.
+ *
+ * Filters are [out_channels][kernel_h][kernel_w][in_channels] so each filter
+ * row is contiguous with the matching input row. VALID padding keeps every
+ * output's tap set complete, which is what makes bias folding exact.
+ */
+void MlKernel_Conv2d(const int8_t *input, uint32_t in_h, uint32_t in_w, uint32_t in_c,
+                     const int8_t *filters, const int32_t *bias,
+                     uint32_t kernel_h, uint32_t kernel_w, uint32_t out_c,
+                     uint32_t stride_h, uint32_t stride_w,
+                     const MlRequant *rq, int8_t *output);
+
+#endif // ML_KERNELS_H
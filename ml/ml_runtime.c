@@ -0,0 +1,173 @@
+/**
+ * @file ml_runtime.c
+ * @brief Implementation of the int8 inference runtime.
+ */
+
+#include "ml_runtime.h"
+#include "cycle_counter.h"
+
+#define LOG_MODULE  LOG_MODULE_ML
+#include "log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ML_BACKEND_ACCEL
+#include "ml_accel.h"
+#endif
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] ML: %s\n", level, message);
+}
+
+static uint32_t TensorElements(const MlTensor *t) {
+    return (uint32_t)t->height * t->width * t->channels;
+}
+
+static bool ValidateOp(const MlModel *model, const MlOp *op) {
+    if (op->input >= model->tensor_count || op->output >= model->tensor_count) {
+        return false;
+    }
+    const MlTensor *in = &model->tensors[op->input];
+    const MlTensor *out = &model->tensors[op->output];
+
+    switch (op->type) {
+        case ML_OP_FULLY_CONNECTED:
+            return out->height == 1 && out->width == 1;
+        case ML_OP_CONV2D:
+            if (op->stride_h == 0 || op->stride_w == 0 ||
+                op->kernel_h > in->height || op->kernel_w > in->width) {
+                return false;
+            }
+            return out->height == (in->height - op->kernel_h) / op->stride_h + 1 &&
+                   out->width == (in->width - op->kernel_w) / op->stride_w + 1;
+        default:
+            return false;
+    }
+}
+
+static void RunFullyConnected(MlRuntime *rt, const MlOp *op, const int8_t *in, int8_t *out,
+                              uint32_t in_features, uint32_t out_features) {
+#ifdef ML_BACKEND_ACCEL
+    if (MlAccel_FullyConnected(in, op->weights, op->bias, in_features, out_features,
+                               &op->requant, out)) {
+        rt->offloaded_ops++;
+        return;
+    }
+#else
+    (void)rt;
+#endif
+    MlKernel_FullyConnected(in, op->weights, op->bias, in_features, out_features, &op->requant, out);
+}
+
+static uint32_t WeightBytes(const MlModel *model) {
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < model->op_count; i++) {
+        const MlOp *op = &model->ops[i];
+        const MlTensor *in = &model->tensors[op->input];
+        const MlTensor *out = &model->tensors[op->output];
+        uint32_t taps = (op->type == ML_OP_CONV2D)
+                            ? (uint32_t)op->kernel_h * op->kernel_w * in->channels
+                            : TensorElements(in);
+        uint32_t rows = (op->type == ML_OP_CONV2D) ? out->channels : TensorElements(out);
+        total += rows * taps + rows * (uint32_t)sizeof(int32_t);
+    }
+    return total;
+}
+
+// --- Public Function Implementations ---
+
+bool MlRuntime_Init(MlRuntime *rt, const MlModel *model, uint8_t *arena, uint32_t arena_size) {
+    rt->model = model;
+    rt->arena = arena;
+    rt->arena_size = arena_size;
+    rt->offloaded_ops = 0;
+
+    if (((uintptr_t)arena % ML_ARENA_ALIGN) != 0 || model->arena_bytes > arena_size) {
+        LOG_ERROR("Arena too small or misaligned for model.");
+        return false;
+    }
+    for (uint32_t i = 0; i < model->tensor_count; i++) {
+        const MlTensor *t = &model->tensors[i];
+        if (t->size_bytes != TensorElements(t) ||
+            t->arena_offset % ML_ARENA_ALIGN != 0 ||
+            t->arena_offset + t->size_bytes > model->arena_bytes) {
+            LOG_ERROR("Tensor does not fit its planned arena slot.");
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < model->op_count; i++) {
+        if (!ValidateOp(model, &model->ops[i])) {
+            LOG_ERROR("Operator shapes are inconsistent.");
+            return false;
+        }
+    }
+    return true;
+}
+
+int8_t *MlRuntime_Input(const MlRuntime *rt) {
+    return (int8_t *)(rt->arena + rt->model->tensors[rt->model->input].arena_offset);
+}
+
+const int8_t *MlRuntime_Output(const MlRuntime *rt) {
+    return (const int8_t *)(rt->arena + rt->model->tensors[rt->model->output].arena_offset);
+}
+
+bool MlRuntime_Invoke(MlRuntime *rt) {
+    const MlModel *model = rt->model;
+    for (uint32_t i = 0; i < model->op_count; i++) {
+        const MlOp *op = &model->ops[i];
+        const MlTensor *in = &model->tensors[op->input];
+        const MlTensor *out = &model->tensors[op->output];
+        const int8_t *in_data = (const int8_t *)(rt->arena + in->arena_offset);
+        int8_t *out_data = (int8_t *)(rt->arena + out->arena_offset);
+
+        switch (op->type) {
+            case ML_OP_FULLY_CONNECTED:
+                RunFullyConnected(rt, op, in_data, out_data, TensorElements(in), TensorElements(out));
+                break;
+            case ML_OP_CONV2D:
+                MlKernel_Conv2d(in_data, in->height, in->width, in->channels,
+                                op->weights, op->bias, op->kernel_h, op->kernel_w, out->channels,
+                                op->stride_h, op->stride_w, &op->requant, out_data);
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+void MlRuntime_Benchmark(MlRuntime *rt, const int8_t *input, uint32_t iterations,
+                         MlBenchResult *result) {
+    const MlTensor *in = &rt->model->tensors[rt->model->input];
+    CycleCounter_Init();
+
+    // Time each inference separately so the sum is immune to counter wrap
+    uint64_t ticks = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        memcpy(MlRuntime_Input(rt), input, in->size_bytes);
+        uint32_t start = CycleCounter_Read();
+        MlRuntime_Invoke(rt);
+        ticks += CycleCounter_Elapsed(start);
+    }
+
+    result->iterations = iterations;
+    result->ticks = ticks;
+    result->inferences_per_second = ticks ? (double)iterations * CYCLE_COUNTER_HZ / (double)ticks : 0.0;
+    result->arena_bytes = rt->model->arena_bytes;
+    result->weight_bytes = WeightBytes(rt->model);
+}
+
+void MlRuntime_PrintReport(const MlRuntime *rt, const MlBenchResult *result) {
+    printf("[INFO] ML: model %s, backend %s%s\n", rt->model->name, MlKernel_BackendName(),
+           rt->offloaded_ops ? " + accelerator" : "");
+    printf("[INFO] ML: %lu inferences, %.1f ticks/inference, %.0f inferences/s\n",
+           (unsigned long)result->iterations,
+           result->iterations ? (double)result->ticks / result->iterations : 0.0,
+           result->inferences_per_second);
+    printf("[INFO] ML: arena %lu bytes, weights %lu bytes\n",
+           (unsigned long)result->arena_bytes, (unsigned long)result->weight_bytes);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file ml_runtime.h
+ * @brief Small int8 inference runtime with a statically planned tensor arena.
+ *
+ * A model is a constant table of tensors and operators, typically placed in
+ * flash. Every tensor has a fixed offset into a single arena that is planned
+ * when the model is built (tools/plan_arena.py), so the runtime performs no
+ * allocation and its RAM use is known at link time. Tensors whose lifetimes
+ * do not overlap share arena bytes, so the input is overwritten by an
+ * invocation and must be written again before the next one.
+ *
+ * Operators run on the CPU kernels in ml_kernels.c. When the firmware is
+ * built with ML_BACKEND_ACCEL, fully-connected layers are offloaded to the
+ * ml_accelerator block instead, falling back to the CPU if the accelerator
+ * reports an error.
+ */
+
+#ifndef ML_RUNTIME_H
+#define ML_RUNTIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ml_kernels.h"
+
+// --- Operator Types ---
+#define ML_OP_FULLY_CONNECTED       0x01
+#define ML_OP_CONV2D                0x02
+
+#define ML_ARENA_ALIGN              16  // Tensor offsets are multiples of this
+
+// --- Public Types ---
+
+/**
+ * @brief An int8 activation tensor, shape [H][W][C].
+ */
+typedef struct {
+    uint32_t arena_offset;
+    uint32_t size_bytes;
+    uint16_t height;
+    uint16_t width;
+    uint16_t channels;
+    int8_t   zero_point;
+} MlTensor;
+
+/**
+ * @brief One operator. Conv-only fields are ignored by fully-connected layers.
+ */
+typedef struct {
+    uint8_t        type;        // One of ML_OP_*
+    uint8_t        input;       // Tensor index
+    uint8_t        output;      // Tensor index
+    uint8_t        kernel_h;
+    uint8_t        kernel_w;
+    uint8_t        stride_h;
+    uint8_t        stride_w;
+    const int8_t  *weights;
+    const int32_t *bias;        // Input zero point already folded in
+    MlRequant      requant;
+} MlOp;
+
+/**
+ * @brief A complete model.
+ */
+typedef struct {
+    const char     *name;
+    const MlTensor *tensors;
+    uint32_t        tensor_count;
+    const MlOp     *ops;
+    uint32_t        op_count;
+    uint8_t         input;
+    uint8_t         output;
+    uint32_t        arena_bytes;    // Planned arena size
+} MlModel;
+
+/**
+ * @brief Runtime state bound to one model and one arena.
+ */
+typedef struct {
+    const MlModel *model;
+    uint8_t       *arena;
+    uint32_t       arena_size;
+    uint32_t       offloaded_ops;   // Ops run on the accelerator since init
+} MlRuntime;
+
+/**
+ * @brief Benchmark results.
+ */
+typedef struct {
+    uint32_t iterations;
+    uint64_t ticks;                 // CycleCounter ticks summed over all iterations
+    double   inferences_per_second;
+    uint32_t arena_bytes;
+    uint32_t weight_bytes;
+} MlBenchResult;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Binds a model to an arena and validates the plan.
+ *
+ * @param rt         Runtime to initialize.
+ * @param model      The model.
+ * @param arena      Arena buffer, ML_ARENA_ALIGN aligned.
+ * @param arena_size Arena size in bytes, at least model->arena_bytes.
+ * @return True if the model fits and its tensor shapes are consistent.
+ */
+bool MlRuntime_Init(MlRuntime *rt, const MlModel *model, uint8_t *arena, uint32_t arena_size);
+
+int8_t *MlRuntime_Input(const MlRuntime *rt);
+const int8_t *MlRuntime_Output(const MlRuntime *rt);
+
+/**
+ * @brief Runs all operators once on the current input.
+ *
+ * The input tensor is clobbered; only the output is valid afterwards.
+ *
+ * @return True on success.
+ */
+bool MlRuntime_Invoke(MlRuntime *rt);
+
+/**
+ * @brief Runs the model repeatedly and measures throughput.
+ *
+ * @param input Input tensor contents, copied in before every (untimed) run.
+ */
+void MlRuntime_Benchmark(MlRuntime *rt, const int8_t *input, uint32_t iterations,
+                         MlBenchResult *result);
+
+/**
+ * @brief Prints inferences per second, arena footprint and backend.
+ */
+void MlRuntime_PrintReport(const MlRuntime *rt, const MlBenchResult *result);
+
+#endif // ML_RUNTIME_H
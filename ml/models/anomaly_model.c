@@ -0,0 +1,153 @@
+/**
+ * @file anomaly_model.c
+ * @brief Traffic anomaly classifier: Conv(3x1) -> FC -> FC.
+ *
+ * Placeholder weights from a fixed-seed generator, in the layout the export
+ * script produces; they will be replaced by the trained model. Biases have the
+ * input zero point folded in (see ml_kernels.h).
+ */
+
+#include "anomaly_model.h"
+
+// --- Weights (flash) ---
+
+// [8 out][3 kh][1 kw][16 in]
+static const int8_t ConvWeights[8 * 3 * 1 * 16] = {
+    -28, 40, -14, 43, 59, 15, 24, -8, 40, 37, 37, 52, 21, -7, -50, 24,
+    2, 7, -28, -2, -52, 31, 0, -51, -15, -36, 35, 17, 26, 7, -4, 36,
+    -37, -54, 47, -5, -8, -31, -11, 50, -62, -52, 3, 53, -11, 8, -38, 22,
+    -1, 37, -37, -1, 16, 24, 7, -31, 26, 51, -49, -13, 15, 58, -12, -14,
+    36, -58, -23, 48, -37, -12, -40, -4, 31, -14, -38, -11, -27, 4, 23, 30,
+    -30, -58, -31, -12, 30, 10, 11, -40, -1, 2, -31, -61, 18, 11, 6, 22,
+    20, 57, 39, 53, 47, 5, -8, -11, 2, -8, 0, -23, 25, 33, 33, 24,
+    -51, -57, 16, -55, 0, -20, -35, -36, -35, -3, 15, -53, -25, 64, -15, 1,
+    -33, -16, 33, 33, 22, -26, 30, 52, 18, 47, 36, 17, -20, -41, 35, 49,
+    -39, 42, -6, 56, -7, 21, 34, 8, 47, 46, 55, -8, 40, -3, -62, -36,
+    -5, -52, -4, -25, -28, 15, -32, 13, -55, 47, 39, -15, -58, 18, 49, 4,
+    12, -48, 55, -32, -7, 10, 16, 49, 14, -12, -63, -29, 5, -10, 9, 15,
+    -38, -6, 27, 42, -63, 10, -54, -9, -30, 14, -22, 12, 48, 59, 44, -33,
+    -29, 36, -61, -4, 59, 2, -59, -38, 47, -16, -21, 31, 49, 46, 52, -29,
+    -18, -52, -48, -21, -43, -41, -49, 7, 17, 49, -46, 11, -62, -64, 17, 14,
+    -48, -9, -42, 42, -37, 55, 57, 29, -51, -1, 13, -51, -58, 8, 34, 26,
+    -1, 25, 50, 56, 28, -10, -56, 13, -64, 48, 19, 49, 62, -22, 10, -64,
+    31, -42, 13, -29, 29, -27, -40, 6, -5, 13, 11, 18, 2, 54, -1, 20,
+    -64, 17, -29, -21, -62, 32, -25, -23, -35, -58, -9, 36, 64, -1, 10, 61,
+    -7, 34, 30, 57, -55, -10, 31, 53, -60, 56, 40, 26, -3, 44, -25, 49,
+    -48, 41, -19, 43, 61, 61, -34, -42, -23, -16, 14, 54, 60, 62, -6, -5,
+    -7, 18, 52, 39, 62, 35, -26, -47, -64, -64, 0, 42, 54, 33, -42, -43,
+    -59, -46, 53, -6, 42, -61, -64, 43, -63, -54, -45, 14, 2, 34, -43, 46,
+    16, 18, -28, 32, 12, -57, 2, 26, 35, -55, -9, 23, -55, -47, 64, 13,
+};
+
+static const int32_t ConvBias[8] = {
+    17183, -21718, 30195, 10255, -33779, 20507, 45666, -22860,
+};
+
+// [16 out][48 in]
+static const int8_t Fc1Weights[16 * 48] = {
+    -5, -57, -32, -53, -6, 33, 40, 36, 49, 63, 25, 44, 56, 47, -9, -43,
+    -58, 60, 8, 52, -35, -33, 14, -8, 32, 32, -11, 41, 42, -10, -9, -34,
+    58, 9, 17, -55, 6, -19, 64, -40, 61, 33, 7, -28, -27, 53, 0, 23,
+    -47, -22, 21, 18, 21, -54, 5, 41, 16, -50, 26, 36, 26, -27, -15, 50,
+    31, 54, -26, -1, -26, 51, -57, 43, -25, -60, 55, 29, 36, -21, -54, 22,
+    -15, 16, -20, -30, 56, 60, 14, -37, -41, -57, -13, 43, -53, -11, 34, -57,
+    -10, 17, 36, 8, 48, 57, -31, -47, 24, 49, -24, 42, -37, 8, -12, 31,
+    11, -38, 40, 11, -36, -44, -9, 51, 18, 1, 11, -22, -32, -5, -25, -26,
+    -57, 16, -41, -4, -23, 13, 43, -50, -23, 24, 13, 24, -17, -56, -27, 29,
+    -20, -29, 38, -63, 31, -51, -8, -63, -36, -34, -2, 27, 20, 13, -38, -17,
+    4, 23, -16, -24, 17, 59, 20, -32, -28, -23, -30, -10, -27, 53, 25, -43,
+    11, 4, 59, -21, 28, 32, -50, -60, 4, 40, -41, 36, 8, -9, -47, -58,
+    -23, 56, 52, 59, -16, -64, -57, -15, 39, 35, -36, 8, 54, 48, -39, 44,
+    -11, -34, 7, 53, -16, 15, -6, 10, -9, 2, 11, -44, 24, -38, -20, -28,
+    -62, 6, -31, 54, 30, 50, -5, -39, 2, 58, 54, 37, 49, -25, 15, 47,
+    19, 27, 28, 51, 29, 55, 16, 10, 26, 21, -35, -53, 20, -55, 57, 39,
+    22, 57, -3, 24, 30, -5, 12, -8, -26, -9, 59, 47, 32, -3, -17, 25,
+    10, 0, -31, 51, -52, -56, 30, -37, -30, -64, 26, -51, 28, 24, -28, -36,
+    10, 0, -33, -49, 50, -39, 42, -49, -11, -52, -29, 48, 56, 45, 4, 53,
+    -26, 11, -57, 59, -61, -18, -39, -32, -13, 25, 32, -2, -21, 7, -18, 40,
+    48, 61, 61, -11, 17, 14, -36, 27, -1, -15, -39, 53, -62, -5, 4, 64,
+    -2, -37, 52, -28, -40, -25, 38, 50, -44, 31, 22, -5, 58, -51, 60, 4,
+    -3, -19, -57, 11, -41, -16, 42, 39, -44, -34, 60, 45, 12, -35, -12, 53,
+    -39, -61, 61, 39, 41, 64, 39, -5, -24, -38, 47, -8, 36, 36, 28, -53,
+    -31, -21, -59, -21, 1, 61, -45, 61, -20, -5, -38, -34, 30, -18, 7, 27,
+    -34, 50, 46, -64, 45, -47, -40, -32, 24, 51, -53, -54, -19, 19, 24, -42,
+    -32, -58, -63, -43, -1, -26, 58, 22, -10, 58, -43, -43, -51, -1, 53, -4,
+    5, 49, -37, -53, -48, 43, 25, -45, 8, -21, 5, -4, -10, 25, 60, 1,
+    14, -3, -37, -45, 29, 29, 56, -18, 15, 17, 50, 30, 8, 15, -6, 48,
+    62, -62, -62, -20, -12, -60, -4, 59, 44, -39, 17, 17, -64, -18, -52, 19,
+    20, -26, -15, 29, -32, 20, -27, -34, 36, -17, 4, -24, -64, 44, -9, 2,
+    -50, 18, -39, -64, -16, 11, -39, 35, -33, 16, -35, -36, 29, -20, -52, 11,
+    55, 48, 16, 13, -59, -47, -52, 61, -23, -25, 13, -40, -9, -39, 51, 50,
+    -24, 58, 32, 33, -32, -52, 45, -26, -45, 61, -37, 3, -1, -58, -44, -50,
+    -64, 0, -22, -62, 53, -16, -32, -3, -35, 0, 53, 62, 52, -4, 29, -10,
+    -30, -41, 33, -13, 9, -7, 51, 23, -55, -48, -57, 40, 9, 1, -24, -6,
+    -41, -56, 48, -11, 39, -57, -49, -10, -10, -43, -2, -54, -33, -8, 31, -16,
+    0, 12, -35, -33, 29, 10, -4, 41, -63, -36, 27, 6, -50, 7, -36, 5,
+    54, -9, 44, 46, 2, -15, -30, 47, 56, 22, -58, -28, -17, 53, 2, -58,
+    25, 62, -42, -56, 21, 3, -29, 2, 17, 18, 30, -17, 56, 53, 11, 63,
+    44, 24, 14, 34, 27, 55, -16, 18, -39, -3, 13, -38, 56, -1, -49, 61,
+    56, 17, -30, 6, 27, -60, 10, 36, 41, 42, -29, 62, 21, 57, -57, -48,
+    46, -51, -40, -64, 62, 6, -15, -13, 22, -41, -62, -25, -13, 7, -28, -16,
+    41, 63, -15, -44, -38, -36, -38, 56, -42, 16, 45, -10, -57, 10, 20, 36,
+    7, -37, 35, 64, -40, 14, -41, -18, 34, -17, 60, 31, -17, 61, -4, -4,
+    31, -25, -50, 36, 3, 24, -18, 62, -34, 26, 8, 19, -25, -32, 37, -33,
+    -18, -13, -36, -63, 36, -34, 5, 25, 60, -3, 19, 39, 46, 8, -22, -57,
+    -62, 59, 64, 42, 63, 50, 43, 6, -18, -55, -19, 59, -24, -44, -59, 30,
+};
+
+static const int32_t Fc1Bias[16] = {
+    55399, -2207, -9431, -41681, 38068, 35011, 14489, 31132,
+    -52891, 4330, -44134, -32343, -35782, 73104, -11076, 20121,
+};
+
+// [2 out][16 in]
+static const int8_t Fc2Weights[2 * 16] = {
+    -39, 58, -60, 43, -10, 45, 3, -22, -47, -55, 26, -38, -43, -40, -8, -57,
+    -27, 32, 37, 29, 28, -13, -50, 18, -33, 63, -43, 41, 45, 19, 6, -61,
+};
+
+static const int32_t Fc2Bias[2] = {
+    -30725, 11212,
+};
+
+// --- Graph ---
+
+// Offsets come from anomaly_model_plan.h; tensors with disjoint lifetimes share bytes
+static const MlTensor AnomalyTensors[] = {
+    [ANOMALY_MODEL_INPUT] = { .arena_offset = ANOMALY_MODEL_INPUT_OFFSET, .size_bytes = ANOMALY_MODEL_INPUT_BYTES,
+                              .height = 8, .width = 1, .channels = 16, .zero_point = -128 },
+    [ANOMALY_MODEL_CONV_OUT] = { .arena_offset = ANOMALY_MODEL_CONV_OUT_OFFSET, .size_bytes = ANOMALY_MODEL_CONV_OUT_BYTES,
+                                 .height = 6, .width = 1, .channels = 8, .zero_point = -128 },
+    [ANOMALY_MODEL_FC1_OUT] = { .arena_offset = ANOMALY_MODEL_FC1_OUT_OFFSET, .size_bytes = ANOMALY_MODEL_FC1_OUT_BYTES,
+                                .height = 1, .width = 1, .channels = 16, .zero_point = -128 },
+    [ANOMALY_MODEL_LOGITS] = { .arena_offset = ANOMALY_MODEL_LOGITS_OFFSET, .size_bytes = ANOMALY_MODEL_LOGITS_BYTES,
+                               .height = 1, .width = 1, .channels = 2, .zero_point = 0 },
+};
+
+// ReLU layers clamp at their output zero point
+static const MlOp AnomalyOps[] = {
+    { .type = ML_OP_CONV2D, .input = ANOMALY_MODEL_INPUT, .output = ANOMALY_MODEL_CONV_OUT,
+      .kernel_h = 3, .kernel_w = 1, .stride_h = 1, .stride_w = 1,
+      .weights = ConvWeights, .bias = ConvBias,
+      .requant = { .multiplier = 0x5A827980, .shift = 8, .output_zero_point = -128,
+                   .activation_min = -128, .activation_max = 127 } },
+    { .type = ML_OP_FULLY_CONNECTED, .input = ANOMALY_MODEL_CONV_OUT, .output = ANOMALY_MODEL_FC1_OUT,
+      .weights = Fc1Weights, .bias = Fc1Bias,
+      .requant = { .multiplier = 0x5A827980, .shift = 8, .output_zero_point = -128,
+                   .activation_min = -128, .activation_max = 127 } },
+    { .type = ML_OP_FULLY_CONNECTED, .input = ANOMALY_MODEL_FC1_OUT, .output = ANOMALY_MODEL_LOGITS,
+      .weights = Fc2Weights, .bias = Fc2Bias,
+      .requant = { .multiplier = 0x5A827980, .shift = 7, .output_zero_point = 0,
+                   .activation_min = -128, .activation_max = 127 } },
+};
+
+const MlModel AnomalyModel = {
+    .name = "anomaly",
+    .tensors = AnomalyTensors,
+    .tensor_count = sizeof(AnomalyTensors) / sizeof(AnomalyTensors[0]),
+    .ops = AnomalyOps,
+    .op_count = sizeof(AnomalyOps) / sizeof(AnomalyOps[0]),
+    .input = ANOMALY_MODEL_INPUT,
+    .output = ANOMALY_MODEL_LOGITS,
+    .arena_bytes = ANOMALY_MODEL_ARENA_BYTES,
+};
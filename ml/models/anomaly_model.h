@@ -0,0 +1,27 @@
+/**
+ * @file anomaly_model.h
+ * @brief Traffic anomaly classifier for the inference runtime.
+ *
+ * Input is a window of 8 feature vectors of 16 features each, shaped
+ * [8][1][16]. Output is two logits: normal and anomalous. The graph is
+ * described in anomaly_model.json; tools/plan_arena.py turns it into the
+ * tensor offsets in anomaly_model_plan.h.
+ */
+
+#ifndef ANOMALY_MODEL_H
+#define ANOMALY_MODEL_H
+
+#include "ml_runtime.h"
+#include "anomaly_model_plan.h"
+
+#define ANOMALY_MODEL_WINDOW        8
+#define ANOMALY_MODEL_FEATURES      16
+#define ANOMALY_MODEL_CLASSES       2
+
+// 0 while anomaly_model.c holds placeholder weights; the export of the
+// trained model sets it to 1. AnomalyDetector_Init refuses to run until then.
+#define ANOMALY_MODEL_TRAINED       0
+
+extern const MlModel AnomalyModel;
+
+#endif // ANOMALY_MODEL_H
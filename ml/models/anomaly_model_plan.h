@@ -0,0 +1,34 @@
+/**
+ * @file anomaly_model_plan.h
+ * @brief Tensor arena plan for the anomaly model.
+ *
+ * GENERATED by tools/plan_arena.py from ml/models/anomaly_model.json. Do not edit.
+ *
+ * Tensor            Bytes  Offset  Live ops
+ * INPUT               128       0  0..0
+ * CONV_OUT             48     128  0..1
+ * FC1_OUT              16       0  1..2
+ * LOGITS                2      16  2..3
+ *
+ * Arena 176 bytes; lower bound 176, without reuse 208.
+ */
+
+#ifndef ANOMALY_MODEL_PLAN_H
+#define ANOMALY_MODEL_PLAN_H
+
+#define ANOMALY_MODEL_ARENA_BYTES            176
+
+#define ANOMALY_MODEL_INPUT                  0
+#define ANOMALY_MODEL_INPUT_OFFSET           0
+#define ANOMALY_MODEL_INPUT_BYTES            128
+#define ANOMALY_MODEL_CONV_OUT               1
+#define ANOMALY_MODEL_CONV_OUT_OFFSET        128
+#define ANOMALY_MODEL_CONV_OUT_BYTES         48
+#define ANOMALY_MODEL_FC1_OUT                2
+#define ANOMALY_MODEL_FC1_OUT_OFFSET         0
+#define ANOMALY_MODEL_FC1_OUT_BYTES          16
+#define ANOMALY_MODEL_LOGITS                 3
+#define ANOMALY_MODEL_LOGITS_OFFSET          16
+#define ANOMALY_MODEL_LOGITS_BYTES           2
+
+#endif // ANOMALY_MODEL_PLAN_H
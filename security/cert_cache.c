@@ -0,0 +1,172 @@
+/**
+ * @file cert_cache.c
+ * @brief Implementation of chain verification and the verified-link cache.
+ */
+
+#include "cert_cache.h"
+#include "secure_trace.h"
+#include "x509.h"
+#include "zeroize.h"
+
+#include <string.h>
+
+// --- Private Types ---
+
+typedef struct {
+    uint8_t  cert[SHA256_DIGEST_BYTES];         // SHA-256 of the certificate DER
+    uint8_t  issuer_key[SHA256_DIGEST_BYTES];   // SHA-256 of the verifying key, x || y
+    uint32_t last_used;                         // Zero: empty slot
+} CacheEntry;
+
+// All zero, as after a wipe, is an empty cache
+typedef struct {
+    CacheEntry entry[CERT_CACHE_ENTRIES];
+    uint32_t   clock;
+} CacheStore;
+
+// Per-call working set, indexed by chain position
+typedef struct {
+    X509Cert       cert[CERT_CHAIN_MAX_DEPTH];
+    uint8_t        cert_hash[CERT_CHAIN_MAX_DEPTH][SHA256_DIGEST_BYTES];
+    uint8_t        key_hash[CERT_CHAIN_MAX_DEPTH][SHA256_DIGEST_BYTES];
+    uint8_t        tbs_hash[CERT_CHAIN_MAX_DEPTH][SHA256_DIGEST_BYTES];
+    uint8_t        rs[CERT_CHAIN_MAX_DEPTH][2 * P256_BYTES];
+    P256VerifyItem item[CERT_CHAIN_MAX_DEPTH];
+    uint8_t        position[CERT_CHAIN_MAX_DEPTH];     // Chain position of each item
+    bool           valid[CERT_CHAIN_MAX_DEPTH];
+} ChainWork;
+
+// --- Private Variables ---
+static CacheStore Cache;
+static ChainWork Work;
+static CertCacheStats Stats;
+
+// --- Private Helper Functions ---
+
+static CacheEntry *Lookup(const uint8_t *cert_hash, const uint8_t *key_hash) {
+    for (uint32_t i = 0; i < CERT_CACHE_ENTRIES; i++) {
+        CacheEntry *e = &Cache.entry[i];
+        if (e->last_used != 0 && memcmp(e->cert, cert_hash, SHA256_DIGEST_BYTES) == 0 &&
+            memcmp(e->issuer_key, key_hash, SHA256_DIGEST_BYTES) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void Insert(const uint8_t *cert_hash, const uint8_t *key_hash) {
+    CacheEntry *victim = &Cache.entry[0];
+    for (uint32_t i = 1; i < CERT_CACHE_ENTRIES && victim->last_used != 0; i++) {
+        if (Cache.entry[i].last_used < victim->last_used) {
+            victim = &Cache.entry[i];
+        }
+    }
+    if (victim->last_used != 0) {
+        Stats.evictions++;
+    }
+    memcpy(victim->cert, cert_hash, SHA256_DIGEST_BYTES);
+    memcpy(victim->issuer_key, key_hash, SHA256_DIGEST_BYTES);
+    victim->last_used = ++Cache.clock;
+}
+
+static bool Reject(uint32_t position, uint32_t reason) {
+    Stats.rejected++;
+    SecureTrace_Event(SECURE_TRACE_EVENT_CERT_REJECT, position, reason);
+    return false;
+}
+
+// Whether cert may issue the certificate at position - 1, below it
+static uint32_t CheckIssuer(const X509Cert *child, const X509Cert *issuer, uint32_t position) {
+    if (!X509_NameEquals(&child->issuer, &issuer->subject)) {
+        return CERT_REJECT_NAME;
+    }
+    if (!issuer->is_ca || (issuer->has_key_usage && (issuer->key_usage & X509_KEY_USAGE_KEY_CERT_SIGN) == 0)) {
+        return CERT_REJECT_NOT_CA;
+    }
+    // Intermediates below the issuer: positions 1 .. position - 1
+    if (issuer->path_len != X509_NO_PATH_LEN && (uint32_t)issuer->path_len < position - 1U) {
+        return CERT_REJECT_PATH_LEN;
+    }
+    return 0;
+}
+
+// --- Public Function Implementations ---
+
+void CertCache_Init(void) {
+    CertCache_Flush();
+    memset(&Stats, 0, sizeof(Stats));
+    Zeroize_Register(&Cache, sizeof(Cache), ZEROIZE_PRIORITY_BULK);
+}
+
+void CertCache_Flush(void) {
+    memset(&Cache, 0, sizeof(Cache));
+}
+
+bool CertCache_VerifyChain(const CertBlob *chain, uint32_t count, const uint8_t anchor_pub[2 * P256_BYTES],
+                           const uint8_t **leaf_pub) {
+    Stats.chains++;
+    if (count == 0 || count > CERT_CHAIN_MAX_DEPTH) {
+        return Reject(0, CERT_REJECT_DEPTH);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!X509_Parse(&Work.cert[i], chain[i].der, chain[i].len)) {
+            return Reject(i, CERT_REJECT_PARSE);
+        }
+    }
+    for (uint32_t i = 0; i + 1U < count; i++) {
+        uint32_t reason = CheckIssuer(&Work.cert[i], &Work.cert[i + 1U], i + 1U);
+        if (reason != 0) {
+            return Reject(i + 1U, reason);
+        }
+    }
+
+    // Links not in the cache are verified together
+    uint32_t pending = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t *issuer_pub = (i + 1U < count) ? Work.cert[i + 1U].pub : anchor_pub;
+        Sha256_Digest(chain[i].der, chain[i].len, Work.cert_hash[i]);
+        Sha256_Digest(issuer_pub, 2U * P256_BYTES, Work.key_hash[i]);
+        CacheEntry *hit = Lookup(Work.cert_hash[i], Work.key_hash[i]);
+        if (hit != NULL) {
+            hit->last_used = ++Cache.clock;
+            Stats.hits++;
+            continue;
+        }
+        Stats.misses++;
+        if (!X509_SignatureRS(&Work.cert[i], Work.rs[pending])) {
+            return Reject(i, CERT_REJECT_PARSE);
+        }
+        X509_TbsDigest(&Work.cert[i], Work.tbs_hash[pending]);
+        Work.item[pending].pub = issuer_pub;
+        Work.item[pending].hash = Work.tbs_hash[pending];
+        Work.item[pending].sig = Work.rs[pending];
+        Work.position[pending] = (uint8_t)i;
+        pending++;
+    }
+    if (pending > 0) {
+        P256_EcdsaVerifyBatch(Work.item, pending, Work.valid);
+        Stats.verified += pending;
+        for (uint32_t p = 0; p < pending; p++) {
+            if (!Work.valid[p]) {
+                return Reject(Work.position[p], CERT_REJECT_SIGNATURE);
+            }
+        }
+        // Cache only once the whole chain holds
+        for (uint32_t p = 0; p < pending; p++) {
+            Insert(Work.cert_hash[Work.position[p]], Work.key_hash[Work.position[p]]);
+        }
+    }
+    if (leaf_pub != NULL) {
+        *leaf_pub = Work.cert[0].pub;
+    }
+    return true;
+}
+
+const CertCacheStats *CertCache_Stats(void) {
+    // Counted, not tracked: a tamper wipe empties the cache behind our back
+    Stats.entries = 0;
+    for (uint32_t i = 0; i < CERT_CACHE_ENTRIES; i++) {
+        Stats.entries += (Cache.entry[i].last_used != 0) ? 1U : 0U;
+    }
+    return &Stats;
+}
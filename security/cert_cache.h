@@ -0,0 +1,96 @@
+/**
+ * @file cert_cache.h
+ * @brief Certificate chain verification with a cache of verified links.
+ *
+ * CertCache_VerifyChain checks a peer chain, leaf first, up to a trust
+ * anchor's public key. Each link is "certificate C is signed by key K".
+ * A link that has verified before is found in the cache and skips the
+ * ECDSA verification entirely. Repeat peers cost a parse and a hash per
+ * certificate, and so does a new leaf under a known intermediate CA,
+ * apart from its own signature.
+ *
+ * A cache entry is keyed by SHA-256 of the whole certificate DER and
+ * SHA-256 of the issuer key it verified under. Any change to the
+ * certificate, or the same certificate presented under another issuer,
+ * misses the cache. Entries are only added after a successful
+ * verification and are evicted least recently used.
+ *
+ * Structural checks are never cached and run on every call:
+ *  - name chaining;
+ *  - the CA flag;
+ *  - keyCertSign;
+ *  - path length.
+ * The signatures still to verify are checked together with
+ * P256_EcdsaVerifyBatch.
+ *
+ * The cache is not secret, but it is a record of trust decisions. It is
+ * registered for zeroisation, so a tamper wipe empties it and every
+ * chain is verified again afterwards.
+ *
+ * Call from the superloop only.
+ */
+
+#ifndef CERT_CACHE_H
+#define CERT_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "p256.h"
+#include "sha256.h"
+
+#define CERT_CACHE_ENTRIES          16
+#define CERT_CHAIN_MAX_DEPTH        4       // Certificates per chain, anchor excluded
+
+// --- Reject Reasons (SECURE_TRACE_EVENT_CERT_REJECT arg1) ---
+#define CERT_REJECT_DEPTH           1
+#define CERT_REJECT_PARSE           2
+#define CERT_REJECT_NAME            3       // Issuer does not match the next subject
+#define CERT_REJECT_NOT_CA          4       // Issuer lacks the CA flag or keyCertSign
+#define CERT_REJECT_PATH_LEN        5
+#define CERT_REJECT_SIGNATURE       6
+
+// --- Public Types ---
+
+typedef struct {
+    const uint8_t *der;
+    uint32_t       len;
+} CertBlob;
+
+typedef struct {
+    uint32_t chains;                // CertCache_VerifyChain calls
+    uint32_t rejected;              // Chains that failed
+    uint32_t hits;                  // Links found in the cache
+    uint32_t misses;
+    uint32_t verified;              // Signatures verified
+    uint32_t evictions;
+    uint32_t entries;               // Links currently cached
+} CertCacheStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Empties the cache and registers it for zeroisation.
+ */
+void CertCache_Init(void);
+
+/**
+ * @brief Drops every cached link, e.g. after the trust anchor changes.
+ */
+void CertCache_Flush(void);
+
+/**
+ * @brief Verifies chain[0] (the leaf) up to the anchor key.
+ *
+ * chain[i] must be issued by chain[i + 1], and the last by the anchor.
+ *
+ * @param anchor_pub Trust anchor public key, x || y.
+ * @param leaf_pub   Set to the leaf's public key (into chain[0]) on success; may be NULL.
+ * @return True if every link holds.
+ */
+bool CertCache_VerifyChain(const CertBlob *chain, uint32_t count, const uint8_t anchor_pub[2 * P256_BYTES],
+                           const uint8_t **leaf_pub);
+
+const CertCacheStats *CertCache_Stats(void);
+
+#endif // CERT_CACHE_H
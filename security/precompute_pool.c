@@ -0,0 +1,274 @@
+/**
+ * @file precompute_pool.c
+ * @brief Implementation of the ECDSA and RSA precomputation pool.
+ */
+
+#include "precompute_pool.h"
+#include "cycle_counter.h"
+#include "hmac_drbg.h"
+#include "secure_trace.h"
+#include "zeroize.h"
+
+#include <string.h>
+
+// --- Private Defines ---
+#define JOB_NONE                    0U
+#define JOB_ECDSA_LADDER            1U
+#define JOB_ECDSA_FINISH            2U
+#define JOB_RSA                     3U  // Only as a Completed value: one step builds a pair
+
+// --- Private Types ---
+
+// Everything secret, wiped as one range; all zero means not initialised
+typedef struct {
+    P256SignTuple ecdsa[PRECOMPUTE_ECDSA_DEPTH];
+    RsaBlinding   rsa[PRECOMPUTE_RSA_DEPTH];
+    uint32_t      ecdsa_head;
+    uint32_t      ecdsa_count;
+    uint32_t      rsa_head;
+    uint32_t      rsa_count;
+    HmacDrbg      drbg;
+    P256Ladder    ladder;           // Job in progress
+    BnLimb        k[P256_LIMBS];
+    uint32_t      job;
+    uint32_t      job_cycles;
+    uint8_t       random[RSA_MAX_BYTES];
+    bool          ready;
+} PoolStore;
+
+// --- Private Variables ---
+static PoolStore Store;
+static const RsaKey *BlindKey;
+static PrecomputePoolStats Stats;
+static uint32_t Completed;          // JOB_* entry finished by the last step
+
+// --- Private Helper Functions ---
+
+// Zeroize_All runs from the tamper interrupt and clears the whole store,
+// ready included. To the superloop the wipe is atomic, so anything drawn
+// from the DRBG is trusted only if the store is still ready after the
+// draw. Otherwise it came, wholly or partly, from a zeroed DRBG and is
+// predictable.
+static bool StoreIntact(void) {
+    __asm__ volatile("" : : : "memory");
+    return *(const volatile bool *)&Store.ready;
+}
+
+// Undoes whatever a step or draw wrote after a wipe
+static void DiscardAfterWipe(void) {
+    Zeroize_Range(&Store, sizeof(Store));
+}
+
+static void DrawNonce(BnLimb k[P256_LIMBS]) {
+    uint8_t bytes[P256_BYTES];
+    do {
+        HmacDrbg_Generate(&Store.drbg, bytes, sizeof(bytes));
+    } while (!P256_ScalarFromBytes(k, bytes));
+    Zeroize_Range(bytes, sizeof(bytes));
+}
+
+static bool DrawBlinding(RsaBlinding *b) {
+    HmacDrbg_Generate(&Store.drbg, Store.random, BlindKey->bytes - 1U);
+    bool ok = Rsa_MakeBlinding(BlindKey, Store.random, b);
+    Zeroize_Range(Store.random, BlindKey->bytes - 1U);
+    return ok;
+}
+
+// Online fallback: the same work as the idle path, in one go
+static void BuildTupleNow(P256SignTuple *t) {
+    P256Ladder ladder;
+    BnLimb k[P256_LIMBS];
+    do {
+        DrawNonce(k);
+        P256_LadderStart(&ladder, k, NULL);
+        P256_LadderStep(&ladder, P256_LADDER_BITS);
+    } while (!P256_TupleFinish(&ladder, k, t));
+    Zeroize_Range(&ladder, sizeof(ladder));
+    Zeroize_Range(k, sizeof(k));
+}
+
+static bool NeedEcdsa(void) {
+    if (Store.ecdsa_count == PRECOMPUTE_ECDSA_DEPTH) {
+        return false;
+    }
+    // Fill whichever pool is emptier, relative to its depth
+    return BlindKey == NULL || Store.rsa_count == PRECOMPUTE_RSA_DEPTH ||
+           Store.ecdsa_count * PRECOMPUTE_RSA_DEPTH <= Store.rsa_count * PRECOMPUTE_ECDSA_DEPTH;
+}
+
+static void UpdateRate(uint32_t *fill_cycles, uint32_t *per_sec, uint32_t cycles) {
+    *fill_cycles = cycles;
+    *per_sec = (cycles > 0) ? (uint32_t)(CYCLE_COUNTER_HZ / cycles) : 0;
+}
+
+// One bounded slice of work; false if the pool is full
+static bool Step(void) {
+    switch (Store.job) {
+        case JOB_NONE:
+            if (NeedEcdsa()) {
+                DrawNonce(Store.k);
+                P256_LadderStart(&Store.ladder, Store.k, NULL);
+                Store.job = JOB_ECDSA_LADDER;
+            } else if (BlindKey != NULL && Store.rsa_count < PRECOMPUTE_RSA_DEPTH) {
+                uint32_t slot = (Store.rsa_head + Store.rsa_count) % PRECOMPUTE_RSA_DEPTH;
+                if (DrawBlinding(&Store.rsa[slot])) {
+                    Store.rsa_count++;
+                    Stats.rsa_filled++;
+                    Completed = JOB_RSA;
+                }
+            } else {
+                return false;
+            }
+            break;
+        case JOB_ECDSA_LADDER:
+            if (P256_LadderStep(&Store.ladder, PRECOMPUTE_LADDER_SLICE)) {
+                Store.job = JOB_ECDSA_FINISH;
+            }
+            break;
+        default: {
+            uint32_t slot = (Store.ecdsa_head + Store.ecdsa_count) % PRECOMPUTE_ECDSA_DEPTH;
+            if (P256_TupleFinish(&Store.ladder, Store.k, &Store.ecdsa[slot])) {
+                Store.ecdsa_count++;
+                Stats.ecdsa_filled++;
+                Completed = JOB_ECDSA_FINISH;
+            }
+            Zeroize_Range(&Store.ladder, sizeof(Store.ladder));
+            Zeroize_Range(Store.k, sizeof(Store.k));
+            Store.job = JOB_NONE;
+            break;
+        }
+    }
+    return true;
+}
+
+// --- Public Function Implementations ---
+
+bool PrecomputePool_Init(const uint8_t *seed, uint32_t seed_len, const RsaKey *rsa) {
+    if (seed == NULL || seed_len == 0) {
+        return false;
+    }
+    Zeroize_Range(&Store, sizeof(Store));
+    memset(&Stats, 0, sizeof(Stats));
+    BlindKey = rsa;
+    HmacDrbg_Init(&Store.drbg, seed, seed_len);
+    Zeroize_Register(&Store, sizeof(Store), ZEROIZE_PRIORITY_KEY_STORE);
+    Store.ready = true;
+    return true;
+}
+
+void PrecomputePool_Reseed(const uint8_t *seed, uint32_t seed_len) {
+    if (Store.ready) {
+        HmacDrbg_Reseed(&Store.drbg, seed, seed_len);
+    }
+}
+
+uint32_t PrecomputePool_Idle(uint32_t budget_cycles) {
+    if (!Store.ready) {
+        return 0;
+    }
+    uint32_t start = CycleCounter_Read();
+    uint32_t used = 0;
+    while (used < budget_cycles && StoreIntact()) {
+        uint32_t step_start = CycleCounter_Read();
+        Completed = JOB_NONE;
+        bool more = Step();
+        if (!StoreIntact()) {
+            DiscardAfterWipe();
+            break;
+        }
+        if (!more) {
+            break;
+        }
+        uint32_t step = CycleCounter_Elapsed(step_start);
+        Store.job_cycles += step;
+        if (step > Stats.max_step_cycles) {
+            Stats.max_step_cycles = step;
+        }
+        if (Completed == JOB_ECDSA_FINISH) {
+            UpdateRate(&Stats.ecdsa_fill_cycles, &Stats.ecdsa_per_sec, Store.job_cycles);
+        } else if (Completed == JOB_RSA) {
+            UpdateRate(&Stats.rsa_fill_cycles, &Stats.rsa_per_sec, Store.job_cycles);
+        }
+        if (Completed != JOB_NONE || Store.job == JOB_NONE) {
+            Store.job_cycles = 0;   // Also drops the cost of a discarded draw
+        }
+        used = CycleCounter_Elapsed(start);
+    }
+    Stats.idle_cycles += used;
+    return used;
+}
+
+bool PrecomputePool_EcdsaSign(const uint8_t priv[P256_BYTES], const uint8_t hash[P256_BYTES],
+                              uint8_t sig[2 * P256_BYTES]) {
+    BnLimb d[P256_LIMBS];
+    if (!Store.ready || !P256_ScalarFromBytes(d, priv)) {
+        return false;
+    }
+    Zeroize_Range(d, sizeof(d));
+
+    P256SignTuple t;
+    bool ok;
+    uint32_t op;
+    do {
+        if (!StoreIntact()) {
+            return false;
+        }
+        if (Store.ecdsa_count > 0) {
+            t = Store.ecdsa[Store.ecdsa_head];
+            Zeroize_Range(&Store.ecdsa[Store.ecdsa_head], sizeof(t));
+            Store.ecdsa_head = (Store.ecdsa_head + 1U) % PRECOMPUTE_ECDSA_DEPTH;
+            Store.ecdsa_count--;
+            Stats.ecdsa_used++;
+            op = SECURE_TRACE_KEY_OP_SIGN;
+        } else {
+            Stats.ecdsa_misses++;
+            BuildTupleNow(&t);
+            op = SECURE_TRACE_KEY_OP_SIGN_ONLINE;
+        }
+        // A nonce from a wiped DRBG would give the key away in one signature
+        if (!StoreIntact()) {
+            Zeroize_Range(&t, sizeof(t));
+            DiscardAfterWipe();
+            return false;
+        }
+        ok = P256_EcdsaSignTuple(&t, priv, hash, sig);    // Fails only if s = 0
+        Zeroize_Range(&t, sizeof(t));
+    } while (!ok);
+    SecureTrace_Event(SECURE_TRACE_EVENT_KEY_USE, SECURE_TRACE_KEY_ECDSA, op);
+    return true;
+}
+
+bool PrecomputePool_RsaSign(const uint8_t *in, uint8_t *out) {
+    if (!Store.ready || BlindKey == NULL) {
+        return false;
+    }
+    RsaBlinding b;
+    uint32_t op = SECURE_TRACE_KEY_OP_SIGN;
+    if (Store.rsa_count > 0) {
+        b = Store.rsa[Store.rsa_head];
+        Zeroize_Range(&Store.rsa[Store.rsa_head], sizeof(b));
+        Store.rsa_head = (Store.rsa_head + 1U) % PRECOMPUTE_RSA_DEPTH;
+        Store.rsa_count--;
+        Stats.rsa_used++;
+    } else {
+        Stats.rsa_misses++;
+        op = SECURE_TRACE_KEY_OP_SIGN_ONLINE;
+        while (!DrawBlinding(&b) && StoreIntact()) {
+        }
+    }
+    if (!StoreIntact()) {
+        Zeroize_Range(&b, sizeof(b));
+        DiscardAfterWipe();
+        return false;
+    }
+    bool ok = Rsa_PrivateBlinded(BlindKey, &b, in, out);
+    Zeroize_Range(&b, sizeof(b));
+    SecureTrace_Event(SECURE_TRACE_EVENT_KEY_USE, SECURE_TRACE_KEY_RSA, op);
+    return ok;
+}
+
+const PrecomputePoolStats *PrecomputePool_Stats(void) {
+    Stats.ecdsa_ready = Store.ecdsa_count;
+    Stats.rsa_ready = Store.rsa_count;
+    return &Stats;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file precompute_pool.h
+ * @brief Idle-time precomputation of ECDSA nonce tuples and RSA blinding pairs.
+ *
+ * Most of the cost of an ECDSA P-256 signature is k * G and k^-1 mod n,
+ * and neither depends on the message or the key. Likewise, an RSA
+ * blinding pair (r^e, r^-1) depends only on r. PrecomputePool_Idle() builds
+ * them in the superloop's spare time, in slices: one ladder slice of
+ * PRECOMPUTE_LADDER_SLICE bits, one inversion, or one blinding pair per
+ * step. Signing then takes one entry off the pool:
+ *
+ *  - ECDSA: s = k^-1 (z + r d) mod n, two multiplications mod n.
+ *  - RSA: the d exponentiation plus two multiplications to blind and unblind.
+ *
+ * An empty pool still signs, by computing the entry online, and counts a
+ * miss. Entries come from an HMAC_DRBG seeded by the caller.
+ *
+ * Every entry is used once and wiped as it is taken. The nonce k itself
+ * is discarded once k^-1 and r are derived, and r of a blinding pair once
+ * r^e and r^-1 are. The whole pool, with the DRBG and the job in
+ * progress, is one range in the zeroisation registry at key-store
+ * priority. A tamper wipe therefore empties it and disables it until the
+ * next PrecomputePool_Init. The wipe runs from an interrupt, so it can
+ * land in the middle of a step or a signature. Every draw is checked
+ * against it afterwards: an entry or signature that could have used the
+ * zeroed DRBG is discarded, and the call fails.
+ *
+ * Call PrecomputePool_Idle() and the sign functions from the superloop only.
+ */
+
+#ifndef PRECOMPUTE_POOL_H
+#define PRECOMPUTE_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "p256.h"
+#include "rsa.h"
+
+#define PRECOMPUTE_ECDSA_DEPTH      8
+#define PRECOMPUTE_RSA_DEPTH        4
+#define PRECOMPUTE_LADDER_SLICE     16U     // Ladder bits per idle step
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t ecdsa_ready;           // Tuples in the pool
+    uint32_t rsa_ready;             // Blinding pairs in the pool
+    uint32_t ecdsa_filled;
+    uint32_t rsa_filled;
+    uint32_t ecdsa_used;
+    uint32_t rsa_used;
+    uint32_t ecdsa_misses;          // Signatures that found the pool empty
+    uint32_t rsa_misses;
+    uint32_t ecdsa_fill_cycles;     // Idle cycles to build the last tuple
+    uint32_t rsa_fill_cycles;
+    uint32_t ecdsa_per_sec;         // Refill rate if the CPU were otherwise idle
+    uint32_t rsa_per_sec;
+    uint32_t max_step_cycles;       // Longest single idle step
+    uint64_t idle_cycles;           // Spent filling, all time
+} PrecomputePoolStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Seeds the DRBG and empties the pool.
+ *
+ * @param rsa Key whose blinding pairs to prepare, or NULL for ECDSA only.
+ *            It must outlive the pool.
+ */
+bool PrecomputePool_Init(const uint8_t *seed, uint32_t seed_len, const RsaKey *rsa);
+
+/**
+ * @brief Mixes fresh entropy into the DRBG.
+ */
+void PrecomputePool_Reseed(const uint8_t *seed, uint32_t seed_len);
+
+/**
+ * @brief Fills the pool for up to budget_cycles.
+ *
+ * A step that starts before the budget runs out is finished, so the call
+ * may overrun by up to max_step_cycles.
+ *
+ * @return Cycles used; 0 when the pool is full or not initialised.
+ */
+uint32_t PrecomputePool_Idle(uint32_t budget_cycles);
+
+/**
+ * @brief ECDSA P-256 signature of a 32-byte hash: sig = r || s.
+ *
+ * Each signature is recorded as a KEY_USE event in the secure trace.
+ *
+ * @return False if the pool is not initialised or was wiped during the call.
+ */
+bool PrecomputePool_EcdsaSign(const uint8_t priv[P256_BYTES], const uint8_t hash[P256_BYTES],
+                              uint8_t sig[2 * P256_BYTES]);
+
+/**
+ * @brief RSA private operation on an encoded message with the Init key.
+ *
+ * Recorded as a KEY_USE event in the secure trace, like the ECDSA path.
+ */
+bool PrecomputePool_RsaSign(const uint8_t *in, uint8_t *out);
+
+const PrecomputePoolStats *PrecomputePool_Stats(void);
+
+#endif // PRECOMPUTE_POOL_H
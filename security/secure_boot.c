@@ -0,0 +1,64 @@
+/**
+ * @file secure_boot.c
+ * @brief Implementation of the firmware image signature check.
+ */
+
+#include "secure_boot.h"
+#include "secure_trace.h"
+
+#include <string.h>
+
+// --- Private Variables ---
+static uint8_t RootKey[HSS_PUBLIC_KEY_BYTES];
+static bool RootKeyValid;
+static SecureBootStats Stats;
+
+// --- Private Helper Functions ---
+
+static uint32_t LoadBe32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static bool Reject(uint32_t image_len, uint32_t reason) {
+    Stats.rejected++;
+    SecureTrace_Event(SECURE_TRACE_EVENT_BOOT_REJECT, image_len, reason);
+    return false;
+}
+
+// --- Public Function Implementations ---
+
+bool SecureBoot_Init(const uint8_t *root_pub, uint32_t root_pub_len) {
+    memset(&Stats, 0, sizeof(Stats));
+    RootKeyValid = false;
+    if (root_pub_len != HSS_PUBLIC_KEY_BYTES) {
+        return false;
+    }
+    // levels || lms type || ots type || I || T[1]
+    uint32_t levels = LoadBe32(root_pub);
+    if (levels == 0 || levels > HSS_MAX_LEVELS ||
+        Lms_SignatureBytes(LoadBe32(root_pub + 4), LoadBe32(root_pub + 8)) == 0) {
+        return false;
+    }
+    memcpy(RootKey, root_pub, HSS_PUBLIC_KEY_BYTES);
+    RootKeyValid = true;
+    return true;
+}
+
+bool SecureBoot_VerifyImage(const uint8_t *image, uint32_t image_len, const uint8_t *sig, uint32_t sig_len) {
+    Stats.images++;
+    if (!RootKeyValid) {
+        return Reject(image_len, SECURE_BOOT_REJECT_NO_KEY);
+    }
+    if (image_len == 0 || sig_len < 4U || LoadBe32(sig) != LoadBe32(RootKey) - 1U) {
+        return Reject(image_len, SECURE_BOOT_REJECT_FORMAT);
+    }
+    if (!Hss_Verify(RootKey, HSS_PUBLIC_KEY_BYTES, image, image_len, sig, sig_len)) {
+        return Reject(image_len, SECURE_BOOT_REJECT_SIGNATURE);
+    }
+    Stats.accepted++;
+    return true;
+}
+
+const SecureBootStats *SecureBoot_Stats(void) {
+    return &Stats;
+}
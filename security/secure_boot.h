@@ -0,0 +1,64 @@
+/**
+ * @file secure_boot.h
+ * @brief Firmware image signature check against a pinned HSS/LMS root key.
+ *
+ * A boot stage calls SecureBoot_VerifyImage on the next image, in place,
+ * before it runs it. The image is signed on the host with
+ * tools/lms_sign.py. The signature is a hash-based HSS signature
+ * (crypto/lms.h), so it holds against quantum attacks and needs only
+ * SHA-256 on the device.
+ *
+ * The root public key is pinned once, at SecureBoot_Init, normally from
+ * OTP or ROM. A signature must carry exactly the root key's level count,
+ * and each LMS level must use the types its key declares. Anything else is
+ * rejected before any hashing.
+ *
+ * Cost is one streaming SHA-256 pass over the image plus the Winternitz
+ * chains, about 500 hashes per level for W4. The chains run through the
+ * multi-buffer engine.
+ *
+ * Every rejection is traced as SECURE_TRACE_EVENT_BOOT_REJECT.
+ */
+
+#ifndef SECURE_BOOT_H
+#define SECURE_BOOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lms.h"
+
+// --- Reject Reasons (SECURE_TRACE_EVENT_BOOT_REJECT arg1) ---
+#define SECURE_BOOT_REJECT_NO_KEY       1   // SecureBoot_Init has not pinned a valid key
+#define SECURE_BOOT_REJECT_FORMAT       2   // Empty image, or signature levels do not match the key
+#define SECURE_BOOT_REJECT_SIGNATURE    3
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t images;                // SecureBoot_VerifyImage calls
+    uint32_t accepted;
+    uint32_t rejected;
+} SecureBootStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Pins the root public key that every image must verify under.
+ *
+ * @param root_pub HSS public key, HSS_PUBLIC_KEY_BYTES.
+ * @return False if the key is malformed; images are then all rejected.
+ */
+bool SecureBoot_Init(const uint8_t *root_pub, uint32_t root_pub_len);
+
+/**
+ * @brief Verifies an image against the pinned root key.
+ *
+ * @param sig HSS signature over the whole image.
+ * @return True only if the image may run.
+ */
+bool SecureBoot_VerifyImage(const uint8_t *image, uint32_t image_len, const uint8_t *sig, uint32_t sig_len);
+
+const SecureBootStats *SecureBoot_Stats(void);
+
+#endif // SECURE_BOOT_H
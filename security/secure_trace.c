@@ -0,0 +1,245 @@
+/**
+ * @file secure_trace.c
+ * @brief Implementation of the HMAC-chained security event trace.
+ */
+
+#include "secure_trace.h"
+#include "cycle_counter.h"
+#include "zeroize.h"
+
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(sizeof(SecureTraceRecord) == 16, "verifier expects 16-byte records");
+_Static_assert(sizeof(SecureTraceExportHeader) == 48, "verifier expects a 48-byte export header");
+_Static_assert(sizeof(SecureTraceExportTrailer) == 40, "verifier expects a 40-byte export trailer");
+
+// --- Private Variables ---
+// Blocks are numbered from 0 at Init; block n lives in Ring[n % SECURE_TRACE_BLOCKS].
+static SecureTraceBlock Ring[SECURE_TRACE_BLOCKS];
+static uint32_t FirstSeq;           // Oldest retained block
+static uint32_t SealSeq;            // Oldest unsealed block
+static uint32_t OpenSeq;            // Block being filled
+static SecureTraceBlock *Open;
+static uint8_t ChainMac[HMAC_SHA256_BYTES];     // MAC of block SealSeq - 1
+static uint8_t AnchorMac[HMAC_SHA256_BYTES];    // MAC of block FirstSeq - 1
+static uint32_t BootId;
+static HmacSha256Key TraceKey;
+static bool Ready;
+static bool Frozen;                 // Sealed by SecureTrace_Tamper; FrozenTrailer is valid
+static SecureTraceExportTrailer FrozenTrailer;
+static volatile bool Busy;          // The superloop is changing the ring
+static SecureTraceStats Stats;
+
+static const char GenesisLabel[12] = { 'S', 'E', 'C', 'U', 'R', 'E', '_', 'T', 'R', 'A', 'C', 'E' };
+static const char ExportLabel[12] = { 'T', 'R', 'A', 'C', 'E', '_', 'E', 'X', 'P', 'O', 'R', 'T' };
+
+// --- Private Helper Functions ---
+
+// Bracket every change to the ring made outside the tamper interrupt. The
+// barriers keep the compiler from moving ring stores outside the bracket.
+static void EnterRing(void) {
+    Busy = true;
+    __asm__ volatile("" : : : "memory");
+}
+
+static void LeaveRing(void) {
+    __asm__ volatile("" : : : "memory");
+    Busy = false;
+}
+
+static void StartBlock(uint32_t seq) {
+    Open = &Ring[seq % SECURE_TRACE_BLOCKS];
+    Open->magic = SECURE_TRACE_BLOCK_MAGIC;
+    Open->sequence = seq;
+    Open->count = 0;
+    Open->reserved = 0;
+}
+
+static void SealOne(void) {
+    uint32_t start = CycleCounter_Read();
+    SecureTraceBlock *b = &Ring[SealSeq % SECURE_TRACE_BLOCKS];
+    HmacSha256Ctx ctx;
+    HmacSha256_Init(&ctx, &TraceKey);
+    HmacSha256_Update(&ctx, ChainMac, sizeof(ChainMac));
+    HmacSha256_Update(&ctx, b, (uint32_t)offsetof(SecureTraceBlock, records) + b->count * sizeof(SecureTraceRecord));
+    HmacSha256_Final(&ctx, b->mac);
+    memcpy(ChainMac, b->mac, sizeof(ChainMac));
+    SealSeq++;
+    Stats.blocks_sealed++;
+    Stats.last_seal_cycles = CycleCounter_Elapsed(start);
+}
+
+// Slow path, once per SECURE_TRACE_BLOCK_RECORDS events
+static void AdvanceBlock(void) {
+    OpenSeq++;
+    if (OpenSeq - FirstSeq == SECURE_TRACE_BLOCKS) {
+        // The next slot holds the oldest block: seal it if Poll has not, then retire it
+        if (SealSeq == FirstSeq) {
+            SealOne();
+            Stats.forced_seals++;
+        }
+        memcpy(AnchorMac, Ring[FirstSeq % SECURE_TRACE_BLOCKS].mac, sizeof(AnchorMac));
+        FirstSeq++;
+        Stats.blocks_retired++;
+    }
+    StartBlock(OpenSeq);
+}
+
+static void AppendRecord(uint16_t type, uint32_t arg0, uint32_t arg1) {
+    SecureTraceRecord *r = &Open->records[Open->count];
+    r->timestamp = CycleCounter_Read();
+    r->type = type;
+    r->reserved = 0;
+    r->arg0 = arg0;
+    r->arg1 = arg1;
+    Stats.events++;
+    if (++Open->count == SECURE_TRACE_BLOCK_RECORDS) {
+        AdvanceBlock();
+    }
+}
+
+// Closes the open block and seals everything up to it
+static void SealAll(void) {
+    if (Open->count > 0) {
+        AdvanceBlock();
+    }
+    while (SealSeq != OpenSeq) {
+        SealOne();
+    }
+}
+
+static void BuildHeader(SecureTraceExportHeader *header) {
+    memset(header, 0, sizeof(*header));
+    header->magic = SECURE_TRACE_EXPORT_MAGIC;
+    header->version = SECURE_TRACE_EXPORT_VERSION;
+    header->block_count = (uint16_t)(SealSeq - FirstSeq);
+    header->block_bytes = sizeof(SecureTraceBlock);
+    header->boot_id = BootId;
+    memcpy(header->anchor, AnchorMac, sizeof(header->anchor));
+}
+
+// Binds both ends of the chain; ChainMac is the anchor when no block is sealed
+static void BuildTrailer(const SecureTraceExportHeader *header, SecureTraceExportTrailer *trailer) {
+    trailer->first_sequence = FirstSeq;
+    trailer->last_sequence = SealSeq - 1U;
+    HmacSha256Ctx ctx;
+    HmacSha256_Init(&ctx, &TraceKey);
+    HmacSha256_Update(&ctx, ExportLabel, sizeof(ExportLabel));
+    HmacSha256_Update(&ctx, header, sizeof(*header));
+    HmacSha256_Update(&ctx, trailer, (uint32_t)offsetof(SecureTraceExportTrailer, mac));
+    HmacSha256_Update(&ctx, ChainMac, sizeof(ChainMac));
+    HmacSha256_Final(&ctx, trailer->mac);
+}
+
+// --- Public Function Implementations ---
+
+bool SecureTrace_Init(const uint8_t *key, uint32_t key_len, uint32_t boot_id) {
+    if (key == NULL || key_len == 0) {
+        return false;
+    }
+    HmacSha256_SetKey(&TraceKey, key, key_len);
+    Zeroize_Register(&TraceKey, sizeof(TraceKey), ZEROIZE_PRIORITY_MIDSTATE);
+    memset(&Stats, 0, sizeof(Stats));
+    FirstSeq = 0;
+    SealSeq = 0;
+    OpenSeq = 0;
+    BootId = boot_id;
+    Frozen = false;
+
+    // Genesis: HMAC(K, "SECURE_TRACE" || boot_id), boot_id little-endian
+    HmacSha256Ctx ctx;
+    HmacSha256_Init(&ctx, &TraceKey);
+    HmacSha256_Update(&ctx, GenesisLabel, sizeof(GenesisLabel));
+    HmacSha256_Update(&ctx, &boot_id, sizeof(boot_id));
+    HmacSha256_Final(&ctx, ChainMac);
+    memcpy(AnchorMac, ChainMac, sizeof(AnchorMac));
+
+    StartBlock(0);
+    Ready = true;
+    SecureTrace_Event(SECURE_TRACE_EVENT_BOOT, boot_id, 0);
+    return true;
+}
+
+void SecureTrace_Event(uint16_t type, uint32_t arg0, uint32_t arg1) {
+    if (!Ready) {
+        return;
+    }
+    EnterRing();
+    AppendRecord(type, arg0, arg1);
+    LeaveRing();
+}
+
+void SecureTrace_Poll(void) {
+    if (!Ready) {
+        return;
+    }
+    EnterRing();
+    while (SealSeq != OpenSeq) {
+        SealOne();
+    }
+    LeaveRing();
+}
+
+uint32_t SecureTrace_Export(uint8_t *out, uint32_t out_len) {
+    if (!Ready && !Frozen) {
+        return 0;
+    }
+    EnterRing();
+    if (Ready) {
+        SealAll();
+    }
+    uint32_t total = (uint32_t)sizeof(SecureTraceExportHeader) +
+                     (SealSeq - FirstSeq) * (uint32_t)sizeof(SecureTraceBlock) +
+                     (uint32_t)sizeof(SecureTraceExportTrailer);
+    if (out == NULL || out_len < total) {
+        LeaveRing();
+        return 0;
+    }
+    SecureTraceExportHeader header;
+    BuildHeader(&header);
+    memcpy(out, &header, sizeof(header));
+    uint8_t *p = out + sizeof(header);
+    for (uint32_t seq = FirstSeq; seq != SealSeq; seq++) {
+        memcpy(p, &Ring[seq % SECURE_TRACE_BLOCKS], sizeof(SecureTraceBlock));
+        p += sizeof(SecureTraceBlock);
+    }
+    if (Frozen) {
+        memcpy(p, &FrozenTrailer, sizeof(FrozenTrailer));
+    } else {
+        SecureTraceExportTrailer trailer;
+        BuildTrailer(&header, &trailer);
+        memcpy(p, &trailer, sizeof(trailer));
+    }
+    LeaveRing();
+    return total;
+}
+
+void SecureTrace_Tamper(uint32_t sensors) {
+    if (!Ready) {
+        return;
+    }
+    if (Busy) {
+        Stats.tamper_lost++;
+        return;
+    }
+    uint32_t start = CycleCounter_Read();
+    AppendRecord(SECURE_TRACE_EVENT_TAMPER, sensors, 0);
+    AppendRecord(SECURE_TRACE_EVENT_ZEROIZE, Zeroize_RegisteredBytes(), 0);
+    SealAll();
+    SecureTraceExportHeader header;
+    BuildHeader(&header);
+    BuildTrailer(&header, &FrozenTrailer);
+    Frozen = true;
+    Ready = false;
+    Stats.tamper_cycles = CycleCounter_Elapsed(start);
+}
+
+void SecureTrace_Zeroize(void) {
+    Ready = false;
+    HmacSha256_ClearKey(&TraceKey);
+}
+
+const SecureTraceStats *SecureTrace_Stats(void) {
+    return &Stats;
+}
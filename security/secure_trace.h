@@ -0,0 +1,182 @@
+/**
+ * @file secure_trace.h
+ * @brief Tamper-evident trace of security events, exported for host verification.
+ *
+ * Security events (violations, key use, tag failures, tamper, zeroisation)
+ * are appended as 16-byte records to the open block of a RAM ring. A full
+ * block is sealed with
+ *
+ *     mac[n] = HMAC-SHA256(K, mac[n-1] || header[n] || records[n])
+ *
+ * so the blocks form a chain. Changing, removing or reordering any record
+ * or block breaks every later MAC. The chain starts from
+ * mac[-1] = HMAC-SHA256(K, "SECURE_TRACE" || boot_id).
+ *
+ * The chain alone does not protect its ends: dropping the newest blocks, or
+ * dropping the oldest and moving its MAC into the anchor, leaves a chain
+ * that still verifies. Each export therefore ends with
+ *
+ *     export_mac = HMAC-SHA256(K, "TRACE_EXPORT" || export header ||
+ *                              first sequence || last sequence || last MAC)
+ *
+ * which fixes the anchor, the block range and the chain head the device
+ * exported. An older export of the same boot still verifies; it is a true
+ * earlier state of the chain, and the verifier prints its last sequence.
+ *
+ * Cost:
+ *  - SecureTrace_Event() only stores the record: a cycle counter read and
+ *    a few stores, tens of cycles.
+ *  - Sealing (one HMAC over a 560-byte block) runs from SecureTrace_Poll()
+ *    in the superloop. If the ring wraps onto a block that is still
+ *    unsealed, the event that wraps seals it itself, so nothing is lost.
+ *  - When the ring is full, the oldest sealed block is retired. Its MAC
+ *    becomes the anchor that the next export starts from.
+ *
+ * Records in the open block are not protected until it is sealed.
+ * SecureTrace_Event is not reentrant: call it from one context, or with
+ * interrupts masked. The one exception is SecureTrace_Tamper(), which the
+ * tamper response calls from its interrupt before the key is wiped.
+ *
+ * tools/verify_trace.py checks an export produced by SecureTrace_Export().
+ */
+
+#ifndef SECURE_TRACE_H
+#define SECURE_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hmac_sha256.h"
+
+// --- Sizing ---
+#define SECURE_TRACE_BLOCK_RECORDS  32  // Events per MAC
+#define SECURE_TRACE_BLOCKS         8   // Ring length; 8 * 560 bytes of RAM
+
+#define SECURE_TRACE_BLOCK_MAGIC    0x43525453UL    // "STRC"
+#define SECURE_TRACE_EXPORT_MAGIC   0x58525453UL    // "STRX"
+#define SECURE_TRACE_EXPORT_VERSION 2
+
+// --- Event Types ---
+#define SECURE_TRACE_EVENT_BOOT         1   // arg0: boot id
+#define SECURE_TRACE_EVENT_VIOLATION    2   // arg0: constraint id
+#define SECURE_TRACE_EVENT_KEY_USE      3   // arg0: SECURE_TRACE_KEY_*, arg1: SECURE_TRACE_KEY_OP_*
+#define SECURE_TRACE_EVENT_TAG_FAIL     4   // arg0: session id
+#define SECURE_TRACE_EVENT_TAMPER       5   // arg0: sensor mask
+#define SECURE_TRACE_EVENT_ZEROIZE      6   // arg0: bytes registered for the wipe that follows
+#define SECURE_TRACE_EVENT_CERT_REJECT  7   // arg0: chain position, arg1: CERT_REJECT_* reason
+#define SECURE_TRACE_EVENT_BOOT_REJECT  8   // arg0: image length, arg1: SECURE_BOOT_REJECT_* reason
+#define SECURE_TRACE_EVENT_GLITCH       9   // arg0: sensor, arg1: glitches filtered since the last report
+
+// --- Key Use ---
+#define SECURE_TRACE_KEY_ECDSA          1   // P-256 signing key
+#define SECURE_TRACE_KEY_RSA            2   // RSA private key
+#define SECURE_TRACE_KEY_OP_SIGN        1   // Signature from a precomputed pool entry
+#define SECURE_TRACE_KEY_OP_SIGN_ONLINE 2   // Signature computed in full; the pool was empty
+
+// --- Public Types ---
+
+typedef struct {
+    uint32_t timestamp;         // CycleCounter ticks
+    uint16_t type;              // SECURE_TRACE_EVENT_*
+    uint16_t reserved;
+    uint32_t arg0;
+    uint32_t arg1;
+} SecureTraceRecord;
+
+typedef struct {
+    uint32_t          magic;    // SECURE_TRACE_BLOCK_MAGIC
+    uint32_t          sequence; // Block number since Init
+    uint32_t          count;    // Records used
+    uint32_t          reserved;
+    SecureTraceRecord records[SECURE_TRACE_BLOCK_RECORDS];
+    uint8_t           mac[HMAC_SHA256_BYTES];
+} SecureTraceBlock;
+
+typedef struct {
+    uint32_t magic;             // SECURE_TRACE_EXPORT_MAGIC
+    uint16_t version;
+    uint16_t block_count;
+    uint32_t block_bytes;       // sizeof(SecureTraceBlock)
+    uint32_t boot_id;
+    uint8_t  anchor[HMAC_SHA256_BYTES];     // MAC chained into the first exported block
+} SecureTraceExportHeader;
+
+typedef struct {
+    uint32_t first_sequence;    // Sequence of the first exported block
+    uint32_t last_sequence;     // Of the last one; first_sequence - 1 if none
+    uint8_t  mac[HMAC_SHA256_BYTES];        // export_mac, see above
+} SecureTraceExportTrailer;
+
+typedef struct {
+    uint32_t events;
+    uint32_t blocks_sealed;
+    uint32_t forced_seals;      // Sealed by SecureTrace_Event because Poll fell behind
+    uint32_t blocks_retired;
+    uint32_t last_seal_cycles;
+    uint32_t tamper_cycles;     // Spent by SecureTrace_Tamper
+    uint32_t tamper_lost;       // Tamper responses that found the ring mid-update
+} SecureTraceStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Keys the trace and starts a new chain.
+ *
+ * @param key     MAC key, provisioned per device.
+ * @param boot_id Distinguishes the chains of different boots.
+ */
+bool SecureTrace_Init(const uint8_t *key, uint32_t key_len, uint32_t boot_id);
+
+/**
+ * @brief Appends one event. Does nothing before SecureTrace_Init.
+ */
+void SecureTrace_Event(uint16_t type, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief Seals every full block. Call from the superloop or idle time.
+ */
+void SecureTrace_Poll(void);
+
+/**
+ * @brief Seals the open block and writes the retained chain.
+ *
+ * Output: SecureTraceExportHeader, the blocks oldest first, then
+ * SecureTraceExportTrailer. After SecureTrace_Tamper, writes the chain
+ * it froze, even though the key is gone.
+ *
+ * @return Bytes written, or 0 if out_len is too small or there is no chain.
+ */
+uint32_t SecureTrace_Export(uint8_t *out, uint32_t out_len);
+
+/**
+ * @brief Records a tamper response and freezes the chain while the key is intact.
+ *
+ * Call from the tamper response, before Zeroize_All. Appends TAMPER and
+ * ZEROIZE records, seals every unsealed block and computes the export MAC,
+ * then ignores further events. The export then ends with those two
+ * records, so the wipe cannot be hidden by cutting the chain short.
+ *
+ * Costs one HMAC per unsealed block plus one for the export: normally the
+ * open block alone, at most SECURE_TRACE_BLOCKS + 1.
+ *
+ * If the interrupt lands while the superloop is inside SecureTrace_Event,
+ * SecureTrace_Poll or SecureTrace_Export, the chain is half updated and
+ * cannot be sealed. Nothing is recorded then (stats.tamper_lost), and once
+ * the key is wiped nothing can be exported either.
+ *
+ * @param sensors TAMPER_SENSOR_* bits that triggered the response.
+ */
+void SecureTrace_Tamper(uint32_t sensors);
+
+/**
+ * @brief Wipes the trace key and stops tracing.
+ *
+ * Safe from the tamper response: a seal in progress finishes with a
+ * zeroed key and its MAC will not verify. Events are then ignored until
+ * SecureTrace_Init.
+ */
+void SecureTrace_Zeroize(void);
+
+const SecureTraceStats *SecureTrace_Stats(void);
+
+#endif // SECURE_TRACE_H
@@ -0,0 +1,187 @@
+/**
+ * @file tamper_monitor.c
+ * @brief Implementation of the interrupt-driven tamper monitor.
+ */
+
+#include "tamper_monitor.h"
+#include "cycle_counter.h"
+#include "secure_trace.h"
+
+#include <string.h>
+
+// --- Private Variables ---
+// Shared by the two handlers, which run at the same priority
+static uint32_t DebounceTicks;
+static TamperResponse Respond;
+static void *RespondCtx;
+static uint32_t Enabled;            // Sensors whose interrupt is unmasked
+static uint32_t Pending;            // Sensors being debounced
+static uint32_t EdgeAt[TAMPER_SENSOR_COUNT];    // Timer count at each pending edge
+static uint32_t WindowStart;        // Timer count where the glitch window opened
+static uint32_t WindowGlitches;     // Glitches filtered since WindowStart
+static volatile uint32_t Glitches[TAMPER_SENSOR_COUNT];    // Written by the timer handler only
+static uint32_t Reported[TAMPER_SENSOR_COUNT];  // Written by TamperMonitor_Poll only
+static TamperMonitorStats Stats;
+
+// --- Private Helper Functions ---
+
+static uint32_t CountBits(uint32_t mask) {
+    uint32_t n = 0;
+    for (; mask != 0; mask &= mask - 1U) {
+        n++;
+    }
+    return n;
+}
+
+static void StartDebounce(uint32_t sensors) {
+    Tamper_HwDisable(sensors);
+    Tamper_HwClear(sensors);
+    Enabled &= ~sensors;
+
+    uint32_t now = Tamper_HwTimerNow();
+    for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+        if (sensors & (1UL << s)) {
+            EdgeAt[s] = now;
+        }
+    }
+    // A running timer expires first; the handler reschedules for later edges
+    if (Pending == 0) {
+        Tamper_HwStartTimer(DebounceTicks);
+    }
+    Pending |= sensors;
+    Stats.edges += CountBits(sensors);
+}
+
+// True once the glitches in the current window reach the limit
+static bool GlitchRun(uint32_t now, uint32_t released) {
+    if (now - WindowStart >= TAMPER_MONITOR_GLITCH_WINDOW_TICKS) {
+        WindowStart = now;
+        WindowGlitches = 0;
+    }
+    WindowGlitches += CountBits(released);
+    return WindowGlitches >= TAMPER_MONITOR_GLITCH_LIMIT;
+}
+
+// --- Interrupt Handlers ---
+
+void Tamper_SensorIrqHandler(void) {
+    uint32_t start = CycleCounter_Read();
+    uint32_t edges = Tamper_HwLatched() & Enabled;
+    if (edges != 0) {
+        StartDebounce(edges);
+    }
+    Stats.isr_cycles += CycleCounter_Elapsed(start);
+}
+
+void Tamper_TimerIrqHandler(void) {
+    uint32_t start = CycleCounter_Read();
+    uint32_t now = Tamper_HwTimerNow();
+    uint32_t level = Tamper_HwLevel();
+    uint32_t confirmed = 0;
+    uint32_t released = 0;
+    uint32_t next = UINT32_MAX;
+
+    for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+        uint32_t bit = 1UL << s;
+        if ((Pending & bit) == 0) {
+            continue;
+        }
+        uint32_t age = now - EdgeAt[s];
+        if ((level & bit) == 0) {
+            released |= bit;
+        } else if (age >= DebounceTicks) {
+            confirmed |= bit;
+            Stats.last_latency_ticks = age;
+            if (age > Stats.max_latency_ticks) {
+                Stats.max_latency_ticks = age;
+            }
+        } else if (DebounceTicks - age < next) {
+            next = DebounceTicks - age;
+        }
+    }
+    Pending &= ~(confirmed | released);
+
+    if (released != 0) {
+        // The line dropped inside the window: a glitch. One is noise; a run
+        // of them is fault injection and gets the full response.
+        Stats.filtered += CountBits(released);
+        for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+            if (released & (1UL << s)) {
+                Glitches[s]++;
+            }
+        }
+        if (GlitchRun(now, released)) {
+            Stats.escalations++;
+            confirmed |= released;
+            released = 0;
+        }
+    }
+    if (confirmed != 0) {
+        Stats.tripped |= confirmed;
+        Stats.confirmed += CountBits(confirmed);
+        uint32_t respond_start = CycleCounter_Read();
+        if (Respond != NULL) {
+            Respond(confirmed, RespondCtx);
+        }
+        Stats.response_cycles = CycleCounter_Elapsed(respond_start);
+    }
+    if (released != 0) {
+        Tamper_HwClear(released);
+        Enabled |= released;
+        Tamper_HwEnable(released);
+    }
+    if (Pending != 0) {
+        Tamper_HwStartTimer(next);
+    }
+    Stats.isr_cycles += CycleCounter_Elapsed(start);
+}
+
+// --- Public Function Implementations ---
+
+bool TamperMonitor_Init(uint32_t debounce_ticks, TamperResponse respond, void *ctx) {
+    if (debounce_ticks == 0 || Tamper_HwPresent() == 0) {
+        return false;
+    }
+    Tamper_HwDisable(TAMPER_SENSOR_ALL);
+    DebounceTicks = debounce_ticks;
+    Respond = respond;
+    RespondCtx = ctx;
+    Pending = 0;
+    memset(&Stats, 0, sizeof(Stats));
+    WindowStart = Tamper_HwTimerNow();
+    WindowGlitches = 0;
+    for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+        Glitches[s] = 0;
+        Reported[s] = 0;
+    }
+
+    Tamper_HwClear(TAMPER_SENSOR_ALL);
+    Enabled = TAMPER_SENSOR_ALL;
+    Tamper_HwEnable(TAMPER_SENSOR_ALL);
+
+    // A detector already high at arming has no edge to latch: debounce it now
+    uint32_t high = Tamper_HwLevel() & Enabled;
+    if (high != 0) {
+        StartDebounce(high);
+    }
+    return true;
+}
+
+void TamperMonitor_Poll(void) {
+    for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+        uint32_t seen = Glitches[s];
+        if (seen != Reported[s]) {
+            SecureTrace_Event(SECURE_TRACE_EVENT_GLITCH, 1UL << s, seen - Reported[s]);
+            Stats.traced += seen - Reported[s];
+            Reported[s] = seen;
+        }
+    }
+}
+
+bool TamperMonitor_Armed(void) {
+    return (Enabled | Pending) == TAMPER_SENSOR_ALL;
+}
+
+const TamperMonitorStats *TamperMonitor_Stats(void) {
+    return &Stats;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file tamper_monitor.h
+ * @brief Interrupt-driven response to voltage, clock and temperature glitches.
+ *
+ * Detection runs entirely in interrupts. A detector edge raises the sensor
+ * interrupt, which masks that sensor and starts the debounce timer
+ * (hal/tamper.h). When the timer expires, a sensor whose output is still
+ * high has been asserted for the whole debounce window and is confirmed;
+ * one that has dropped was a glitch on the line and is re-armed.
+ *
+ * A single glitch is noise, but a train of them is what voltage or clock
+ * fault injection looks like. Once TAMPER_MONITOR_GLITCH_LIMIT glitches
+ * are filtered within one TAMPER_MONITOR_GLITCH_WINDOW_TICKS window, the
+ * sensors of the last one are confirmed as if they had held, so the
+ * response runs.
+ *
+ * A confirmed sensor calls the response (key zeroisation) from the timer
+ * interrupt itself. Response time is therefore fixed by the debounce
+ * window, not by how often a loop happens to poll:
+ *
+ *     edge -> response <= debounce_ticks + two interrupt entries
+ *
+ * Each sensor is debounced from its own edge. A sensor that asserts while
+ * another is being debounced is not confirmed early. A confirmed sensor
+ * stays masked: the response runs once per sensor until TamperMonitor_Init
+ * is called again.
+ *
+ * Give the sensor and timer interrupts the same priority so that the
+ * handlers never preempt each other. The response runs at that priority:
+ * it must be bounded and must not take locks held by the superloop.
+ *
+ * Filtered glitches are also recorded in the secure trace. SecureTrace_Event
+ * is not reentrant, so the handlers only count them and
+ * TamperMonitor_Poll() writes the events from the superloop.
+ */
+
+#ifndef TAMPER_MONITOR_H
+#define TAMPER_MONITOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tamper.h"
+
+#define TAMPER_MONITOR_DEBOUNCE_TICKS   20U     // 20 us at TAMPER_TIMER_HZ
+#define TAMPER_MONITOR_GLITCH_LIMIT     16U     // Glitches per window that count as an attack
+#define TAMPER_MONITOR_GLITCH_WINDOW_TICKS  1000000U    // 1 s at TAMPER_TIMER_HZ
+
+// --- Public Types ---
+
+/**
+ * @brief Called from the timer interrupt when sensors are confirmed.
+ *
+ * @param sensors TAMPER_SENSOR_* bits confirmed by this expiry.
+ * @param ctx     Context given to TamperMonitor_Init.
+ */
+typedef void (*TamperResponse)(uint32_t sensors, void *ctx);
+
+typedef struct {
+    uint32_t edges;             // Sensor interrupts taken
+    uint32_t filtered;          // Edges that dropped before the window closed
+    uint32_t escalations;       // Glitch runs that triggered the response
+    uint32_t traced;            // Filtered glitches written to the secure trace
+    uint32_t confirmed;         // Sensors that triggered the response
+    uint32_t tripped;           // TAMPER_SENSOR_* bits confirmed so far
+    uint32_t last_latency_ticks;    // Edge to response, timer ticks
+    uint32_t max_latency_ticks;
+    uint32_t response_cycles;   // Cycles spent in the last response
+    uint32_t isr_cycles;        // Cycles spent in both handlers, all time
+} TamperMonitorStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Clears state and arms every sensor.
+ *
+ * @param debounce_ticks Window a detector must stay asserted, in timer ticks.
+ * @param respond        Zeroisation hook; NULL only counts.
+ * @return False if debounce_ticks is 0 or the part has no detectors
+ *         (hal/tamper.h); nothing is armed then.
+ */
+bool TamperMonitor_Init(uint32_t debounce_ticks, TamperResponse respond, void *ctx);
+
+/**
+ * @brief Writes glitches filtered since the last call to the secure trace.
+ *
+ * Call from the superloop, the one context that writes trace events.
+ */
+void TamperMonitor_Poll(void);
+
+/**
+ * @brief True while every sensor is armed or being debounced.
+ */
+bool TamperMonitor_Armed(void);
+
+const TamperMonitorStats *TamperMonitor_Stats(void);
+
+#endif // TAMPER_MONITOR_H
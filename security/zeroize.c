@@ -0,0 +1,199 @@
+/**
+ * @file zeroize.c
+ * @brief Implementation of the zeroisation registry and wipe.
+ */
+
+#include "zeroize.h"
+#include "cycle_counter.h"
+#include "ramfunc.h"
+
+#include <string.h>
+
+#if defined(__AVX2__)
+#define ZEROIZE_AVX2
+#include <immintrin.h>
+#define ZEROIZE_ALIGN               32U
+#elif defined(__SSE2__)
+#define ZEROIZE_SSE2
+#include <emmintrin.h>
+#define ZEROIZE_ALIGN               16U
+#else
+#define ZEROIZE_ALIGN               4U
+#endif
+
+// Keeps the compiler from treating the stores to ptr as dead
+#define ZEROIZE_BARRIER(ptr)        __asm__ volatile("" : : "r"(ptr) : "memory")
+
+// --- Private Variables ---
+static ZeroizeRange Ranges[ZEROIZE_MAX_RANGES];    // Sorted by priority, then registration order
+static uint32_t RangeCount;
+static ZeroizeStats Stats;
+
+// --- Private Helper Functions ---
+
+static RAMFUNC bool RangeIsZero(const ZeroizeRange *r) {
+    const volatile uint8_t *p = (const volatile uint8_t *)r->base;
+    uint32_t n = r->bytes;
+    uint32_t acc = 0;
+    while (n > 0 && ((uintptr_t)p & 3U) != 0) {
+        acc |= *p++;
+        n--;
+    }
+    const volatile uint32_t *w = (const volatile uint32_t *)p;
+    for (; n >= 4; n -= 4) {
+        acc |= *w++;
+    }
+    p = (const volatile uint8_t *)w;
+    while (n > 0) {
+        acc |= *p++;
+        n--;
+    }
+    return acc == 0;
+}
+
+static RAMFUNC void ClearBytes(const ZeroizeRange *r) {
+    volatile uint8_t *p = (volatile uint8_t *)r->base;
+    for (uint32_t i = 0; i < r->bytes; i++) {
+        p[i] = 0;
+    }
+}
+
+// --- Public Function Implementations ---
+
+bool Zeroize_Register(void *base, uint32_t bytes, uint8_t priority) {
+    if (base == NULL || bytes == 0) {
+        return false;
+    }
+    Zeroize_Unregister(base);
+    if (RangeCount == ZEROIZE_MAX_RANGES) {
+        return false;
+    }
+    // Insert after the last range of the same or higher priority
+    uint32_t at = RangeCount;
+    while (at > 0 && Ranges[at - 1].priority > priority) {
+        Ranges[at] = Ranges[at - 1];
+        at--;
+    }
+    Ranges[at].base = (uintptr_t)base;
+    Ranges[at].bytes = bytes;
+    Ranges[at].priority = priority;
+    RangeCount++;
+    return true;
+}
+
+bool Zeroize_Unregister(void *base) {
+    for (uint32_t i = 0; i < RangeCount; i++) {
+        if (Ranges[i].base == (uintptr_t)base) {
+            memmove(&Ranges[i], &Ranges[i + 1], (RangeCount - i - 1) * sizeof(Ranges[0]));
+            RangeCount--;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t Zeroize_RegisteredBytes(void) {
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < RangeCount; i++) {
+        total += Ranges[i].bytes;
+    }
+    return total;
+}
+
+RAMFUNC void Zeroize_Range(void *base, uint32_t bytes) {
+    uint8_t *p = (uint8_t *)base;
+    while (bytes > 0 && ((uintptr_t)p & (ZEROIZE_ALIGN - 1U)) != 0) {
+        *p++ = 0;
+        bytes--;
+    }
+#if defined(ZEROIZE_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    for (; bytes >= 128; bytes -= 128, p += 128) {
+        _mm256_store_si256((__m256i *)p, zero);
+        _mm256_store_si256((__m256i *)(p + 32), zero);
+        _mm256_store_si256((__m256i *)(p + 64), zero);
+        _mm256_store_si256((__m256i *)(p + 96), zero);
+    }
+    for (; bytes >= 32; bytes -= 32, p += 32) {
+        _mm256_store_si256((__m256i *)p, zero);
+    }
+#elif defined(ZEROIZE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; bytes >= 64; bytes -= 64, p += 64) {
+        _mm_store_si128((__m128i *)p, zero);
+        _mm_store_si128((__m128i *)(p + 16), zero);
+        _mm_store_si128((__m128i *)(p + 32), zero);
+        _mm_store_si128((__m128i *)(p + 48), zero);
+    }
+    for (; bytes >= 16; bytes -= 16, p += 16) {
+        _mm_store_si128((__m128i *)p, zero);
+    }
+#else
+    // Four word stores per iteration, unrolled
+    volatile uint32_t *w = (volatile uint32_t *)p;
+    for (; bytes >= 16; bytes -= 16, w += 4) {
+        w[0] = 0;
+        w[1] = 0;
+        w[2] = 0;
+        w[3] = 0;
+    }
+    for (; bytes >= 4; bytes -= 4) {
+        *w++ = 0;
+    }
+    p = (uint8_t *)w;
+#endif
+    while (bytes > 0) {
+        *p++ = 0;
+        bytes--;
+    }
+    ZEROIZE_BARRIER(base);
+}
+
+RAMFUNC bool Zeroize_All(void) {
+    uint32_t start = CycleCounter_Read();
+    uint32_t bytes = 0;
+    uint32_t i = 0;
+    for (; i < RangeCount && Ranges[i].priority < ZEROIZE_PRIORITY_BULK; i++) {
+        Zeroize_Range((void *)Ranges[i].base, Ranges[i].bytes);
+        bytes += Ranges[i].bytes;
+    }
+    Stats.secrets_cycles = CycleCounter_Elapsed(start);
+    for (; i < RangeCount; i++) {
+        Zeroize_Range((void *)Ranges[i].base, Ranges[i].bytes);
+        bytes += Ranges[i].bytes;
+    }
+    uint32_t wiped = CycleCounter_Elapsed(start);
+
+    uint32_t verify_start = CycleCounter_Read();
+    bool clean = true;
+    for (i = 0; i < RangeCount; i++) {
+        if (!RangeIsZero(&Ranges[i])) {
+            Stats.verify_failures++;
+            ClearBytes(&Ranges[i]);
+            clean = clean && RangeIsZero(&Ranges[i]);
+        }
+    }
+
+    Stats.wipes++;
+    Stats.bytes = bytes;
+    Stats.last_wipe_cycles = wiped;
+    if (wiped > Stats.max_wipe_cycles) {
+        Stats.max_wipe_cycles = wiped;
+    }
+    Stats.last_verify_cycles = CycleCounter_Elapsed(verify_start);
+    return clean;
+}
+
+const char *Zeroize_BackendName(void) {
+#if defined(ZEROIZE_AVX2)
+    return "avx2 32-byte stores";
+#elif defined(ZEROIZE_SSE2)
+    return "sse2 16-byte stores";
+#else
+    return "32-bit word stores";
+#endif
+}
+
+const ZeroizeStats *Zeroize_Stats(void) {
+    return &Stats;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file zeroize.h
+ * @brief Registry of secret-bearing memory and the wipe that clears it on tamper.
+ *
+ * Modules that hold key material register each range once, with a
+ * priority: the key store first, then expanded round keys, then hash and
+ * MAC midstates, then bulk buffers that may hold secrets in passing.
+ * Zeroize_All() clears the ranges in that order. Each range is cleared with
+ * the widest stores available (32-bit words, unrolled, on Cortex-M4; 16- or
+ * 32-byte vectors on the host), then everything is read back and any range
+ * that is not zero is cleared again byte by byte.
+ *
+ * The registry is a fixed array kept sorted at registration, so the wipe
+ * is one linear walk with no allocation or search. The wipe and verify
+ * code is RAMFUNC: it does not depend on flash reads that a glitch may
+ * corrupt.
+ *
+ * Worst case: the wipe is bounded by the registered bytes
+ * (Zeroize_RegisteredBytes()), at about one word per cycle on the M4
+ * store path, plus the same again to verify. Never register the stack, the
+ * registry itself or .ramfunc.
+ *
+ * Zeroize_All() may be called from the tamper response interrupt.
+ * Register and unregister from the superloop only.
+ */
+
+#ifndef ZEROIZE_H
+#define ZEROIZE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ZEROIZE_MAX_RANGES          16
+
+// --- Priorities: lower is wiped first ---
+#define ZEROIZE_PRIORITY_KEY_STORE  0   // Long-term keys
+#define ZEROIZE_PRIORITY_ROUND_KEYS 1   // Expanded key schedules
+#define ZEROIZE_PRIORITY_MIDSTATE   2   // Precomputed HMAC/hash states
+#define ZEROIZE_PRIORITY_BULK       3   // Buffers that may hold secrets
+
+// --- Public Types ---
+
+typedef struct {
+    uintptr_t base;
+    uint32_t  bytes;
+    uint8_t   priority;
+} ZeroizeRange;
+
+typedef struct {
+    uint32_t wipes;
+    uint32_t bytes;                 // Cleared by the last wipe
+    uint32_t secrets_cycles;        // Start of the last wipe until every non-bulk range was clear
+    uint32_t last_wipe_cycles;
+    uint32_t max_wipe_cycles;
+    uint32_t last_verify_cycles;
+    uint32_t verify_failures;       // Ranges found non-zero and cleared again
+} ZeroizeStats;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Adds a range to the registry, or updates the one at base.
+ *
+ * @return False if the registry is full or the arguments are invalid.
+ */
+bool Zeroize_Register(void *base, uint32_t bytes, uint8_t priority);
+
+/**
+ * @brief Removes the range at base.
+ */
+bool Zeroize_Unregister(void *base);
+
+uint32_t Zeroize_RegisteredBytes(void);
+
+/**
+ * @brief Clears one range with the wide store path.
+ *
+ * For modules that discard a secret themselves. Unlike memset, the stores
+ * are not removed by the optimiser.
+ */
+void Zeroize_Range(void *base, uint32_t bytes);
+
+/**
+ * @brief Clears every registered range in priority order, then verifies.
+ *
+ * @return True if every range read back as zero.
+ */
+bool Zeroize_All(void);
+
+/**
+ * @brief Name of the store path compiled in.
+ */
+const char *Zeroize_BackendName(void);
+
+const ZeroizeStats *Zeroize_Stats(void);
+
+#endif // ZEROIZE_H
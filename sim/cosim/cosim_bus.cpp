@@ -0,0 +1,166 @@
+/**
+ * @file cosim_bus.cpp
+ * @brief Bus-functional model driving the Verilated asic_top.
+ *
+ * Inputs are applied on the low phase of the clock, the model is evaluated
+ * to settle combinational outputs such as bus_req_ready_o, and then a full
+ * clock period is simulated. Responses are collected after each rising edge.
+ */
+
+#include "cosim_bus.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "Vasic_top.h"
+#include "verilated.h"
+
+// --- Private Defines and Constants ---
+#define COSIM_RESET_CYCLES          8
+#define COSIM_TIMEOUT_CYCLES        10000   // Per transaction, catches a hung bus
+#define COSIM_EXIT_CYCLE_LIMIT      2       // Run cut short: neither pass (0) nor fail (1)
+
+// --- Private State ---
+namespace {
+
+std::unique_ptr<VerilatedContext> g_context;
+std::unique_ptr<Vasic_top>        g_top;
+uint64_t                          g_cycles     = 0;
+uint64_t                          g_max_cycles = 0;
+uint32_t                          g_errors     = 0;
+
+void TickHandler() {
+    g_top->clk_i = 0;
+    g_top->eval();
+    g_context->timeInc(1);
+    g_top->clk_i = 1;
+    g_top->eval();
+    g_context->timeInc(1);
+    g_cycles++;
+
+    if (g_max_cycles != 0 && g_cycles >= g_max_cycles) {
+        std::printf("[ERROR] COSIM: cycle limit %llu reached, stopping.\n",
+                    static_cast<unsigned long long>(g_max_cycles));
+        CosimBus_Shutdown();
+        std::exit(COSIM_EXIT_CYCLE_LIMIT);
+    }
+}
+
+/**
+ * @brief Issues `words` requests back to back and collects their responses in order.
+ */
+void BurstHandler(bool write, uint32_t addr, const uint32_t *src, uint32_t *dst, size_t words) {
+    size_t issued = 0;
+    size_t received = 0;
+    uint64_t idle = 0;
+
+    while (received < words) {
+        bool drive = issued < words;
+        g_top->bus_req_valid_i = drive;
+        g_top->bus_req_we_i    = write;
+        g_top->bus_req_addr_i  = addr + static_cast<uint32_t>(issued * 4);
+        g_top->bus_req_wdata_i = (write && drive) ? src[issued] : 0;
+        g_top->bus_req_be_i    = 0xF;
+        g_top->eval();
+        bool accepted = drive && g_top->bus_req_ready_o;
+
+        TickHandler();
+        if (accepted) {
+            issued++;
+        }
+        if (g_top->bus_rsp_valid_o) {
+            if (g_top->bus_rsp_err_o) {
+                g_errors++;
+            }
+            if (dst != nullptr) {
+                dst[received] = g_top->bus_rsp_rdata_o;
+            }
+            received++;
+            idle = 0;
+        } else if (++idle > COSIM_TIMEOUT_CYCLES) {
+            std::fprintf(stderr, "[ERROR] COSIM: no response at 0x%08X after %d cycles.\n",
+                         addr + static_cast<uint32_t>(received * 4), COSIM_TIMEOUT_CYCLES);
+            std::exit(1);
+        }
+    }
+    g_top->bus_req_valid_i = 0;
+}
+
+} // namespace
+
+// --- Public Function Implementations ---
+
+bool CosimBus_Init(int argc, char **argv, uint64_t max_cycles) {
+    g_context = std::make_unique<VerilatedContext>();
+    g_context->commandArgs(argc, argv);
+    g_top = std::make_unique<Vasic_top>(g_context.get(), "asic_top");
+    if (!g_top) {
+        return false;
+    }
+
+    g_top->bus_req_valid_i = 0;
+    g_top->rst_ni = 0;
+    for (int i = 0; i < COSIM_RESET_CYCLES; i++) {
+        TickHandler();
+    }
+    g_top->rst_ni = 1;
+    TickHandler();
+
+    g_cycles = 0;
+    g_errors = 0;
+    g_max_cycles = max_cycles;
+    return true;
+}
+
+void CosimBus_Shutdown(void) {
+    if (g_top) {
+        g_top->final();
+    }
+    g_top.reset();
+    g_context.reset();
+}
+
+uint32_t CosimBus_Read32(uint32_t addr) {
+    uint32_t value = 0;
+    BurstHandler(false, addr, nullptr, &value, 1);
+    return value;
+}
+
+void CosimBus_Write32(uint32_t addr, uint32_t value) {
+    BurstHandler(true, addr, &value, nullptr, 1);
+}
+
+void CosimBus_WriteBurst(uint32_t addr, const uint32_t *src, size_t words) {
+    BurstHandler(true, addr, src, nullptr, words);
+}
+
+void CosimBus_ReadBurst(uint32_t addr, uint32_t *dst, size_t words) {
+    BurstHandler(false, addr, nullptr, dst, words);
+}
+
+void CosimBus_Idle(uint32_t cycles) {
+    for (uint32_t i = 0; i < cycles; i++) {
+        TickHandler();
+    }
+}
+
+uint64_t CosimBus_Cycles(void) {
+    return g_cycles;
+}
+
+uint32_t CosimBus_ErrorCount(void) {
+    return g_errors;
+}
+
+uint32_t CosimBus_ModelThreads(void) {
+#if defined(VERILATOR_VERSION_INTEGER) && VERILATOR_VERSION_INTEGER >= 5000000
+    return g_context ? g_context->threads() : 0;
+#else
+    return 1; // Verilator 4 fixes the thread count at verilation time
+#endif
+}
+
+bool CosimBus_IrqPending(void) {
+    return g_top && g_top->irq_o;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file cosim_bus.h
+ * @brief C interface to the co-simulation bus-functional model (BFM).
+ *
+ * The BFM owns the Verilated asic_top model and acts as the bus master in
+ * place of processor_core. Every call advances simulated time: a single
+ * access costs its full request/response round trip, while burst calls
+ * pipeline one request per cycle. Firmware normally reaches these through
+ * hal/asic_bus.h rather than calling them directly.
+ */
+
+#ifndef COSIM_BUS_H
+#define COSIM_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates the model and applies reset.
+ *
+ * @param argc,argv Forwarded to Verilator (e.g. +verilator+seed+N).
+ * @param max_cycles Simulation exits with status 2 after this many cycles, guarding against hung
+ *                   firmware (0 = no limit). A truncated run never reports success.
+ * @return True if the model was created successfully.
+ */
+bool CosimBus_Init(int argc, char **argv, uint64_t max_cycles);
+
+/**
+ * @brief Finishes the simulation and releases the model.
+ */
+void CosimBus_Shutdown(void);
+
+uint32_t CosimBus_Read32(uint32_t addr);
+void     CosimBus_Write32(uint32_t addr, uint32_t value);
+void     CosimBus_WriteBurst(uint32_t addr, const uint32_t *src, size_t words);
+void     CosimBus_ReadBurst(uint32_t addr, uint32_t *dst, size_t words);
+
+/**
+ * @brief Advances the clock without bus traffic (models firmware compute time).
+ */
+void CosimBus_Idle(uint32_t cycles);
+
+/**
+ * @brief Simulated clock cycles since reset was released.
+ */
+uint64_t CosimBus_Cycles(void);
+
+/**
+ * @brief Number of responses that carried a bus error since init.
+ */
+uint32_t CosimBus_ErrorCount(void);
+
+/**
+ * @brief Number of threads the Verilated model evaluates with.
+ */
+uint32_t CosimBus_ModelThreads(void);
+
+/**
+ * @brief Current level of the top-level interrupt line.
+ */
+bool CosimBus_IrqPending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COSIM_BUS_H
@@ -0,0 +1,68 @@
+/**
+ * @file cosim_main.cpp
+ * @brief Entry point of the Verilator co-simulation target.
+ *
+ * Usage: asic_cosim [--iterations N] [--max-cycles N] [verilator +args]
+ *
+ * Runs the firmware workload against the Verilated asic_top and reports
+ * per-path throughput (bytes per simulated cycle and MB/s at the configured
+ * system clock) plus simulator speed in simulated cycles per wall-clock
+ * second.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "cosim_bus.h"
+#include "cosim_workload.h"
+
+// --- Private Defines and Constants ---
+#define COSIM_SYSTEM_CLOCK_HZ       (120000000.0)   // config.json clock_settings.system_clock_hz
+#define COSIM_DEFAULT_ITERATIONS    100
+#define COSIM_DEFAULT_MAX_CYCLES    (500000000ULL)
+
+int main(int argc, char **argv) {
+    uint32_t iterations = COSIM_DEFAULT_ITERATIONS;
+    uint64_t max_cycles = COSIM_DEFAULT_MAX_CYCLES;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--iterations") == 0) {
+            iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 0));
+        } else if (std::strcmp(argv[i], "--max-cycles") == 0) {
+            max_cycles = std::strtoull(argv[++i], nullptr, 0);
+        }
+    }
+
+    if (!CosimBus_Init(argc, argv, max_cycles)) {
+        std::fprintf(stderr, "[FATAL] COSIM: could not create the model.\n");
+        return 1;
+    }
+
+    CosimWorkloadReport report;
+    auto wall_start = std::chrono::steady_clock::now();
+    CosimWorkload_Run(iterations, &report);
+    auto wall_end = std::chrono::steady_clock::now();
+    double wall_s = std::chrono::duration<double>(wall_end - wall_start).count();
+    uint64_t cycles = CosimBus_Cycles();
+
+    std::printf("\n%-24s %12s %12s %10s %10s\n", "path", "bytes", "cycles", "B/cycle", "MB/s");
+    for (uint32_t i = 0; i < report.path_count; i++) {
+        const CosimPathResult &p = report.paths[i];
+        double bpc = p.cycles ? static_cast<double>(p.bytes) / p.cycles : 0.0;
+        std::printf("%-24s %12llu %12llu %10.3f %10.1f\n", p.name,
+                    static_cast<unsigned long long>(p.bytes),
+                    static_cast<unsigned long long>(p.cycles),
+                    bpc, bpc * COSIM_SYSTEM_CLOCK_HZ / 1e6);
+    }
+
+    unsigned threads = CosimBus_ModelThreads();
+    std::printf("\n[INFO] COSIM: %llu cycles in %.3f s wall = %.0f sim cycles/s (%u model threads)\n",
+                static_cast<unsigned long long>(cycles), wall_s,
+                wall_s > 0 ? cycles / wall_s : 0.0, threads);
+    std::printf("[%s] COSIM: workload %s.\n", report.passed ? "INFO" : "ERROR",
+                report.passed ? "passed" : "FAILED");
+
+    CosimBus_Shutdown();
+    return report.passed ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file cosim_workload.h
+ * @brief Firmware-side throughput workload run under co-simulation.
+ */
+
+#ifndef COSIM_WORKLOAD_H
+#define COSIM_WORKLOAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Throughput measured for one firmware-to-hardware path.
+ */
+typedef struct {
+    const char *name;
+    uint64_t    bytes;
+    uint64_t    cycles;     // Simulated cycles spent on the path
+} CosimPathResult;
+
+#define COSIM_WORKLOAD_MAX_PATHS    8
+
+typedef struct {
+    CosimPathResult paths[COSIM_WORKLOAD_MAX_PATHS];
+    uint32_t        path_count;
+    bool            passed;     // All read-backs matched and no bus errors
+} CosimWorkloadReport;
+
+/**
+ * @brief Runs the firmware throughput paths through hal/asic_bus.h.
+ *
+ * @param iterations Number of times each path is repeated.
+ * @param report     Filled with per-path results.
+ */
+void CosimWorkload_Run(uint32_t iterations, CosimWorkloadReport *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COSIM_WORKLOAD_H
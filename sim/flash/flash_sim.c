@@ -0,0 +1,132 @@
+/**
+ * @file flash_sim.c
+ * @brief Implementation of the host flash simulator.
+ */
+
+#include "flash_sim.h"
+#include "flash.h"
+
+#define LOG_MODULE  LOG_MODULE_FLASH
+#include "log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// --- Private Variables ---
+static uint8_t FlashArray[FLASH_SIZE_BYTES];
+static uint32_t EraseCounts[FLASH_SECTOR_COUNT];
+static uint64_t BytesProgrammed;
+static bool PowerFailArmed;
+static bool PoweredOff;
+static uint32_t BytesUntilFailure;
+static bool Initialized;
+
+// --- Private Helper Functions ---
+
+static void LogHandler(const char *level, const char *message) {
+    printf("[%s] FLASH_SIM: %s\n", level, message);
+}
+
+static bool InRange(uint32_t address, uint32_t len) {
+    return address >= FLASH_BASE_ADDR && len <= FLASH_SIZE_BYTES &&
+           address - FLASH_BASE_ADDR <= FLASH_SIZE_BYTES - len;
+}
+
+static void EnsureInitialized(void) {
+    if (!Initialized) {
+        FlashSim_Reset();
+    }
+}
+
+// --- Flash Interface ---
+
+bool Flash_EraseSector(uint32_t address) {
+    EnsureInitialized();
+    if (!InRange(address, 1) || PoweredOff) {
+        return false;
+    }
+    uint32_t sector = (address - FLASH_BASE_ADDR) / FLASH_SECTOR_BYTES;
+    memset(&FlashArray[sector * FLASH_SECTOR_BYTES], FLASH_ERASED_BYTE, FLASH_SECTOR_BYTES);
+    EraseCounts[sector]++;
+    return true;
+}
+
+bool Flash_Program(uint32_t address, const void *data, uint32_t len) {
+    EnsureInitialized();
+    if (!InRange(address, len) || PoweredOff) {
+        return false;
+    }
+    const uint8_t *src = (const uint8_t *)data;
+    uint8_t *dst = &FlashArray[address - FLASH_BASE_ADDR];
+    for (uint32_t i = 0; i < len; i++) {
+        if (PowerFailArmed && BytesUntilFailure-- == 0) {
+            PoweredOff = true;
+            return false;
+        }
+        if ((src[i] & ~dst[i]) != 0) {
+            if (LOG_ENABLED(LOG_LEVEL_ERROR)) {
+                char msg[80];
+                snprintf(msg, sizeof(msg), "Program sets erased-0 bits at 0x%08lX.",
+                         (unsigned long)(address + i));
+                LogHandler("ERROR", msg);
+            }
+            return false;
+        }
+        dst[i] &= src[i];
+        BytesProgrammed++;
+    }
+    return true;
+}
+
+const void *Flash_Map(uint32_t address) {
+    EnsureInitialized();
+    return InRange(address, 1) ? &FlashArray[address - FLASH_BASE_ADDR] : NULL;
+}
+
+// --- Simulator Control ---
+
+void FlashSim_Reset(void) {
+    memset(FlashArray, FLASH_ERASED_BYTE, sizeof(FlashArray));
+    memset(EraseCounts, 0, sizeof(EraseCounts));
+    BytesProgrammed = 0;
+    PowerFailArmed = false;
+    PoweredOff = false;
+    Initialized = true;
+}
+
+void FlashSim_FailAfter(uint32_t bytes) {
+    EnsureInitialized();
+    PowerFailArmed = true;
+    BytesUntilFailure = bytes;
+}
+
+void FlashSim_PowerCycle(void) {
+    PowerFailArmed = false;
+    PoweredOff = false;
+}
+
+uint32_t FlashSim_EraseCount(uint32_t address) {
+    return InRange(address, 1) ? EraseCounts[(address - FLASH_BASE_ADDR) / FLASH_SECTOR_BYTES] : 0;
+}
+
+uint32_t FlashSim_TotalErases(void) {
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < FLASH_SECTOR_COUNT; i++) {
+        total += EraseCounts[i];
+    }
+    return total;
+}
+
+uint32_t FlashSim_MaxEraseCount(void) {
+    uint32_t max = 0;
+    for (uint32_t i = 0; i < FLASH_SECTOR_COUNT; i++) {
+        if (EraseCounts[i] > max) {
+            max = EraseCounts[i];
+        }
+    }
+    return max;
+}
+
+uint64_t FlashSim_BytesProgrammed(void) {
+    return BytesProgrammed;
+}
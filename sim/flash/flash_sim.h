@@ -0,0 +1,40 @@
+/**
+ * @file flash_sim.h
+ * @brief Host flash simulator behind hal/flash.h (ASIC_FLASH_SIM).
+ *
+ * Models NOR semantics. Erase sets a sector to 0xFF. Program can only
+ * clear bits; an attempt to set a bit is reported and fails. The
+ * simulator counts erases per sector for wear analysis. A power loss can
+ * be injected after a given number of programmed bytes: later programs
+ * and erases fail until FlashSim_PowerCycle() is called.
+ */
+
+#ifndef FLASH_SIM_H
+#define FLASH_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Erases the whole array and clears all counters.
+ */
+void FlashSim_Reset(void);
+
+/**
+ * @brief Cuts power after bytes more bytes have been programmed.
+ *
+ * The program call that crosses the limit writes only the bytes before it.
+ */
+void FlashSim_FailAfter(uint32_t bytes);
+
+/**
+ * @brief Restores power after an injected failure; contents are kept.
+ */
+void FlashSim_PowerCycle(void);
+
+uint32_t FlashSim_EraseCount(uint32_t address);
+uint32_t FlashSim_TotalErases(void);
+uint32_t FlashSim_MaxEraseCount(void);
+uint64_t FlashSim_BytesProgrammed(void);
+
+#endif // FLASH_SIM_H
@@ -0,0 +1,127 @@
+/**
+ * @file tamper_sim.c
+ * @brief Implementation of the host tamper detector simulator.
+ */
+
+#include "tamper_sim.h"
+#include "tamper.h"
+
+#include <stdbool.h>
+
+// --- Private Variables ---
+static uint32_t Now;
+static uint32_t Level;
+static uint32_t Latched;
+static uint32_t IrqEnabled;
+static uint32_t Holding;                // Outputs that drop at ReleaseAt
+static uint32_t ReleaseAt[TAMPER_SENSOR_COUNT];
+static bool TimerRunning;
+static uint32_t TimerExpiry;
+
+// --- Private Helper Functions ---
+
+static void Dispatch(void) {
+    // The handler clears what it takes; stop if it leaves a bit set
+    for (uint32_t guard = 0; (Latched & IrqEnabled) != 0 && guard < TAMPER_SENSOR_COUNT; guard++) {
+        Tamper_SensorIrqHandler();
+    }
+}
+
+// --- Tamper Interface ---
+
+uint32_t Tamper_HwPresent(void) {
+    return TAMPER_SENSOR_ALL;
+}
+
+void Tamper_HwEnable(uint32_t sensors) {
+    IrqEnabled |= sensors & TAMPER_SENSOR_ALL;
+}
+
+void Tamper_HwDisable(uint32_t sensors) {
+    IrqEnabled &= ~sensors;
+}
+
+uint32_t Tamper_HwLatched(void) {
+    return Latched;
+}
+
+void Tamper_HwClear(uint32_t sensors) {
+    Latched &= ~sensors;
+}
+
+uint32_t Tamper_HwLevel(void) {
+    return Level;
+}
+
+void Tamper_HwStartTimer(uint32_t ticks) {
+    TimerRunning = true;
+    TimerExpiry = Now + ticks;
+}
+
+uint32_t Tamper_HwTimerNow(void) {
+    return Now;
+}
+
+// --- Simulator Control ---
+
+void TamperSim_Reset(void) {
+    Now = 0;
+    Level = 0;
+    Latched = 0;
+    IrqEnabled = 0;
+    Holding = 0;
+    TimerRunning = false;
+}
+
+void TamperSim_Assert(uint32_t sensors, uint32_t duration) {
+    sensors &= TAMPER_SENSOR_ALL;
+    Latched |= sensors & ~Level;
+    Level |= sensors;
+    for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+        if (sensors & (1UL << s)) {
+            ReleaseAt[s] = Now + duration;
+        }
+    }
+    if (duration == TAMPER_SIM_HELD) {
+        Holding &= ~sensors;
+    } else {
+        Holding |= sensors;
+    }
+    Dispatch();
+}
+
+void TamperSim_Release(uint32_t sensors) {
+    Level &= ~sensors;
+    Holding &= ~sensors;
+}
+
+void TamperSim_Advance(uint32_t ticks) {
+    uint32_t end = Now + ticks;
+    for (;;) {
+        // Step to the next release, timer expiry or the end, whichever is first
+        uint32_t step = end - Now;
+        for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+            if ((Holding & (1UL << s)) && ReleaseAt[s] - Now < step) {
+                step = ReleaseAt[s] - Now;
+            }
+        }
+        if (TimerRunning && TimerExpiry - Now < step) {
+            step = TimerExpiry - Now;
+        }
+        Now += step;
+
+        for (uint32_t s = 0; s < TAMPER_SENSOR_COUNT; s++) {
+            if ((Holding & (1UL << s)) && ReleaseAt[s] == Now) {
+                TamperSim_Release(1UL << s);
+            }
+        }
+        if (TimerRunning && TimerExpiry == Now) {
+            TimerRunning = false;
+            Tamper_TimerIrqHandler();
+        }
+        Dispatch();
+        if (Now == end) {
+            break;
+        }
+    }
+}
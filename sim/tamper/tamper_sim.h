@@ -0,0 +1,40 @@
+/**
+ * @file tamper_sim.h
+ * @brief Host simulator behind hal/tamper.h.
+ *
+ * Simulated time advances only through TamperSim_Advance(), in timer ticks.
+ * Detector outputs are driven with TamperSim_Assert(). A rising edge sets
+ * the latched bit and, if the sensor is enabled, calls
+ * Tamper_SensorIrqHandler() at once. Timer expiry calls
+ * Tamper_TimerIrqHandler() at the exact tick. Responses are therefore
+ * reproducible to the tick, whatever the host is doing.
+ */
+
+#ifndef TAMPER_SIM_H
+#define TAMPER_SIM_H
+
+#include <stdint.h>
+
+#define TAMPER_SIM_HELD             UINT32_MAX  // Assert duration: until released
+
+/**
+ * @brief Drops every output, clears the latch and mask, and stops the timer.
+ */
+void TamperSim_Reset(void);
+
+/**
+ * @brief Raises the outputs of sensors for duration ticks.
+ */
+void TamperSim_Assert(uint32_t sensors, uint32_t duration);
+
+/**
+ * @brief Drops the outputs of sensors now.
+ */
+void TamperSim_Release(uint32_t sensors);
+
+/**
+ * @brief Runs simulated time forward, taking interrupts as they fall due.
+ */
+void TamperSim_Advance(uint32_t ticks);
+
+#endif // TAMPER_SIM_H
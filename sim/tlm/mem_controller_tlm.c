@@ -0,0 +1,265 @@
+/**
+ * @file mem_controller_tlm.c
+ * @brief Implementation of the mem_controller transaction-level model.
+ */
+
+#include "mem_controller_tlm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Private Defines and Constants ---
+// Defaults follow asic_top.sv (MEM_LATENCY = 2, one 32-bit word per cycle) and
+// config.json (128 KB at 0x20000000, 120 MHz). Banking parameters describe the
+// planned four-bank controller.
+#define MEM_TLM_DEFAULT_BASE            (0x20000000UL)
+#define MEM_TLM_DEFAULT_SIZE            (131072UL)
+#define MEM_TLM_DEFAULT_LATENCY         2
+#define MEM_TLM_DEFAULT_BANK_BUSY       2
+#define MEM_TLM_DEFAULT_BANKS           4
+#define MEM_TLM_DEFAULT_INTERLEAVE      32
+#define MEM_TLM_DEFAULT_BUS_BYTES       4
+#define MEM_TLM_DEFAULT_QUEUE_DEPTH     4
+#define MEM_TLM_DEFAULT_CLOCK_HZ        (120000000UL)
+
+// --- Private State ---
+static MemTlm g_bus_model;
+static bool   g_bus_model_ready = false;
+
+// --- Private Helper Functions ---
+
+static bool IsPowerOfTwo(uint32_t v) {
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+static uint64_t Max64(uint64_t a, uint64_t b) {
+    return a > b ? a : b;
+}
+
+static void RetireCompleted(MemTlm *model) {
+    while (model->inflight_count > 0 && model->inflight[model->inflight_head] <= model->now) {
+        model->inflight_head = (model->inflight_head + 1) % model->config.queue_depth;
+        model->inflight_count--;
+    }
+}
+
+// --- Public Function Implementations ---
+
+void MemTlm_DefaultConfig(MemTlmConfig *config) {
+    config->base_address = MEM_TLM_DEFAULT_BASE;
+    config->size_bytes = MEM_TLM_DEFAULT_SIZE;
+    config->access_latency_cycles = MEM_TLM_DEFAULT_LATENCY;
+    config->bank_busy_cycles = MEM_TLM_DEFAULT_BANK_BUSY;
+    config->num_banks = MEM_TLM_DEFAULT_BANKS;
+    config->bank_interleave_bytes = MEM_TLM_DEFAULT_INTERLEAVE;
+    config->bus_bytes_per_cycle = MEM_TLM_DEFAULT_BUS_BYTES;
+    config->queue_depth = MEM_TLM_DEFAULT_QUEUE_DEPTH;
+    config->clock_hz = MEM_TLM_DEFAULT_CLOCK_HZ;
+}
+
+bool MemTlm_Init(MemTlm *model, const MemTlmConfig *config) {
+    memset(model, 0, sizeof(*model));
+    if (!IsPowerOfTwo(config->num_banks) || config->num_banks > MEM_TLM_MAX_BANKS ||
+        !IsPowerOfTwo(config->bank_interleave_bytes) ||
+        config->queue_depth == 0 || config->queue_depth > MEM_TLM_MAX_QUEUE_DEPTH ||
+        config->bus_bytes_per_cycle == 0 || config->size_bytes == 0) {
+        printf("[ERROR] MEMTLM: invalid configuration.\n");
+        return false;
+    }
+    model->storage = calloc(1, config->size_bytes);
+    if (model->storage == NULL) {
+        return false;
+    }
+    model->config = *config;
+    return true;
+}
+
+void MemTlm_Free(MemTlm *model) {
+    free(model->storage);
+    memset(model, 0, sizeof(*model));
+}
+
+uint64_t MemTlm_Access(MemTlm *model, uint32_t addr, void *data, uint32_t bytes,
+                       bool write, bool blocking) {
+    const MemTlmConfig *cfg = &model->config;
+    if (bytes == 0 || addr < cfg->base_address ||
+        (uint64_t)addr - cfg->base_address + bytes > cfg->size_bytes) {
+        model->out_of_window++;
+        return model->now;
+    }
+
+    // --- Request queue admission ---
+    RetireCompleted(model);
+    if (model->inflight_count == cfg->queue_depth) {
+        model->now = model->inflight[model->inflight_head];
+        model->stats.queue_full_stalls++;
+        RetireCompleted(model);
+    }
+    uint64_t submit = model->now;
+    if (model->stats.requests == 0) {
+        model->stats.first_submit_cycle = submit;
+    }
+
+    // --- Bank and bus scheduling, one chunk issued per cycle ---
+    uint32_t offset = addr - cfg->base_address;
+    uint32_t remaining = bytes;
+    uint64_t earliest = submit;
+    uint64_t service_start = UINT64_MAX;
+    while (remaining > 0) {
+        uint32_t in_chunk = cfg->bank_interleave_bytes - (offset & (cfg->bank_interleave_bytes - 1));
+        uint32_t chunk = remaining < in_chunk ? remaining : in_chunk;
+        uint32_t bank = (offset / cfg->bank_interleave_bytes) & (cfg->num_banks - 1);
+
+        uint64_t start = Max64(earliest, model->bank_free[bank]);
+        if (start > earliest) {
+            model->stats.bank_conflicts++;
+            model->stats.bank_conflict_cycles += start - earliest;
+        }
+        model->bank_free[bank] = start + cfg->bank_busy_cycles;
+        uint64_t data_ready = start + cfg->access_latency_cycles;
+        model->bus_free = Max64(model->bus_free, data_ready) +
+                          (chunk + cfg->bus_bytes_per_cycle - 1) / cfg->bus_bytes_per_cycle;
+        if (start < service_start) {
+            service_start = start;
+        }
+
+        earliest = start + 1;
+        offset += chunk;
+        remaining -= chunk;
+    }
+    uint64_t complete = model->bus_free;
+
+    uint32_t slot = (model->inflight_head + model->inflight_count) % cfg->queue_depth;
+    model->inflight[slot] = complete;
+    model->inflight_count++;
+
+    // --- Functional effect ---
+    if (data != NULL) {
+        uint8_t *mem = model->storage + (addr - cfg->base_address);
+        if (write) {
+            memcpy(mem, data, bytes);
+        } else {
+            memcpy(data, mem, bytes);
+        }
+    }
+
+    // --- Statistics ---
+    uint64_t delay = service_start - submit;
+    model->stats.requests++;
+    model->stats.bytes += bytes;
+    model->stats.queue_delay_cycles += delay;
+    if (delay > model->stats.max_queue_delay_cycles) {
+        model->stats.max_queue_delay_cycles = delay;
+    }
+    if (complete > model->stats.last_complete_cycle) {
+        model->stats.last_complete_cycle = complete;
+    }
+
+    if (blocking) {
+        model->now = complete;
+    }
+    return complete;
+}
+
+void MemTlm_Advance(MemTlm *model, uint64_t cycles) {
+    model->now += cycles;
+}
+
+void MemTlm_Drain(MemTlm *model) {
+    if (model->bus_free > model->now) {
+        model->now = model->bus_free;
+    }
+    RetireCompleted(model);
+}
+
+double MemTlm_AchievedBytesPerCycle(const MemTlm *model) {
+    const MemTlmStats *s = &model->stats;
+    uint64_t span = s->last_complete_cycle - s->first_submit_cycle;
+    return (s->requests == 0 || span == 0) ? 0.0 : (double)s->bytes / (double)span;
+}
+
+void MemTlm_ResetStats(MemTlm *model) {
+    memset(&model->stats, 0, sizeof(model->stats));
+}
+
+void MemTlm_PrintReport(const MemTlm *model, const char *label) {
+    const MemTlmStats *s = &model->stats;
+    double bpc = MemTlm_AchievedBytesPerCycle(model);
+    double mbps = bpc * model->config.clock_hz / 1e6;
+    double peak = (double)model->config.bus_bytes_per_cycle;
+    double avg_delay = s->requests ? (double)s->queue_delay_cycles / (double)s->requests : 0.0;
+
+    printf("[INFO] MEMTLM %s: %llu requests, %llu bytes, %.3f B/cycle = %.1f MB/s (%.0f%% of peak)\n",
+           label, (unsigned long long)s->requests, (unsigned long long)s->bytes,
+           bpc, mbps, peak > 0 ? 100.0 * bpc / peak : 0.0);
+    printf("[INFO] MEMTLM %s: queue delay avg %.2f / max %llu cycles, %llu queue-full stalls, "
+           "%llu bank conflicts (%llu cycles)\n",
+           label, avg_delay, (unsigned long long)s->max_queue_delay_cycles,
+           (unsigned long long)s->queue_full_stalls, (unsigned long long)s->bank_conflicts,
+           (unsigned long long)s->bank_conflict_cycles);
+    if (model->out_of_window != 0) {
+        printf("[WARN] MEMTLM %s: %u accesses outside the RAM window were ignored.\n",
+               label, (unsigned)model->out_of_window);
+    }
+}
+
+void MemTlm_SweepBurstSizes(const MemTlmConfig *config, uint32_t total_bytes,
+                            uint32_t min_burst, uint32_t max_burst) {
+    uint32_t half = config->size_bytes / 2;
+    if (total_bytes > half) {
+        total_bytes = half;
+    }
+    printf("%10s %10s %10s %12s %10s\n", "burst", "B/cycle", "MB/s", "avg qdelay", "conflicts");
+
+    for (uint32_t burst = min_burst; burst != 0 && burst <= max_burst; burst *= 2) {
+        MemTlm model;
+        if (!MemTlm_Init(&model, config)) {
+            return;
+        }
+        // DMA copy: read a burst from the source half, write it to the destination half
+        for (uint32_t off = 0; off + burst <= total_bytes; off += burst) {
+            MemTlm_Access(&model, config->base_address + off, NULL, burst, false, false);
+            MemTlm_Access(&model, config->base_address + half + off, NULL, burst, true, false);
+        }
+        MemTlm_Drain(&model);
+
+        const MemTlmStats *s = &model.stats;
+        double bpc = MemTlm_AchievedBytesPerCycle(&model);
+        printf("%10u %10.3f %10.1f %12.2f %10llu\n", (unsigned)burst, bpc,
+               bpc * config->clock_hz / 1e6,
+               s->requests ? (double)s->queue_delay_cycles / (double)s->requests : 0.0,
+               (unsigned long long)s->bank_conflicts);
+        MemTlm_Free(&model);
+    }
+}
+
+// --- Firmware Bus Hooks ---
+
+MemTlm *MemTlm_BusModel(void) {
+    if (!g_bus_model_ready) {
+        MemTlmConfig config;
+        MemTlm_DefaultConfig(&config);
+        g_bus_model_ready = MemTlm_Init(&g_bus_model, &config);
+    }
+    return &g_bus_model;
+}
+
+uint32_t MemTlm_BusRead32(uint32_t addr) {
+    uint32_t value = 0;
+    MemTlm_Access(MemTlm_BusModel(), addr, &value, sizeof(value), false, true);
+    return value;
+}
+
+void MemTlm_BusWrite32(uint32_t addr, uint32_t value) {
+    // Stores are posted: the CPU continues once the request is queued
+    MemTlm_Access(MemTlm_BusModel(), addr, &value, sizeof(value), true, false);
+}
+
+void MemTlm_BusWriteBurst(uint32_t addr, const uint32_t *src, size_t words) {
+    MemTlm_Access(MemTlm_BusModel(), addr, (void *)src, (uint32_t)(words * 4), true, false);
+}
+
+void MemTlm_BusReadBurst(uint32_t addr, uint32_t *dst, size_t words) {
+    MemTlm_Access(MemTlm_BusModel(), addr, dst, (uint32_t)(words * 4), false, true);
+}
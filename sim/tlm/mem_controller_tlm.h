@@ -0,0 +1,163 @@
+/**
+ * @file mem_controller_tlm.h
+ * @brief Transaction-level model of design/rtl/mem_controller.sv.
+ *
+ * A fast, cycle-approximate model of the on-chip SRAM controller for running
+ * full firmware workloads on the host. Each transaction is timed analytically
+ * from a handful of parameters (access latency, bank occupancy, data-bus
+ * bandwidth and request queue depth) instead of being clocked through RTL,
+ * so millions of accesses per second can be modelled. The model also keeps a
+ * functional copy of RAM so firmware reads return what it wrote.
+ *
+ * Timing of one request:
+ *  - It enters the request queue at the current time, stalling the requester
+ *    if queue_depth requests are already outstanding.
+ *  - It is split into bank_interleave_bytes chunks; each chunk waits for its
+ *    bank to be free (a bank conflict), occupies it for bank_busy_cycles and
+ *    produces data access_latency_cycles after it starts.
+ *  - Data returns over a shared bus moving bus_bytes_per_cycle per cycle.
+ * Requests complete in order, as in the RTL.
+ */
+
+#ifndef MEM_CONTROLLER_TLM_H
+#define MEM_CONTROLLER_TLM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --- Limits ---
+#define MEM_TLM_MAX_BANKS           16
+#define MEM_TLM_MAX_QUEUE_DEPTH     64
+
+/**
+ * @brief Model parameters.
+ */
+typedef struct {
+    uint32_t base_address;            // Start of the RAM window
+    uint32_t size_bytes;              // Size of the RAM window
+    uint32_t access_latency_cycles;   // Bank start to data available
+    uint32_t bank_busy_cycles;        // Bank occupancy per access
+    uint32_t num_banks;               // Power of two, <= MEM_TLM_MAX_BANKS
+    uint32_t bank_interleave_bytes;   // Address stride between banks, power of two
+    uint32_t bus_bytes_per_cycle;     // Data-bus bandwidth
+    uint32_t queue_depth;             // Outstanding requests, <= MEM_TLM_MAX_QUEUE_DEPTH
+    uint32_t clock_hz;                // Used only to convert cycles to MB/s
+} MemTlmConfig;
+
+/**
+ * @brief Accumulated statistics.
+ */
+typedef struct {
+    uint64_t requests;
+    uint64_t bytes;
+    uint64_t bank_conflicts;          // Chunks that waited for a busy bank
+    uint64_t bank_conflict_cycles;
+    uint64_t queue_full_stalls;       // Submissions that waited for a free queue slot
+    uint64_t queue_delay_cycles;      // Sum of submit-to-service-start delays
+    uint64_t max_queue_delay_cycles;
+    uint64_t first_submit_cycle;
+    uint64_t last_complete_cycle;
+} MemTlmStats;
+
+/**
+ * @brief Model state. Treat as opaque outside mem_controller_tlm.c.
+ */
+typedef struct {
+    MemTlmConfig config;
+    uint8_t     *storage;
+    uint64_t     now;                                  // Requester time in cycles
+    uint64_t     bank_free[MEM_TLM_MAX_BANKS];
+    uint64_t     bus_free;
+    uint64_t     inflight[MEM_TLM_MAX_QUEUE_DEPTH];     // Completion times, ring buffer
+    uint32_t     inflight_head;
+    uint32_t     inflight_count;
+    uint32_t     out_of_window;                        // Accesses outside the RAM window
+    MemTlmStats  stats;
+} MemTlm;
+
+// --- Public Function Declarations ---
+
+/**
+ * @brief Fills a config with defaults matching the RTL and config.json.
+ */
+void MemTlm_DefaultConfig(MemTlmConfig *config);
+
+/**
+ * @brief Initializes a model.
+ *
+ * @return True on success, false if the config is invalid or memory runs out.
+ */
+bool MemTlm_Init(MemTlm *model, const MemTlmConfig *config);
+
+/**
+ * @brief Releases a model's storage.
+ */
+void MemTlm_Free(MemTlm *model);
+
+/**
+ * @brief Performs one functional and timed transaction.
+ *
+ * A blocking access advances the requester's time to the completion of the
+ * transaction, like a CPU load. A non-blocking access only advances time past
+ * any queue-full stall, like a DMA descriptor being posted.
+ *
+ * @param model    The model.
+ * @param addr     Bus address inside the RAM window.
+ * @param data     Source (write) or destination (read) buffer, may be NULL for timing only.
+ * @param bytes    Transaction size.
+ * @param write    True for a write.
+ * @param blocking True to wait for completion.
+ * @return The cycle at which the transaction completes.
+ */
+uint64_t MemTlm_Access(MemTlm *model, uint32_t addr, void *data, uint32_t bytes,
+                       bool write, bool blocking);
+
+/**
+ * @brief Advances requester time, modelling compute between accesses.
+ */
+void MemTlm_Advance(MemTlm *model, uint64_t cycles);
+
+/**
+ * @brief Advances requester time until every queued transaction has completed.
+ */
+void MemTlm_Drain(MemTlm *model);
+
+/**
+ * @brief Achieved bandwidth in bytes per cycle over the measured interval.
+ */
+double MemTlm_AchievedBytesPerCycle(const MemTlm *model);
+
+/**
+ * @brief Clears statistics without touching memory contents or time.
+ */
+void MemTlm_ResetStats(MemTlm *model);
+
+/**
+ * @brief Prints bandwidth, queueing delay and bank-conflict statistics.
+ */
+void MemTlm_PrintReport(const MemTlm *model, const char *label);
+
+/**
+ * @brief Prints achieved bandwidth for a DMA copy of total_bytes at each burst size.
+ *
+ * Burst sizes run from min_burst to max_burst in powers of two. Each run uses
+ * a fresh model with the given config, posting non-blocking bursts back to
+ * back, which is how the DMA engine drives the controller.
+ */
+void MemTlm_SweepBurstSizes(const MemTlmConfig *config, uint32_t total_bytes,
+                            uint32_t min_burst, uint32_t max_burst);
+
+// --- Firmware Bus Hooks (hal/asic_bus.h with ASIC_TLM) ---
+
+/**
+ * @brief The shared model used by hal/asic_bus.h, created on first use.
+ */
+MemTlm *MemTlm_BusModel(void);
+
+uint32_t MemTlm_BusRead32(uint32_t addr);
+void     MemTlm_BusWrite32(uint32_t addr, uint32_t value);
+void     MemTlm_BusWriteBurst(uint32_t addr, const uint32_t *src, size_t words);
+void     MemTlm_BusReadBurst(uint32_t addr, uint32_t *dst, size_t words);
+
+#endif // MEM_CONTROLLER_TLM_H
@@ -0,0 +1,51 @@
+"""
+@file asic_config.py
+@brief Loader for config/config.json, which is JSON with // line comments.
+
+Shared by the build-time generators so they read the memory map, clock and
+build defaults from the same file as the firmware.
+"""
+
+import json
+import os
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+DEFAULT_CONFIG = os.path.join(REPO_ROOT, "config", "config.json")
+
+
+def strip_comments(text):
+    """Removes // comments that are outside string literals."""
+    out = []
+    in_string = False
+    escaped = False
+    i = 0
+    while i < len(text):
+        ch = text[i]
+        if in_string:
+            out.append(ch)
+            if escaped:
+                escaped = False
+            elif ch == "\\":
+                escaped = True
+            elif ch == '"':
+                in_string = False
+        elif ch == '"':
+            in_string = True
+            out.append(ch)
+        elif text.startswith("//", i):
+            while i < len(text) and text[i] != "\n":
+                i += 1
+            continue
+        else:
+            out.append(ch)
+        i += 1
+    return "".join(out)
+
+
+def load(path=DEFAULT_CONFIG):
+    with open(path, "r") as fp:
+        return json.loads(strip_comments(fp.read()))
+
+
+def parse_int(value):
+    return int(value, 0) if isinstance(value, str) else int(value)
@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+"""
+@file gen_config_image.py
+@brief Generates the runtime configuration layout and binary image.
+
+The runtime-tunable sections of config/config.json (clock, debug, power and
+peripheral defaults) are packed into a fixed binary layout that firmware
+reads in place from flash (see config/runtime_config.h). This script is the
+single source of that layout. It writes:
+  - config/runtime_config_layout.h : C structs, enum codes, section IDs and
+    the compiled-in default image.
+  - an image file (-o)             : the packed image, for staging an update
+    through RuntimeConfig_StageWrite().
+  - a sector file (--sector)       : the image padded to one flash sector
+    with a committed sequence number of 1, for production programming.
+
+Every section struct uses natural alignment with explicit padding, so the C
+compiler and the packer here produce identical bytes. LAYOUT_VERSION is a
+hash of the field list. Firmware therefore rejects images built for a
+different layout.
+
+Usage: tools/gen_config_image.py [--check] [-o image.bin] [--sector sector.bin] [config.json]
+  --check  Exit non-zero if runtime_config_layout.h is out of date (for CI).
+"""
+
+import binascii
+import os
+import struct
+import sys
+
+import asic_config
+
+REPO_ROOT = asic_config.REPO_ROOT
+HEADER_OUTPUT = os.path.join(REPO_ROOT, "config", "runtime_config_layout.h")
+
+MAGIC = 0x47464341          # "ACFG"
+COMMIT = 0x544D4F43         # "COMT"
+SECTOR_BYTES = 4096         # Must match FLASH_SECTOR_BYTES in hal/flash.h
+
+# --- Layout Description ---
+
+LOG_LEVELS = ["DEBUG", "INFO", "WARN", "ERROR", "FATAL"]
+OSCILLATORS = ["HSE", "HSI", "PLL"]
+SLEEP_MODES = ["NONE", "SLEEP", "DEEP_SLEEP"]
+WAKEUP_SOURCES = ["GPIO_WKUP", "TIMER_WKUP", "UART_WKUP", "RTC_WKUP"]
+PULLS = ["NONE", "UP", "DOWN"]
+FLOW_CONTROLS = ["NONE", "RTS_CTS"]
+SPI_MODES = ["MODE0", "MODE1", "MODE2", "MODE3"]
+
+# (section, config.json key, [(field, C type, encoding)])
+# encoding: None (integer), "bool", a list (enum) or ("mask", list)
+SECTIONS = [
+    ("CLOCK", "clock_settings", [
+        ("system_clock_hz", "uint32_t", None),
+        ("pll_multiplier", "uint8_t", None),
+        ("pll_divider", "uint8_t", None),
+        ("oscillator_type", "uint8_t", OSCILLATORS),
+    ]),
+    ("DEBUG", "debug_settings", [
+        ("uart_debug_baud_rate", "uint32_t", None),
+        ("default_log_level", "uint8_t", LOG_LEVELS),
+        ("jtag_swd_enabled", "uint8_t", "bool"),
+        ("halt_on_startup", "uint8_t", "bool"),
+    ]),
+    ("POWER", "power_management_defaults", [
+        ("wakeup_sources", "uint32_t", ("mask", WAKEUP_SOURCES)),
+        ("default_sleep_mode", "uint8_t", SLEEP_MODES),
+    ]),
+    ("PERIPHERAL", "peripheral_defaults", [
+        ("i2c_speed_default_khz", "uint16_t", None),
+        ("gpio_pull_up_down_default", "uint8_t", PULLS),
+        ("uart_flow_control_default", "uint8_t", FLOW_CONTROLS),
+        ("spi_mode_default", "uint8_t", SPI_MODES),
+    ]),
+]
+
+ENUMS = [
+    ("LOG_LEVEL", LOG_LEVELS),
+    ("OSC", OSCILLATORS),
+    ("SLEEP", SLEEP_MODES),
+    ("PULL", PULLS),
+    ("FLOW", FLOW_CONTROLS),
+    ("SPI", SPI_MODES),
+]
+
+C_SIZES = {"uint32_t": 4, "uint16_t": 2, "uint8_t": 1}
+PACK_CODES = {"uint32_t": "I", "uint16_t": "H", "uint8_t": "B"}
+
+HEADER_FORMAT = "<IHHII"    # magic, layout_version, section_count, image_bytes, image_crc
+HEADER_BYTES = struct.calcsize(HEADER_FORMAT)
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] CONFIG: %s\n" % message)
+    sys.exit(1)
+
+
+def camel(name):
+    return "".join(part.capitalize() for part in name.lower().split("_"))
+
+
+def section_members(fields):
+    """Fields ordered largest first, then padding to a 4-byte multiple."""
+    members = sorted(fields, key=lambda f: -C_SIZES[f[1]])
+    size = sum(C_SIZES[f[1]] for f in members)
+    pad = (4 - size % 4) % 4
+    return members, size + pad, pad
+
+
+def layout_version():
+    text = repr([(s, [(f, t) for f, t, _ in fields]) for s, _, fields in SECTIONS])
+    return binascii.crc32(text.encode()) & 0xFFFF
+
+
+# --- Packing ---
+
+def encode(section, field, encoding, value):
+    where = "%s.%s" % (section, field)
+    if encoding is None:
+        return asic_config.parse_int(value)
+    if encoding == "bool":
+        if not isinstance(value, bool):
+            fail("%s: expected true/false" % where)
+        return int(value)
+    if isinstance(encoding, tuple):
+        mask = 0
+        for name in value:
+            if name not in encoding[1]:
+                fail("%s: unknown value %s" % (where, name))
+            mask |= 1 << encoding[1].index(name)
+        return mask
+    if value not in encoding:
+        fail("%s: unknown value %s (expected one of %s)" % (where, value, ", ".join(encoding)))
+    return encoding.index(value)
+
+
+def pack_sections(config):
+    blobs = []
+    for section, key, fields in SECTIONS:
+        members, size, pad = section_members(fields)
+        values = []
+        for field, ctype, encoding in members:
+            if field not in config.get(key, {}):
+                fail("%s: missing %s.%s in config.json" % (section, key, field))
+            value = encode(section, field, encoding, config[key][field])
+            if value < 0 or value >= 1 << (8 * C_SIZES[ctype]):
+                fail("%s.%s: %d does not fit %s" % (section, field, value, ctype))
+            values.append(value)
+        fmt = "<" + "".join(PACK_CODES[t] for _, t, _ in members) + "x" * pad
+        blobs.append(struct.pack(fmt, *values))
+    return blobs
+
+
+def pack_image(config):
+    blobs = pack_sections(config)
+    crcs = struct.pack("<%dI" % len(blobs), *[binascii.crc32(b) & 0xFFFFFFFF for b in blobs])
+    body = crcs + b"".join(blobs)
+    header = struct.pack(HEADER_FORMAT, MAGIC, layout_version(), len(blobs),
+                         HEADER_BYTES + len(body), binascii.crc32(body) & 0xFFFFFFFF)
+    return header + body
+
+
+def pack_sector(image, sequence=1):
+    if len(image) > SECTOR_BYTES - 8:
+        fail("image of %d bytes does not fit a sector" % len(image))
+    padding = b"\xFF" * (SECTOR_BYTES - 8 - len(image))
+    return image + padding + struct.pack("<II", sequence, COMMIT)
+
+
+# --- C Header ---
+
+def generate_header(config, image, source_name):
+    out = []
+    out.append("/**")
+    out.append(" * @file runtime_config_layout.h")
+    out.append(" * @brief Binary layout of the runtime configuration image.")
+    out.append(" *")
+    out.append(" * GENERATED by tools/gen_config_image.py from %s. Do not edit." % source_name)
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef RUNTIME_CONFIG_LAYOUT_H")
+    out.append("#define RUNTIME_CONFIG_LAYOUT_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("#define RUNTIME_CONFIG_MAGIC            0x%08XUL" % MAGIC)
+    out.append("#define RUNTIME_CONFIG_COMMIT           0x%08XUL" % COMMIT)
+    out.append("#define RUNTIME_CONFIG_LAYOUT_VERSION   0x%04X" % layout_version())
+    out.append("#define RUNTIME_CONFIG_SECTION_COUNT    %d" % len(SECTIONS))
+    out.append("")
+    out.append("// --- Section Identifiers ---")
+    for index, (section, _, _) in enumerate(SECTIONS):
+        out.append("#define %-40s %d" % ("RUNTIME_CONFIG_SECTION_" + section, index))
+    out.append("")
+    out.append("// --- Encoded Values ---")
+    for prefix, names in ENUMS:
+        for index, name in enumerate(names):
+            out.append("#define %-40s %d" % ("RUNTIME_CONFIG_%s_%s" % (prefix, name), index))
+    for index, name in enumerate(WAKEUP_SOURCES):
+        out.append("#define %-40s (1UL << %d)" % ("RUNTIME_CONFIG_WAKEUP_" + name, index))
+    out.append("")
+    out.append("// --- Sections ---")
+    for section, key, fields in SECTIONS:
+        members, size, pad = section_members(fields)
+        out.append("")
+        out.append("// config.json \"%s\"" % key)
+        out.append("typedef struct {")
+        for field, ctype, _ in members:
+            out.append("    %-9s %s;" % (ctype, field))
+        if pad:
+            out.append("    %-9s reserved[%d];" % ("uint8_t", pad))
+        out.append("} RuntimeConfig%s;" % camel(section))
+    out.append("")
+    out.append("// --- Image ---")
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    uint32_t magic;             // RUNTIME_CONFIG_MAGIC")
+    out.append("    uint16_t layout_version;    // RUNTIME_CONFIG_LAYOUT_VERSION")
+    out.append("    uint16_t section_count;")
+    out.append("    uint32_t image_bytes;       // sizeof(RuntimeConfigImage)")
+    out.append("    uint32_t image_crc;         // CRC-32 of everything after this header")
+    out.append("} RuntimeConfigHeader;")
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    RuntimeConfigHeader header;")
+    out.append("    uint32_t section_crc[RUNTIME_CONFIG_SECTION_COUNT];   // For change detection")
+    for section, _, _ in SECTIONS:
+        out.append("    RuntimeConfig%s %s;" % (camel(section), section.lower()))
+    out.append("} RuntimeConfigImage;")
+    out.append("")
+    out.append("_Static_assert(sizeof(RuntimeConfigImage) == %d, \"layout differs from the image packer\");"
+               % len(image))
+    out.append("")
+    out.append("// --- Defaults (config.json at build time) ---")
+    out.append("")
+    out.append("#define RUNTIME_CONFIG_DEFAULT_IMAGE { \\")
+    words = struct.unpack("<IHHII", image[:HEADER_BYTES])
+    out.append("    .header = { 0x%08XUL, 0x%04X, %d, %d, 0x%08XUL }, \\" % words)
+    crcs = struct.unpack_from("<%dI" % len(SECTIONS), image, HEADER_BYTES)
+    out.append("    .section_crc = { %s }, \\" % ", ".join("0x%08XUL" % c for c in crcs))
+    for section, key, fields in SECTIONS:
+        members, _, _ = section_members(fields)
+        values = ", ".join(".%s = %d" % (f, encode(section, f, e, config[key][f])) for f, _, e in members)
+        out.append("    .%s = { %s }, \\" % (section.lower(), values))
+    out.append("}")
+    out.append("")
+    out.append("#endif // RUNTIME_CONFIG_LAYOUT_H")
+    out.append("")
+    return "\n".join(out)
+
+
+# --- Entry Point ---
+
+def write_if_changed(path, content, check):
+    old = None
+    if os.path.exists(path):
+        with open(path, "r") as fp:
+            old = fp.read()
+    if old == content:
+        return True
+    if check:
+        sys.stderr.write("[ERROR] CONFIG: %s is out of date, run tools/gen_config_image.py\n"
+                         % os.path.relpath(path, REPO_ROOT))
+        return False
+    with open(path, "w") as fp:
+        fp.write(content)
+    print("[INFO] CONFIG: wrote %s" % os.path.relpath(path, REPO_ROOT))
+    return True
+
+
+def option(args, name):
+    if name in args:
+        index = args.index(name)
+        if index + 1 >= len(args):
+            fail("%s needs a path" % name)
+        value = args[index + 1]
+        del args[index:index + 2]
+        return value
+    return None
+
+
+def main(argv):
+    args = list(argv)
+    check = "--check" in args
+    args = [a for a in args if a != "--check"]
+    image_path = option(args, "-o")
+    sector_path = option(args, "--sector")
+    source = os.path.abspath(args[0]) if args else asic_config.DEFAULT_CONFIG
+    source_name = os.path.relpath(source, REPO_ROOT)
+
+    config = asic_config.load(source)
+    image = pack_image(config)
+    ok = write_if_changed(HEADER_OUTPUT, generate_header(config, image, source_name), check)
+    if image_path:
+        with open(image_path, "wb") as fp:
+            fp.write(image)
+    if sector_path:
+        with open(sector_path, "wb") as fp:
+            fp.write(pack_sector(image))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
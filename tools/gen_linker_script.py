@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+@file gen_linker_script.py
+@brief Generates a variant's linker script from its memory map and the
+       execution profile.
+
+Fills conf/<memory_map_defaults.linker_script_template> (conf/linker_default.ld
+by default) with:
+  - FLASH, FAULTLOG, CONFIG, RAM and optional TCM regions from
+    memory_map_defaults. The last RUNTIME_CONFIG_SECTORS flash sectors become
+    CONFIG and the FAULT_LOG_SECTORS below them FAULTLOG. Both are left out
+    of FLASH, so the runtime configuration (config/runtime_config.h) and the
+    fault journal (constraints/fault_log.h) can never be overwritten by code.
+  - .ramfunc input sections for every hot function in the profile
+    (conf/pgo/profile.json, see tools/pgo_profile.py) and every table in
+    code_placement.hot_tables. -ffunction-sections and -fdata-sections give
+    each of them a section of its own, so the placement is per function.
+    The output runs from code_placement.fast_memory (RAM or TCM).
+    Everything else stays in flash.
+
+The generated script asserts at link time that .ramfunc fits in
+code_placement.fast_budget_bytes.
+
+Usage: tools/gen_linker_script.py [--config config.json] [--profile profile.json] -o linker.ld
+"""
+
+import json
+import os
+import string
+import sys
+
+import asic_config
+
+REPO_ROOT = asic_config.REPO_ROOT
+DEFAULT_PROFILE = os.path.join(REPO_ROOT, "conf", "pgo", "profile.json")
+
+SECTOR_BYTES = 4096             # Must match FLASH_SECTOR_BYTES in hal/flash.h
+RUNTIME_CONFIG_SECTORS = 2      # RUNTIME_CONFIG_SECTOR_A and _B
+FAULT_LOG_SECTORS = 16          # Must match FAULT_LOG_SECTORS in constraints/fault_log.h
+
+FAST_MEMORIES = ("RAM", "TCM")
+
+# Run before SystemManager() has copied .ramfunc, so they must stay in flash
+BOOT_FUNCTIONS = {"Reset_Handler", "main", "SystemManager", "RamFuncCopy", "Crc32_Update"}
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] LINKER: %s\n" % message)
+    sys.exit(1)
+
+
+def option(args, name, default=None):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def hot_functions(profile_path):
+    if not os.path.exists(profile_path):
+        return []
+    with open(profile_path, "r") as fp:
+        profile = json.load(fp)
+    return [f["name"] for f in profile["functions"] if f["hot"] and f["name"] not in BOOT_FUNCTIONS]
+
+
+def section_patterns(kind, names):
+    return "\n".join("        *(.%s.%s .%s.%s.*)" % (kind, n, kind, n) for n in names)
+
+
+def generate(config, config_path, profile_path):
+    memory = config["memory_map_defaults"]
+    placement = config["code_placement"]
+
+    flash_origin = asic_config.parse_int(memory["flash_start_address"])
+    flash_size = asic_config.parse_int(memory["flash_size_bytes"])
+    ram_origin = asic_config.parse_int(memory["ram_start_address"])
+    ram_size = asic_config.parse_int(memory["ram_size_bytes"])
+    tcm_origin = asic_config.parse_int(memory["tcm_start_address"])
+    tcm_size = asic_config.parse_int(memory["tcm_size_bytes"])
+    config_bytes = RUNTIME_CONFIG_SECTORS * SECTOR_BYTES
+    fault_log_bytes = FAULT_LOG_SECTORS * SECTOR_BYTES
+    reserved_bytes = config_bytes + fault_log_bytes
+    if flash_size % SECTOR_BYTES != 0 or flash_size <= reserved_bytes:
+        fail("flash_size_bytes must be a multiple of %d larger than %d" % (SECTOR_BYTES, reserved_bytes))
+
+    fast_region = placement["fast_memory"]
+    if fast_region not in FAST_MEMORIES:
+        fail("code_placement.fast_memory must be one of %s" % ", ".join(FAST_MEMORIES))
+    if fast_region == "TCM" and tcm_size == 0:
+        fail("code_placement.fast_memory is TCM but tcm_size_bytes is 0")
+
+    functions = hot_functions(profile_path)
+    tables = placement["hot_tables"]
+    template_path = os.path.join(REPO_ROOT, "conf", memory["linker_script_template"])
+    with open(template_path, "r") as fp:
+        template = string.Template(fp.read())
+
+    script = template.substitute(
+        generated="GENERATED by tools/gen_linker_script.py from %s and %s. Do not edit." %
+                  (os.path.basename(config_path), os.path.relpath(profile_path, REPO_ROOT)),
+        flash_origin="0x%08X" % flash_origin,
+        flash_length="%d" % (flash_size - reserved_bytes),
+        fault_log_origin="0x%08X" % (flash_origin + flash_size - reserved_bytes),
+        fault_log_length="%d" % fault_log_bytes,
+        config_origin="0x%08X" % (flash_origin + flash_size - config_bytes),
+        config_length="%d" % config_bytes,
+        ram_origin="0x%08X" % ram_origin,
+        ram_length="%d" % ram_size,
+        tcm_memory=("    TCM      (rwx) : ORIGIN = 0x%08X, LENGTH = %d" % (tcm_origin, tcm_size)
+                    if tcm_size else ""),
+        fast_region=fast_region,
+        fast_text=section_patterns("text", functions),
+        fast_data=section_patterns("rodata", tables),
+        fast_budget="%d" % asic_config.parse_int(placement["fast_budget_bytes"]),
+    )
+    return script, functions, tables
+
+
+def main(argv):
+    args = list(argv)
+    config_path = os.path.abspath(option(args, "--config", asic_config.DEFAULT_CONFIG))
+    profile_path = os.path.abspath(option(args, "--profile", DEFAULT_PROFILE))
+    output = option(args, "-o")
+    if output is None or args:
+        fail("usage: gen_linker_script.py [--config C] [--profile P] -o linker.ld")
+
+    script, functions, tables = generate(asic_config.load(config_path), config_path, profile_path)
+    if os.path.exists(output):
+        with open(output, "r") as fp:
+            if fp.read() == script:
+                return 0
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+    with open(output, "w") as fp:
+        fp.write(script)
+    print("[INFO] LINKER: %s: %d hot functions and %d tables in fast memory" %
+          (output, len(functions), len(tables)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+@file gen_regmap.py
+@brief Generates the SystemVerilog package and C register header from one description.
+
+Reads design/registers/asic_regs.json and writes:
+  - design/packages/asic_pkg.sv : address map, register offsets, field
+    positions and a packed struct per register for the RTL.
+  - hal/asic_regs.h             : the same offsets and field masks for the
+    firmware, plus inline accessors built on hal/asic_bus.h.
+
+Multi-field updates are batched: firmware stages field values into an
+AsicRegBatch and commits it once. A commit is a single bus write when the
+staged fields cover every writable bit (or the register is write-only or
+write-1-to-clear), and one read plus one write otherwise, no matter how many
+fields were staged.
+
+Usage: tools/gen_regmap.py [--check] [description.json]
+  --check  Exit non-zero if the generated files are out of date (for CI).
+"""
+
+import json
+import os
+import sys
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+DEFAULT_INPUT = os.path.join(REPO_ROOT, "design", "registers", "asic_regs.json")
+SV_OUTPUT = os.path.join(REPO_ROOT, "design", "packages", "asic_pkg.sv")
+C_OUTPUT = os.path.join(REPO_ROOT, "hal", "asic_regs.h")
+
+ACCESS_TYPES = ("RO", "RW", "WO", "W1C")
+
+
+# --- Description Loading and Validation ---
+
+def parse_int(value):
+    return int(value, 0) if isinstance(value, str) else int(value)
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] REGMAP: %s\n" % message)
+    sys.exit(1)
+
+
+def load_description(path):
+    with open(path, "r") as fp:
+        desc = json.load(fp)
+
+    block_names = set()
+    for block in desc["blocks"]:
+        block["base"] = parse_int(block["base"])
+        if block["name"] in block_names:
+            fail("duplicate block %s" % block["name"])
+        block_names.add(block["name"])
+
+        offsets = set()
+        reg_names = set()
+        for reg in block["registers"]:
+            where = "%s.%s" % (block["name"], reg["name"])
+            reg["offset"] = parse_int(reg["offset"])
+            reg["reset"] = parse_int(reg.get("reset", 0))
+            if reg["access"] not in ACCESS_TYPES:
+                fail("%s: unknown access type %s" % (where, reg["access"]))
+            if reg["offset"] % 4 != 0:
+                fail("%s: offset 0x%X is not word aligned" % (where, reg["offset"]))
+            if reg["offset"] in offsets or reg["name"] in reg_names:
+                fail("%s: duplicate name or offset" % where)
+            offsets.add(reg["offset"])
+            reg_names.add(reg["name"])
+
+            used = 0
+            for field in reg["fields"]:
+                lsb, width = field["lsb"], field["width"]
+                if width < 1 or lsb < 0 or lsb + width > 32:
+                    fail("%s.%s: field does not fit in 32 bits" % (where, field["name"]))
+                mask = ((1 << width) - 1) << lsb
+                if used & mask:
+                    fail("%s.%s: field overlaps another field" % (where, field["name"]))
+                used |= mask
+                field["mask"] = mask
+            reg["field_mask"] = used
+    for region in desc.get("memory_regions", []):
+        region["base"] = parse_int(region["base"])
+        region["size"] = parse_int(region["size"])
+    return desc
+
+
+def camel(name):
+    return "".join(part.capitalize() for part in name.split("_"))
+
+
+def readable(reg):
+    return reg["access"] in ("RO", "RW", "W1C")
+
+
+def writable(reg):
+    return reg["access"] in ("RW", "WO", "W1C")
+
+
+# --- SystemVerilog Package ---
+
+def generate_sv(desc, source_name):
+    out = []
+    out.append("// -----------------------------------------------------------------------------")
+    out.append("// asic_pkg.sv")
+    out.append("// Shared address map and register definitions.")
+    out.append("//")
+    out.append("// GENERATED by tools/gen_regmap.py from %s. Do not edit." % source_name)
+    out.append("// -----------------------------------------------------------------------------")
+    out.append("")
+    out.append("package asic_pkg;")
+    out.append("")
+    for region in desc.get("memory_regions", []):
+        out.append("  localparam logic [31:0] %s_BASE_ADDR  = 32'h%08X;" % (region["name"], region["base"]))
+        out.append("  localparam int unsigned %s_SIZE_BYTES = %d;" % (region["name"], region["size"]))
+    out.append("")
+
+    for block in desc["blocks"]:
+        b = block["name"]
+        out.append("  // --- %s: %s ---" % (b, block.get("description", "")))
+        out.append("  localparam logic [31:0] %s_BASE_ADDR = 32'h%08X;" % (b, block["base"]))
+        for reg in block["registers"]:
+            r = "%s_%s" % (b, reg["name"])
+            out.append("")
+            out.append("  // %s (%s): %s" % (reg["name"], reg["access"], reg.get("description", "")))
+            out.append("  localparam logic [7:0]  %s_OFFSET = 8'h%02X;" % (r, reg["offset"]))
+            out.append("  localparam logic [31:0] %s_RESET  = 32'h%08X;" % (r, reg["reset"]))
+            for field in reg["fields"]:
+                f = "%s_%s" % (r, field["name"])
+                out.append("  localparam int unsigned %s_LSB   = %d;" % (f, field["lsb"]))
+                out.append("  localparam int unsigned %s_WIDTH = %d;" % (f, field["width"]))
+
+            # Packed struct, MSB first, with reserved gaps
+            members = []
+            bit = 32
+            for field in sorted(reg["fields"], key=lambda fl: -fl["lsb"]):
+                top = field["lsb"] + field["width"]
+                if top < bit:
+                    members.append((bit - top, "reserved_%d" % top))
+                members.append((field["width"], field["name"].lower()))
+                bit = field["lsb"]
+            if bit > 0:
+                members.append((bit, "reserved_0"))
+            out.append("  typedef struct packed {")
+            for width, name in members:
+                decl = "logic" if width == 1 else "logic [%d:0]" % (width - 1)
+                out.append("    %-14s %s;" % (decl, name))
+            out.append("  } %s_t;" % r.lower())
+        out.append("")
+
+    out.append("endpackage")
+    out.append("")
+    return "\n".join(out)
+
+
+# --- C Header ---
+
+def generate_c(desc, source_name):
+    out = []
+    out.append("/**")
+    out.append(" * @file asic_regs.h")
+    out.append(" * @brief Register offsets, field masks and accessors for firmware.")
+    out.append(" *")
+    out.append(" * GENERATED by tools/gen_regmap.py from %s. Do not edit." % source_name)
+    out.append(" *")
+    out.append(" * Multi-field updates are staged into an AsicRegBatch and committed once:")
+    out.append(" *")
+    out.append(" *     AsicRegBatch b = ASIC_REG_BATCH_INIT;")
+    out.append(" *     PeriphCtrl_StageEnable(&b, 1);")
+    out.append(" *     PeriphCtrl_StageIrqEn(&b, 1);")
+    out.append(" *     PeriphCtrl_Commit(&b);   // one bus write")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef ASIC_REGS_H")
+    out.append("#define ASIC_REGS_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append('#include "asic_bus.h"')
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief Pending field updates for one register.")
+    out.append(" */")
+    out.append("typedef struct {")
+    out.append("    uint32_t mask;      // Bits that have been staged")
+    out.append("    uint32_t value;     // Staged bit values, already shifted into place")
+    out.append("} AsicRegBatch;")
+    out.append("")
+    out.append("#define ASIC_REG_BATCH_INIT         { 0U, 0U }")
+    out.append("")
+
+    for block in desc["blocks"]:
+        b = block["name"]
+        out.append("// --- %s: %s ---" % (b, block.get("description", "")))
+        out.append("#define %-36s (0x%08XUL)" % (b + "_BASE_ADDR", block["base"]))
+        out.append("")
+        for reg in block["registers"]:
+            r = "%s_%s" % (b, reg["name"])
+            fn = camel(b) + camel(reg["name"])
+            out.append("// %s (%s): %s" % (reg["name"], reg["access"], reg.get("description", "")))
+            out.append("#define %-36s (0x%02XUL)" % (r + "_OFFSET", reg["offset"]))
+            out.append("#define %-36s (%s_BASE_ADDR + %s_OFFSET)" % (r + "_ADDR", b, r))
+            out.append("#define %-36s (0x%08XUL)" % (r + "_RESET", reg["reset"]))
+            for field in reg["fields"]:
+                f = "%s_%s" % (r, field["name"])
+                out.append("#define %-36s (%dU)" % (f + "_SHIFT", field["lsb"]))
+                out.append("#define %-36s (0x%08XUL)" % (f + "_MASK", field["mask"]))
+            out.append("")
+
+            if readable(reg):
+                out.append("static inline uint32_t %s_Read(void) {" % fn)
+                out.append("    return AsicBus_Read32(%s_ADDR);" % r)
+                out.append("}")
+                out.append("")
+                for field in reg["fields"]:
+                    f = "%s_%s" % (r, field["name"])
+                    out.append("static inline uint32_t %s_Get%s(uint32_t reg) {" % (fn, camel(field["name"])))
+                    out.append("    return (reg & %s_MASK) >> %s_SHIFT;" % (f, f))
+                    out.append("}")
+                    out.append("")
+
+            if writable(reg):
+                out.append("static inline void %s_Write(uint32_t value) {" % fn)
+                out.append("    AsicBus_Write32(%s_ADDR, value);" % r)
+                out.append("}")
+                out.append("")
+                for field in reg["fields"]:
+                    f = "%s_%s" % (r, field["name"])
+                    out.append("static inline void %s_Stage%s(AsicRegBatch *batch, uint32_t value) {"
+                               % (fn, camel(field["name"])))
+                    out.append("    batch->mask |= %s_MASK;" % f)
+                    out.append("    batch->value = (batch->value & ~%s_MASK) | ((value << %s_SHIFT) & %s_MASK);"
+                               % (f, f, f))
+                    out.append("}")
+                    out.append("")
+
+                out.append("static inline void %s_Commit(AsicRegBatch *batch) {" % fn)
+                if reg["access"] == "RW":
+                    out.append("    uint32_t value = batch->value;")
+                    out.append("    if ((batch->mask & 0x%08XUL) != 0x%08XUL) {" % (reg["field_mask"], reg["field_mask"]))
+                    out.append("        // Partial update: one read keeps the fields that were not staged")
+                    out.append("        value |= AsicBus_Read32(%s_ADDR) & ~batch->mask;" % r)
+                    out.append("    }")
+                    out.append("    AsicBus_Write32(%s_ADDR, value);" % r)
+                elif reg["access"] == "W1C":
+                    out.append("    // Zeros are ignored by write-1-to-clear bits, so no read is needed")
+                    out.append("    AsicBus_Write32(%s_ADDR, batch->value);" % r)
+                else:
+                    out.append("    AsicBus_Write32(%s_ADDR, batch->value);" % r)
+                out.append("    batch->mask = 0U;")
+                out.append("    batch->value = 0U;")
+                out.append("}")
+                out.append("")
+
+    out.append("#endif // ASIC_REGS_H")
+    out.append("")
+    return "\n".join(out)
+
+
+# --- Entry Point ---
+
+def write_if_changed(path, content, check):
+    old = None
+    if os.path.exists(path):
+        with open(path, "r") as fp:
+            old = fp.read()
+    if old == content:
+        return True
+    if check:
+        sys.stderr.write("[ERROR] REGMAP: %s is out of date, run tools/gen_regmap.py\n"
+                         % os.path.relpath(path, REPO_ROOT))
+        return False
+    with open(path, "w") as fp:
+        fp.write(content)
+    print("[INFO] REGMAP: wrote %s" % os.path.relpath(path, REPO_ROOT))
+    return True
+
+
+def main(argv):
+    check = "--check" in argv
+    args = [a for a in argv if a != "--check"]
+    source = os.path.abspath(args[0]) if args else DEFAULT_INPUT
+    source_name = os.path.relpath(source, REPO_ROOT)
+
+    desc = load_description(source)
+    ok = write_if_changed(SV_OUTPUT, generate_sv(desc, source_name), check)
+    ok = write_if_changed(C_OUTPUT, generate_c(desc, source_name), check) and ok
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+@file gen_variants.py
+@brief Resolves ASIC variant profiles for the firmware build matrix.
+
+Each variants/<ASIC_ID>.json profile is layered over config/config.json.
+The "config" object is deep-merged over the common file, so a profile lists
+only the values where that part differs. The script writes:
+  - <out-dir>/<ASIC_ID>/config.json : the merged configuration, which later
+    build steps for that variant read.
+  - <cmake file>                    : one set() block per variant holding its
+    compile definitions and flag sets. CMakeLists.txt includes this file at
+    configure time.
+
+Variants whose flag sets match share the same object libraries, so
+ASIC_VARIANT_<ID>_FLAGS_KEY names the flag set rather than the variant.
+The shared objects also take ASIC_VARIANT_<ID>_SHARED_DEFINES (the
+compile-time log level, see utils/log.h), which is part of the key.
+
+Usage: tools/gen_variants.py --cmake variants.cmake --out-dir DIR [profile.json ...]
+"""
+
+import copy
+import glob
+import json
+import os
+import re
+import sys
+
+import asic_config
+
+REPO_ROOT = asic_config.REPO_ROOT
+VARIANTS_DIR = os.path.join(REPO_ROOT, "variants")
+
+LOG_LEVELS = ["DEBUG", "INFO", "WARN", "ERROR", "FATAL"]
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] VARIANTS: %s\n" % message)
+    sys.exit(1)
+
+
+def deep_merge(base, overlay, where):
+    merged = copy.deepcopy(base)
+    for key, value in overlay.items():
+        if key not in merged:
+            fail("%s: unknown setting %s" % (where, key))
+        if isinstance(value, dict):
+            if not isinstance(merged[key], dict):
+                fail("%s: %s is not a section" % (where, key))
+            merged[key] = deep_merge(merged[key], value, "%s.%s" % (where, key))
+        else:
+            merged[key] = value
+    return merged
+
+
+def load_variant(path, common):
+    with open(path, "r") as fp:
+        profile = json.load(fp)
+    asic_id = profile["asic_id"]
+    if not re.match(r"^[A-Za-z0-9_]+$", asic_id):
+        fail("%s: asic_id must be an identifier" % path)
+    if os.path.splitext(os.path.basename(path))[0] != asic_id:
+        fail("%s: file name must match asic_id %s" % (path, asic_id))
+
+    config = deep_merge(common, profile.get("config", {}), asic_id)
+    default_size = common["build_config_defaults"]["optimization_level"]
+    build = profile.get("build", {})
+    size_flags = build.get("size_flags", [default_size])
+    speed_flags = build.get("speed_flags", ["-O3"])
+
+    memory = config["memory_map_defaults"]
+    clock = config["clock_settings"]
+    debug = config["debug_settings"]
+    if debug["default_log_level"] not in LOG_LEVELS:
+        fail("%s: unknown log level %s" % (asic_id, debug["default_log_level"]))
+
+    defines = [
+        ("ASIC_ID", '"%s"' % asic_id),
+        ("ASIC_SYSTEM_CLOCK_HZ", "%dUL" % asic_config.parse_int(clock["system_clock_hz"])),
+        ("ASIC_FLASH_BASE_ADDR", "0x%08XUL" % asic_config.parse_int(memory["flash_start_address"])),
+        ("ASIC_FLASH_SIZE_BYTES", "%dUL" % asic_config.parse_int(memory["flash_size_bytes"])),
+        ("ASIC_RAM_BASE_ADDR", "0x%08XUL" % asic_config.parse_int(memory["ram_start_address"])),
+        ("ASIC_RAM_SIZE_BYTES", "%dUL" % asic_config.parse_int(memory["ram_size_bytes"])),
+    ]
+    # Also compiled into the shared objects, where it removes logging below it
+    shared_defines = [
+        ("ASIC_LOG_LEVEL_DEFAULT", "%d" % LOG_LEVELS.index(debug["default_log_level"])),
+    ]
+    return {
+        "id": asic_id,
+        "config": config,
+        "defines": defines + shared_defines,
+        "shared_defines": shared_defines,
+        "size_flags": size_flags,
+        "speed_flags": speed_flags,
+    }
+
+
+def flags_key(variant):
+    text = "_".join(variant["size_flags"]) + "__" + "_".join(variant["speed_flags"])
+    text += "".join("__%s%s" % (name.replace("ASIC_", ""), value) for name, value in variant["shared_defines"])
+    return re.sub(r"[^A-Za-z0-9_]", "", text.replace("-", ""))
+
+
+def cmake_list(items):
+    return " ".join('"%s"' % item.replace("\\", "\\\\").replace('"', '\\"') for item in items)
+
+
+def generate_cmake(variants, out_dir):
+    out = []
+    out.append("# GENERATED by tools/gen_variants.py. Do not edit.")
+    out.append("set(ASIC_VARIANTS %s)" % " ".join(v["id"] for v in variants))
+    for v in variants:
+        prefix = "ASIC_VARIANT_%s" % v["id"]
+        out.append("")
+        out.append("set(%s_CONFIG \"%s\")" % (prefix, os.path.join(out_dir, v["id"], "config.json")))
+        out.append("set(%s_DEFINES %s)" % (prefix, cmake_list("%s=%s" % d for d in v["defines"])))
+        out.append("set(%s_SHARED_DEFINES %s)" % (prefix, cmake_list("%s=%s" % d for d in v["shared_defines"])))
+        out.append("set(%s_SIZE_FLAGS %s)" % (prefix, cmake_list(v["size_flags"])))
+        out.append("set(%s_SPEED_FLAGS %s)" % (prefix, cmake_list(v["speed_flags"])))
+        out.append("set(%s_FLAGS_KEY %s)" % (prefix, flags_key(v)))
+    out.append("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, content):
+    if os.path.exists(path):
+        with open(path, "r") as fp:
+            if fp.read() == content:
+                return
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as fp:
+        fp.write(content)
+
+
+def option(args, name):
+    if name not in args:
+        fail("%s is required" % name)
+    index = args.index(name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def main(argv):
+    args = list(argv)
+    cmake_path = os.path.abspath(option(args, "--cmake"))
+    out_dir = os.path.abspath(option(args, "--out-dir"))
+    profiles = [os.path.abspath(a) for a in args] or sorted(glob.glob(os.path.join(VARIANTS_DIR, "*.json")))
+    if not profiles:
+        fail("no variant profiles found")
+
+    common = asic_config.load()
+    variants = [load_variant(p, common) for p in profiles]
+    for v in variants:
+        write_if_changed(os.path.join(out_dir, v["id"], "config.json"),
+                         json.dumps(v["config"], indent=2) + "\n")
+    write_if_changed(cmake_path, generate_cmake(variants, out_dir))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,379 @@
+#!/usr/bin/env python3
+"""
+@file lms_sign.py
+@brief Host-side HSS/LMS signer for firmware images, with cached tree state.
+
+LMS (RFC 8554, SP 800-208) is stateful. Every signature uses a fresh
+one-time key, the leaf q of a Merkle tree of height h, and a leaf must
+never sign twice. The key file therefore holds the signing state. The
+next leaf is advanced and written back before a signature is released,
+and the file is replaced atomically. Never copy or restore a key file.
+
+Signing needs the authentication path of leaf q: one node per tree level.
+Recomputing it would mean rebuilding every one-time public key in the
+tree. Instead the key file caches the Merkle tree split at height s:
+  - The top tree: every node above the level-s subtree roots. It is
+    built once, at key generation.
+  - The bottom subtree holding the current leaf: its 2^s leaves and
+    their parents. When signing moves past the subtree, the next one is
+    built.
+A signature then costs one one-time signature plus, amortised, one leaf.
+The cache is 2^(h - s + 1) + 2^(s + 1) nodes of 32 bytes.
+
+Output is HSS with one level (RFC 8554 Section 6), the format
+Hss_Verify in crypto/lms.h and SecureBoot_VerifyImage expect:
+  - public key: u32 1 || u32 lms type || u32 ots type || I || T[1];
+  - signature: u32 0 || LMS signature.
+Every signature is verified here before it is written.
+
+Key generation builds all 2^h leaves: seconds for H10, minutes for H15.
+
+Usage:
+  tools/lms_sign.py keygen [--lms H5|H10|H15|H20] [--ots W1|W2|W4|W8] [--subtree S] key.json pub.bin
+  tools/lms_sign.py sign key.json image.bin sig.bin
+  tools/lms_sign.py verify pub.bin image.bin sig.bin
+  tools/lms_sign.py info key.json
+"""
+
+import hashlib
+import json
+import os
+import struct
+import sys
+
+# Must match crypto/lms.h
+LMS_TYPES = {"H5": (5, 5), "H10": (6, 10), "H15": (7, 15), "H20": (8, 20), "H25": (9, 25)}
+OTS_TYPES = {"W1": (1, 1, 265, 7), "W2": (2, 2, 133, 6), "W4": (3, 4, 67, 4), "W8": (4, 8, 34, 0)}
+
+N = 32
+ID_BYTES = 16
+D_PBLC = 0x8080
+D_MESG = 0x8181
+D_LEAF = 0x8282
+D_INTR = 0x8383
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] LMS: %s\n" % message)
+    sys.exit(1)
+
+
+def option(args, name, default=None):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def u32(v):
+    return struct.pack(">I", v)
+
+
+def u16(v):
+    return struct.pack(">H", v)
+
+
+def sha256(*parts):
+    h = hashlib.sha256()
+    for part in parts:
+        h.update(part)
+    return h.digest()
+
+
+def lms_params(lms_type):
+    for code, height in LMS_TYPES.values():
+        if code == lms_type:
+            return height
+    fail("unsupported LMS type %d" % lms_type)
+
+
+def ots_params(ots_type):
+    for code, w, p, ls in OTS_TYPES.values():
+        if code == ots_type:
+            return w, p, ls
+    fail("unsupported LM-OTS type %d" % ots_type)
+
+
+# --- LM-OTS ---
+
+def digits(q_hash, w, p, ls):
+    """Q || Cksm(Q) as p base-2^w digits, most significant first."""
+    count = N * 8 // w
+    mask = (1 << w) - 1
+
+    def coef(s, i):
+        return (s[i * w // 8] >> (8 - (w * (i % (8 // w)) + w))) & mask
+
+    checksum = sum(mask - coef(q_hash, i) for i in range(count)) << ls
+    s = q_hash + u16(checksum & 0xFFFF)
+    return [coef(s, i) for i in range(p)]
+
+
+def chain(ident, q, i, tmp, start, stop):
+    prefix = ident + u32(q) + u16(i)
+    for j in range(start, stop):
+        tmp = sha256(prefix, bytes([j]), tmp)
+    return tmp
+
+
+def ots_secret(key, q, i):
+    # RFC 8554 Appendix A: x_q[i] = H(I || u32 q || u16 i || u8 0xff || SEED)
+    return sha256(key.ident, u32(q), u16(i), b"\xff", key.seed)
+
+
+def ots_public(key, q):
+    w, p, _ = ots_params(key.ots_type)
+    ends = [chain(key.ident, q, i, ots_secret(key, q, i), 0, (1 << w) - 1) for i in range(p)]
+    return sha256(key.ident, u32(q), u16(D_PBLC), *ends)
+
+
+def ots_sign(key, q, message):
+    w, p, ls = ots_params(key.ots_type)
+    c = os.urandom(N)
+    q_hash = sha256(key.ident, u32(q), u16(D_MESG), c, message)
+    ys = [chain(key.ident, q, i, ots_secret(key, q, i), 0, a) for i, a in enumerate(digits(q_hash, w, p, ls))]
+    return u32(key.ots_type) + c + b"".join(ys)
+
+
+# --- Merkle Tree and Cached State ---
+
+class Key:
+    def __init__(self, state):
+        self.lms_type = state["lms_type"]
+        self.ots_type = state["ots_type"]
+        self.ident = bytes.fromhex(state["id"])
+        self.seed = bytes.fromhex(state["seed"])
+        self.q = state["q"]
+        self.subtree = state["subtree_height"]
+        self.top = [bytes.fromhex(n) if n else None for n in state["top"]]
+        self.bottom_index = state["bottom"]["index"]
+        self.bottom = [bytes.fromhex(n) if n else None for n in state["bottom"]["nodes"]]
+        self.height = lms_params(self.lms_type)
+
+    def state(self):
+        return {
+            "lms_type": self.lms_type,
+            "ots_type": self.ots_type,
+            "id": self.ident.hex(),
+            "seed": self.seed.hex(),
+            "q": self.q,
+            "subtree_height": self.subtree,
+            "top": [n.hex() if n else "" for n in self.top],
+            "bottom": {"index": self.bottom_index, "nodes": [n.hex() if n else "" for n in self.bottom]},
+        }
+
+    def leaf(self, q):
+        node = (1 << self.height) + q
+        return sha256(self.ident, u32(node), u16(D_LEAF), ots_public(self, q))
+
+    def interior(self, node, left, right):
+        return sha256(self.ident, u32(node), u16(D_INTR), left, right)
+
+    def subtree_root_node(self, index):
+        return (1 << (self.height - self.subtree)) + index
+
+    def build_subtree(self, index):
+        """Nodes of bottom subtree index, as a heap: entry 1 is its root."""
+        s = self.subtree
+        nodes = [None] * (1 << (s + 1))
+        for k in range(1 << s):
+            nodes[(1 << s) + k] = self.leaf((index << s) + k)
+        root = self.subtree_root_node(index)
+        for local in range((1 << s) - 1, 0, -1):
+            depth = local.bit_length() - 1
+            node = (root << depth) + (local - (1 << depth))
+            nodes[local] = self.interior(node, nodes[2 * local], nodes[2 * local + 1])
+        return nodes
+
+    def build_top(self, subtree_roots):
+        top_height = self.height - self.subtree
+        top = [None] * (1 << (top_height + 1))
+        for index, root in enumerate(subtree_roots):
+            top[self.subtree_root_node(index)] = root
+        for node in range((1 << top_height) - 1, 0, -1):
+            top[node] = self.interior(node, top[2 * node], top[2 * node + 1])
+        return top
+
+    def auth_path(self, q):
+        path = []
+        leaf_node = (1 << self.height) + q
+        root = self.subtree_root_node(self.bottom_index)
+        for level in range(self.height):
+            sibling = (leaf_node >> level) ^ 1
+            if level < self.subtree:
+                depth = self.subtree - level
+                path.append(self.bottom[(1 << depth) + sibling - (root << depth)])
+            else:
+                path.append(self.top[sibling])
+        return path
+
+    def public_key(self):
+        return u32(1) + u32(self.lms_type) + u32(self.ots_type) + self.ident + self.top[1]
+
+
+def save_state(path, key):
+    """Write-ahead: the file must show the leaf as used before its signature exists."""
+    tmp = path + ".tmp"
+    fd = os.open(tmp, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o600)
+    with os.fdopen(fd, "w") as fp:
+        json.dump(key.state(), fp)
+        fp.flush()
+        os.fsync(fp.fileno())
+    os.replace(tmp, path)
+    # The rename is only durable once the directory entry is on disk
+    dfd = os.open(os.path.dirname(os.path.abspath(path)), os.O_RDONLY)
+    try:
+        os.fsync(dfd)
+    finally:
+        os.close(dfd)
+
+
+def load_state(path):
+    with open(path) as fp:
+        return Key(json.load(fp))
+
+
+# --- Verification ---
+
+def lms_verify(pub, message, sig):
+    lms_type, ots_type = struct.unpack_from(">II", pub, 0)
+    ident, root = pub[8:8 + ID_BYTES], pub[8 + ID_BYTES:8 + ID_BYTES + N]
+    height = lms_params(lms_type)
+    w, p, ls = ots_params(ots_type)
+    ots_bytes = 4 + N + p * N
+    if len(sig) != 4 + ots_bytes + 4 + height * N:
+        return False
+    q, sig_ots_type = struct.unpack_from(">II", sig, 0)
+    if sig_ots_type != ots_type or struct.unpack_from(">I", sig, 4 + ots_bytes)[0] != lms_type:
+        return False
+    if q >= 1 << height:
+        return False
+    c = sig[8:8 + N]
+    q_hash = sha256(ident, u32(q), u16(D_MESG), c, message)
+    ends = []
+    for i, a in enumerate(digits(q_hash, w, p, ls)):
+        y = sig[8 + N + i * N:8 + N + (i + 1) * N]
+        ends.append(chain(ident, q, i, y, a, (1 << w) - 1))
+    kc = sha256(ident, u32(q), u16(D_PBLC), *ends)
+
+    node = (1 << height) + q
+    tmp = sha256(ident, u32(node), u16(D_LEAF), kc)
+    path = sig[4 + ots_bytes + 4:]
+    for level in range(height):
+        sibling = path[level * N:(level + 1) * N]
+        if node & 1:
+            tmp = sha256(ident, u32(node >> 1), u16(D_INTR), sibling, tmp)
+        else:
+            tmp = sha256(ident, u32(node >> 1), u16(D_INTR), tmp, sibling)
+        node >>= 1
+    return tmp == root
+
+
+def hss_verify(pub, message, sig):
+    if len(pub) != 60 or len(sig) < 4:
+        return False
+    levels, nspk = struct.unpack_from(">I", pub, 0)[0], struct.unpack_from(">I", sig, 0)[0]
+    if levels != 1 or nspk != 0:
+        return False        # This tool only produces single-level keys
+    return lms_verify(pub[4:], message, sig[4:])
+
+
+# --- Commands ---
+
+def keygen(args):
+    lms_name = option(args, "--lms", "H10")
+    ots_name = option(args, "--ots", "W4")
+    if lms_name not in LMS_TYPES or ots_name not in OTS_TYPES:
+        fail("--lms must be one of %s and --ots one of %s" % (sorted(LMS_TYPES), sorted(OTS_TYPES)))
+    lms_type, height = LMS_TYPES[lms_name]
+    subtree = int(option(args, "--subtree", str((height + 1) // 2)))
+    if len(args) != 2 or not 0 < subtree <= height:
+        fail("usage: lms_sign.py keygen [--lms H] [--ots W] [--subtree S] key.json pub.bin")
+    key_path, pub_path = args
+    if os.path.exists(key_path):
+        fail("%s exists; refusing to overwrite a signing state" % key_path)
+
+    key = Key({
+        "lms_type": lms_type, "ots_type": OTS_TYPES[ots_name][0], "id": os.urandom(ID_BYTES).hex(),
+        "seed": os.urandom(N).hex(), "q": 0, "subtree_height": subtree, "top": [],
+        "bottom": {"index": 0, "nodes": []},
+    })
+    roots = []
+    for index in range(1 << (height - subtree)):
+        nodes = key.build_subtree(index)
+        if index == 0:
+            key.bottom = nodes
+        roots.append(nodes[1])
+    key.top = key.build_top(roots)
+    save_state(key_path, key)
+    with open(pub_path, "wb") as fp:
+        fp.write(key.public_key())
+    print("[INFO] LMS: LMS_SHA256_M32_%s / LMOTS_SHA256_N32_%s, %d signatures, root %s" %
+          (lms_name, ots_name, 1 << height, key.top[1].hex()))
+    return 0
+
+
+def sign(args):
+    if len(args) != 3:
+        fail("usage: lms_sign.py sign key.json image.bin sig.bin")
+    key_path, image_path, sig_path = args
+    key = load_state(key_path)
+    if key.q >= 1 << key.height:
+        fail("key exhausted: all %d leaves are used" % (1 << key.height))
+    with open(image_path, "rb") as fp:
+        image = fp.read()
+
+    q = key.q
+    index = q >> key.subtree
+    if index != key.bottom_index:
+        key.bottom = key.build_subtree(index)
+        key.bottom_index = index
+    key.q = q + 1
+    save_state(key_path, key)
+
+    lms_sig = u32(q) + ots_sign(key, q, image) + u32(key.lms_type) + b"".join(key.auth_path(q))
+    sig = u32(0) + lms_sig
+    if not hss_verify(key.public_key(), image, sig):
+        fail("signature for leaf %d does not verify; leaf is burned, state kept" % q)
+    with open(sig_path, "wb") as fp:
+        fp.write(sig)
+    print("[INFO] LMS: signed %s with leaf %d, %d left" % (image_path, q, (1 << key.height) - key.q))
+    return 0
+
+
+def verify(args):
+    if len(args) != 3:
+        fail("usage: lms_sign.py verify pub.bin image.bin sig.bin")
+    blobs = []
+    for path in args:
+        with open(path, "rb") as fp:
+            blobs.append(fp.read())
+    if not hss_verify(*blobs):
+        fail("signature does not verify")
+    print("[INFO] LMS: signature verifies")
+    return 0
+
+
+def info(args):
+    if len(args) != 1:
+        fail("usage: lms_sign.py info key.json")
+    key = load_state(args[0])
+    cached = sum(1 for n in key.top if n) + sum(1 for n in key.bottom if n)
+    print("[INFO] LMS: height %d, subtree %d, next leaf %d of %d, %d cached nodes, root %s" %
+          (key.height, key.subtree, key.q, 1 << key.height, cached, key.top[1].hex()))
+    return 0
+
+
+def main(argv):
+    commands = {"keygen": keygen, "sign": sign, "verify": verify, "info": info}
+    if not argv or argv[0] not in commands:
+        fail("usage: lms_sign.py (keygen | sign | verify | info) ...")
+    return commands[argv[0]](list(argv[1:]))
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
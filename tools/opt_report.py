@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""
+@file opt_report.py
+@brief Per-function size and speed comparison between optimisation modes.
+
+Each argument names a mode and an image built in that mode. For the host
+bench, with the profile from tools/pgo_profile.py run:
+
+  cmake -S bench -B build/bench/o2
+  cmake -S bench -B build/bench/lto -DBENCH_LTO=ON
+  cmake -S bench -B build/bench/pgo -DBENCH_PGO=USE
+  tools/opt_report.py --run o2=build/bench/o2/asic_bench lto=build/bench/lto/asic_bench \
+                            pgo=build/bench/pgo/asic_bench
+
+For firmware images, build the root project once per mode (plain,
+-DASIC_ENABLE_LTO=ON, -DASIC_ENABLE_PGO=ON, both) and pass the same variant
+from each, with --nm arm-none-eabi-nm for target builds. Only functions
+reachable from main() survive --gc-sections in those images.
+
+For every function the report lists its share of the profiled work (from
+conf/pgo/profile.json) and its code size in each mode. Hot functions come
+first, so the table shows whether the hot paths received the speed flags and
+whether the cold code stayed small. Compiler clones (.constprop, .isra,
+.lto_priv, ...) are counted under the function they were cloned from.
+
+Speed is measured per benchmark, not per function. With --run, each image
+is treated as a host bench binary (bench/ built with BENCH_LTO/BENCH_PGO) and
+executed, and every "N ticks/<unit>" line it prints is compared across modes.
+
+Usage: tools/opt_report.py [--profile profile.json] [--nm NM] [--run]
+                           [--iterations N] MODE=ELF [MODE=ELF ...]
+"""
+
+import json
+import os
+import re
+import subprocess
+import sys
+
+import asic_config
+
+DEFAULT_PROFILE = os.path.join(asic_config.REPO_ROOT, "conf", "pgo", "profile.json")
+DEFAULT_ITERATIONS = 10000
+
+# C runtime and toolchain symbols that are not part of the firmware
+RUNTIME_SYMBOLS = {"deregister_tm_clones", "register_tm_clones", "frame_dummy"}
+
+INFO_LINE = re.compile(r"\[INFO\] (\w+): (.*)")
+TICKS_VALUE = re.compile(r"(?:(\w+) +)?([0-9.]+) ticks/(\w+)")
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] OPT_REPORT: %s\n" % message)
+    sys.exit(1)
+
+
+def option(args, name, default=None):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def function_sizes(nm, elf):
+    result = subprocess.run([nm, "--defined-only", "-S", elf], stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        fail("%s failed on %s: %s" % (nm, elf, result.stderr.strip()))
+    sizes = {}
+    for line in result.stdout.splitlines():
+        fields = line.split()
+        if len(fields) != 4 or fields[2] not in ("t", "T"):
+            continue
+        name = fields[3].split(".")[0]
+        if name.startswith("_") or name in RUNTIME_SYMBOLS:
+            continue
+        sizes[name] = sizes.get(name, 0) + int(fields[1], 16)
+    return sizes
+
+
+def bench_ticks(elf, iterations):
+    result = subprocess.run([os.path.abspath(elf), "--iterations", str(iterations)],
+                            stdout=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        fail("%s exited with %d" % (elf, result.returncode))
+    ticks = {}
+    for line in result.stdout.splitlines():
+        match = INFO_LINE.match(line)
+        if not match:
+            continue
+        module, rest = match.groups()
+        values = TICKS_VALUE.findall(rest)
+        # Lines with several timings (e.g. RAMFUNC flash vs ram) name the subject first
+        for label, value, unit in values:
+            parts = [module] + ([rest.split()[0], label] if len(values) > 1 else [])
+            ticks["%s ticks/%s" % (" ".join(parts), unit)] = float(value)
+    return ticks
+
+
+def load_profile(path):
+    if not os.path.exists(path):
+        return {}
+    with open(path, "r") as fp:
+        profile = json.load(fp)
+    return {f["name"]: f for f in profile["functions"]}
+
+
+def print_table(header, rows):
+    widths = [max(len(str(row[i])) for row in [header] + rows) for i in range(len(header))]
+    for row in [header] + rows:
+        cells = [str(cell).ljust(widths[0]) if i == 0 else str(cell).rjust(widths[i])
+                 for i, cell in enumerate(row)]
+        print("  ".join(cells))
+
+
+def main(argv):
+    args = list(argv)
+    profile_path = option(args, "--profile", DEFAULT_PROFILE)
+    nm = option(args, "--nm", "nm")
+    iterations = int(option(args, "--iterations", DEFAULT_ITERATIONS))
+    run = "--run" in args
+    args = [a for a in args if a != "--run"]
+
+    modes = []
+    for arg in args:
+        if "=" not in arg:
+            fail("expected MODE=ELF, got %s" % arg)
+        mode, elf = arg.split("=", 1)
+        if not os.path.exists(elf):
+            fail("%s: no such file %s" % (mode, elf))
+        modes.append((mode, elf))
+    if not modes:
+        fail("usage: opt_report.py [--profile P] [--nm NM] [--run] MODE=ELF ...")
+
+    profile = load_profile(profile_path)
+    sizes = {mode: function_sizes(nm, elf) for mode, elf in modes}
+    # Profiled functions that every mode inlined still belong in the table
+    names = set(profile)
+    for table in sizes.values():
+        names.update(table)
+
+    def heat(name):
+        return profile[name]["share"] if name in profile else 0.0
+
+    rows = []
+    totals = {mode: {"hot": 0, "cold": 0} for mode, _ in modes}
+    for name in sorted(names, key=lambda n: (-heat(n), n)):
+        hot = name in profile and profile[name]["hot"]
+        row = [name, "%.1f%%" % (100.0 * heat(name)) if name in profile else "-", "hot" if hot else ""]
+        for mode, _ in modes:
+            size = sizes[mode].get(name)
+            row.append(size if size is not None else "inlined")
+            totals[mode]["hot" if hot else "cold"] += size or 0
+        rows.append(row)
+
+    print("Code size in bytes per function (profile: %s)" %
+          (os.path.relpath(profile_path) if profile else "none"))
+    print_table(["function", "work", ""] + [mode for mode, _ in modes], rows)
+    print()
+    print_table(["total", "", ""] + [mode for mode, _ in modes], [
+        ["hot functions", "", ""] + [totals[mode]["hot"] for mode, _ in modes],
+        ["cold functions", "", ""] + [totals[mode]["cold"] for mode, _ in modes],
+        ["all functions", "", ""] + [totals[mode]["hot"] + totals[mode]["cold"] for mode, _ in modes],
+    ])
+
+    if run:
+        ticks = {mode: bench_ticks(elf, iterations) for mode, elf in modes}
+        metrics = sorted(set(k for table in ticks.values() for k in table))
+        print()
+        print("Benchmark ticks (lower is faster, %d iterations)" % iterations)
+        print_table(["benchmark"] + [mode for mode, _ in modes],
+                    [[metric] + ["%.1f" % ticks[mode][metric] if metric in ticks[mode] else "-"
+                                 for mode, _ in modes] for metric in metrics])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
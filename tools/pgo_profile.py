@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+@file pgo_profile.py
+@brief Collects an execution profile from the host benchmark and converts it
+       for the firmware build.
+
+The profile is collected once, on the host, by building bench/ with
+BENCH_PGO=GENERATE and running the benchmark suite. It is used two ways:
+
+  - Host: the raw .gcda files feed -fprofile-use in a bench build with
+    BENCH_PGO=USE and otherwise identical options. GCC then optimises each
+    function and branch from the measured counts.
+  - Target and firmware matrix: .gcda files are tied to the exact compiler,
+    target and flags that produced them, so they cannot be applied to the
+    arm-none-eabi build. Instead the counts are reduced to
+    conf/pgo/profile.json, a per-function weight list that is independent of
+    the toolchain. With -DASIC_ENABLE_PGO=ON, the root CMakeLists.txt compiles
+    every source that holds a hot function with the variant's speed flags,
+    and everything else with its size flags.
+
+The profile also records a SHA-256 of every file the benchmark build
+compiled, plus bench/CMakeLists.txt that lists them. A profile taken before one of them
+changed no longer describes the code being built, so the cmake command
+refuses it and names the files to re-profile for; the firmware build then
+fails at configure time instead of silently sizing new hot code for -Os.
+
+A function's weight is the sum of the execution counts of its source lines,
+which approximates the work done inside it (calls alone would rank a small
+accessor above a kernel loop). Functions are ranked by weight. The hot set
+is the shortest prefix of that ranking that covers HOT_FRACTION of the total.
+
+Usage:
+  tools/pgo_profile.py run [--build-dir DIR] [--iterations N] [-o profile.json]
+      Configure, build and run the instrumented bench, then collect.
+  tools/pgo_profile.py collect --build-dir GEN --gcda-dir DIR [-o profile.json]
+      Collect from an existing BENCH_PGO=GENERATE build that has been run.
+  tools/pgo_profile.py cmake [--profile profile.json] -o pgo.cmake
+      Write ASIC_PGO_HOT_SOURCES and ASIC_PGO_HOT_FUNCTIONS for CMake.
+"""
+
+import glob
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import asic_config
+
+REPO_ROOT = asic_config.REPO_ROOT
+DEFAULT_PROFILE = os.path.join(REPO_ROOT, "conf", "pgo", "profile.json")
+DEFAULT_BUILD_DIR = os.path.join(REPO_ROOT, "build", "pgo")
+DEFAULT_ITERATIONS = 10000
+
+HOT_FRACTION = 0.95
+
+# The benchmark driver itself is not firmware
+EXCLUDED_DIRS = ("bench/",)
+
+# Lists the sources the benchmark builds; hashed along with them
+BENCH_LISTFILE = "bench/CMakeLists.txt"
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] PGO: %s\n" % message)
+    sys.exit(1)
+
+
+def info(message):
+    print("[INFO] PGO: %s" % message)
+
+
+def option(args, name, default=None):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+# --- Collection ---
+
+def gcov_units(build_dir, gcda_dir):
+    """
+    Pairs each .gcda with its .gcno. The bench build passes
+    -fprofile-prefix-path, so a .gcda name is the object path relative to the
+    build directory with '/' replaced by '#'.
+    """
+    units = []
+    for gcda in sorted(glob.glob(os.path.join(gcda_dir, "*.gcda"))):
+        relative = os.path.basename(gcda)[:-len(".gcda")].replace("#", "/")
+        # bench/'s own sources (the driver, the flash-resident kernel copy)
+        # compile to objects directly in the target directory; skip them
+        if "/" not in relative.split(".dir/", 1)[-1]:
+            continue
+        gcno = os.path.join(build_dir, relative + ".gcno")
+        if not os.path.exists(gcno):
+            fail("no notes file %s for %s (was the bench rebuilt after the run?)" % (gcno, gcda))
+        units.append((gcno, gcda))
+    if not units:
+        fail("no profile data in %s (run the instrumented bench first)" % gcda_dir)
+    return units
+
+
+def read_unit(gcno, gcda):
+    # gcov finds the notes file by stem, so give both the same name
+    with tempfile.TemporaryDirectory() as tmp:
+        shutil.copy(gcno, os.path.join(tmp, "unit.gcno"))
+        shutil.copy(gcda, os.path.join(tmp, "unit.gcda"))
+        result = subprocess.run(["gcov", "--json-format", "--stdout", "unit.gcda"],
+                                cwd=tmp, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                                universal_newlines=True)
+    if result.returncode != 0:
+        fail("gcov failed on %s: %s" % (gcda, result.stderr.strip()))
+    return json.loads(result.stdout)
+
+
+def repo_relative(path):
+    path = os.path.realpath(path)
+    root = os.path.realpath(REPO_ROOT) + os.sep
+    if not path.startswith(root):
+        return None
+    return path[len(root):].replace(os.sep, "/")
+
+
+def file_digest(source):
+    path = os.path.join(REPO_ROOT, source)
+    if not os.path.exists(path):
+        return None
+    with open(path, "rb") as fp:
+        return hashlib.sha256(fp.read()).hexdigest()
+
+
+def bench_sources():
+    """Repo-relative sources compiled into the benchmark, from its listfile."""
+    with open(os.path.join(REPO_ROOT, BENCH_LISTFILE), "r") as fp:
+        listfile = fp.read()
+    block = re.search(r"add_executable\(asic_bench(.*?)\)", listfile, re.S)
+    if block is None:
+        fail("no asic_bench sources in %s" % BENCH_LISTFILE)
+    sources = []
+    for item in re.findall(r"\S+\.c\b", block.group(1)):
+        item = item.strip('"')
+        sources.append(item.replace("${REPO_ROOT}/", "") if item.startswith("${REPO_ROOT}/") else "bench/" + item)
+    return sources
+
+
+def collect(build_dir, gcda_dir):
+    functions = {}
+    # Headers reach the profile through gcov; sources without functions do not
+    inputs = set(bench_sources())
+    inputs.add(BENCH_LISTFILE)
+    compiler = None
+    for gcno, gcda in gcov_units(build_dir, gcda_dir):
+        report = read_unit(gcno, gcda)
+        compiler = report.get("gcc_version", compiler)
+        for entry in report["files"]:
+            source = repo_relative(entry["file"])
+            if source is not None:
+                inputs.add(source)
+            if source is None or source.startswith(EXCLUDED_DIRS):
+                continue
+            for fn in entry["functions"]:
+                functions[(source, fn["name"])] = {
+                    "name": fn["name"],
+                    "source": source,
+                    "calls": fn["execution_count"],
+                    "weight": 0,
+                }
+            for line in entry["lines"]:
+                key = (source, line.get("function_name"))
+                if key in functions:
+                    functions[key]["weight"] += line["count"]
+    return compiler, functions, {source: file_digest(source) for source in sorted(inputs)}
+
+
+def rank(functions):
+    ranked = sorted((f for f in functions.values() if f["weight"] > 0),
+                    key=lambda f: (-f["weight"], f["source"], f["name"]))
+    total = sum(f["weight"] for f in ranked)
+    covered = 0
+    for f in ranked:
+        f["hot"] = covered < HOT_FRACTION * total
+        covered += f["weight"]
+        f["share"] = round(f["weight"] / total, 6) if total else 0.0
+    return ranked
+
+
+def write_profile(path, workload, compiler, inputs, ranked):
+    profile = {
+        "workload": workload,
+        "compiler": compiler,
+        "hot_fraction": HOT_FRACTION,
+        "inputs": inputs,
+        "functions": ranked,
+    }
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w") as fp:
+        json.dump(profile, fp, indent=2)
+        fp.write("\n")
+    hot = [f for f in ranked if f["hot"]]
+    info("%d functions profiled, %d hot, written to %s" % (len(ranked), len(hot), path))
+    for f in hot:
+        info("  hot %5.1f%%  %s (%s)" % (100.0 * f["share"], f["name"], f["source"]))
+
+
+def run_workload(build_dir, iterations):
+    gen_dir = os.path.join(build_dir, "gen")
+    gcda_dir = os.path.join(build_dir, "gcda")
+    # Counts accumulate across runs; start from a clean profile
+    shutil.rmtree(gcda_dir, ignore_errors=True)
+    steps = [
+        ["cmake", "-S", os.path.join(REPO_ROOT, "bench"), "-B", gen_dir,
+         "-DBENCH_PGO=GENERATE", "-DBENCH_PGO_DIR=" + gcda_dir],
+        ["cmake", "--build", gen_dir],
+        [os.path.join(gen_dir, "asic_bench"), "--iterations", str(iterations)],
+    ]
+    for step in steps:
+        if subprocess.run(step, stdout=subprocess.DEVNULL).returncode != 0:
+            fail("step failed: %s" % " ".join(step))
+    return gen_dir, gcda_dir
+
+
+# --- CMake Output ---
+
+def cmake_list(items):
+    return " ".join('"%s"' % item for item in items)
+
+
+def stale_inputs(profile):
+    """Files that changed since the profile was taken, or all if it predates input tracking."""
+    inputs = profile.get("inputs")
+    if not inputs:
+        return ["(profile has no input digests)"]
+    stale = [source for source, digest in sorted(inputs.items()) if file_digest(source) != digest]
+    # A source the bench builds now but did not when profiled
+    stale.extend(source for source in bench_sources() if source not in inputs)
+    return stale
+
+
+def write_cmake(profile_path, out_path):
+    with open(profile_path, "r") as fp:
+        profile = json.load(fp)
+    stale = stale_inputs(profile)
+    if stale:
+        fail("%s is stale; changed since it was taken: %s. Re-run tools/pgo_profile.py run "
+             "(or the 'pgo_profile' target) and commit the result."
+             % (os.path.relpath(profile_path, REPO_ROOT), ", ".join(stale)))
+    hot = [f for f in profile["functions"] if f["hot"]]
+    # Hot inline functions from headers are compiled into their callers
+    sources = sorted(set(os.path.join(REPO_ROOT, f["source"]).replace(os.sep, "/")
+                         for f in hot if f["source"].endswith(".c")))
+    lines = [
+        "# GENERATED by tools/pgo_profile.py from %s. Do not edit." % os.path.relpath(profile_path, REPO_ROOT),
+        "set(ASIC_PGO_HOT_SOURCES %s)" % cmake_list(sources),
+        "set(ASIC_PGO_HOT_FUNCTIONS %s)" % cmake_list(f["name"] for f in hot),
+        "set(ASIC_PGO_INPUTS %s)" % cmake_list(os.path.join(REPO_ROOT, source).replace(os.sep, "/")
+                                               for source in sorted(profile["inputs"])),
+        "",
+    ]
+    content = "\n".join(lines)
+    if os.path.exists(out_path):
+        with open(out_path, "r") as fp:
+            if fp.read() == content:
+                return
+    with open(out_path, "w") as fp:
+        fp.write(content)
+
+
+def main(argv):
+    if not argv:
+        fail("usage: pgo_profile.py run|collect|cmake [options]")
+    command, args = argv[0], list(argv[1:])
+    output = option(args, "-o")
+
+    if command == "run":
+        build_dir = os.path.abspath(option(args, "--build-dir", DEFAULT_BUILD_DIR))
+        iterations = int(option(args, "--iterations", DEFAULT_ITERATIONS))
+        gen_dir, gcda_dir = run_workload(build_dir, iterations)
+        compiler, functions, inputs = collect(gen_dir, gcda_dir)
+        write_profile(output or DEFAULT_PROFILE, "bench/asic_bench --iterations %d" % iterations,
+                      compiler, inputs, rank(functions))
+    elif command == "collect":
+        build_dir = option(args, "--build-dir")
+        gcda_dir = option(args, "--gcda-dir")
+        if build_dir is None or gcda_dir is None:
+            fail("collect needs --build-dir and --gcda-dir")
+        compiler, functions, inputs = collect(os.path.abspath(build_dir), os.path.abspath(gcda_dir))
+        write_profile(output or DEFAULT_PROFILE, "bench/asic_bench", compiler, inputs, rank(functions))
+    elif command == "cmake":
+        if output is None:
+            fail("cmake needs -o")
+        write_cmake(os.path.abspath(option(args, "--profile", DEFAULT_PROFILE)), os.path.abspath(output))
+    else:
+        fail("unknown command %s" % command)
+    if args:
+        fail("unexpected arguments: %s" % " ".join(args))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
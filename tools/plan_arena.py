@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""
+@file plan_arena.py
+@brief Build-time tensor arena planner for the inference runtime.
+
+Reads a model graph (ml/models/<model>.json) and writes <model>_plan.h next
+to it with one arena offset per tensor and the total arena size.
+
+Each tensor is live from the op that produces it to the last op that reads
+it. Graph inputs are live from the first op. Graph outputs stay live after
+the last op so they can be read back. Two tensors may share arena bytes only
+if their lifetimes are disjoint. An op's input and output are both live
+during that op, so they never alias.
+
+Placement is greedy by size. Tensors are taken largest first, and each one
+goes at the lowest aligned offset that does not collide with any
+already-placed tensor whose lifetime overlaps its own. The report compares
+the result with the lower bound, which is the largest total size of tensors
+live at any one op.
+
+Usage: tools/plan_arena.py [--check] [model.json ...]
+  --check  Exit non-zero if a generated plan is out of date (for CI).
+"""
+
+import glob
+import json
+import os
+import sys
+
+import asic_config
+
+REPO_ROOT = asic_config.REPO_ROOT
+MODELS_DIR = os.path.join(REPO_ROOT, "ml", "models")
+
+ARENA_ALIGN = 16    # Must match ML_ARENA_ALIGN in ml/ml_runtime.h
+
+
+# --- Graph Loading and Validation ---
+
+def fail(message):
+    sys.stderr.write("[ERROR] ARENA: %s\n" % message)
+    sys.exit(1)
+
+
+def align_up(value):
+    return (value + ARENA_ALIGN - 1) // ARENA_ALIGN * ARENA_ALIGN
+
+
+def load_graph(path):
+    with open(path, "r") as fp:
+        graph = json.load(fp)
+
+    tensors = {}
+    for index, tensor in enumerate(graph["tensors"]):
+        if tensor["name"] in tensors:
+            fail("%s: duplicate tensor %s" % (graph["name"], tensor["name"]))
+        size = 1
+        for dim in tensor["shape"]:
+            size *= dim
+        tensor["index"] = index
+        tensor["bytes"] = size
+        tensors[tensor["name"]] = tensor
+
+    for op in graph["ops"]:
+        for name in op["inputs"] + op["outputs"]:
+            if name not in tensors:
+                fail("%s.%s: unknown tensor %s" % (graph["name"], op["name"], name))
+    for name in graph["inputs"] + graph["outputs"]:
+        if name not in tensors:
+            fail("%s: unknown graph input/output %s" % (graph["name"], name))
+
+    graph["tensor_map"] = tensors
+    return graph
+
+
+# --- Planning ---
+
+def compute_lifetimes(graph):
+    """Sets first/last op index on every tensor."""
+    tensors = graph["tensor_map"]
+    op_count = len(graph["ops"])
+    for tensor in graph["tensors"]:
+        tensor["first"] = None
+        tensor["last"] = None
+
+    for name in graph["inputs"]:
+        tensors[name]["first"] = 0
+    for step, op in enumerate(graph["ops"]):
+        for name in op["outputs"]:
+            if tensors[name]["first"] is not None:
+                fail("%s: tensor %s is written twice" % (graph["name"], name))
+            tensors[name]["first"] = step
+        for name in op["inputs"]:
+            if tensors[name]["first"] is None:
+                fail("%s.%s: reads %s before it is produced" % (graph["name"], op["name"], name))
+            tensors[name]["last"] = step
+    for name in graph["outputs"]:
+        tensors[name]["last"] = op_count
+
+    for tensor in graph["tensors"]:
+        if tensor["first"] is None:
+            fail("%s: tensor %s is never produced" % (graph["name"], tensor["name"]))
+        if tensor["last"] is None:
+            tensor["last"] = tensor["first"]
+
+
+def overlaps(a, b):
+    return a["first"] <= b["last"] and b["first"] <= a["last"]
+
+
+def place_greedy_by_size(graph):
+    """Assigns offsets and returns the arena size."""
+    order = sorted(graph["tensors"],
+                   key=lambda t: (-t["bytes"], -(t["last"] - t["first"]), t["index"]))
+    placed = []
+    arena = 0
+    for tensor in order:
+        conflicts = sorted((p for p in placed if overlaps(p, tensor)), key=lambda p: p["offset"])
+        offset = 0
+        for other in conflicts:
+            if offset + tensor["bytes"] <= other["offset"]:
+                break
+            offset = max(offset, align_up(other["offset"] + other["bytes"]))
+        tensor["offset"] = offset
+        placed.append(tensor)
+        arena = max(arena, offset + tensor["bytes"])
+    return align_up(arena)
+
+
+def lower_bound(graph):
+    steps = range(len(graph["ops"]) + 1)
+    return max(sum(align_up(t["bytes"]) for t in graph["tensors"]
+                   if t["first"] <= step <= t["last"]) for step in steps)
+
+
+def no_reuse_size(graph):
+    return sum(align_up(t["bytes"]) for t in graph["tensors"])
+
+
+def verify(graph):
+    tensors = graph["tensors"]
+    for i, a in enumerate(tensors):
+        for b in tensors[i + 1:]:
+            if overlaps(a, b) and a["offset"] < b["offset"] + b["bytes"] \
+                    and b["offset"] < a["offset"] + a["bytes"]:
+                fail("%s: %s and %s alias while both live" % (graph["name"], a["name"], b["name"]))
+
+
+# --- C Header Generation ---
+
+def generate_header(graph, arena, bound, naive, source_name, header_name):
+    prefix = graph["name"].upper() + "_MODEL"
+    guard = header_name.upper().replace(".", "_")
+    out = []
+    out.append("/**")
+    out.append(" * @file %s" % header_name)
+    out.append(" * @brief Tensor arena plan for the %s model." % graph["name"])
+    out.append(" *")
+    out.append(" * GENERATED by tools/plan_arena.py from %s. Do not edit." % source_name)
+    out.append(" *")
+    out.append(" * Tensor            Bytes  Offset  Live ops")
+    for t in graph["tensors"]:
+        out.append(" * %-16s %6d %7d  %d..%d" % (t["name"], t["bytes"], t["offset"], t["first"], t["last"]))
+    out.append(" *")
+    out.append(" * Arena %d bytes; lower bound %d, without reuse %d." % (arena, bound, naive))
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#define %-36s %d" % (prefix + "_ARENA_BYTES", arena))
+    out.append("")
+    for t in graph["tensors"]:
+        out.append("#define %-36s %d" % ("%s_%s" % (prefix, t["name"]), t["index"]))
+        out.append("#define %-36s %d" % ("%s_%s_OFFSET" % (prefix, t["name"]), t["offset"]))
+        out.append("#define %-36s %d" % ("%s_%s_BYTES" % (prefix, t["name"]), t["bytes"]))
+    out.append("")
+    out.append("#endif // %s" % guard)
+    out.append("")
+    return "\n".join(out)
+
+
+# --- Entry Point ---
+
+def write_if_changed(path, content, check):
+    old = None
+    if os.path.exists(path):
+        with open(path, "r") as fp:
+            old = fp.read()
+    if old == content:
+        return True
+    if check:
+        sys.stderr.write("[ERROR] ARENA: %s is out of date, run tools/plan_arena.py\n"
+                         % os.path.relpath(path, REPO_ROOT))
+        return False
+    with open(path, "w") as fp:
+        fp.write(content)
+    print("[INFO] ARENA: wrote %s" % os.path.relpath(path, REPO_ROOT))
+    return True
+
+
+def plan_model(source, ram_budget, check):
+    graph = load_graph(source)
+    compute_lifetimes(graph)
+    arena = place_greedy_by_size(graph)
+    verify(graph)
+    bound = lower_bound(graph)
+    naive = no_reuse_size(graph)
+    if arena > ram_budget:
+        fail("%s: arena of %d bytes exceeds RAM (%d bytes)" % (graph["name"], arena, ram_budget))
+
+    header_name = os.path.splitext(os.path.basename(source))[0] + "_plan.h"
+    header_path = os.path.join(os.path.dirname(source), header_name)
+    source_name = os.path.relpath(source, REPO_ROOT)
+    if not check:
+        print("[INFO] ARENA: %s: %d bytes (lower bound %d, without reuse %d)"
+              % (graph["name"], arena, bound, naive))
+    return write_if_changed(header_path,
+                            generate_header(graph, arena, bound, naive, source_name, header_name),
+                            check)
+
+
+def main(argv):
+    check = "--check" in argv
+    args = [a for a in argv if a != "--check"]
+    sources = [os.path.abspath(a) for a in args] or sorted(glob.glob(os.path.join(MODELS_DIR, "*.json")))
+
+    config = asic_config.load()
+    ram_budget = asic_config.parse_int(config["memory_map_defaults"]["ram_size_bytes"])
+
+    ok = True
+    for source in sources:
+        ok = plan_model(source, ram_budget, check) and ok
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+@file verify_trace.py
+@brief Verifies and decodes a secure event trace export.
+
+Reads the output of SecureTrace_Export() (security/secure_trace.h) and
+recomputes the HMAC-SHA256 chain with the device's trace key:
+
+    mac[n] = HMAC(K, mac[n-1] || header[n] || records[n])
+
+starting from the export's anchor. Block sequence numbers must be
+consecutive. If the export starts at block 0, the anchor must equal the
+genesis value HMAC(K, "SECURE_TRACE" || boot_id). The trailer's export MAC
+
+    HMAC(K, "TRACE_EXPORT" || header || first seq || last seq || last MAC)
+
+must match, so blocks cannot have been cut from either end and the anchor
+cannot have been replaced. Any mismatch is reported with the block it occurs
+in, and the script exits non-zero.
+
+Usage: tools/verify_trace.py (--key HEX | --key-file FILE) [--events] trace.bin
+  --events  Also print every record.
+"""
+
+import hashlib
+import hmac
+import struct
+import sys
+
+EXPORT_MAGIC = 0x58525453       # "STRX"
+EXPORT_VERSION = 2
+BLOCK_MAGIC = 0x43525453        # "STRC"
+GENESIS_LABEL = b"SECURE_TRACE"
+EXPORT_LABEL = b"TRACE_EXPORT"
+
+EXPORT_HEADER = struct.Struct("<IHHII32s")
+EXPORT_TRAILER = struct.Struct("<II32s")
+BLOCK_HEADER = struct.Struct("<IIII")
+RECORD = struct.Struct("<IHHII")
+MAC_BYTES = 32
+
+# Must match SECURE_TRACE_EVENT_* in security/secure_trace.h
+EVENT_NAMES = {
+    1: "BOOT",
+    2: "VIOLATION",
+    3: "KEY_USE",
+    4: "TAG_FAIL",
+    5: "TAMPER",
+    6: "ZEROIZE",
+    7: "CERT_REJECT",
+    8: "BOOT_REJECT",
+    9: "GLITCH",
+}
+
+
+def fail(message):
+    sys.stderr.write("[ERROR] TRACE: %s\n" % message)
+    sys.exit(1)
+
+
+def option(args, name, default=None):
+    if name not in args:
+        return default
+    index = args.index(name)
+    if index + 1 >= len(args):
+        fail("%s needs a value" % name)
+    value = args[index + 1]
+    del args[index:index + 2]
+    return value
+
+
+def mac(key, *parts):
+    h = hmac.new(key, digestmod=hashlib.sha256)
+    for part in parts:
+        h.update(part)
+    return h.digest()
+
+
+def verify(key, data, show_events):
+    if len(data) < EXPORT_HEADER.size:
+        fail("export is shorter than its header")
+    magic, version, block_count, block_bytes, boot_id, anchor = EXPORT_HEADER.unpack_from(data, 0)
+    if magic != EXPORT_MAGIC or version != EXPORT_VERSION:
+        fail("not a version %d trace export" % EXPORT_VERSION)
+    if len(data) != EXPORT_HEADER.size + block_count * block_bytes + EXPORT_TRAILER.size:
+        fail("export length does not match %d blocks of %d bytes and a trailer" % (block_count, block_bytes))
+    records_per_block = (block_bytes - BLOCK_HEADER.size - MAC_BYTES) // RECORD.size
+
+    chain = anchor
+    expected_seq = None
+    events = 0
+    for n in range(block_count):
+        base = EXPORT_HEADER.size + n * block_bytes
+        block_magic, seq, count, _ = BLOCK_HEADER.unpack_from(data, base)
+        if block_magic != BLOCK_MAGIC or count > records_per_block:
+            fail("block %d: bad header" % n)
+        if expected_seq is None:
+            genesis = mac(key, GENESIS_LABEL, struct.pack("<I", boot_id))
+            if seq == 0 and not hmac.compare_digest(anchor, genesis):
+                fail("block 0: anchor is not the genesis of boot %d" % boot_id)
+        elif seq != expected_seq:
+            fail("block %d: sequence %d follows %d" % (n, seq, expected_seq - 1))
+        expected_seq = seq + 1
+
+        covered = data[base:base + BLOCK_HEADER.size + count * RECORD.size]
+        stored = data[base + block_bytes - MAC_BYTES:base + block_bytes]
+        computed = mac(key, chain, covered)
+        if not hmac.compare_digest(stored, computed):
+            fail("block %d (sequence %d): MAC mismatch, trace was modified" % (n, seq))
+        chain = stored
+
+        for i in range(count):
+            timestamp, kind, _, arg0, arg1 = RECORD.unpack_from(data, base + BLOCK_HEADER.size + i * RECORD.size)
+            events += 1
+            if show_events:
+                print("%6d.%02d  %10u  %-10s 0x%08X 0x%08X" %
+                      (seq, i, timestamp, EVENT_NAMES.get(kind, "TYPE_%d" % kind), arg0, arg1))
+
+    trailer_base = EXPORT_HEADER.size + block_count * block_bytes
+    first_seq, last_seq, export_mac = EXPORT_TRAILER.unpack_from(data, trailer_base)
+    if block_count > 0 and (first_seq != expected_seq - block_count or last_seq != expected_seq - 1):
+        fail("trailer: sequences %d..%d do not match the blocks" % (first_seq, last_seq))
+    if block_count == 0 and last_seq != (first_seq - 1) & 0xFFFFFFFF:
+        fail("trailer: sequences %d..%d for an empty export" % (first_seq, last_seq))
+    computed = mac(key, EXPORT_LABEL, data[:EXPORT_HEADER.size], data[trailer_base:trailer_base + 8], chain)
+    if not hmac.compare_digest(export_mac, computed):
+        fail("export MAC mismatch, blocks or anchor were changed")
+
+    print("[INFO] TRACE: boot %d, %d blocks, sequence %d..%d, %d events, chain verified" %
+          (boot_id, block_count, first_seq, last_seq, events))
+    return 0
+
+
+def main(argv):
+    args = list(argv)
+    key_hex = option(args, "--key")
+    key_file = option(args, "--key-file")
+    show_events = "--events" in args
+    args = [a for a in args if a != "--events"]
+    if len(args) != 1 or (key_hex is None) == (key_file is None):
+        fail("usage: verify_trace.py (--key HEX | --key-file FILE) [--events] trace.bin")
+
+    if key_hex is not None:
+        try:
+            key = bytes.fromhex(key_hex)
+        except ValueError:
+            fail("--key must be hexadecimal")
+    else:
+        with open(key_file, "rb") as fp:
+            key = fp.read()
+    with open(args[0], "rb") as fp:
+        data = fp.read()
+    return verify(key, data, show_events)
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,27 @@
+/**
+ * @file crc32.h
+ * @brief CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320).
+ *
+ * Matches zlib's crc32() and Python's binascii.crc32(), so host tools can
+ * produce images the firmware verifies. Uses a 16-entry table (64 bytes of
+ * flash) and processes one nibble per step.
+ */
+
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stdint.h>
+
+#define CRC32_INIT                  0x00000000UL
+
+/**
+ * @brief Continues a CRC over more data.
+ *
+ * @param crc  Result of a previous call, or CRC32_INIT.
+ * @param data Bytes to add.
+ * @param len  Number of bytes.
+ * @return Updated CRC.
+ */
+uint32_t Crc32_Update(uint32_t crc, const void *data, uint32_t len);
+
+#endif // CRC32_H
@@ -0,0 +1,24 @@
+/**
+ * @file log.c
+ * @brief Runtime per-module log level masks.
+ */
+
+#include "log.h"
+
+// --- Public Variables ---
+// Every module logs at every compiled-in level until Log_SetLevel() says otherwise
+uint32_t Log_ModuleMask[LOG_LEVEL_COUNT] = {
+    LOG_MODULE_ALL, LOG_MODULE_ALL, LOG_MODULE_ALL, LOG_MODULE_ALL, LOG_MODULE_ALL,
+};
+
+// --- Public Function Implementations ---
+
+void Log_SetLevel(uint32_t modules, uint32_t level) {
+    for (uint32_t l = 0; l < LOG_LEVEL_FATAL; l++) {
+        if (l >= level) {
+            Log_ModuleMask[l] |= modules;
+        } else {
+            Log_ModuleMask[l] &= ~modules;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file log.h
+ * @brief Log level filtering: a compile-time floor and runtime per-module masks.
+ *
+ * Each module keeps its own LogHandler(level, message) sink and logs
+ * through the macros below. Define LOG_MODULE to the module's bit before
+ * including this header:
+ *
+ *     #define LOG_MODULE  LOG_MODULE_SWEEPER
+ *     #include "log.h"
+ *
+ *     LOG_WARN("Check table full.");
+ *     if (LOG_ENABLED(LOG_LEVEL_WARN)) {      // Messages that need formatting
+ *         char msg[96];
+ *         snprintf(msg, sizeof(msg), ...);
+ *         LogHandler("WARN", msg);
+ *     }
+ *
+ * Levels below LOG_LEVEL_COMPILED expand to nothing, format strings
+ * included. Variant builds set it from debug_settings.default_log_level
+ * (ASIC_LOG_LEVEL_DEFAULT); other builds keep everything. A level that is
+ * compiled in costs one load and one AND at runtime: Log_ModuleMask[level]
+ * holds a bit for every module that currently logs at that level, and
+ * Log_SetLevel() rewrites it.
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+// --- Levels: same values as RUNTIME_CONFIG_LOG_LEVEL_* ---
+#define LOG_LEVEL_DEBUG             0
+#define LOG_LEVEL_INFO              1
+#define LOG_LEVEL_WARN              2
+#define LOG_LEVEL_ERROR             3
+#define LOG_LEVEL_FATAL             4
+#define LOG_LEVEL_COUNT             5
+
+#ifndef LOG_LEVEL_COMPILED
+#if defined(ASIC_LOG_LEVEL_DEFAULT)
+#define LOG_LEVEL_COMPILED          (ASIC_LOG_LEVEL_DEFAULT)
+#else
+#define LOG_LEVEL_COMPILED          LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// --- Modules ---
+#define LOG_MODULE_MAIN             (1UL << 0)
+#define LOG_MODULE_CONSTRAINTS      (1UL << 1)
+#define LOG_MODULE_SWEEPER          (1UL << 2)
+#define LOG_MODULE_RUNTIME_CONFIG   (1UL << 3)
+#define LOG_MODULE_FLASH            (1UL << 4)
+#define LOG_MODULE_ML               (1UL << 5)
+#define LOG_MODULE_FAULT_LOG        (1UL << 6)
+#define LOG_MODULE_ALL              (0xFFFFFFFFUL)
+
+// --- Runtime Masks ---
+extern uint32_t Log_ModuleMask[LOG_LEVEL_COUNT];
+
+/**
+ * @brief Sets the runtime level of one or more modules.
+ *
+ * Messages below @p level are dropped for those modules. It cannot bring
+ * back levels compiled out, and FATAL always stays on.
+ *
+ * @param modules LOG_MODULE_* bits, or LOG_MODULE_ALL.
+ * @param level   LOG_LEVEL_*.
+ */
+void Log_SetLevel(uint32_t modules, uint32_t level);
+
+// --- Logging Macros ---
+#define LOG_ENABLED(level) \
+    ((level) >= LOG_LEVEL_COMPILED && (Log_ModuleMask[(level)] & (LOG_MODULE)) != 0U)
+
+#define LOG_AT(level, name, msg) \
+    do { \
+        if (LOG_ENABLED(level)) { \
+            LogHandler((name), (msg)); \
+        } \
+    } while (0)
+
+// Compiled-out levels still name LogHandler so it never becomes unused
+#define LOG_OFF(msg)                ((void)LogHandler)
+
+#if LOG_LEVEL_COMPILED <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(msg)              LOG_AT(LOG_LEVEL_DEBUG, "DEBUG", msg)
+#else
+#define LOG_DEBUG(msg)              LOG_OFF(msg)
+#endif
+#if LOG_LEVEL_COMPILED <= LOG_LEVEL_INFO
+#define LOG_INFO(msg)               LOG_AT(LOG_LEVEL_INFO, "INFO", msg)
+#else
+#define LOG_INFO(msg)               LOG_OFF(msg)
+#endif
+#if LOG_LEVEL_COMPILED <= LOG_LEVEL_WARN
+#define LOG_WARN(msg)               LOG_AT(LOG_LEVEL_WARN, "WARN", msg)
+#else
+#define LOG_WARN(msg)               LOG_OFF(msg)
+#endif
+#if LOG_LEVEL_COMPILED <= LOG_LEVEL_ERROR
+#define LOG_ERROR(msg)              LOG_AT(LOG_LEVEL_ERROR, "ERROR", msg)
+#else
+#define LOG_ERROR(msg)              LOG_OFF(msg)
+#endif
+#define LOG_FATAL(msg)              LOG_AT(LOG_LEVEL_FATAL, "FATAL", msg)
+
+#endif // LOG_H